@@ -27,25 +27,36 @@ class EInkDisplay {
   static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
 
   // Frame buffer operations
-  void clearScreen(uint8_t color = 0xFF) const;
-  void drawImage(const uint8_t* imageData, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
-                 bool fromProgmem = false) const;
+  void clearScreen(uint8_t color = 0xFF);
+  void drawImage(const uint8_t* imageData, uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool fromProgmem = false);
 
 #ifndef EINK_DISPLAY_SINGLE_BUFFER_MODE
   void swapBuffers();
 #endif
-  void setFramebuffer(const uint8_t* bwBuffer) const;
+  void setFramebuffer(const uint8_t* bwBuffer);
 
   void copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer);
   void copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer);
   void copyGrayscaleMsbBuffers(const uint8_t* msbBuffer);
+  // Write rows [y, y + h) of both grayscale planes; each strip is h * DISPLAY_WIDTH_BYTES bytes.
+  // Like every RAM write it is synchronous: it returns once the strip has left SPI, so the caller may reuse
+  // the strip buffers right away but can't rasterize the next strip while this one is on the bus.
+  void copyGrayscaleStrip(uint16_t y, uint16_t h, const uint8_t* lsbStrip, const uint8_t* msbStrip);
 #ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
   void cleanupGrayscaleBuffers(const uint8_t* bwBuffer);
 #endif
 
   // turnOffScreen: Power down display after refresh. Used for sunlight fading fix
   // on SSD1677 displays without resin protection (XTEINK X4).
+  // A fast refresh only sends the window that changed since the last displayBuffer, or nothing at all if the
+  // frame is unchanged; changes larger than MAX_WINDOW_BYTES go out as full frames.
   void displayBuffer(RefreshMode mode = FAST_REFRESH, bool turnOffScreen = false);
+  // Non-blocking displayBuffer: returns once the waveform has started instead of waiting out BUSY.
+  // waitForRefresh() completes it; so does the next panel command and, in single buffer mode, the next
+  // frame buffer access, since the displayed frame is still copied into RED RAM afterwards.
+  void startDisplayBuffer(RefreshMode mode = FAST_REFRESH, bool turnOffScreen = false);
+  bool isRefreshing() const;  // A started refresh is still driving the panel (BUSY high)
+  void waitForRefresh();
   // EXPERIMENTAL: Windowed update - display only a rectangular region
   void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen = false);
   void displayGrayBuffer(bool turnOffScreen = false);
@@ -62,7 +73,7 @@ class EInkDisplay {
   void deepSleep();
 
   // Access to frame buffer
-  uint8_t* getFrameBuffer() const { return frameBuffer; }
+  uint8_t* getFrameBuffer();
 
   // Save the current framebuffer to a PBM file (desktop/test builds only)
   void saveFrameBufferAsPBM(const char* filename);
@@ -82,21 +93,54 @@ class EInkDisplay {
   // SPI settings
   SPISettings spiSettings;
 
+  // Dirty windows are byte-aligned rectangles in whole DIRTY_COLUMN_BYTES columns
+  struct Window {
+    uint16_t x, y, w, h;
+  };
+  static constexpr uint16_t DIRTY_COLUMN_BYTES = 4;
+  static constexpr uint16_t DIRTY_COLUMNS = DISPLAY_WIDTH_BYTES / DIRTY_COLUMN_BYTES;
+  // A window saves SPI bytes, not waveform time, so a frame that changed this much is sent whole
+  static constexpr uint32_t MAX_WINDOW_BYTES = BUFFER_SIZE / 2;
+  bool displayedFrameKnown;  // RED RAM matches the last displayBuffer frame (no gray or window updates since)
+#ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
+  // Without a second buffer, hashes of each row and column of the displayed frame stand in for it
+  uint32_t rowHashes[DISPLAY_HEIGHT];
+  uint32_t columnHashes[DIRTY_COLUMNS];
+#endif
+
   // State
   bool isScreenOn;
   bool customLutActive;
   bool inGrayscaleMode;
   bool drawGrayscale;
+  const char* pendingRefresh;  // Refresh type started by startRefresh() and not yet waited for
+  bool pendingRedSync;          // Single buffer mode: RED RAM still needs the frame of the pending refresh
+  Window redSyncWindow;         // Part of the frame the pending RED sync covers
 
   // Low-level display control
   void resetDisplay();
   void sendCommand(uint8_t command);
   void sendData(uint8_t data);
-  void sendData(const uint8_t* data, uint16_t length);
   void waitWhileBusy(const char* comment = nullptr);
   void initDisplayController();
+  void startRefresh(RefreshMode mode, bool turnOffScreen);
+  // Shuts the analog rails and clock down without a refresh; waitForRefresh() finishes it
+  void startPowerOff();
 
   // Low-level display operations
   void setRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  // RAM writes hold one SPI transaction and chip select for the whole plane and stream it in chunks that
+  // fit a DMA descriptor (word multiples under 4095 bytes), instead of one transaction per sendData.
+  // Each chunk is a blocking SPI.writeBytes: the transfer may use DMA underneath, but nothing is queued,
+  // so the CPU does no other work until the write returns.
+  static constexpr uint32_t RAM_CHUNK_BYTES = 4092;
+  void beginRamWrite(uint8_t ramBuffer);
+  void writeRamChunks(const uint8_t* data, uint32_t size);
+  void endRamWrite();
+  void logRamWrite(uint8_t ramBuffer, uint32_t size, unsigned long startMicros);
   void writeRamBuffer(uint8_t ramBuffer, const uint8_t* data, uint32_t size);
+  void writeRamWindow(uint8_t ramBuffer, const uint8_t* frame, const Window& window);
+  // Records the frame about to be displayed; false if the displayed one is unknown, else sets the changed
+  // window (h == 0 when nothing changed)
+  bool findDirtyWindow(Window& window);
 };
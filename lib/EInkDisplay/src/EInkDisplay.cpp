@@ -1,5 +1,6 @@
 #include "EInkDisplay.h"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <vector>
@@ -118,10 +119,14 @@ EInkDisplay::EInkDisplay(int8_t sclk, int8_t mosi, int8_t cs, int8_t dc, int8_t
 #ifndef EINK_DISPLAY_SINGLE_BUFFER_MODE
       frameBufferActive(nullptr),
 #endif
+      displayedFrameKnown(false),
       isScreenOn(false),
       customLutActive(false),
       inGrayscaleMode(false),
-      drawGrayscale(false) {
+      drawGrayscale(false),
+      pendingRefresh(nullptr),
+      pendingRedSync(false),
+      redSyncWindow{0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT} {
   if (Serial) Serial.printf("[%lu] EInkDisplay: Constructor called\n", millis());
   if (Serial)
     Serial.printf("[%lu]   SCLK=%d, MOSI=%d, CS=%d, DC=%d, RST=%d, BUSY=%d\n", millis(), sclk, mosi, cs, dc, rst, busy);
@@ -134,6 +139,7 @@ void EInkDisplay::begin() {
   // This is especially important after deep sleep wake-up where the display
   // controller needs to be treated as a fresh initialization
   isScreenOn = false;
+  displayedFrameKnown = false;
 
   frameBuffer = frameBuffer0;
 #ifndef EINK_DISPLAY_SINGLE_BUFFER_MODE
@@ -192,6 +198,9 @@ void EInkDisplay::resetDisplay() {
 }
 
 void EInkDisplay::sendCommand(uint8_t command) {
+  // The controller ignores commands while BUSY is high, so the first one after startDisplayBuffer() waits
+  if (pendingRefresh) waitForRefresh();
+
   SPI.beginTransaction(spiSettings);
   digitalWrite(_dc, LOW);  // Command mode
   digitalWrite(_cs, LOW);  // Select chip
@@ -209,15 +218,36 @@ void EInkDisplay::sendData(uint8_t data) {
   SPI.endTransaction();
 }
 
-void EInkDisplay::sendData(const uint8_t* data, uint16_t length) {
+void EInkDisplay::beginRamWrite(const uint8_t ramBuffer) {
+  sendCommand(ramBuffer);
   SPI.beginTransaction(spiSettings);
-  digitalWrite(_dc, HIGH);       // Data mode
-  digitalWrite(_cs, LOW);        // Select chip
-  SPI.writeBytes(data, length);  // Transfer all bytes
-  digitalWrite(_cs, HIGH);       // Deselect chip
+  digitalWrite(_dc, HIGH);  // Data mode
+  digitalWrite(_cs, LOW);   // Select chip for the whole write
+}
+
+void EInkDisplay::writeRamChunks(const uint8_t* data, uint32_t size) {
+  while (size > 0) {
+    const uint32_t chunk = std::min(size, RAM_CHUNK_BYTES);
+    SPI.writeBytes(data, chunk);
+    data += chunk;
+    size -= chunk;
+  }
+}
+
+void EInkDisplay::endRamWrite() {
+  digitalWrite(_cs, HIGH);  // Deselect chip
   SPI.endTransaction();
 }
 
+void EInkDisplay::logRamWrite(const uint8_t ramBuffer, const uint32_t size, const unsigned long startMicros) {
+  const char* bufferName = (ramBuffer == CMD_WRITE_RAM_BW) ? "BW" : "RED";
+  const unsigned long duration = micros() - startMicros;
+  const unsigned long kbPerSecond = duration ? static_cast<unsigned long>(size * 1000ULL / duration) : 0;
+  if (Serial)
+    Serial.printf("[%lu]   %s RAM write complete (%lu ms, %lu bytes at %lu KB/s)\n", millis(), bufferName,
+                  duration / 1000, size, kbPerSecond);
+}
+
 void EInkDisplay::waitWhileBusy(const char* comment) {
   unsigned long start = millis();
   while (digitalRead(_busy) == HIGH) {
@@ -314,11 +344,19 @@ void EInkDisplay::setRamArea(const uint16_t x, uint16_t y, uint16_t w, uint16_t
   sendData((y + h - 1) / 256);  // high byte
 }
 
-void EInkDisplay::clearScreen(const uint8_t color) const { memset(frameBuffer, color, BUFFER_SIZE); }
+uint8_t* EInkDisplay::getFrameBuffer() {
+#ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
+  // The pending refresh still copies this frame into RED RAM, so it can't be drawn over yet
+  if (pendingRedSync) waitForRefresh();
+#endif
+  return frameBuffer;
+}
+
+void EInkDisplay::clearScreen(const uint8_t color) { memset(getFrameBuffer(), color, BUFFER_SIZE); }
 
 void EInkDisplay::drawImage(const uint8_t* imageData, const uint16_t x, const uint16_t y, const uint16_t w,
-                            const uint16_t h, const bool fromProgmem) const {
-  if (!frameBuffer) {
+                            const uint16_t h, const bool fromProgmem) {
+  if (!getFrameBuffer()) {
     if (Serial) Serial.printf("[%lu]   ERROR: Frame buffer not allocated!\n", millis());
     return;
   }
@@ -350,17 +388,117 @@ void EInkDisplay::drawImage(const uint8_t* imageData, const uint16_t x, const ui
 
 void EInkDisplay::writeRamBuffer(uint8_t ramBuffer, const uint8_t* data, uint32_t size) {
   const char* bufferName = (ramBuffer == CMD_WRITE_RAM_BW) ? "BW" : "RED";
-  const unsigned long startTime = millis();
-  if (Serial) Serial.printf("[%lu]   Writing frame buffer to %s RAM (%lu bytes)...\n", startTime, bufferName, size);
+  const unsigned long startMicros = micros();
+  if (Serial) Serial.printf("[%lu]   Writing frame buffer to %s RAM (%lu bytes)...\n", millis(), bufferName, size);
 
-  sendCommand(ramBuffer);
-  sendData(data, size);
+  beginRamWrite(ramBuffer);
+  writeRamChunks(data, size);
+  endRamWrite();
 
-  const unsigned long duration = millis() - startTime;
-  if (Serial) Serial.printf("[%lu]   %s RAM write complete (%lu ms)\n", millis(), bufferName, duration);
+  logRamWrite(ramBuffer, size, startMicros);
 }
 
-void EInkDisplay::setFramebuffer(const uint8_t* bwBuffer) const { memcpy(frameBuffer, bwBuffer, BUFFER_SIZE); }
+void EInkDisplay::writeRamWindow(const uint8_t ramBuffer, const uint8_t* frame, const Window& window) {
+  setRamArea(window.x, window.y, window.w, window.h);
+  if (window.w == DISPLAY_WIDTH) {
+    // Whole rows are contiguous in the frame
+    writeRamBuffer(ramBuffer, frame + window.y * DISPLAY_WIDTH_BYTES,
+                   static_cast<uint32_t>(window.h) * DISPLAY_WIDTH_BYTES);
+    return;
+  }
+
+  const char* bufferName = (ramBuffer == CMD_WRITE_RAM_BW) ? "BW" : "RED";
+  const uint16_t windowWidthBytes = window.w / 8;
+  const uint32_t size = static_cast<uint32_t>(windowWidthBytes) * window.h;
+  const unsigned long startMicros = micros();
+  if (Serial)
+    Serial.printf("[%lu]   Writing %dx%d window at (%d,%d) to %s RAM (%lu bytes)...\n", millis(), window.w, window.h,
+                  window.x, window.y, bufferName, size);
+
+  // The RAM address counter wraps to the next window row, so rows go back to back in one write
+  beginRamWrite(ramBuffer);
+  for (uint16_t row = 0; row < window.h; row++) {
+    writeRamChunks(frame + (window.y + row) * DISPLAY_WIDTH_BYTES + window.x / 8, windowWidthBytes);
+  }
+  endRamWrite();
+
+  logRamWrite(ramBuffer, size, startMicros);
+}
+
+bool EInkDisplay::findDirtyWindow(Window& window) {
+  int minRow = DISPLAY_HEIGHT;
+  int maxRow = -1;
+  int minColumn = DIRTY_COLUMNS;
+  int maxColumn = -1;
+  auto markColumn = [&](const int column) {
+    minColumn = std::min(minColumn, column);
+    maxColumn = std::max(maxColumn, column);
+  };
+
+#ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
+  // FNV-1a over 32-bit words, one hash per row and one per column of words
+  constexpr uint32_t FNV_OFFSET = 2166136261u;
+  constexpr uint32_t FNV_PRIME = 16777619u;
+  uint32_t columns[DIRTY_COLUMNS];
+  std::fill(columns, columns + DIRTY_COLUMNS, FNV_OFFSET);
+  for (int row = 0; row < DISPLAY_HEIGHT; row++) {
+    const uint8_t* line = frameBuffer + row * DISPLAY_WIDTH_BYTES;
+    uint32_t rowHash = FNV_OFFSET;
+    for (int column = 0; column < DIRTY_COLUMNS; column++) {
+      uint32_t word;
+      memcpy(&word, line + column * DIRTY_COLUMN_BYTES, sizeof(word));
+      rowHash = (rowHash ^ word) * FNV_PRIME;
+      columns[column] = (columns[column] ^ word) * FNV_PRIME;
+    }
+    if (rowHash != rowHashes[row]) {
+      minRow = std::min(minRow, row);
+      maxRow = row;
+      rowHashes[row] = rowHash;
+    }
+  }
+  for (int column = 0; column < DIRTY_COLUMNS; column++) {
+    if (columns[column] != columnHashes[column]) {
+      markColumn(column);
+      columnHashes[column] = columns[column];
+    }
+  }
+#else
+  for (int row = 0; row < DISPLAY_HEIGHT; row++) {
+    const uint32_t offset = row * DISPLAY_WIDTH_BYTES;
+    if (memcmp(frameBuffer + offset, frameBufferActive + offset, DISPLAY_WIDTH_BYTES) == 0) continue;
+    minRow = std::min(minRow, row);
+    maxRow = row;
+    for (int column = 0; column < DIRTY_COLUMNS; column++) {
+      const uint32_t at = offset + column * DIRTY_COLUMN_BYTES;
+      if (memcmp(frameBuffer + at, frameBufferActive + at, DIRTY_COLUMN_BYTES) != 0) markColumn(column);
+    }
+  }
+#endif
+
+  const bool known = displayedFrameKnown;
+  displayedFrameKnown = true;
+  if (!known) return false;
+
+  if (maxRow < 0 && maxColumn < 0) {
+    window = {0, 0, 0, 0};
+    return true;
+  }
+  // A hash collision can hide one axis of a change; take its full extent then
+  if (maxRow < 0) {
+    minRow = 0;
+    maxRow = DISPLAY_HEIGHT - 1;
+  }
+  if (maxColumn < 0) {
+    minColumn = 0;
+    maxColumn = DIRTY_COLUMNS - 1;
+  }
+  window = {static_cast<uint16_t>(minColumn * DIRTY_COLUMN_BYTES * 8), static_cast<uint16_t>(minRow),
+            static_cast<uint16_t>((maxColumn - minColumn + 1) * DIRTY_COLUMN_BYTES * 8),
+            static_cast<uint16_t>(maxRow - minRow + 1)};
+  return true;
+}
+
+void EInkDisplay::setFramebuffer(const uint8_t* bwBuffer) { memcpy(getFrameBuffer(), bwBuffer, BUFFER_SIZE); }
 
 #ifndef EINK_DISPLAY_SINGLE_BUFFER_MODE
 void EInkDisplay::swapBuffers() {
@@ -393,6 +531,16 @@ void EInkDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) {
   writeRamBuffer(CMD_WRITE_RAM_RED, msbBuffer, BUFFER_SIZE);
 }
 
+void EInkDisplay::copyGrayscaleStrip(const uint16_t y, const uint16_t h, const uint8_t* lsbStrip,
+                                     const uint8_t* msbStrip) {
+  const uint32_t size = static_cast<uint32_t>(DISPLAY_WIDTH_BYTES) * h;
+  // The RAM address counter carries over between write commands, so rewind it for the second plane
+  setRamArea(0, y, DISPLAY_WIDTH, h);
+  writeRamBuffer(CMD_WRITE_RAM_BW, lsbStrip, size);
+  setRamArea(0, y, DISPLAY_WIDTH, h);
+  writeRamBuffer(CMD_WRITE_RAM_RED, msbStrip, size);
+}
+
 void EInkDisplay::copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer) {
   setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
   writeRamBuffer(CMD_WRITE_RAM_BW, lsbBuffer, BUFFER_SIZE);
@@ -411,7 +559,12 @@ void EInkDisplay::cleanupGrayscaleBuffers(const uint8_t* bwBuffer) {
 }
 #endif
 
-void EInkDisplay::displayBuffer(RefreshMode mode, bool turnOffScreen) {
+void EInkDisplay::displayBuffer(const RefreshMode mode, const bool turnOffScreen) {
+  startDisplayBuffer(mode, turnOffScreen);
+  waitForRefresh();
+}
+
+void EInkDisplay::startDisplayBuffer(RefreshMode mode, const bool turnOffScreen) {
   if (!isScreenOn && mode == FAST_REFRESH) {
     // Force half refresh if screen is off - FAST_REFRESH requires valid
     // previous frame data in RED RAM which may be stale after power-off
@@ -424,20 +577,31 @@ void EInkDisplay::displayBuffer(RefreshMode mode, bool turnOffScreen) {
     grayscaleRevert();
   }
 
-  // Set up full screen RAM area
-  setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+  // A fast refresh compares BW against RED RAM, so only the part that changed has to be sent
+  Window window = {0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT};
+  Window dirty;
+  if (findDirtyWindow(dirty) && mode == FAST_REFRESH) {
+    if (dirty.h == 0) {
+      if (Serial) Serial.printf("[%lu]   Frame unchanged, skipping refresh\n", millis());
+      // The refresh is skipped, the requested power-down isn't
+      if (turnOffScreen && isScreenOn) startPowerOff();
+      return;
+    }
+    if (static_cast<uint32_t>(dirty.w / 8) * dirty.h <= MAX_WINDOW_BYTES) window = dirty;
+  }
 
   if (mode != FAST_REFRESH) {
     // For full refresh, write to both buffers before refresh
+    setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
     writeRamBuffer(CMD_WRITE_RAM_BW, frameBuffer, BUFFER_SIZE);
     writeRamBuffer(CMD_WRITE_RAM_RED, frameBuffer, BUFFER_SIZE);
   } else {
     // For fast refresh, write to BW buffer only
-    writeRamBuffer(CMD_WRITE_RAM_BW, frameBuffer, BUFFER_SIZE);
+    writeRamWindow(CMD_WRITE_RAM_BW, frameBuffer, window);
     // In single buffer mode, the RED RAM should already contain the previous frame
     // In dual buffer mode, we write back frameBufferActive which is the last frame
 #ifndef EINK_DISPLAY_SINGLE_BUFFER_MODE
-    writeRamBuffer(CMD_WRITE_RAM_RED, frameBufferActive, BUFFER_SIZE);
+    writeRamWindow(CMD_WRITE_RAM_RED, frameBufferActive, window);
 #endif
   }
 
@@ -445,14 +609,33 @@ void EInkDisplay::displayBuffer(RefreshMode mode, bool turnOffScreen) {
   swapBuffers();
 #endif
 
-  // Refresh the display
-  refreshDisplay(mode, turnOffScreen);
+  // Start the refresh; waitForRefresh() finishes it
+  startRefresh(mode, turnOffScreen);
 
 #ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
-  // In single buffer mode always sync RED RAM after refresh to prepare for next fast refresh
-  // This ensures RED contains the currently displayed frame for differential comparison
-  setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
-  writeRamBuffer(CMD_WRITE_RAM_RED, frameBuffer, BUFFER_SIZE);
+  pendingRedSync = true;
+  redSyncWindow = window;
+#endif
+}
+
+bool EInkDisplay::isRefreshing() const { return pendingRefresh && digitalRead(_busy) == HIGH; }
+
+void EInkDisplay::waitForRefresh() {
+  if (!pendingRefresh) return;
+  const char* refreshType = pendingRefresh;
+  pendingRefresh = nullptr;
+
+  // Wait for display to finish updating
+  if (Serial) Serial.printf("[%lu]   Waiting for display refresh...\n", millis());
+  waitWhileBusy(refreshType);
+
+#ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
+  if (pendingRedSync) {
+    pendingRedSync = false;
+    // In single buffer mode always sync RED RAM after refresh to prepare for next fast refresh
+    // This ensures RED contains the currently displayed frame for differential comparison
+    writeRamWindow(CMD_WRITE_RAM_RED, frameBuffer, redSyncWindow);
+  }
 #endif
 }
 
@@ -484,6 +667,7 @@ void EInkDisplay::displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
     inGrayscaleMode = false;
     grayscaleRevert();
   }
+  displayedFrameKnown = false;
 
   // Calculate window buffer size
   const uint16_t windowWidthBytes = w / 8;
@@ -536,6 +720,7 @@ void EInkDisplay::displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 void EInkDisplay::displayGrayBuffer(const bool turnOffScreen) {
   drawGrayscale = false;
   inGrayscaleMode = true;
+  displayedFrameKnown = false;
 
   // activate the custom LUT for grayscale rendering and refresh
   setCustomLUT(true, lut_grayscale);
@@ -544,6 +729,11 @@ void EInkDisplay::displayGrayBuffer(const bool turnOffScreen) {
 }
 
 void EInkDisplay::refreshDisplay(const RefreshMode mode, const bool turnOffScreen) {
+  startRefresh(mode, turnOffScreen);
+  waitForRefresh();
+}
+
+void EInkDisplay::startRefresh(const RefreshMode mode, const bool turnOffScreen) {
   // Configure Display Update Control 1
   sendCommand(CMD_DISPLAY_UPDATE_CTRL1);
   sendData((mode == FAST_REFRESH) ? CTRL1_NORMAL : CTRL1_BYPASS_RED);  // Configure buffer comparison mode
@@ -593,10 +783,20 @@ void EInkDisplay::refreshDisplay(const RefreshMode mode, const bool turnOffScree
   sendData(displayMode);
 
   sendCommand(CMD_MASTER_ACTIVATION);
+  pendingRefresh = refreshType;
+}
 
-  // Wait for display to finish updating
-  if (Serial) Serial.printf("[%lu]   Waiting for display refresh...\n", millis());
-  waitWhileBusy(refreshType);
+void EInkDisplay::startPowerOff() {
+  waitForRefresh();
+  sendCommand(CMD_DISPLAY_UPDATE_CTRL1);
+  sendData(CTRL1_BYPASS_RED);  // Normal mode
+
+  sendCommand(CMD_DISPLAY_UPDATE_CTRL2);
+  sendData(0x03);  // Set ANALOG_OFF_PHASE (bit 1) and CLOCK_OFF (bit 0)
+
+  sendCommand(CMD_MASTER_ACTIVATION);
+  isScreenOn = false;
+  pendingRefresh = "power-down";
 }
 
 void EInkDisplay::setCustomLUT(const bool enabled, const unsigned char* lutData) {
@@ -635,18 +835,8 @@ void EInkDisplay::deepSleep() {
   // First, power down the display properly
   // This shuts down the analog power rails and clock
   if (isScreenOn) {
-    sendCommand(CMD_DISPLAY_UPDATE_CTRL1);
-    sendData(CTRL1_BYPASS_RED);  // Normal mode
-
-    sendCommand(CMD_DISPLAY_UPDATE_CTRL2);
-    sendData(0x03);  // Set ANALOG_OFF_PHASE (bit 1) and CLOCK_OFF (bit 0)
-
-    sendCommand(CMD_MASTER_ACTIVATION);
-
-    // Wait for the power-down sequence to complete
-    waitWhileBusy(" display power-down");
-
-    isScreenOn = false;
+    startPowerOff();
+    waitForRefresh();
   }
 
   // Now enter deep sleep mode
@@ -2,6 +2,9 @@
 
 #include <Utf8.h>
 
+#include <cstring>
+#include <new>
+
 inline int min(const int a, const int b) { return a < b ? a : b; }
 inline int max(const int a, const int b) { return a < b ? b : a; }
 
@@ -92,3 +95,20 @@ const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
 
   return nullptr;
 }
+
+void EpdFont::buildAdvanceTable() const {
+  if (advances) return;
+  advances = new (std::nothrow) uint8_t[ADVANCE_TABLE_SIZE];
+  if (!advances) return;  // Width measurement falls back to getGlyph()
+
+  // Intervals are sorted, so one walk fills the table
+  memset(advances, 0, ADVANCE_TABLE_SIZE);
+  for (uint32_t i = 0; i < data->intervalCount; i++) {
+    const EpdUnicodeInterval& interval = data->intervals[i];
+    if (interval.first >= ADVANCE_TABLE_SIZE) break;
+    const uint32_t last = interval.last < ADVANCE_TABLE_SIZE ? interval.last : ADVANCE_TABLE_SIZE - 1;
+    for (uint32_t cp = interval.first; cp <= last; cp++) {
+      advances[cp] = data->glyph[interval.offset + (cp - interval.first)].advanceX;
+    }
+  }
+}
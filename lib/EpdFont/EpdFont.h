@@ -42,14 +42,25 @@ class EpdFont {
   void getTextBounds(const char* string, int startX, int startY, int* minX, int* minY, int* maxX, int* maxY) const;
 
  public:
+  // Dense advance table covers Basic Latin, Latin-1 Supplement and Latin Extended-A
+  static constexpr uint32_t ADVANCE_TABLE_SIZE = 0x180;
+
   const EpdFontData* data;
   explicit EpdFont(const EpdFontData* data) : data(data) {}
-  ~EpdFont() = default;
+  ~EpdFont() { delete[] advances; }
+  EpdFont(const EpdFont&) = delete;
+  EpdFont& operator=(const EpdFont&) = delete;
   void getTextDimensions(const char* string, int* w, int* h) const;
   bool hasPrintableChars(const char* string) const;
 
   const EpdGlyph* getGlyph(uint32_t cp) const;
 
+  // Build the advance table (384 bytes); called once when the font is registered with the renderer
+  void buildAdvanceTable() const;
+  // advanceX of codepoints below ADVANCE_TABLE_SIZE, 0 where the font has no glyph; nullptr until built
+  const uint8_t* advanceTable() const { return advances; }
+
  private:
   mutable GlyphCache glyphCache;
+  mutable uint8_t* advances = nullptr;
 };
@@ -35,3 +35,32 @@ const EpdFontData* EpdFontFamily::getData(const Style style) const { return getF
 const EpdGlyph* EpdFontFamily::getGlyph(const uint32_t cp, const Style style) const {
   return getFont(style)->getGlyph(cp);
 };
+
+void EpdFontFamily::buildAdvanceTables() const {
+  for (const EpdFont* font : {regular, bold, italic, boldItalic}) {
+    if (font) font->buildAdvanceTable();
+  }
+}
+
+bool EpdFontFamily::getAdvanceWidth(const char* string, int* w, const Style style) const {
+  const uint8_t* advances = getFont(style)->advanceTable();
+  if (!advances) return false;
+
+  int width = 0;
+  const auto* p = reinterpret_cast<const uint8_t*>(string);
+  while (*p) {
+    uint32_t cp = *p;
+    if (cp < 0x80) {
+      p++;
+    } else if ((cp & 0xE0) == 0xC0 && (p[1] & 0xC0) == 0x80) {
+      cp = ((cp & 0x1F) << 6) | (p[1] & 0x3F);
+      p += 2;
+    } else {
+      return false;  // 3- and 4-byte sequences are beyond the tables
+    }
+    if (cp >= EpdFont::ADVANCE_TABLE_SIZE || advances[cp] == 0) return false;
+    width += advances[cp];
+  }
+  *w = width;
+  return true;
+}
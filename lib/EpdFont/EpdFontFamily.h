@@ -14,6 +14,14 @@ class EpdFontFamily {
   const EpdFontData* getData(Style style = REGULAR) const;
   const EpdGlyph* getGlyph(uint32_t cp, Style style = REGULAR) const;
 
+  void buildAdvanceTables() const;
+  /**
+   * Sum of advanceX over string from the dense advance tables, decoding only 1- and 2-byte UTF-8.
+   * Returns false if any codepoint lies outside the tables or has no glyph; the caller then measures
+   * with getGlyph() (fallback glyphs, Thai shaping).
+   */
+  bool getAdvanceWidth(const char* string, int* w, Style style = REGULAR) const;
+
  private:
   const EpdFont* regular;
   const EpdFont* bold;
@@ -13,6 +13,9 @@
 #include "Epub/parsers/TocNavParser.h"
 #include "Epub/parsers/TocNcxParser.h"
 
+// Compiled style table, written with book.bin and loaded on every later open
+constexpr char cssCacheFile[] = "/css.bin";
+
 bool Epub::findContentOpfFile(std::string* contentOpfFile) const {
   const auto containerPath = "META-INF/container.xml";
   size_t containerSize;
@@ -217,42 +220,47 @@ bool Epub::parseTocNavFile() const {
 }
 
 bool Epub::parseCssFiles() {
+  const unsigned long startMs = millis();
+  cssParser_.reset(new CssParser());
+
   if (cssFiles_.empty()) {
     Serial.printf("[%lu] [EBP] No CSS files to parse\n", millis());
-    return true;
   }
 
-  cssParser_.reset(new CssParser());
-
+  // Stylesheets are tokenized as they inflate, no temp file round trip
   for (const auto& cssHref : cssFiles_) {
-    // Extract CSS file to temp location
-    const auto tmpCssPath = getCachePath() + "/.tmp_css.css";
-
-    FsFile tempCssFile;
-    if (!SdMan.openFileForWrite("EBP", tmpCssPath, tempCssFile)) {
-      Serial.printf("[%lu] [EBP] Failed to create temp CSS file\n", millis());
-      continue;
+    const bool parsed = cssParser_->parseStream(
+        [this, &cssHref](Print& out) { return readItemContentsToStream(cssHref, out, 1024); }, cssHref.c_str());
+    if (!parsed) {
+      Serial.printf("[%lu] [EBP] Failed to parse CSS: %s\n", millis(), cssHref.c_str());
     }
+  }
 
-    if (!readItemContentsToStream(cssHref, tempCssFile, 1024)) {
-      Serial.printf("[%lu] [EBP] Failed to extract CSS: %s\n", millis(), cssHref.c_str());
-      tempCssFile.close();
-      SdMan.remove(tmpCssPath.c_str());
-      continue;
-    }
-    tempCssFile.close();
+  Serial.printf("[%lu] [EBP] Parsed CSS files, %d style rules loaded in %lu ms\n", millis(),
+                static_cast<int>(cssParser_->getStyleCount()), millis() - startMs);
 
-    // Parse the CSS file
-    if (!cssParser_->parseFile(tmpCssPath.c_str())) {
-      Serial.printf("[%lu] [EBP] Failed to parse CSS: %s\n", millis(), cssHref.c_str());
-    }
+  // Saved even when empty: the fast path in load() needs it to know styling is complete
+  const bool saved = cssParser_->saveToCache(getCachePath() + cssCacheFile);
+  if (!cssParser_->hasStyles()) {
+    cssParser_.reset();
+  }
+  return saved;
+}
 
-    // Clean up temp file
-    SdMan.remove(tmpCssPath.c_str());
+// Restores the style table parseCssFiles() compiled when the book cache was built
+bool Epub::loadCssCache() {
+  const unsigned long startMs = millis();
+  cssParser_.reset(new CssParser());
+  if (!cssParser_->loadFromCache(getCachePath() + cssCacheFile)) {
+    cssParser_.reset();
+    return false;
   }
 
-  Serial.printf("[%lu] [EBP] Parsed CSS files, %d style rules loaded\n", millis(),
-                static_cast<int>(cssParser_->getStyleCount()));
+  Serial.printf("[%lu] [EBP] Loaded %d cached style rules in %lu ms\n", millis(),
+                static_cast<int>(cssParser_->getStyleCount()), millis() - startMs);
+  if (!cssParser_->hasStyles()) {
+    cssParser_.reset();
+  }
   return true;
 }
 
@@ -260,13 +268,21 @@ bool Epub::parseCssFiles() {
 bool Epub::load(const bool buildIfMissing) {
   Serial.printf("[%lu] [EBP] Loading ePub: %s\n", millis(), filepath.c_str());
 
+  const unsigned long startMs = millis();
+
   // Initialize spine/TOC cache
   bookMetadataCache.reset(new BookMetadataCache(cachePath));
 
-  // Try to load existing cache first
+  // Try to load existing cache first; the style table is part of it, so a cache without one is rebuilt
   if (bookMetadataCache->load()) {
-    Serial.printf("[%lu] [EBP] Loaded ePub: %s\n", millis(), filepath.c_str());
-    return true;
+    if (loadCssCache()) {
+      loadZipIndex();
+      Serial.printf("[%lu] [EBP] Loaded ePub from cache in %lu ms: %s\n", millis(), millis() - startMs,
+                    filepath.c_str());
+      return true;
+    }
+    Serial.printf("[%lu] [EBP] Style cache missing or stale, rebuilding book cache\n", millis());
+    bookMetadataCache.reset(new BookMetadataCache(cachePath));
   }
 
   // If we didn't load from cache above and we aren't allowed to build, fail now
@@ -277,6 +293,7 @@ bool Epub::load(const bool buildIfMissing) {
   // Cache doesn't exist or is invalid, build it
   Serial.printf("[%lu] [EBP] Cache not found, building spine/TOC cache\n", millis());
   setupCacheDir();
+  loadZipIndex();
 
   // Begin building cache - stream entries to disk immediately
   if (!bookMetadataCache->beginWrite()) {
@@ -299,8 +316,12 @@ bool Epub::load(const bool buildIfMissing) {
     return false;
   }
 
-  // Parse CSS files for styling
-  parseCssFiles();
+  // Parse CSS files for styling; book.bin is only valid alongside the style table, so a failed write
+  // fails the build rather than leaving a cache that every later open would have to rebuild
+  if (!parseCssFiles()) {
+    Serial.printf("[%lu] [EBP] Could not write style cache\n", millis());
+    return false;
+  }
 
   // TOC Pass - try EPUB 3 nav first, fall back to NCX
   if (!bookMetadataCache->beginTocPass()) {
@@ -355,10 +376,22 @@ bool Epub::load(const bool buildIfMissing) {
     return false;
   }
 
-  Serial.printf("[%lu] [EBP] Loaded ePub: %s\n", millis(), filepath.c_str());
+  Serial.printf("[%lu] [EBP] Built ePub cache in %lu ms: %s\n", millis(), millis() - startMs, filepath.c_str());
   return true;
 }
 
+// Every item read constructs a fresh ZipFile, so lookups go through an on-SD index of the central
+// directory rather than rescanning it (1000+ entries in image-heavy books) for each item
+void Epub::loadZipIndex() {
+  const std::string indexPath = cachePath + "/zip_index.bin";
+  ZipFile zip(filepath);
+  if (zip.checkIndex(indexPath) || zip.buildIndex(indexPath)) {
+    zipIndexPath_ = indexPath;
+  } else {
+    zipIndexPath_.clear();
+  }
+}
+
 bool Epub::clearCache() const {
   if (!SdMan.exists(cachePath.c_str())) {
     Serial.printf("[%lu] [EPB] Cache does not exist, no action needed\n", millis());
@@ -471,7 +504,7 @@ bool Epub::generateCoverPreviewBmp() const {
   };
   constexpr int commonCoverPathsCount = sizeof(commonCoverPaths) / sizeof(commonCoverPaths[0]);
 
-  ZipFile zip(filepath);
+  ZipFile zip(filepath, zipIndexPath_);
   const int foundIndex = zip.findFirstExisting(commonCoverPaths, commonCoverPathsCount);
   if (foundIndex >= 0) {
     const char* path = commonCoverPaths[foundIndex];
@@ -710,7 +743,7 @@ bool Epub::generateCoverBmp(bool use1BitDithering) const {
   constexpr int commonCoverPathsCount = sizeof(commonCoverPaths) / sizeof(commonCoverPaths[0]);
 
   // Use single ZipFile instance with batch lookup for efficiency
-  ZipFile zip(filepath);
+  ZipFile zip(filepath, zipIndexPath_);
   const int foundIndex = zip.findFirstExisting(commonCoverPaths, commonCoverPathsCount);
   if (foundIndex >= 0) {
     const char* path = commonCoverPaths[foundIndex];
@@ -813,7 +846,7 @@ uint8_t* Epub::readItemContentsToBytes(const std::string& itemHref, size_t* size
 
   const std::string path = FsHelpers::normalisePath(itemHref);
 
-  const auto content = ZipFile(filepath).readFileToMemory(path.c_str(), size, trailingNullByte);
+  const auto content = ZipFile(filepath, zipIndexPath_).readFileToMemory(path.c_str(), size, trailingNullByte);
   if (!content) {
     Serial.printf("[%lu] [EBP] Failed to read item %s\n", millis(), path.c_str());
     return nullptr;
@@ -829,12 +862,24 @@ bool Epub::readItemContentsToStream(const std::string& itemHref, Print& out, con
   }
 
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).readFileToStream(path.c_str(), out, chunkSize);
+  return ZipFile(filepath, zipIndexPath_).readFileToStream(path.c_str(), out, chunkSize);
+}
+
+bool Epub::readItemContentsToStream(const std::string& itemHref, Print& out, const size_t chunkSize,
+                                    const uint32_t fromOffset) const {
+  if (itemHref.empty()) {
+    Serial.printf("[%lu] [EBP] Failed to read item, empty href\n", millis());
+    return false;
+  }
+
+  const std::string path = FsHelpers::normalisePath(itemHref);
+  const std::string seekIndexPath = cachePath + "/seek_" + std::to_string(std::hash<std::string>{}(path)) + ".bin";
+  return ZipFile(filepath, zipIndexPath_).readFileToStream(path.c_str(), out, chunkSize, fromOffset, seekIndexPath);
 }
 
 bool Epub::getItemSize(const std::string& itemHref, size_t* size) const {
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).getInflatedFileSize(path.c_str(), size);
+  return ZipFile(filepath, zipIndexPath_).getInflatedFileSize(path.c_str(), size);
 }
 
 int Epub::getSpineItemsCount() const {
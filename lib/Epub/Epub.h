@@ -29,9 +29,13 @@ class Epub {
   std::unique_ptr<CssParser> cssParser_;
   // CSS file paths from manifest
   std::vector<std::string> cssFiles_;
+  // Central directory index in the cache dir, empty until validated or built by load()
+  std::string zipIndexPath_;
 
   bool findContentOpfFile(std::string* contentOpfFile) const;
+  void loadZipIndex();
   bool parseCssFiles();
+  bool loadCssCache();
   bool parseContentOpf(BookMetadataCache::BookMetadata& bookMetadata);
   bool parseTocNcxFile() const;
   bool parseTocNavFile() const;
@@ -60,6 +64,9 @@ class Epub {
   uint8_t* readItemContentsToBytes(const std::string& itemHref, size_t* size = nullptr,
                                    bool trailingNullByte = false) const;
   bool readItemContentsToStream(const std::string& itemHref, Print& out, size_t chunkSize) const;
+  // Stream an item from an uncompressed offset. Large deflated items keep an inflate seek index in the book cache
+  // so later reads deep into the item skip most of the inflation.
+  bool readItemContentsToStream(const std::string& itemHref, Print& out, size_t chunkSize, uint32_t fromOffset) const;
   bool getItemSize(const std::string& itemHref, size_t* size) const;
   BookMetadataCache::SpineEntry getSpineItem(int spineIndex) const;
   BookMetadataCache::TocEntry getTocItem(int tocIndex) const;
@@ -0,0 +1,165 @@
+#include "KnuthPlass.h"
+
+#include <algorithm>
+
+uint32_t KnuthPlass::lineDemerits(const int lineWidth, const int pageWidth, const bool isLastLine) {
+  if (pageWidth <= 0) return OVERSIZED_DEMERITS;
+  if (isLastLine) return LINE_PENALTY;  // Last line may be loose
+
+  // ratio = slack / width in 1/4096ths; 32-bit only (no FPU or 64-bit divide on the C3)
+  const uint32_t slack = pageWidth - std::max(lineWidth, 0);
+  const uint32_t ratio = slack * RATIO_ONE / static_cast<uint32_t>(pageWidth);
+  const uint32_t cubed = (ratio * ratio / RATIO_ONE) * ratio / RATIO_ONE;
+  const uint32_t badness = cubed * 100 * ONE / RATIO_ONE;
+  const uint32_t stretch = ONE + badness;
+  return stretch * stretch / ONE + LINE_PENALTY;
+}
+
+std::vector<size_t> KnuthPlass::breakLines(const std::vector<uint16_t>& widths, const AbortFn& shouldAbort,
+                                           const bool paragraphComplete) {
+  std::vector<size_t> breaks;
+  const size_t n = widths.size();
+  peakNodes_ = 0;
+  if (n == 0) {
+    return breaks;
+  }
+
+  nodes_.clear();
+  active_.clear();
+  nodes_.reserve(MAX_NODES);
+  active_.reserve(MAX_NODES);
+  live_.reserve(MAX_NODES);
+  nodes_.push_back({0, 0, NO_NODE});
+  active_.push_back({0, -spaceWidth_});  // First word won't have preceding space
+
+  for (size_t i = 0; i < n; i++) {
+    // Check for abort periodically (every 100 words)
+    if (shouldAbort && (i % 100 == 0) && shouldAbort()) {
+      return {};  // Return empty to signal abort
+    }
+
+    if (nodes_.size() == MAX_NODES) {
+      compact(breaks);
+    }
+
+    // Best line ending after word i; breaks whose line has become overfull are retired
+    const bool isLastLine = paragraphComplete && i == n - 1;
+    uint32_t best = UINT32_MAX;
+    int16_t bestPrev = NO_NODE;
+    size_t kept = 0;
+    for (size_t a = 0; a < active_.size(); a++) {
+      Active entry = active_[a];
+      const Node& from = nodes_[entry.node];
+      entry.lineWidth += widths[i] + spaceWidth_;
+
+      uint32_t demerits;
+      if (entry.lineWidth > pageWidth_) {
+        // Oversized word: force onto its own line with high penalty
+        if (from.position != i) continue;
+        demerits = OVERSIZED_DEMERITS;
+      } else {
+        demerits = lineDemerits(entry.lineWidth, pageWidth_, isLastLine);
+        active_[kept++] = entry;
+      }
+
+      // Ties go to the earliest break
+      if (from.demerits + demerits < best) {
+        best = from.demerits + demerits;
+        bestPrev = static_cast<int16_t>(entry.node);
+      }
+    }
+    active_.resize(kept);
+
+    nodes_.push_back({static_cast<uint32_t>(i + 1), best, bestPrev});
+    active_.push_back({static_cast<uint16_t>(nodes_.size() - 1), -spaceWidth_});
+    peakNodes_ = std::max(peakNodes_, nodes_.size());
+  }
+
+  if (paragraphComplete) {
+    appendPath(static_cast<uint16_t>(nodes_.size() - 1), breaks);
+    return breaks;
+  }
+
+  // Later words can still reroute every path below the common ancestor. Bounded lookahead: if that
+  // leaves too much open, the best path to the last word decides all but its last LOOKAHEAD_WORDS
+  uint16_t common = commonAncestor();
+  if (n - nodes_[common].position > MAX_OPEN_WORDS) {
+    uint16_t node = static_cast<uint16_t>(nodes_.size() - 1);
+    while (node > common && nodes_[node].position + LOOKAHEAD_WORDS > n) node = nodes_[node].prev;
+    common = node;
+  }
+  appendPath(common, breaks);
+  if (nodes_[common].position != n) breaks.push_back(n);
+  return breaks;
+}
+
+void KnuthPlass::compact(std::vector<size_t>& breaks) {
+  while (true) {
+    markLive();
+
+    // Breaks up to the deepest node every active path runs through are final
+    const uint16_t common = commonAncestor();
+    appendPath(common, breaks);
+    rebase(common);
+    if (nodes_.size() <= MAX_NODES * 3 / 4) {
+      return;
+    }
+
+    // Paths haven't converged within the pool: commit the first line of the best path to the current
+    // word, which keeps that word's break (the newest node) active
+    uint16_t first = active_.back().node;
+    while (nodes_[first].prev != 0) first = nodes_[first].prev;
+    active_.erase(std::remove_if(active_.begin(), active_.end(),
+                                 [this, first](const Active& a) {
+                                   uint16_t node = a.node;
+                                   while (node > first) node = nodes_[node].prev;
+                                   return node != first;
+                                 }),
+                  active_.end());
+  }
+}
+
+// Deepest node on every active path; later nodes only ever link to active ones
+uint16_t KnuthPlass::commonAncestor() const {
+  uint16_t common = active_.front().node;
+  for (const Active& a : active_) {
+    uint16_t node = a.node;
+    while (node != common) {
+      if (node > common) {
+        node = nodes_[node].prev;
+      } else {
+        common = nodes_[common].prev;
+      }
+    }
+  }
+  return common;
+}
+
+void KnuthPlass::markLive() {
+  live_.assign(nodes_.size(), 0);
+  for (const Active& a : active_) {
+    for (int16_t node = a.node; node != NO_NODE && !live_[node]; node = nodes_[node].prev) live_[node] = 1;
+  }
+}
+
+// Drops nodes above newRoot and nodes no active path uses; demerits restart from newRoot
+void KnuthPlass::rebase(const uint16_t newRoot) {
+  const uint32_t base = nodes_[newRoot].demerits;
+  uint16_t kept = 0;
+  for (size_t i = newRoot; i < nodes_.size(); i++) {
+    if (live_[i] == 0) continue;
+    Node node = nodes_[i];
+    node.demerits -= base;
+    node.prev = i == newRoot ? NO_NODE : static_cast<int16_t>(live_[node.prev]);
+    live_[i] = kept;  // Ancestors come first, so children read their parent's new index
+    nodes_[kept++] = node;
+  }
+  nodes_.resize(kept);
+  for (Active& a : active_) a.node = live_[a.node];
+}
+
+void KnuthPlass::appendPath(const uint16_t node, std::vector<size_t>& breaks) const {
+  const size_t start = breaks.size();
+  for (int16_t i = node; i > 0; i = nodes_[i].prev) breaks.push_back(nodes_[i].position);
+  std::reverse(breaks.begin() + start, breaks.end());
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * KnuthPlass - Optimal-fit line breaking with bounded memory
+ *
+ * Walks the paragraph once, keeping only the active breakpoints (those that can still start a
+ * line reaching the current word) and the break nodes their best paths run through. Whenever the
+ * node pool fills, breaks shared by every surviving path are committed and their nodes released,
+ * so working memory is fixed at MAX_NODES regardless of paragraph length. If the paths haven't
+ * converged (hundreds of breakpoints within one line), the first line of the best path to the
+ * current word is committed instead.
+ *
+ * Demerits are fixed-point integers: badness = 100 * (slack / width)^3, demerits = (1 + badness)^2
+ * plus a per-line penalty; the last line pays only the penalty.
+ */
+class KnuthPlass {
+ public:
+  using AbortFn = std::function<bool()>;
+
+  static constexpr size_t MAX_NODES = 512;
+  static constexpr uint32_t ONE = 256;  // Fixed-point 1.0
+  static constexpr uint32_t LINE_PENALTY = 50 * ONE;
+  static constexpr uint32_t OVERSIZED_DEMERITS = 100 * ONE + LINE_PENALTY;  // Word wider than the page, own line
+  static constexpr size_t MAX_OPEN_WORDS = 100;
+  static constexpr size_t LOOKAHEAD_WORDS = 50;
+
+  KnuthPlass(int pageWidth, int spaceWidth) : pageWidth_(pageWidth), spaceWidth_(spaceWidth) {}
+
+  /**
+   * Line break indices (one past each line's last word, the last one == widths.size());
+   * empty if aborted. With paragraphComplete false more words will follow: only breaks that
+   * every candidate path shares are returned (or, past MAX_OPEN_WORDS undecided words, those of
+   * the best path that lie LOOKAHEAD_WORDS back), then widths.size() for the still-open tail.
+   */
+  std::vector<size_t> breakLines(const std::vector<uint16_t>& widths, const AbortFn& shouldAbort = nullptr,
+                                 bool paragraphComplete = true);
+
+  /**
+   * Demerits of a line that fits; lineWidth includes inter-word spaces
+   */
+  static uint32_t lineDemerits(int lineWidth, int pageWidth, bool isLastLine);
+
+  size_t peakNodes() const { return peakNodes_; }
+
+ private:
+  static constexpr int16_t NO_NODE = -1;
+  static constexpr uint32_t RATIO_ONE = 4096;  // Fixed-point 1.0 for slack ratios
+
+  struct Node {
+    uint32_t position;  // Break before this word
+    uint32_t demerits;  // Best total since the committed root
+    int16_t prev;       // Index into nodes_, NO_NODE for the root
+  };
+
+  struct Active {
+    uint16_t node;
+    int32_t lineWidth;  // Width of the line from this break to the current word
+  };
+
+  void compact(std::vector<size_t>& breaks);
+  uint16_t commonAncestor() const;
+  void markLive();
+  void rebase(uint16_t newRoot);
+  void appendPath(uint16_t node, std::vector<size_t>& breaks) const;
+
+  int pageWidth_;
+  int spaceWidth_;
+  std::vector<Node> nodes_;     // Creation order, so ancestors come first; nodes_[0] is the root
+  std::vector<Active> active_;  // Ascending position
+  std::vector<uint16_t> live_;  // compact() scratch: set if an active path uses the node, then its new index
+  size_t peakNodes_ = 0;
+};
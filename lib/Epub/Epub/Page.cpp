@@ -1,33 +1,32 @@
 #include "Page.h"
 
+#include <GfxRenderer.h>
 #include <HardwareSerial.h>
 #include <Serialization.h>
 
-void PageLine::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset, const bool black,
-                      const int monoFontId) {
-  block->render(renderer, fontId, xPos + xOffset, yPos + yOffset, black, monoFontId);
-}
+#include <cstring>
 
-bool PageLine::serialize(FsFile& file) {
-  serialization::writePod(file, xPos);
-  serialization::writePod(file, yPos);
+namespace {
+// Max elements per page - prevents memory exhaustion from corrupted cache
+constexpr uint16_t MAX_PAGE_ELEMENTS = 500;
+// Max words per page, matching the old per-line sanity limit
+constexpr uint16_t MAX_PAGE_WORDS = 10000;
+constexpr uint32_t MAX_BLOB_SIZE = sizeof(PageBlobHeader) + MAX_PAGE_ELEMENTS * sizeof(PageBlobElement) +
+                                   MAX_PAGE_WORDS * sizeof(PageBlobWord) + UINT16_MAX;
 
-  // serialize TextBlock pointed to by PageLine
-  return block->serialize(file);
+// Appends a NUL-terminated string to the pool, returns false if the pool would outgrow 16-bit offsets
+bool appendToPool(std::vector<char>& pool, const char* str, const size_t len, uint16_t* offset) {
+  if (pool.size() + len + 1 > UINT16_MAX) return false;
+  *offset = static_cast<uint16_t>(pool.size());
+  pool.insert(pool.end(), str, str + len);
+  pool.push_back('\0');
+  return true;
 }
+}  // namespace
 
-std::unique_ptr<PageLine> PageLine::deserialize(FsFile& file) {
-  int16_t xPos;
-  int16_t yPos;
-  serialization::readPod(file, xPos);
-  serialization::readPod(file, yPos);
-
-  auto tb = TextBlock::deserialize(file);
-  if (!tb) {
-    Serial.printf("[%lu] [PGE] Deserialization failed: TextBlock is null\n", millis());
-    return nullptr;
-  }
-  return std::unique_ptr<PageLine>(new PageLine(std::move(tb), xPos, yPos));
+void PageLine::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset, const bool black,
+                      const int monoFontId) {
+  block->render(renderer, fontId, xPos + xOffset, yPos + yOffset, black, monoFontId);
 }
 
 void PageImage::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset,
@@ -37,25 +36,6 @@ void PageImage::render(GfxRenderer& renderer, const int fontId, const int xOffse
   block->render(renderer, fontId, xPos + xOffset, yPos + yOffset);
 }
 
-bool PageImage::serialize(FsFile& file) {
-  serialization::writePod(file, xPos);
-  serialization::writePod(file, yPos);
-  return block->serialize(file);
-}
-
-std::unique_ptr<PageImage> PageImage::deserialize(FsFile& file) {
-  int16_t xPos;
-  int16_t yPos;
-  serialization::readPod(file, xPos);
-  serialization::readPod(file, yPos);
-
-  auto ib = ImageBlock::deserialize(file);
-  if (!ib) {
-    return nullptr;
-  }
-  return std::unique_ptr<PageImage>(new PageImage(std::move(ib), xPos, yPos));
-}
-
 void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset, const bool black,
                   const int monoFontId) const {
   for (auto& element : elements) {
@@ -64,57 +44,251 @@ void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, co
 }
 
 bool Page::serialize(FsFile& file) const {
-  const uint16_t count = elements.size();
-  serialization::writePod(file, count);
+  std::vector<PageBlobElement> blobElements;
+  std::vector<PageBlobWord> blobWords;
+  std::vector<char> pool;
+  blobElements.reserve(elements.size());
 
   for (const auto& el : elements) {
-    serialization::writePod(file, static_cast<uint8_t>(el->getTag()));
-    if (!el->serialize(file)) {
+    PageBlobElement be = {static_cast<uint8_t>(el->getTag()), 0, el->xPos, el->yPos, 0, 0, 0};
+
+    if (el->getTag() == TAG_PageLine) {
+      const TextBlock& block = static_cast<const PageLine&>(*el).getBlock();
+      const auto& wordData = block.getWordData();
+      be.flags = static_cast<uint8_t>(block.getStyle()) | (block.getUseMonospace() ? TextBlock::FLAG_MONOSPACE : 0);
+      be.first = static_cast<uint16_t>(blobWords.size());
+      be.count = static_cast<uint16_t>(wordData.size());
+      if (blobWords.size() + wordData.size() > MAX_PAGE_WORDS) {
+        Serial.printf("[%lu] [PGE] Serialization failed: too many words\n", millis());
+        return false;
+      }
+      for (const auto& wd : wordData) {
+        const char* word = block.getText().c_str() + wd.offset;
+        PageBlobWord bw = {0, wd.xPos, static_cast<uint8_t>(wd.style), 0};
+        if (!appendToPool(pool, word, strlen(word), &bw.offset)) {
+          Serial.printf("[%lu] [PGE] Serialization failed: string pool full\n", millis());
+          return false;
+        }
+        blobWords.push_back(bw);
+      }
+    } else if (el->getTag() == TAG_PageImage) {
+      const ImageBlock& block = static_cast<const PageImage&>(*el).getBlock();
+      const std::string& path = block.getCachedBmpPath();
+      be.count = block.getWidth();
+      be.height = block.getHeight();
+      if (!appendToPool(pool, path.c_str(), path.size(), &be.first)) {
+        Serial.printf("[%lu] [PGE] Serialization failed: string pool full\n", millis());
+        return false;
+      }
+    } else {
       return false;
     }
+    blobElements.push_back(be);
   }
 
-  return true;
+  if (blobElements.size() > MAX_PAGE_ELEMENTS) {
+    Serial.printf("[%lu] [PGE] Serialization failed: %zu elements\n", millis(), blobElements.size());
+    return false;
+  }
+
+  const PageBlobHeader header = {static_cast<uint16_t>(blobElements.size()), static_cast<uint16_t>(blobWords.size()),
+                                 static_cast<uint16_t>(pool.size()), 0};
+  const uint32_t blobSize = sizeof(header) + blobElements.size() * sizeof(PageBlobElement) +
+                            blobWords.size() * sizeof(PageBlobWord) + pool.size();
+
+  // Assemble the record so the page goes out in a single write
+  std::vector<uint8_t> record(sizeof(blobSize) + blobSize);
+  uint8_t* out = record.data();
+  auto put = [&out](const void* data, const size_t len) {
+    if (len > 0) memcpy(out, data, len);
+    out += len;
+  };
+  put(&blobSize, sizeof(blobSize));
+  put(&header, sizeof(header));
+  put(blobElements.data(), blobElements.size() * sizeof(PageBlobElement));
+  put(blobWords.data(), blobWords.size() * sizeof(PageBlobWord));
+  put(pool.data(), pool.size());
+
+  return file.write(record.data(), record.size()) == record.size();
 }
 
 std::unique_ptr<Page> Page::deserialize(FsFile& file) {
-  auto page = std::unique_ptr<Page>(new Page());
+  PageView view;
+  if (!view.load(file)) {
+    return nullptr;
+  }
+  return view.toPage();
+}
 
-  // Max elements per page - prevents memory exhaustion from corrupted cache
-  constexpr uint16_t MAX_PAGE_ELEMENTS = 500;
+bool PageView::load(FsFile& file, const uint32_t recordSpan) {
+  loaded_ = false;
+  readCalls_ = 0;
 
-  uint16_t count;
-  serialization::readPod(file, count);
+  uint32_t blobSize;
+  if (recordSpan >= PREFIX_SIZE + sizeof(PageBlobHeader) && recordSpan <= PREFIX_SIZE + MAX_BLOB_SIZE) {
+    // Size prefix and blob in one read. Between cache chunks the span also covers the previous chunk's
+    // LUT; those trailing bytes are read and ignored.
+    if (buffer_.size() < recordSpan) {
+      buffer_.resize(recordSpan);
+    }
+    readCalls_++;
+    if (file.read(buffer_.data(), recordSpan) != static_cast<int>(recordSpan)) {
+      Serial.printf("[%lu] [PGE] Deserialization failed: short read\n", millis());
+      return false;
+    }
+    memcpy(&blobSize, buffer_.data(), PREFIX_SIZE);
+    if (blobSize < sizeof(PageBlobHeader) || blobSize > recordSpan - PREFIX_SIZE) {
+      Serial.printf("[%lu] [PGE] Page size %u out of range\n", millis(), blobSize);
+      return false;
+    }
+  } else {
+    readCalls_++;
+    if (!serialization::readPodChecked(file, blobSize)) {
+      Serial.printf("[%lu] [PGE] Deserialization failed: no page size\n", millis());
+      return false;
+    }
+    if (blobSize < sizeof(PageBlobHeader) || blobSize > MAX_BLOB_SIZE) {
+      Serial.printf("[%lu] [PGE] Page size %u out of range\n", millis(), blobSize);
+      return false;
+    }
 
-  // Validate element count to prevent memory exhaustion
-  if (count > MAX_PAGE_ELEMENTS) {
-    Serial.printf("[%lu] [PGE] Element count %u exceeds limit %u\n", millis(), count, MAX_PAGE_ELEMENTS);
-    return nullptr;
+    // Grow-only: the buffer settles at the largest page seen
+    if (buffer_.size() < PREFIX_SIZE + blobSize) {
+      buffer_.resize(PREFIX_SIZE + blobSize);
+    }
+    readCalls_++;
+    if (file.read(buffer_.data() + PREFIX_SIZE, blobSize) != static_cast<int>(blobSize)) {
+      Serial.printf("[%lu] [PGE] Deserialization failed: short read\n", millis());
+      return false;
+    }
+  }
+  size_ = blobSize;
+
+  if (!validate()) {
+    return false;
+  }
+  loaded_ = true;
+  return true;
+}
+
+// Checks every table reference once so rendering can trust the blob
+bool PageView::validate() const {
+  const PageBlobHeader* h = header();
+  if (h->elementCount > MAX_PAGE_ELEMENTS) {
+    Serial.printf("[%lu] [PGE] Element count %u exceeds limit %u\n", millis(), h->elementCount, MAX_PAGE_ELEMENTS);
+    return false;
+  }
+  if (h->wordCount > MAX_PAGE_WORDS) {
+    Serial.printf("[%lu] [PGE] Word count %u exceeds limit %u\n", millis(), h->wordCount, MAX_PAGE_WORDS);
+    return false;
+  }
+  const size_t expected = sizeof(PageBlobHeader) + h->elementCount * sizeof(PageBlobElement) +
+                          h->wordCount * sizeof(PageBlobWord) + h->poolSize;
+  if (expected != size_ || (h->poolSize > 0 && pool()[h->poolSize - 1] != '\0')) {
+    Serial.printf("[%lu] [PGE] Deserialization failed: malformed page blob\n", millis());
+    return false;
+  }
+
+  const PageBlobElement* els = elements();
+  for (uint16_t i = 0; i < h->elementCount; i++) {
+    const PageBlobElement& el = els[i];
+    if (el.tag == TAG_PageLine) {
+      if (el.first + el.count > h->wordCount) {
+        Serial.printf("[%lu] [PGE] Deserialization failed: line words out of range\n", millis());
+        return false;
+      }
+    } else if (el.tag == TAG_PageImage) {
+      if (el.first >= h->poolSize || el.count > 2000 || el.height > 2000) {
+        Serial.printf("[%lu] [PGE] Deserialization failed: bad image element\n", millis());
+        return false;
+      }
+    } else {
+      Serial.printf("[%lu] [PGE] Deserialization failed: Unknown tag %u\n", millis(), el.tag);
+      return false;
+    }
+  }
+
+  const PageBlobWord* ws = words();
+  for (uint16_t i = 0; i < h->wordCount; i++) {
+    if (ws[i].offset >= h->poolSize) {
+      Serial.printf("[%lu] [PGE] Deserialization failed: word offset out of range\n", millis());
+      return false;
+    }
   }
+  return true;
+}
 
-  for (uint16_t i = 0; i < count; i++) {
-    uint8_t tag;
-    serialization::readPod(file, tag);
+void PageView::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset, const bool black,
+                      const int monoFontId) const {
+  if (!loaded_) return;
 
-    if (tag == TAG_PageLine) {
-      auto pl = PageLine::deserialize(file);
-      if (!pl) {
-        Serial.printf("[%lu] [PGE] Deserialization failed: PageLine is null\n", millis());
-        return nullptr;
+  const PageBlobElement* els = elements();
+  const PageBlobWord* ws = words();
+  const char* strings = pool();
+  const auto& textFont = renderer.getFont(fontId);
+  const auto& monoFont = monoFontId != 0 ? renderer.getFont(monoFontId) : textFont;
+
+  for (uint16_t i = 0; i < header()->elementCount; i++) {
+    const PageBlobElement& el = els[i];
+    const int x = el.xPos + xOffset;
+    const int y = el.yPos + yOffset;
+
+    if (el.tag == TAG_PageLine) {
+      const auto& font = (el.flags & TextBlock::FLAG_MONOSPACE) != 0 ? monoFont : textFont;
+      for (uint16_t w = el.first; w < el.first + el.count; w++) {
+        renderer.drawText(font, ws[w].xPos + x, y, strings + ws[w].offset, black,
+                          static_cast<EpdFontFamily::Style>(ws[w].style));
       }
-      page->elements.push_back(std::move(pl));
-    } else if (tag == TAG_PageImage) {
-      auto pi = PageImage::deserialize(file);
-      if (!pi) {
-        Serial.printf("[%lu] [PGE] Deserialization failed: PageImage is null\n", millis());
-        return nullptr;
+    } else {
+      ImageBlock::renderBmp(renderer, fontId, strings + el.first, el.count, el.height, x, y);
+    }
+  }
+}
+
+bool PageView::hasImages() const {
+  if (!loaded_) return false;
+  const PageBlobElement* els = elements();
+  for (uint16_t i = 0; i < header()->elementCount; i++) {
+    if (els[i].tag != TAG_PageLine) return true;
+  }
+  return false;
+}
+
+std::unique_ptr<Page> PageView::toPage() const {
+  if (!loaded_) return nullptr;
+
+  auto page = std::unique_ptr<Page>(new Page());
+  const PageBlobElement* els = elements();
+  const PageBlobWord* ws = words();
+  const char* strings = pool();
+
+  for (uint16_t i = 0; i < header()->elementCount; i++) {
+    const PageBlobElement& el = els[i];
+    if (el.tag == TAG_PageLine) {
+      std::string text;
+      std::vector<TextBlock::WordData> data;
+      data.reserve(el.count);
+      for (uint16_t w = el.first; w < el.first + el.count; w++) {
+        const char* word = strings + ws[w].offset;
+        data.push_back(
+            {static_cast<uint16_t>(text.size()), ws[w].xPos, static_cast<EpdFontFamily::Style>(ws[w].style)});
+        text.append(word, strlen(word) + 1);
       }
-      page->elements.push_back(std::move(pi));
+      const auto style = static_cast<TextBlock::BLOCK_STYLE>(el.flags & 0x03);
+      const bool mono = (el.flags & TextBlock::FLAG_MONOSPACE) != 0;
+      auto block = std::make_shared<TextBlock>(std::move(text), std::move(data), style, mono);
+      page->elements.push_back(std::make_shared<PageLine>(std::move(block), el.xPos, el.yPos));
     } else {
-      Serial.printf("[%lu] [PGE] Deserialization failed: Unknown tag %u\n", millis(), tag);
-      return nullptr;
+      auto block = std::make_shared<ImageBlock>(std::string(strings + el.first), el.count, el.height);
+      page->elements.push_back(std::make_shared<PageImage>(std::move(block), el.xPos, el.yPos));
     }
   }
 
   return page;
 }
+
+void PageView::release() {
+  std::vector<uint8_t>().swap(buffer_);
+  size_ = 0;
+  loaded_ = false;
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <SdFat.h>
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -22,7 +23,6 @@ class PageElement {
   virtual PageElementTag getTag() const = 0;
   virtual void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset, bool black = true,
                       int monoFontId = 0) = 0;
-  virtual bool serialize(FsFile& file) = 0;
 };
 
 // a line from a block element
@@ -33,10 +33,9 @@ class PageLine final : public PageElement {
   PageLine(std::shared_ptr<TextBlock> block, const int16_t xPos, const int16_t yPos)
       : PageElement(xPos, yPos), block(std::move(block)) {}
   PageElementTag getTag() const override { return TAG_PageLine; }
+  const TextBlock& getBlock() const { return *block; }
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset, bool black = true,
               int monoFontId = 0) override;
-  bool serialize(FsFile& file) override;
-  static std::unique_ptr<PageLine> deserialize(FsFile& file);
 };
 
 // an image on a page
@@ -47,10 +46,83 @@ class PageImage final : public PageElement {
   PageImage(std::shared_ptr<ImageBlock> block, const int16_t xPos, const int16_t yPos)
       : PageElement(xPos, yPos), block(std::move(block)) {}
   PageElementTag getTag() const override { return TAG_PageImage; }
+  const ImageBlock& getBlock() const { return *block; }
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset, bool black = true,
               int monoFontId = 0) override;
-  bool serialize(FsFile& file) override;
-  static std::unique_ptr<PageImage> deserialize(FsFile& file);
+};
+
+// Serialized page: a u32 byte count followed by one flat blob of fixed-size tables and a string pool
+//   PageBlobHeader | PageBlobElement[elementCount] | PageBlobWord[wordCount] | pool[poolSize]
+// Every string in the pool is NUL-terminated, so words render straight out of the blob.
+struct PageBlobHeader {
+  uint16_t elementCount;
+  uint16_t wordCount;
+  uint16_t poolSize;
+  uint16_t reserved;
+};
+
+struct PageBlobElement {
+  uint8_t tag;      // PageElementTag
+  uint8_t flags;    // Line: block style | TextBlock::FLAG_MONOSPACE
+  int16_t xPos;
+  int16_t yPos;
+  uint16_t first;   // Line: index of its first word; image: pool offset of the cached BMP path
+  uint16_t count;   // Line: word count; image: width
+  uint16_t height;  // Image only
+};
+
+struct PageBlobWord {
+  uint16_t offset;  // Into the pool
+  uint16_t xPos;
+  uint8_t style;    // EpdFontFamily::Style
+  uint8_t reserved;
+};
+
+static_assert(sizeof(PageBlobHeader) == 8, "PageBlobHeader layout is part of the cache format");
+static_assert(sizeof(PageBlobElement) == 12, "PageBlobElement layout is part of the cache format");
+static_assert(sizeof(PageBlobWord) == 6, "PageBlobWord layout is part of the cache format");
+
+class Page;
+
+// Read-only page rendered directly from its serialized blob.
+// The buffer is kept between loads, so turning pages doesn't allocate once it has grown to the largest page.
+class PageView {
+ public:
+  // Reads one serialized page at the current file position. Returns false on a corrupt or truncated blob.
+  // recordSpan is the distance to the next record when known (from the page LUT); the page is then read
+  // with a single read() instead of reading its size first.
+  bool load(FsFile& file, uint32_t recordSpan = 0);
+  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset, bool black = true,
+              int monoFontId = 0) const;
+  // Rebuild element objects, e.g. for a page that's still being laid out
+  std::unique_ptr<Page> toPage() const;
+  bool isLoaded() const { return loaded_; }
+  uint16_t elementCount() const { return loaded_ ? header()->elementCount : 0; }
+  bool hasImages() const;
+  size_t blobSize() const { return size_; }
+  uint8_t readCalls() const { return readCalls_; }  // read() calls made by the last load
+  // Free the buffer when leaving the reader
+  void release();
+
+ private:
+  // The buffer holds the whole record, size prefix included
+  static constexpr size_t PREFIX_SIZE = sizeof(uint32_t);
+  const uint8_t* blob() const { return buffer_.data() + PREFIX_SIZE; }
+  const PageBlobHeader* header() const { return reinterpret_cast<const PageBlobHeader*>(blob()); }
+  const PageBlobElement* elements() const {
+    return reinterpret_cast<const PageBlobElement*>(blob() + sizeof(PageBlobHeader));
+  }
+  const PageBlobWord* words() const {
+    return reinterpret_cast<const PageBlobWord*>(blob() + sizeof(PageBlobHeader) +
+                                                 header()->elementCount * sizeof(PageBlobElement));
+  }
+  const char* pool() const { return reinterpret_cast<const char*>(words() + header()->wordCount); }
+  bool validate() const;
+
+  std::vector<uint8_t> buffer_;
+  size_t size_ = 0;
+  uint8_t readCalls_ = 0;
+  bool loaded_ = false;
 };
 
 class Page {
@@ -1,16 +1,15 @@
 #include "ParsedText.h"
 
 #include <GfxRenderer.h>
+#include <Serialization.h>
 #include <Utf8.h>
 
 #include <algorithm>
-#include <cmath>
+#include <cstring>
 #include <functional>
 #include <vector>
 
-// Knuth-Plass algorithm constants
-constexpr float INFINITY_PENALTY = 10000.0f;
-constexpr float LINE_PENALTY = 50.0f;
+#include "KnuthPlass.h"
 
 // Soft hyphen (U+00AD) as UTF-8 bytes
 constexpr unsigned char SOFT_HYPHEN_BYTE1 = 0xC2;
@@ -30,6 +29,16 @@ std::vector<size_t> findSoftHyphenPositions(const std::string& word) {
   return positions;
 }
 
+bool containsSoftHyphen(const char* word, size_t len) {
+  for (size_t i = 0; i + 1 < len; ++i) {
+    if (static_cast<unsigned char>(word[i]) == SOFT_HYPHEN_BYTE1 &&
+        static_cast<unsigned char>(word[i + 1]) == SOFT_HYPHEN_BYTE2) {
+      return true;
+    }
+  }
+  return false;
+}
+
 // Remove all soft hyphens from a string
 std::string stripSoftHyphens(const std::string& word) {
   std::string result;
@@ -79,34 +88,26 @@ bool isCjkCodepoint(uint32_t cp) {
   return false;
 }
 
-// Knuth-Plass: Calculate badness (looseness) of a line
-// Returns cubic ratio penalty - loose lines are penalized more heavily
-float calculateBadness(int lineWidth, int targetWidth) {
-  if (targetWidth <= 0) return INFINITY_PENALTY;
-  if (lineWidth > targetWidth) return INFINITY_PENALTY;
-  if (lineWidth == targetWidth) return 0.0f;
-  float ratio = static_cast<float>(targetWidth - lineWidth) / static_cast<float>(targetWidth);
-  return ratio * ratio * ratio * 100.0f;
-}
+}  // namespace
 
-// Knuth-Plass: Calculate demerits for a line based on its badness
-// Last line gets 0 demerits (allowed to be loose)
-float calculateDemerits(float badness, bool isLastLine) {
-  if (badness >= INFINITY_PENALTY) return INFINITY_PENALTY;
-  if (isLastLine) return 0.0f;
-  return (1.0f + badness) * (1.0f + badness);
+void ParsedText::appendWord(std::vector<WordSlice>& slices, const char* word, size_t len,
+                            const EpdFontFamily::Style fontStyle) {
+  if (len > UINT16_MAX) len = UINT16_MAX;
+  slices.push_back({static_cast<uint32_t>(wordBytes.size()), static_cast<uint16_t>(len), fontStyle});
+  wordBytes.insert(wordBytes.end(), word, word + len);
+  wordBytes.push_back('\0');
 }
 
-}  // namespace
-
-void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle) {
-  if (word.empty()) return;
+void ParsedText::addWord(const char* word, const size_t len, const EpdFontFamily::Style fontStyle) {
+  if (len == 0) return;
 
   // Check if word contains any CJK characters
   bool hasCjk = false;
-  const unsigned char* check = reinterpret_cast<const unsigned char*>(word.c_str());
+  const auto begin = reinterpret_cast<const unsigned char*>(word);
+  const auto end = begin + len;
+  const unsigned char* check = begin;
   uint32_t cp;
-  while ((cp = utf8NextCodepoint(&check))) {
+  while (check < end && (cp = utf8NextCodepoint(&check))) {
     if (isCjkCodepoint(cp)) {
       hasCjk = true;
       break;
@@ -115,63 +116,93 @@ void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle)
 
   if (!hasCjk) {
     // No CJK - keep as single word (Latin, accented Latin, Cyrillic, etc.)
-    words.push_back(std::move(word));
-    wordStyles.push_back(fontStyle);
+    appendWord(words, word, len, fontStyle);
     return;
   }
 
   // Mixed content: group non-CJK runs together, split CJK individually
-  const unsigned char* p = reinterpret_cast<const unsigned char*>(word.c_str());
-  std::string nonCjkBuf;
+  const unsigned char* p = begin;
+  const unsigned char* runStart = begin;
+
+  while (p < end) {
+    const unsigned char* charStart = p;
+    if (!(cp = utf8NextCodepoint(&p))) break;
+    if (p > end) p = end;
 
-  while ((cp = utf8NextCodepoint(&p))) {
     if (isCjkCodepoint(cp)) {
-      // CJK character - flush non-CJK buffer first, then add this char alone
-      if (!nonCjkBuf.empty()) {
-        words.push_back(std::move(nonCjkBuf));
-        wordStyles.push_back(fontStyle);
-        nonCjkBuf.clear();
+      // CJK character - flush non-CJK run first, then add this char alone
+      if (charStart > runStart) {
+        appendWord(words, reinterpret_cast<const char*>(runStart), charStart - runStart, fontStyle);
       }
+      appendWord(words, reinterpret_cast<const char*>(charStart), p - charStart, fontStyle);
+      runStart = p;
+    }
+  }
 
-      // Re-encode CJK codepoint to UTF-8
-      std::string buf;
-      if (cp < 0x10000) {
-        buf += static_cast<char>(0xE0 | (cp >> 12));
-        buf += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
-        buf += static_cast<char>(0x80 | (cp & 0x3F));
-      } else {
-        buf += static_cast<char>(0xF0 | (cp >> 18));
-        buf += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
-        buf += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
-        buf += static_cast<char>(0x80 | (cp & 0x3F));
-      }
-      words.push_back(buf);
-      wordStyles.push_back(fontStyle);
-    } else {
-      // Non-CJK character - accumulate into buffer
-      if (cp < 0x80) {
-        nonCjkBuf += static_cast<char>(cp);
-      } else if (cp < 0x800) {
-        nonCjkBuf += static_cast<char>(0xC0 | (cp >> 6));
-        nonCjkBuf += static_cast<char>(0x80 | (cp & 0x3F));
-      } else if (cp < 0x10000) {
-        nonCjkBuf += static_cast<char>(0xE0 | (cp >> 12));
-        nonCjkBuf += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
-        nonCjkBuf += static_cast<char>(0x80 | (cp & 0x3F));
-      } else {
-        nonCjkBuf += static_cast<char>(0xF0 | (cp >> 18));
-        nonCjkBuf += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
-        nonCjkBuf += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
-        nonCjkBuf += static_cast<char>(0x80 | (cp & 0x3F));
-      }
+  // Flush any remaining non-CJK run
+  if (p > runStart) {
+    appendWord(words, reinterpret_cast<const char*>(runStart), p - runStart, fontStyle);
+  }
+}
+
+bool ParsedText::serialize(FsFile& file) const {
+  const uint8_t flags = (hyphenationEnabled ? 0x01 : 0) | (useGreedyBreaking ? 0x02 : 0) | (useMonospace ? 0x04 : 0) |
+                        (indentApplied ? 0x08 : 0);
+  if (!serialization::writePodChecked(file, static_cast<uint8_t>(style)) ||
+      !serialization::writePodChecked(file, indentLevel) || !serialization::writePodChecked(file, flags) ||
+      !serialization::writePodChecked(file, static_cast<uint32_t>(words.size()))) {
+    return false;
+  }
+
+  for (const auto& w : words) {
+    if (!serialization::writePodChecked(file, static_cast<uint32_t>(w.len)) ||
+        file.write(reinterpret_cast<const uint8_t*>(wordText(w)), w.len) != w.len) {
+      return false;
     }
   }
+  for (const auto& w : words) {
+    if (!serialization::writePodChecked(file, w.style)) {
+      return false;
+    }
+  }
+  return true;
+}
 
-  // Flush any remaining non-CJK buffer
-  if (!nonCjkBuf.empty()) {
-    words.push_back(std::move(nonCjkBuf));
-    wordStyles.push_back(fontStyle);
+std::unique_ptr<ParsedText> ParsedText::deserialize(FsFile& file) {
+  uint8_t blockStyle;
+  uint8_t indent;
+  uint8_t flags;
+  uint32_t count;
+  if (!serialization::readPodChecked(file, blockStyle) || !serialization::readPodChecked(file, indent) ||
+      !serialization::readPodChecked(file, flags) || !serialization::readPodChecked(file, count)) {
+    return nullptr;
   }
+
+  // Same bound as TextBlock - a checkpointed paragraph is at most a few pages of words
+  if (count > 10000) {
+    Serial.printf("[%lu] [PT] Deserialization failed: word count %u exceeds maximum\n", millis(), count);
+    return nullptr;
+  }
+
+  auto text = std::unique_ptr<ParsedText>(new ParsedText(static_cast<TextBlock::BLOCK_STYLE>(blockStyle & 0x03),
+                                                         indent, (flags & 0x01) != 0, (flags & 0x02) != 0));
+  text->useMonospace = (flags & 0x04) != 0;
+  text->indentApplied = (flags & 0x08) != 0;
+
+  text->words.reserve(count);
+  std::string w;
+  for (uint32_t i = 0; i < count; i++) {
+    if (!serialization::readString(file, w)) {
+      return nullptr;
+    }
+    text->appendWord(text->words, w.data(), w.size(), EpdFontFamily::REGULAR);
+  }
+  for (auto& slice : text->words) {
+    if (!serialization::readPodChecked(file, slice.style)) {
+      return nullptr;
+    }
+  }
+  return text;
 }
 
 // Consumes data to minimize memory usage
@@ -179,7 +210,7 @@ void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle)
 bool ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fontId, const int monoFontId,
                                        const uint16_t viewportWidth,
                                        const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                                       const bool includeLastLine, const AbortCallback& shouldAbort) {
+                                       const bool paragraphComplete, const AbortCallback& shouldAbort) {
   if (words.empty()) {
     return true;
   }
@@ -209,27 +240,54 @@ bool ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fo
   }
 
   const auto wordWidths = calculateWordWidths(renderer, effectiveFontId);
-  const auto lineBreakIndices = useGreedyBreaking
-                                    ? computeLineBreaksGreedy(pageWidth, spaceWidth, wordWidths, shouldAbort)
-                                    : computeLineBreaks(pageWidth, spaceWidth, wordWidths, shouldAbort);
+  const auto lineBreakIndices =
+      useGreedyBreaking ? computeLineBreaksGreedy(pageWidth, spaceWidth, wordWidths, shouldAbort)
+                        : computeLineBreaks(pageWidth, spaceWidth, wordWidths, paragraphComplete, shouldAbort);
 
   // Check if we were aborted during line break computation
   if (shouldAbort && shouldAbort()) {
     return false;
   }
 
-  const size_t lineCount = includeLastLine ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
+  // Both break lists end with the words' end; unless the paragraph is complete that last line is still open
+  if (lineBreakIndices.empty()) {
+    return true;
+  }
+  const size_t lineCount = paragraphComplete ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
 
   for (size_t i = 0; i < lineCount; ++i) {
     // Check for abort periodically during line extraction
     if (shouldAbort && (i % 50 == 0) && shouldAbort()) {
+      dropWords(i > 0 ? lineBreakIndices[i - 1] : 0);
       return false;
     }
     extractLine(i, pageWidth, spaceWidth, wordWidths, lineBreakIndices, processLine);
   }
+  dropWords(lineCount > 0 ? lineBreakIndices[lineCount - 1] : 0);
   return true;
 }
 
+// Release words already extracted into lines. The arena is kept for the rest of the paragraph,
+// compacted to the remaining words so long paragraphs laid out in parts don't accumulate text.
+void ParsedText::dropWords(const size_t count) {
+  if (count == 0) return;
+  if (count >= words.size()) {
+    words.clear();
+    wordBytes.clear();
+    return;
+  }
+
+  std::vector<char> remainingBytes;
+  std::vector<WordSlice> remaining;
+  remaining.reserve(words.size() - count);
+  for (size_t i = count; i < words.size(); i++) {
+    remaining.push_back({static_cast<uint32_t>(remainingBytes.size()), words[i].len, words[i].style});
+    remainingBytes.insert(remainingBytes.end(), wordText(words[i]), wordText(words[i]) + words[i].len + 1);
+  }
+  words = std::move(remaining);
+  wordBytes = std::move(remainingBytes);
+}
+
 std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const int fontId) {
   const size_t totalWordCount = words.size();
 
@@ -237,36 +295,53 @@ std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& rendere
   wordWidths.reserve(totalWordCount);
 
   // Add indentation at the beginning of first word in paragraph
-  // Skip for monospace/pre blocks which preserve exact whitespace
-  if (indentLevel > 0 && !words.empty() && !useMonospace) {
-    std::string& first_word = words.front();
+  // Skip for monospace/pre blocks which preserve exact whitespace, and on later streaming passes: the
+  // first word keeps its indent until its line is emitted, even when a pass emits no lines at all
+  if (indentLevel > 0 && !words.empty() && !useMonospace && !indentApplied) {
+    const char* indent;
     switch (indentLevel) {
       case 2:  // Normal - em-space (U+2003)
-        first_word.insert(0, "\xe2\x80\x83");
+        indent = "\xe2\x80\x83";
         break;
       case 3:  // Large - em-space + en-space (U+2003 + U+2002)
-        first_word.insert(0, "\xe2\x80\x83\xe2\x80\x82");
+        indent = "\xe2\x80\x83\xe2\x80\x82";
         break;
       default:  // Fallback for unexpected values: single en-space (U+2002)
-        first_word.insert(0, "\xe2\x80\x82");
+        indent = "\xe2\x80\x82";
         break;
     }
+    // Re-home the first word at the end of the arena with the indent in front
+    const size_t indentLen = strlen(indent);
+    WordSlice& first = words.front();
+    const size_t indentedLen = std::min<size_t>(indentLen + first.len, UINT16_MAX);
+    const uint32_t offset = wordBytes.size();
+    wordBytes.resize(offset + indentedLen + 1);
+    memcpy(wordBytes.data() + offset, indent, indentLen);
+    memcpy(wordBytes.data() + offset + indentLen, wordBytes.data() + first.offset, indentedLen - indentLen);
+    wordBytes[offset + indentedLen] = '\0';
+    first.offset = offset;
+    first.len = static_cast<uint16_t>(indentedLen);
+    indentApplied = true;
   }
 
-  auto wordsIt = words.begin();
-  auto wordStylesIt = wordStyles.begin();
-
-  while (wordsIt != words.end()) {
-    // Strip soft hyphens before measuring (they should be invisible)
+  for (auto& word : words) {
+    // Strip soft hyphens in place before measuring (they should be invisible)
     // After preSplitOversizedWords, words shouldn't contain soft hyphens,
     // but we strip here for safety and for when hyphenation is disabled
-    std::string displayWord = stripSoftHyphens(*wordsIt);
-    wordWidths.push_back(renderer.getTextWidth(fontId, displayWord.c_str(), *wordStylesIt));
-    // Update the word in the list with the stripped version for rendering
-    *wordsIt = std::move(displayWord);
+    char* text = wordBytes.data() + word.offset;
+    size_t out = 0;
+    for (size_t i = 0; i < word.len; i++) {
+      if (i + 1 < word.len && static_cast<unsigned char>(text[i]) == SOFT_HYPHEN_BYTE1 &&
+          static_cast<unsigned char>(text[i + 1]) == SOFT_HYPHEN_BYTE2) {
+        i++;  // Skip soft hyphen
+        continue;
+      }
+      text[out++] = text[i];
+    }
+    text[out] = '\0';
+    word.len = static_cast<uint16_t>(out);
 
-    std::advance(wordsIt, 1);
-    std::advance(wordStylesIt, 1);
+    wordWidths.push_back(renderer.getTextWidth(fontId, text, word.style));
   }
 
   return wordWidths;
@@ -274,73 +349,9 @@ std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& rendere
 
 std::vector<size_t> ParsedText::computeLineBreaks(const int pageWidth, const int spaceWidth,
                                                   const std::vector<uint16_t>& wordWidths,
+                                                  const bool paragraphComplete,
                                                   const AbortCallback& shouldAbort) const {
-  const size_t n = words.size();
-
-  if (n == 0) {
-    return {};
-  }
-
-  // Forward DP: minDemerits[i] = minimum demerits to reach position i (before word i)
-  std::vector<float> minDemerits(n + 1, INFINITY_PENALTY);
-  std::vector<int> prevBreak(n + 1, -1);
-  minDemerits[0] = 0.0f;
-
-  for (size_t i = 0; i < n; i++) {
-    // Check for abort periodically (every 100 words in outer loop)
-    if (shouldAbort && (i % 100 == 0) && shouldAbort()) {
-      return {};  // Return empty to signal abort
-    }
-
-    if (minDemerits[i] >= INFINITY_PENALTY) continue;
-
-    int lineWidth = -spaceWidth;  // First word won't have preceding space
-    for (size_t j = i; j < n; j++) {
-      lineWidth += wordWidths[j] + spaceWidth;
-
-      if (lineWidth > pageWidth) {
-        if (j == i) {
-          // Oversized word: force onto its own line with high penalty
-          float demerits = 100.0f + LINE_PENALTY;
-          if (minDemerits[i] + demerits < minDemerits[j + 1]) {
-            minDemerits[j + 1] = minDemerits[i] + demerits;
-            prevBreak[j + 1] = static_cast<int>(i);
-          }
-        }
-        break;
-      }
-
-      bool isLastLine = (j == n - 1);
-      float badness = calculateBadness(lineWidth, pageWidth);
-      float demerits = calculateDemerits(badness, isLastLine) + LINE_PENALTY;
-
-      if (minDemerits[i] + demerits < minDemerits[j + 1]) {
-        minDemerits[j + 1] = minDemerits[i] + demerits;
-        prevBreak[j + 1] = static_cast<int>(i);
-      }
-    }
-  }
-
-  // Backtrack to reconstruct line break indices
-  std::vector<size_t> lineBreakIndices;
-  int pos = static_cast<int>(n);
-  while (pos > 0 && prevBreak[pos] >= 0) {
-    lineBreakIndices.push_back(static_cast<size_t>(pos));
-    pos = prevBreak[pos];
-  }
-  std::reverse(lineBreakIndices.begin(), lineBreakIndices.end());
-
-  // Fallback: if backtracking failed or chain is incomplete, use single-word-per-line
-  // After the loop, pos should be 0 if we successfully traced back to the start.
-  // If pos > 0, the chain is incomplete (no valid path from position 0 to n).
-  if (lineBreakIndices.empty() || pos != 0) {
-    lineBreakIndices.clear();
-    for (size_t i = 1; i <= n; i++) {
-      lineBreakIndices.push_back(i);
-    }
-  }
-
-  return lineBreakIndices;
+  return KnuthPlass(pageWidth, spaceWidth).breakLines(wordWidths, shouldAbort, paragraphComplete);
 }
 
 std::vector<size_t> ParsedText::computeLineBreaksGreedy(const int pageWidth, const int spaceWidth,
@@ -416,55 +427,52 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
     xpos = (spareSpace - (lineWordCount - 1) * spaceWidth) / 2;
   }
 
-  // Build WordData vector directly, consuming from front of lists
+  // Copy the line's words into one shared buffer; WordData refers to slices of it
+  size_t lineBytes = 0;
+  for (size_t i = lastBreakAt; i < lineBreak; i++) {
+    lineBytes += words[i].len + 1;
+  }
+  std::string lineText;
+  lineText.reserve(std::min<size_t>(lineBytes, UINT16_MAX));
   std::vector<TextBlock::WordData> lineData;
   lineData.reserve(lineWordCount);
 
-  auto wordIt = words.begin();
-  auto styleIt = wordStyles.begin();
   for (size_t i = lastBreakAt; i < lineBreak; i++) {
-    const uint16_t currentWordWidth = wordWidths[i];
-    lineData.push_back({std::move(*wordIt), xpos, *styleIt});
-    xpos += currentWordWidth + spacing;
-    ++wordIt;
-    ++styleIt;
+    const WordSlice& word = words[i];
+    if (lineText.size() + word.len + 1 > UINT16_MAX) break;  // Offsets are 16-bit
+    lineData.push_back({static_cast<uint16_t>(lineText.size()), xpos, word.style});
+    lineText.append(wordText(word), word.len + 1);
+    xpos += wordWidths[i] + spacing;
   }
 
-  // Remove consumed elements from lists
-  words.erase(words.begin(), wordIt);
-  wordStyles.erase(wordStyles.begin(), styleIt);
-
-  processLine(std::make_shared<TextBlock>(std::move(lineData), style, useMonospace));
+  processLine(std::make_shared<TextBlock>(std::move(lineText), std::move(lineData), style, useMonospace));
 }
 
 bool ParsedText::hardWrapMonospaceLines(const GfxRenderer& renderer, const int fontId, const int pageWidth,
                                         const AbortCallback& shouldAbort) {
-
-  std::list<std::string> newWords;
-  std::list<EpdFontFamily::Style> newStyles;
-
-  auto wordIt = words.begin();
-  auto styleIt = wordStyles.begin();
+  // Lines that fit keep their arena slices; split lines append their chunks to the arena
+  std::vector<WordSlice> newWords;
+  newWords.reserve(words.size());
   size_t wordCount = 0;
 
-  while (wordIt != words.end()) {
+  for (const WordSlice& slice : words) {
     // Check for abort periodically
     if (shouldAbort && (++wordCount % 50 == 0) && shouldAbort()) {
       return false;
     }
 
-    const std::string& line = *wordIt;
-    const EpdFontFamily::Style lineStyle = *styleIt;
+    const EpdFontFamily::Style lineStyle = slice.style;
 
     // Measure the full line
-    const int lineWidth = renderer.getTextWidth(fontId, line.c_str(), lineStyle);
+    const int lineWidth = renderer.getTextWidth(fontId, wordText(slice), lineStyle);
 
     if (lineWidth <= pageWidth) {
       // Line fits, keep as-is
-      newWords.push_back(line);
-      newStyles.push_back(lineStyle);
+      newWords.push_back(slice);
     } else {
       // Line too wide - split at character boundaries
+      // Copy out first: appending chunks may reallocate the arena
+      const std::string line(wordText(slice), slice.len);
       std::string current;
       int currentWidth = 0;
       const unsigned char* p = reinterpret_cast<const unsigned char*>(line.c_str());
@@ -483,8 +491,7 @@ bool ParsedText::hardWrapMonospaceLines(const GfxRenderer& renderer, const int f
         // Would adding this character overflow?
         if (currentWidth + charWidth > pageWidth && !current.empty()) {
           // Emit current chunk and start new one
-          newWords.push_back(current);
-          newStyles.push_back(lineStyle);
+          appendWord(newWords, current.data(), current.size(), lineStyle);
           current = charStr;
           currentWidth = charWidth;
         } else {
@@ -495,124 +502,110 @@ bool ParsedText::hardWrapMonospaceLines(const GfxRenderer& renderer, const int f
 
       // Emit remaining chunk
       if (!current.empty()) {
-        newWords.push_back(current);
-        newStyles.push_back(lineStyle);
+        appendWord(newWords, current.data(), current.size(), lineStyle);
       }
     }
-
-    ++wordIt;
-    ++styleIt;
   }
 
   words = std::move(newWords);
-  wordStyles = std::move(newStyles);
   return true;
 }
 
 bool ParsedText::preSplitOversizedWords(const GfxRenderer& renderer, const int fontId, const int pageWidth,
                                         const AbortCallback& shouldAbort) {
-  std::list<std::string> newWords;
-  std::list<EpdFontFamily::Style> newStyles;
-
-  auto wordIt = words.begin();
-  auto styleIt = wordStyles.begin();
+  // Words that fit keep their arena slices; split words append their pieces to the arena
+  std::vector<WordSlice> newWords;
+  newWords.reserve(words.size());
   size_t wordCount = 0;
 
-  while (wordIt != words.end()) {
+  for (const WordSlice& slice : words) {
     // Check for abort periodically (every 50 words)
     if (shouldAbort && (++wordCount % 50 == 0) && shouldAbort()) {
       return false;  // Aborted
     }
 
-    const std::string& word = *wordIt;
-    const EpdFontFamily::Style wordStyle = *styleIt;
+    const EpdFontFamily::Style wordStyle = slice.style;
+    const char* text = wordText(slice);
 
     // Measure word without soft hyphens
-    const std::string stripped = stripSoftHyphens(word);
-    const int wordWidth = renderer.getTextWidth(fontId, stripped.c_str(), wordStyle);
+    const int wordWidth = containsSoftHyphen(text, slice.len)
+                              ? renderer.getTextWidth(fontId, stripSoftHyphens(text).c_str(), wordStyle)
+                              : renderer.getTextWidth(fontId, text, wordStyle);
 
     if (wordWidth <= pageWidth) {
       // Word fits, keep as-is (will be stripped later in calculateWordWidths)
-      newWords.push_back(word);
-      newStyles.push_back(wordStyle);
+      newWords.push_back(slice);
+      continue;
+    }
+
+    // Word is too wide - copy it out first, appending pieces may reallocate the arena
+    const std::string word(text, slice.len);
+    auto shyPositions = findSoftHyphenPositions(word);
+
+    if (shyPositions.empty()) {
+      // No soft hyphens - use GfxRenderer's hard hyphenation helper
+      auto chunks = renderer.breakWordWithHyphenation(fontId, word.c_str(), pageWidth, wordStyle);
+      for (const auto& chunk : chunks) {
+        appendWord(newWords, chunk.data(), chunk.size(), wordStyle);
+      }
     } else {
-      // Word is too wide - try to split at soft hyphen positions
-      auto shyPositions = findSoftHyphenPositions(word);
-
-      if (shyPositions.empty()) {
-        // No soft hyphens - use GfxRenderer's hard hyphenation helper
-        auto chunks = renderer.breakWordWithHyphenation(fontId, word.c_str(), pageWidth, wordStyle);
-        for (const auto& chunk : chunks) {
-          newWords.push_back(chunk);
-          newStyles.push_back(wordStyle);
+      // Split word at soft hyphen positions
+      std::string remaining = word;
+      size_t splitIterations = 0;
+      constexpr size_t MAX_SPLIT_ITERATIONS = 100;  // Safety limit
+
+      while (splitIterations++ < MAX_SPLIT_ITERATIONS) {
+        if (splitIterations == MAX_SPLIT_ITERATIONS) {
+          Serial.printf("[PT] Warning: hit max split iterations for oversized word\n");
         }
-      } else {
-        // Split word at soft hyphen positions
-        std::string remaining = word;
-        size_t splitIterations = 0;
-        constexpr size_t MAX_SPLIT_ITERATIONS = 100;  // Safety limit
-
-        while (splitIterations++ < MAX_SPLIT_ITERATIONS) {
-          if (splitIterations == MAX_SPLIT_ITERATIONS) {
-            Serial.printf("[PT] Warning: hit max split iterations for oversized word\n");
-          }
-          const std::string strippedRemaining = stripSoftHyphens(remaining);
-          const int remainingWidth = renderer.getTextWidth(fontId, strippedRemaining.c_str(), wordStyle);
+        const std::string strippedRemaining = stripSoftHyphens(remaining);
+        const int remainingWidth = renderer.getTextWidth(fontId, strippedRemaining.c_str(), wordStyle);
 
-          if (remainingWidth <= pageWidth) {
-            // Remaining part fits, add it and done
-            newWords.push_back(remaining);
-            newStyles.push_back(wordStyle);
-            break;
-          }
-
-          // Find soft hyphen positions in remaining string
-          auto localPositions = findSoftHyphenPositions(remaining);
-          if (localPositions.empty()) {
-            // No more soft hyphens, output as-is
-            newWords.push_back(remaining);
-            newStyles.push_back(wordStyle);
-            break;
-          }
+        if (remainingWidth <= pageWidth) {
+          // Remaining part fits, add it and done
+          appendWord(newWords, remaining.data(), remaining.size(), wordStyle);
+          break;
+        }
 
-          // Find the rightmost soft hyphen where prefix + hyphen fits
-          int bestPos = -1;
-          for (int i = static_cast<int>(localPositions.size()) - 1; i >= 0; --i) {
-            std::string prefix = getWordPrefix(remaining, localPositions[i]);
-            int prefixWidth = renderer.getTextWidth(fontId, prefix.c_str(), wordStyle);
-            if (prefixWidth <= pageWidth) {
-              bestPos = i;
-              break;
-            }
-          }
+        // Find soft hyphen positions in remaining string
+        auto localPositions = findSoftHyphenPositions(remaining);
+        if (localPositions.empty()) {
+          // No more soft hyphens, output as-is
+          appendWord(newWords, remaining.data(), remaining.size(), wordStyle);
+          break;
+        }
 
-          if (bestPos < 0) {
-            // Even the smallest prefix is too wide - output as-is
-            newWords.push_back(remaining);
-            newStyles.push_back(wordStyle);
+        // Find the rightmost soft hyphen where prefix + hyphen fits
+        int bestPos = -1;
+        for (int i = static_cast<int>(localPositions.size()) - 1; i >= 0; --i) {
+          std::string prefix = getWordPrefix(remaining, localPositions[i]);
+          int prefixWidth = renderer.getTextWidth(fontId, prefix.c_str(), wordStyle);
+          if (prefixWidth <= pageWidth) {
+            bestPos = i;
             break;
           }
+        }
 
-          // Split at this position
-          std::string prefix = getWordPrefix(remaining, localPositions[bestPos]);
-          std::string suffix = getWordSuffix(remaining, localPositions[bestPos]);
+        if (bestPos < 0) {
+          // Even the smallest prefix is too wide - output as-is
+          appendWord(newWords, remaining.data(), remaining.size(), wordStyle);
+          break;
+        }
 
-          newWords.push_back(prefix);  // Already includes visible hyphen "-"
-          newStyles.push_back(wordStyle);
+        // Split at this position
+        std::string prefix = getWordPrefix(remaining, localPositions[bestPos]);
+        std::string suffix = getWordSuffix(remaining, localPositions[bestPos]);
 
-          if (suffix.empty()) {
-            break;
-          }
-          remaining = suffix;
+        appendWord(newWords, prefix.data(), prefix.size(), wordStyle);  // Already includes visible hyphen "-"
+
+        if (suffix.empty()) {
+          break;
         }
+        remaining = suffix;
       }
     }
-
-    ++wordIt;
-    ++styleIt;
   }
 
   words = std::move(newWords);
-  wordStyles = std::move(newStyles);
   return true;
 }
@@ -2,8 +2,8 @@
 
 #include <EpdFontFamily.h>
 
+#include <cstring>
 #include <functional>
-#include <list>
 #include <memory>
 #include <string>
 #include <vector>
@@ -19,22 +19,32 @@ class GfxRenderer;
 using AbortCallback = std::function<bool()>;
 
 class ParsedText {
-  std::list<std::string> words;
-  std::list<EpdFontFamily::Style> wordStyles;
+  // Word text lives in a paragraph-scoped bump arena, NUL-terminated so slices can be measured and drawn in place
+  struct WordSlice {
+    uint32_t offset;  // Into wordBytes
+    uint16_t len;
+    EpdFontFamily::Style style;
+  };
+  std::vector<char> wordBytes;
+  std::vector<WordSlice> words;
   TextBlock::BLOCK_STYLE style;
   uint8_t indentLevel;
   bool hyphenationEnabled;
-  bool useGreedyBreaking = true;  // Default to greedy to avoid Knuth-Plass memory spike
-  bool useMonospace = false;      // Use monospace font for this block (e.g., <pre>)
+  bool useGreedyBreaking = false;  // Knuth-Plass runs in bounded memory, see KnuthPlass.h
+  bool useMonospace = false;       // Use monospace font for this block (e.g., <pre>)
+  bool indentApplied = false;      // First word already carries the first-line indent
 
   std::vector<size_t> computeLineBreaks(int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths,
-                                        const AbortCallback& shouldAbort = nullptr) const;
+                                        bool paragraphComplete, const AbortCallback& shouldAbort = nullptr) const;
   std::vector<size_t> computeLineBreaksGreedy(int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths,
                                               const AbortCallback& shouldAbort = nullptr) const;
   void extractLine(size_t breakIndex, int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths,
                    const std::vector<size_t>& lineBreakIndices,
                    const std::function<void(std::shared_ptr<TextBlock>)>& processLine);
   std::vector<uint16_t> calculateWordWidths(const GfxRenderer& renderer, int fontId);
+  void appendWord(std::vector<WordSlice>& slices, const char* word, size_t len, EpdFontFamily::Style fontStyle);
+  const char* wordText(const WordSlice& slice) const { return wordBytes.data() + slice.offset; }
+  void dropWords(size_t count);
   bool preSplitOversizedWords(const GfxRenderer& renderer, int fontId, int pageWidth,
                               const AbortCallback& shouldAbort = nullptr);
   bool hardWrapMonospaceLines(const GfxRenderer& renderer, int fontId, int pageWidth,
@@ -46,14 +56,25 @@ class ParsedText {
       : style(style), indentLevel(indentLevel), hyphenationEnabled(hyphenationEnabled), useGreedyBreaking(useGreedy) {}
   ~ParsedText() = default;
 
-  void addWord(std::string word, EpdFontFamily::Style fontStyle);
+  void addWord(const char* word, size_t len, EpdFontFamily::Style fontStyle);
+  void addWord(const char* word, const EpdFontFamily::Style fontStyle) { addWord(word, strlen(word), fontStyle); }
+  void addWord(const std::string& word, const EpdFontFamily::Style fontStyle) {
+    addWord(word.data(), word.size(), fontStyle);
+  }
   void setStyle(const TextBlock::BLOCK_STYLE style) { this->style = style; }
   void setUseGreedyBreaking(const bool greedy) { useGreedyBreaking = greedy; }
   void setUseMonospace(const bool mono) { useMonospace = mono; }
   TextBlock::BLOCK_STYLE getStyle() const { return style; }
   size_t size() const { return words.size(); }
   bool isEmpty() const { return words.empty(); }
+  // Checkpoint support: persists words not yet laid out so parsing can resume later
+  bool serialize(FsFile& file) const;
+  static std::unique_ptr<ParsedText> deserialize(FsFile& file);
+  // Words parsers buffer before laying out the lines that are already final
+  static constexpr size_t STREAM_LAYOUT_WORDS = 200;
+  // With paragraphComplete false more words will follow: only lines they can't change are emitted (all
+  // but the last for greedy breaking, the breaks every Knuth-Plass candidate shares) and the rest stay buffered
   bool layoutAndExtractLines(const GfxRenderer& renderer, int fontId, int monoFontId, uint16_t viewportWidth,
                              const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                             bool includeLastLine = true, const AbortCallback& shouldAbort = nullptr);
+                             bool paragraphComplete = true, const AbortCallback& shouldAbort = nullptr);
 };
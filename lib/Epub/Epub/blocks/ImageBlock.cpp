@@ -3,10 +3,15 @@
 #include <Bitmap.h>
 #include <GfxRenderer.h>
 #include <HardwareSerial.h>
+#include <PackedImage.h>
 #include <SDCardManager.h>
-#include <Serialization.h>
 
 void ImageBlock::render(GfxRenderer& renderer, const int fontId, const int x, const int y) const {
+  renderBmp(renderer, fontId, cachedBmpPath.c_str(), width, height, x, y);
+}
+
+void ImageBlock::renderBmp(GfxRenderer& renderer, const int fontId, const char* cachedBmpPath, const uint16_t width,
+                           const uint16_t height, const int x, const int y) {
   auto renderPlaceholder = [&]() {
     const char* placeholder = "[Image]";
     const int textWidth = renderer.getTextWidth(fontId, placeholder);
@@ -16,14 +21,25 @@ void ImageBlock::render(GfxRenderer& renderer, const int fontId, const int x, co
     renderer.drawText(fontId, textX, textY, placeholder, true);
   };
 
-  if (cachedBmpPath.empty()) {
+  if (cachedBmpPath[0] == '\0') {
     renderPlaceholder();
     return;
   }
 
+  // Panel-ready copy written when the image was cached; older caches only have the BMP
+  const std::string packedPath = PackedImage::pathFor(cachedBmpPath);
+  if (SdMan.exists(packedPath.c_str())) {
+    FsFile packedFile;
+    if (SdMan.openFileForRead("IMB", packedPath, packedFile)) {
+      const bool drawn = renderer.drawPackedImage(packedFile, x, y);
+      packedFile.close();
+      if (drawn) return;
+    }
+  }
+
   FsFile bmpFile;
   if (!SdMan.openFileForRead("IMB", cachedBmpPath, bmpFile)) {
-    Serial.printf("[%lu] [IMB] Failed to open cached BMP: %s\n", millis(), cachedBmpPath.c_str());
+    Serial.printf("[%lu] [IMB] Failed to open cached BMP: %s\n", millis(), cachedBmpPath);
     renderPlaceholder();
     return;
   }
@@ -40,29 +56,3 @@ void ImageBlock::render(GfxRenderer& renderer, const int fontId, const int x, co
   renderer.drawBitmap(bitmap, x, y, width, height);
   bmpFile.close();
 }
-
-bool ImageBlock::serialize(FsFile& file) const {
-  serialization::writeString(file, cachedBmpPath);
-  serialization::writePod(file, width);
-  serialization::writePod(file, height);
-  return true;
-}
-
-std::unique_ptr<ImageBlock> ImageBlock::deserialize(FsFile& file) {
-  std::string path;
-  uint16_t w, h;
-
-  if (!serialization::readString(file, path) || !serialization::readPodChecked(file, w) ||
-      !serialization::readPodChecked(file, h)) {
-    Serial.printf("[%lu] [IMB] Deserialization failed: couldn't read data\n", millis());
-    return nullptr;
-  }
-
-  // Sanity check: prevent unreasonable dimensions from corrupted data
-  if (w > 2000 || h > 2000) {
-    Serial.printf("[%lu] [IMB] Deserialization failed: dimensions %ux%u exceed maximum\n", millis(), w, h);
-    return nullptr;
-  }
-
-  return std::unique_ptr<ImageBlock>(new ImageBlock(std::move(path), w, h));
-}
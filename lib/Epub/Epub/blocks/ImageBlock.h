@@ -28,6 +28,7 @@ class ImageBlock final : public Block {
   const std::string& getCachedBmpPath() const { return cachedBmpPath; }
 
   void render(GfxRenderer& renderer, int fontId, int x, int y) const;
-  bool serialize(FsFile& file) const;
-  static std::unique_ptr<ImageBlock> deserialize(FsFile& file);
+  // Draw a cached BMP at its laid-out size, or an "[Image]" placeholder if it can't be read
+  static void renderBmp(GfxRenderer& renderer, int fontId, const char* cachedBmpPath, uint16_t width, uint16_t height,
+                        int x, int y);
 };
@@ -18,34 +18,37 @@ class TextBlock final : public Block {
     RIGHT_ALIGN = 3,
   };
 
-  // Flags stored in high bits of serialized style byte
+  // Flags stored in high bits of the serialized style byte
   static constexpr uint8_t FLAG_MONOSPACE = 0x04;
 
+  // A word is a slice of the shared line text
   struct WordData {
-    std::string word;
+    uint16_t offset;  // Start of the NUL-terminated word in text
     uint16_t xPos;
     EpdFontFamily::Style style;
   };
 
  private:
+  std::string text;  // All words of the line, each followed by a NUL
   std::vector<WordData> wordData;
   BLOCK_STYLE style;
   bool useMonospace = false;
 
  public:
-  explicit TextBlock(std::vector<WordData> data, const BLOCK_STYLE style, const bool useMonospace = false)
-      : wordData(std::move(data)), style(style), useMonospace(useMonospace) {}
+  explicit TextBlock(std::string text, std::vector<WordData> data, const BLOCK_STYLE style,
+                     const bool useMonospace = false)
+      : text(std::move(text)), wordData(std::move(data)), style(style), useMonospace(useMonospace) {}
   ~TextBlock() override = default;
   void setStyle(const BLOCK_STYLE style) { this->style = style; }
   BLOCK_STYLE getStyle() const { return style; }
   void setUseMonospace(const bool mono) { useMonospace = mono; }
   bool getUseMonospace() const { return useMonospace; }
+  const std::string& getText() const { return text; }
+  const std::vector<WordData>& getWordData() const { return wordData; }
   bool isEmpty() override { return wordData.empty(); }
   void layout(GfxRenderer& renderer) override {};
   // given a renderer works out where to break the words into lines
   // monoFontId is used when useMonospace is true (0 = use regular fontId)
   void render(const GfxRenderer& renderer, int fontId, int x, int y, bool black = true, int monoFontId = 0) const;
   BlockType getType() override { return TEXT_BLOCK; }
-  bool serialize(FsFile& file) const;
-  static std::unique_ptr<TextBlock> deserialize(FsFile& file);
 };
@@ -2,6 +2,9 @@
 
 #include <HardwareSerial.h>
 #include <SDCardManager.h>
+#include <Serialization.h>
+
+#include "CssTokenizer.h"
 
 #include <cctype>
 #include <cmath>
@@ -33,6 +36,39 @@ std::string toLower(const std::string& str) {
   return result;
 }
 
+// Style cache: version, rule count, then per rule the selector string and a fixed record
+constexpr uint8_t STYLE_CACHE_VERSION = 1;
+constexpr uint32_t MAX_CACHED_RULES = 8192;
+
+enum StyleCacheFlags : uint8_t {
+  HAS_TEXT_ALIGN = 1 << 0,
+  HAS_FONT_STYLE = 1 << 1,
+  HAS_FONT_WEIGHT = 1 << 2,
+  HAS_TEXT_INDENT = 1 << 3,
+  HAS_MARGIN_TOP = 1 << 4,
+  HAS_MARGIN_BOTTOM = 1 << 5,
+};
+
+// Print sink feeding a CssTokenizer as stylesheet bytes are written
+class TokenizerSink final : public Print {
+ public:
+  explicit TokenizerSink(CssTokenizer& tokenizer) : tokenizer_(tokenizer) {}
+
+  size_t write(const uint8_t c) override {
+    const char ch = static_cast<char>(c);
+    tokenizer_.feed(&ch, 1);
+    return 1;
+  }
+
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    tokenizer_.feed(reinterpret_cast<const char*>(buffer), size);
+    return size;
+  }
+
+ private:
+  CssTokenizer& tokenizer_;
+};
+
 }  // namespace
 
 CssParser::CssParser() {}
@@ -46,143 +82,49 @@ bool CssParser::parseFile(const char* filepath) {
     return false;
   }
 
-  std::string selector;
-  std::string properties;
-  bool inComment = false;
-  bool inAtRule = false;
-  bool inRule = false;
-  bool inString = false;
-  char stringQuote = 0;
-  int braceCount = 0;
-
-  int pushback = -1;
-  while (file.available() || pushback != -1) {
-    char c;
-    if (pushback != -1) {
-      c = static_cast<char>(pushback);
-      pushback = -1;
-    } else {
-      c = static_cast<char>(file.read());
-    }
-
-    // Handle comment start '/*'
-    if (!inComment && c == '/') {
-      int next = -1;
-      if (file.available()) next = file.read();
-      if (next == '*') {
-        inComment = true;
-        continue;
-      }
-      if (next != -1) pushback = next;
-    }
-
-    if (inComment) {
-      if (c == '*') {
-        int next = -1;
-        if (file.available()) next = file.read();
-        if (next == '/') {
-          inComment = false;
-        } else if (next != -1) {
-          pushback = next;
+  const bool ok = parseStream(
+      [&file](Print& out) {
+        uint8_t block[PARSE_BLOCK_SIZE];
+        int n;
+        while ((n = file.read(block, sizeof(block))) > 0) {
+          out.write(block, n);
         }
-      }
-      continue;
-    }
-
-    // Ignore carriage returns
-    if (c == '\r') continue;
-
-    if (!inRule) {
-      // Handle AT-rules
-      if (inAtRule) {
-        if (c == '{') {
-          braceCount++;
-        } else if (c == '}') {
-          if (braceCount > 0) {
-            braceCount--;
-            if (braceCount == 0) {
-              inAtRule = false;
-            }
-          }
-        } else if (c == ';' && braceCount == 0) {
-          inAtRule = false;
-        }
-        continue;
-      }
-
-      if (c == '@') {
-        inAtRule = true;
-        braceCount = 0;
-        continue;
-      }
-
-      if (c == '{') {
-        inRule = true;
-        braceCount = 1;
-        selector = trim(selector);
-        properties.clear();
-        continue;
-      }
-
-      selector += c;
-    } else {
-      // Inside declaration block
-      if (!inString && (c == '"' || c == '\'')) {
-        inString = true;
-        stringQuote = c;
-        properties += c;
-        continue;
-      } else if (inString && c == stringQuote) {
-        inString = false;
-        stringQuote = 0;
-        properties += c;
-        continue;
-      }
-
-      if (!inString) {
-        if (c == '{') {
-          braceCount++;
-          properties += c;
-          continue;
-        } else if (c == '}') {
-          braceCount--;
-          if (braceCount == 0) {
-            properties = trim(properties);
-            if (!selector.empty() && !properties.empty()) {
-              parseRule(selector, properties);
-            }
-            selector.clear();
-            properties.clear();
-            inRule = false;
-            continue;
-          }
-        }
-      }
-
-      properties += c;
-    }
-  }
+        return n == 0;
+      },
+      filepath);
+  file.close();
+  return ok;
+}
 
-  // Handle incomplete rule at EOF
-  if (inRule && !properties.empty()) {
-    properties = trim(properties);
-    selector = trim(selector);
-    if (!selector.empty()) {
-      parseRule(selector, properties);
+bool CssParser::parseStream(const std::function<bool(Print&)>& writeFn, const char* name) {
+  // Rules from earlier stylesheets only live in the compiled table; reopen them so later sheets merge in
+  selectorTable_.forEachSelector([this](const std::string& selector, const CssStyle& style) {
+    styleMap_.emplace(selector, style);
+  });
+
+  CssTokenizer tokenizer([this](const std::string& selector, const std::string& properties) {
+    const std::string trimmedSelector = trim(selector);
+    const std::string trimmedProperties = trim(properties);
+    if (!trimmedSelector.empty() && !trimmedProperties.empty()) {
+      parseRule(trimmedSelector, trimmedProperties);
     }
+  });
+  TokenizerSink sink(tokenizer);
+  const bool ok = writeFn(sink);
+  tokenizer.finish();
+
+  selectorTable_.build(styleMap_);
+  styleMap_.clear();
+  if (!ok) {
+    Serial.printf("[%lu] [CSS] Failed to read %s\n", millis(), name);
+    return false;
   }
-
-  file.close();
-  Serial.printf("[%lu] [CSS] Loaded %d style rules from %s\n", millis(), static_cast<int>(styleMap_.size()), filepath);
+  Serial.printf("[%lu] [CSS] Loaded %d style rules from %s\n", millis(), static_cast<int>(getStyleCount()), name);
   return true;
 }
 
 const CssStyle* CssParser::getStyleForClass(const std::string& className) const {
-  auto it = styleMap_.find(className);
-  if (it != styleMap_.end()) {
-    return &it->second;
-  }
-  return nullptr;
+  return selectorTable_.findStyle(className);
 }
 
 CssStyle CssParser::getTagStyle(const std::string& tagName) const {
@@ -194,52 +136,100 @@ CssStyle CssParser::getTagStyle(const std::string& tagName) const {
   return combined;
 }
 
-CssStyle CssParser::getCombinedStyle(const std::string& tagName, const std::string& classNames) const {
-  CssStyle combined;
-
-  // First apply tag-level styles
-  const CssStyle* tagStyle = getStyleForClass(tagName);
-  if (tagStyle) {
-    combined.merge(*tagStyle);
+// Saved from the compiled table: selectors it dropped (descendant, pseudo-class, ...) could never match anyway
+bool CssParser::saveToCache(const std::string& cachePath) const {
+  const std::string tmpPath = cachePath + ".tmp";
+  FsFile file;
+  if (!SdMan.openFileForWrite("CSS", tmpPath, file)) {
+    return false;
   }
 
-  // Split class names by whitespace and apply each
-  size_t start = 0;
-  size_t len = classNames.length();
-
-  while (start < len) {
-    // Skip whitespace
-    while (start < len && std::isspace(static_cast<unsigned char>(classNames[start]))) {
-      ++start;
-    }
-    if (start >= len) break;
+  const uint32_t count = selectorTable_.selectorCount();
+  size_t expectedSize = sizeof(STYLE_CACHE_VERSION) + sizeof(count);
+  serialization::writePod(file, STYLE_CACHE_VERSION);
+  serialization::writePod(file, count);
+  selectorTable_.forEachSelector([&file, &expectedSize](const std::string& selector, const CssStyle& style) {
+    const uint8_t flags = (style.hasTextAlign ? HAS_TEXT_ALIGN : 0) | (style.hasFontStyle ? HAS_FONT_STYLE : 0) |
+                          (style.hasFontWeight ? HAS_FONT_WEIGHT : 0) | (style.hasTextIndent ? HAS_TEXT_INDENT : 0) |
+                          (style.hasMarginTop ? HAS_MARGIN_TOP : 0) | (style.hasMarginBottom ? HAS_MARGIN_BOTTOM : 0);
+    const uint8_t enums[3] = {static_cast<uint8_t>(style.textAlign), static_cast<uint8_t>(style.fontStyle),
+                              static_cast<uint8_t>(style.fontWeight)};
+    const int16_t margins[2] = {static_cast<int16_t>(style.marginTop), static_cast<int16_t>(style.marginBottom)};
+    serialization::writeString(file, selector);
+    serialization::writePod(file, flags);
+    serialization::writePod(file, enums);
+    serialization::writePod(file, style.textIndent);
+    serialization::writePod(file, margins);
+    expectedSize += sizeof(uint32_t) + selector.size() + sizeof(flags) + sizeof(enums) + sizeof(style.textIndent) +
+                    sizeof(margins);
+  });
+  // The serialization writers don't report short writes, so check what actually reached the card
+  bool ok = file.size() == expectedSize;
+  file.close();
 
-    // Find end of class name
-    size_t end = start;
-    while (end < len && !std::isspace(static_cast<unsigned char>(classNames[end]))) {
-      ++end;
+  if (ok) {
+    if (SdMan.exists(cachePath.c_str())) {
+      SdMan.remove(cachePath.c_str());
     }
+    ok = SdMan.rename(tmpPath.c_str(), cachePath.c_str());
+  }
+  if (!ok) {
+    Serial.printf("[%lu] [CSS] Failed to write style cache %s\n", millis(), cachePath.c_str());
+    SdMan.remove(tmpPath.c_str());
+  }
+  return ok;
+}
 
-    if (end > start) {
-      std::string className = classNames.substr(start, end - start);
+bool CssParser::loadFromCache(const std::string& cachePath) {
+  clear();
+  FsFile file;
+  if (!SdMan.openFileForRead("CSS", cachePath, file)) {
+    return false;
+  }
 
-      // Try class-only selector (.classname)
-      const CssStyle* classOnly = getStyleForClass("." + className);
-      if (classOnly) {
-        combined.merge(*classOnly);
-      }
+  uint8_t version = 0;
+  uint32_t count = 0;
+  if (!serialization::readPodChecked(file, version) || version != STYLE_CACHE_VERSION ||
+      !serialization::readPodChecked(file, count) || count > MAX_CACHED_RULES) {
+    Serial.printf("[%lu] [CSS] Style cache version mismatch or corrupt: %s\n", millis(), cachePath.c_str());
+    file.close();
+    return false;
+  }
 
-      // Try tag.class selector (p.classname)
-      const CssStyle* tagAndClass = getStyleForClass(tagName + "." + className);
-      if (tagAndClass) {
-        combined.merge(*tagAndClass);
-      }
+  std::string selector;
+  for (uint32_t i = 0; i < count; i++) {
+    uint8_t flags;
+    uint8_t enums[3];
+    float textIndent;
+    int16_t margins[2];
+    if (!serialization::readString(file, selector) || !serialization::readPodChecked(file, flags) ||
+        !serialization::readPodChecked(file, enums) || !serialization::readPodChecked(file, textIndent) ||
+        !serialization::readPodChecked(file, margins) || enums[0] > static_cast<uint8_t>(TextAlign::Justify) ||
+        enums[1] > static_cast<uint8_t>(CssFontStyle::Italic) || enums[2] > static_cast<uint8_t>(CssFontWeight::Bold)) {
+      Serial.printf("[%lu] [CSS] Style cache truncated at rule %u: %s\n", millis(), i, cachePath.c_str());
+      styleMap_.clear();
+      file.close();
+      return false;
     }
 
-    start = end;
+    CssStyle& style = styleMap_[selector];
+    style.textAlign = static_cast<TextAlign>(enums[0]);
+    style.hasTextAlign = flags & HAS_TEXT_ALIGN;
+    style.fontStyle = static_cast<CssFontStyle>(enums[1]);
+    style.hasFontStyle = flags & HAS_FONT_STYLE;
+    style.fontWeight = static_cast<CssFontWeight>(enums[2]);
+    style.hasFontWeight = flags & HAS_FONT_WEIGHT;
+    style.textIndent = textIndent;
+    style.hasTextIndent = flags & HAS_TEXT_INDENT;
+    style.marginTop = margins[0];
+    style.hasMarginTop = flags & HAS_MARGIN_TOP;
+    style.marginBottom = margins[1];
+    style.hasMarginBottom = flags & HAS_MARGIN_BOTTOM;
   }
-
-  return combined;
+  file.close();
+  selectorTable_.build(styleMap_);
+  styleMap_.clear();
+  return true;
 }
 
 void CssParser::parseRule(const std::string& selector, const std::string& properties) {
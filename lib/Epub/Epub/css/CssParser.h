@@ -1,9 +1,13 @@
 #pragma once
 
+#include <Print.h>
+
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "CssSelectorTable.h"
 #include "CssStyle.h"
 
 /**
@@ -32,6 +36,13 @@ class CssParser {
    */
   bool parseFile(const char* filepath);
 
+  /**
+   * Parse a stylesheet that writeFn pushes into the given Print, e.g. straight out of the EPUB
+   * with Epub::readItemContentsToStream, and add its rules to the style map.
+   * Returns false if writeFn fails (rules seen before the failure are kept)
+   */
+  bool parseStream(const std::function<bool(Print&)>& writeFn, const char* name);
+
   /**
    * Get the style for a given selector (class or tag)
    * Returns nullptr if no style is defined
@@ -47,7 +58,14 @@ class CssParser {
    * Get the combined style for a tag with multiple class names (space-separated)
    * Styles are merged in order, later classes override earlier ones
    */
-  CssStyle getCombinedStyle(const std::string& tagName, const std::string& classNames) const;
+  CssStyle getCombinedStyle(const std::string& tagName, const std::string& classNames) const {
+    return selectorTable_.getCombinedStyle(tagName.c_str(), classNames.c_str());
+  }
+
+  /**
+   * Compiled selectors for allocation-free lookups (rebuilt after each parseFile / loadFromCache)
+   */
+  const CssSelectorTable& getSelectorTable() const { return selectorTable_; }
 
   /**
    * Parse an inline style attribute (e.g., "text-align: center; font-weight: bold;")
@@ -56,11 +74,28 @@ class CssParser {
    */
   static CssStyle parseInlineStyle(const std::string& styleAttr);
 
-  bool hasStyles() const { return !styleMap_.empty(); }
-  size_t getStyleCount() const { return styleMap_.size(); }
-  void clear() { styleMap_.clear(); }
+  /**
+   * Write the compiled style table to a versioned cache file (atomically, via a .tmp rename)
+   * Returns false on any write failure
+   */
+  bool saveToCache(const std::string& cachePath) const;
+
+  /**
+   * Replace the style table with one saved by saveToCache()
+   * Returns false (leaving the map empty) if the file is missing, from another version or corrupt
+   */
+  bool loadFromCache(const std::string& cachePath);
+
+  bool hasStyles() const { return !selectorTable_.empty(); }
+  size_t getStyleCount() const { return selectorTable_.selectorCount(); }
+  void clear() {
+    styleMap_.clear();
+    selectorTable_.clear();
+  }
 
  private:
+  static constexpr size_t PARSE_BLOCK_SIZE = 512;
+
   void parseRule(const std::string& selector, const std::string& properties);
   static void parseProperty(const std::string& name, const std::string& value, CssStyle& style);
   static TextAlign parseTextAlign(const std::string& value);
@@ -69,5 +104,7 @@ class CssParser {
   static float parseTextIndent(const std::string& value);
   static int parseMargin(const std::string& value);
 
+  // Rules by selector text while a stylesheet or cache is read; released once compiled into selectorTable_
   std::map<std::string, CssStyle> styleMap_;
+  CssSelectorTable selectorTable_;
 };
@@ -0,0 +1,180 @@
+#include "CssSelectorTable.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace {
+
+bool isSpace(const char c) { return std::isspace(static_cast<unsigned char>(c)); }
+
+}  // namespace
+
+void CssSelectorTable::build(const std::map<std::string, CssStyle>& styleMap) {
+  clear();
+
+  // Split selectors into tag and class parts; anything else (descendant, pseudo, id) can never match
+  struct Split {
+    std::string tag;
+    std::string cls;
+    const CssStyle* style;
+  };
+  std::vector<Split> split;
+  std::vector<std::string> names;
+  split.reserve(styleMap.size());
+  for (const auto& entry : styleMap) {
+    const std::string& selector = entry.first;
+    if (std::any_of(selector.begin(), selector.end(), isSpace)) continue;
+
+    const size_t dot = selector.find('.');
+    Split s = {selector.substr(0, dot), dot == std::string::npos ? "" : selector.substr(dot + 1), &entry.second};
+    if ((dot != std::string::npos && s.cls.empty()) || (s.tag.empty() && s.cls.empty())) continue;
+    if (s.tag.size() > UINT8_MAX || s.cls.size() > UINT8_MAX) continue;
+    if (!s.tag.empty()) names.push_back(s.tag);
+    if (!s.cls.empty()) names.push_back(s.cls);
+    split.push_back(std::move(s));
+  }
+
+  std::sort(names.begin(), names.end());
+  names.erase(std::unique(names.begin(), names.end()), names.end());
+  if (names.size() >= NO_NAME) names.resize(NO_NAME - 1);
+
+  size_t poolSize = 0;
+  for (const auto& name : names) poolSize += name.size();
+  namePool_.reserve(poolSize);
+  names_.reserve(names.size());
+  for (const auto& name : names) {
+    names_.push_back({static_cast<uint32_t>(namePool_.size()), static_cast<uint8_t>(name.size())});
+    namePool_.insert(namePool_.end(), name.begin(), name.end());
+  }
+
+  selectors_.reserve(split.size());
+  for (const auto& s : split) {
+    const uint16_t tagId = s.tag.empty() ? NO_NAME : findName(s.tag.data(), s.tag.size());
+    const uint16_t classId = s.cls.empty() ? NO_NAME : findName(s.cls.data(), s.cls.size());
+    if ((!s.tag.empty() && tagId == NO_NAME) || (!s.cls.empty() && classId == NO_NAME)) continue;
+    selectors_.push_back({makeKey(tagId, classId), *s.style});
+  }
+  std::sort(selectors_.begin(), selectors_.end(),
+            [](const CompiledSelector& a, const CompiledSelector& b) { return a.key < b.key; });
+}
+
+void CssSelectorTable::clear() {
+  std::vector<char>().swap(namePool_);
+  std::vector<NameRef>().swap(names_);
+  std::vector<CompiledSelector>().swap(selectors_);
+}
+
+int CssSelectorTable::compareName(const NameRef& ref, const char* name, const size_t length) const {
+  const int cmp = memcmp(namePool_.data() + ref.offset, name, std::min<size_t>(ref.length, length));
+  if (cmp != 0) return cmp;
+  return ref.length < length ? -1 : (ref.length > length ? 1 : 0);
+}
+
+uint16_t CssSelectorTable::findName(const char* name, const size_t length) const {
+  size_t lo = 0;
+  size_t hi = names_.size();
+  while (lo < hi) {
+    const size_t mid = (lo + hi) / 2;
+    const int cmp = compareName(names_[mid], name, length);
+    if (cmp == 0) return static_cast<uint16_t>(mid);
+    if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return NO_NAME;
+}
+
+const CssStyle* CssSelectorTable::findSelector(const uint16_t tagId, const uint16_t classId) const {
+  const uint32_t key = makeKey(tagId, classId);
+  const auto it = std::lower_bound(selectors_.begin(), selectors_.end(), key,
+                                   [](const CompiledSelector& s, const uint32_t k) { return s.key < k; });
+  return it != selectors_.end() && it->key == key ? &it->style : nullptr;
+}
+
+const CssStyle* CssSelectorTable::findStyle(const std::string& selector) const {
+  const size_t dot = selector.find('.');
+  const size_t tagLength = dot == std::string::npos ? selector.size() : dot;
+  const uint16_t tagId = tagLength == 0 ? NO_NAME : findName(selector.data(), tagLength);
+  const uint16_t classId =
+      dot == std::string::npos ? NO_NAME : findName(selector.data() + dot + 1, selector.size() - dot - 1);
+  if ((tagLength != 0 && tagId == NO_NAME) || (dot != std::string::npos && classId == NO_NAME)) return nullptr;
+  return findSelector(tagId, classId);
+}
+
+void CssSelectorTable::forEachSelector(const std::function<void(const std::string&, const CssStyle&)>& fn) const {
+  std::string selector;
+  for (const auto& compiled : selectors_) {
+    const uint16_t tagId = compiled.key >> 16;
+    const uint16_t classId = compiled.key & 0xFFFF;
+    selector.clear();
+    if (tagId != NO_NAME) selector.append(namePool_.data() + names_[tagId].offset, names_[tagId].length);
+    if (classId != NO_NAME) {
+      selector += '.';
+      selector.append(namePool_.data() + names_[classId].offset, names_[classId].length);
+    }
+    fn(selector, compiled.style);
+  }
+}
+
+CssStyle CssSelectorTable::getCombinedStyle(const char* tagName, const char* classAttr) const {
+  CssStyle combined;
+  if (selectors_.empty() || !tagName) return combined;
+
+  // First apply tag-level styles
+  const uint16_t tagId = findName(tagName, strlen(tagName));
+  if (tagId != NO_NAME) {
+    if (const CssStyle* tagStyle = findSelector(tagId, NO_NAME)) combined.merge(*tagStyle);
+  }
+  if (!classAttr) return combined;
+
+  // Then each class in attribute order: ".class", then "tag.class"
+  const char* p = classAttr;
+  while (*p) {
+    while (*p && isSpace(*p)) ++p;
+    const char* start = p;
+    while (*p && !isSpace(*p)) ++p;
+    if (p == start) continue;
+
+    const uint16_t classId = findName(start, p - start);
+    if (classId == NO_NAME) continue;
+    if (const CssStyle* classOnly = findSelector(NO_NAME, classId)) combined.merge(*classOnly);
+    if (tagId != NO_NAME) {
+      if (const CssStyle* tagAndClass = findSelector(tagId, classId)) combined.merge(*tagAndClass);
+    }
+  }
+  return combined;
+}
+
+CssStyle CssStyleMemo::getCombinedStyle(const CssSelectorTable& table, const char* tagName, const char* classAttr) {
+  if (!tagName) return CssStyle();
+  if (!classAttr) classAttr = "";
+  const size_t tagLength = strlen(tagName);
+  const size_t classLength = strlen(classAttr);
+  if (tagLength + classLength > KEY_SIZE) {
+    return table.getCombinedStyle(tagName, classAttr);
+  }
+
+  // FNV-1a over tag, separator, class attribute
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < tagLength; i++) hash = (hash ^ static_cast<uint8_t>(tagName[i])) * 16777619u;
+  hash = (hash ^ 0xFF) * 16777619u;
+  for (size_t i = 0; i < classLength; i++) hash = (hash ^ static_cast<uint8_t>(classAttr[i])) * 16777619u;
+
+  if (slots_.empty()) slots_.resize(SLOT_COUNT);
+  Slot& slot = slots_[hash % SLOT_COUNT];
+  if (slot.hash == hash && slot.tagLength == tagLength && slot.keyLength == tagLength + classLength &&
+      memcmp(slot.key, tagName, tagLength) == 0 && memcmp(slot.key + tagLength, classAttr, classLength) == 0) {
+    return slot.style;
+  }
+
+  slot.style = table.getCombinedStyle(tagName, classAttr);
+  slot.hash = hash;
+  slot.tagLength = static_cast<uint8_t>(tagLength);
+  slot.keyLength = static_cast<uint8_t>(tagLength + classLength);
+  memcpy(slot.key, tagName, tagLength);
+  memcpy(slot.key + tagLength, classAttr, classLength);
+  return slot.style;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "CssStyle.h"
+
+/**
+ * CssSelectorTable - Compiled form of CssParser's style map for per-element lookups
+ *
+ * Tag and class names are interned once into a sorted name table; each selector becomes a
+ * (tagId, classId) key in a sorted array. Lookups take the tag name and class attribute as
+ * plain character spans, so matching an element allocates nothing.
+ *
+ * Matches the same selectors as the string map did: "tag", ".class" and "tag.class".
+ */
+class CssSelectorTable {
+ public:
+  /**
+   * Rebuild from a parsed style map (selector text -> style)
+   */
+  void build(const std::map<std::string, CssStyle>& styleMap);
+  void clear();
+  bool empty() const { return selectors_.empty(); }
+  size_t selectorCount() const { return selectors_.size(); }
+
+  /**
+   * Combined style for a tag with a whitespace-separated class attribute:
+   * tag rule first, then for each class in order ".class" then "tag.class"
+   */
+  CssStyle getCombinedStyle(const char* tagName, const char* classAttr) const;
+
+  /**
+   * Style of a single "tag", ".class" or "tag.class" selector, nullptr if it has none
+   */
+  const CssStyle* findStyle(const std::string& selector) const;
+
+  /**
+   * Calls fn with the selector text and style of every compiled rule, so the table can be saved or
+   * merged into without keeping the style map it was built from
+   */
+  void forEachSelector(const std::function<void(const std::string&, const CssStyle&)>& fn) const;
+
+ private:
+  static constexpr uint16_t NO_NAME = 0xFFFF;
+
+  struct NameRef {
+    uint32_t offset;  // Into namePool_
+    uint8_t length;
+  };
+
+  struct CompiledSelector {
+    uint32_t key;  // tagId << 16 | classId
+    CssStyle style;
+  };
+
+  static uint32_t makeKey(uint16_t tagId, uint16_t classId) { return static_cast<uint32_t>(tagId) << 16 | classId; }
+  int compareName(const NameRef& ref, const char* name, size_t length) const;
+  uint16_t findName(const char* name, size_t length) const;
+  const CssStyle* findSelector(uint16_t tagId, uint16_t classId) const;
+
+  std::vector<char> namePool_;
+  std::vector<NameRef> names_;               // Sorted by name
+  std::vector<CompiledSelector> selectors_;  // Sorted by key
+};
+
+/**
+ * CssStyleMemo - Per-chapter cache of (tag, class attribute) -> combined style
+ *
+ * Chapters repeat a handful of tag/class combinations thousands of times. Slots are direct-mapped
+ * by hash and allocated on first use; keys too long for a slot are looked up in the table each time.
+ */
+class CssStyleMemo {
+ public:
+  CssStyle getCombinedStyle(const CssSelectorTable& table, const char* tagName, const char* classAttr);
+  void clear() { std::vector<Slot>().swap(slots_); }
+
+ private:
+  static constexpr size_t SLOT_COUNT = 32;
+  static constexpr size_t KEY_SIZE = 46;
+
+  struct Slot {
+    uint32_t hash;
+    uint8_t tagLength;
+    uint8_t keyLength;   // 0 = empty
+    char key[KEY_SIZE];  // Tag name then class attribute, not terminated
+    CssStyle style;
+  };
+
+  std::vector<Slot> slots_;
+};
@@ -0,0 +1,121 @@
+#include "CssTokenizer.h"
+
+void CssTokenizer::feed(const char* data, const size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    put(data[i]);
+  }
+}
+
+void CssTokenizer::finish() {
+  if (pendingSlash_) {
+    pendingSlash_ = false;
+    token('/');
+  }
+
+  // Handle incomplete rule at EOF
+  if (inRule_ && !properties_.empty()) {
+    onRule_(selector_, properties_);
+  }
+
+  selector_.clear();
+  properties_.clear();
+  pendingStar_ = false;
+  inComment_ = false;
+  inAtRule_ = false;
+  inRule_ = false;
+  inString_ = false;
+  stringQuote_ = 0;
+  braceCount_ = 0;
+}
+
+void CssTokenizer::put(const char c) {
+  if (inComment_) {
+    if (pendingStar_) {
+      pendingStar_ = false;
+      if (c == '/') {
+        inComment_ = false;
+        return;
+      }
+    }
+    if (c == '*') pendingStar_ = true;
+    return;
+  }
+
+  // Comment start '/*'; a lone '/' is ordinary input
+  if (pendingSlash_) {
+    pendingSlash_ = false;
+    if (c == '*') {
+      inComment_ = true;
+      return;
+    }
+    token('/');
+  }
+  if (c == '/') {
+    pendingSlash_ = true;
+    return;
+  }
+
+  token(c);
+}
+
+void CssTokenizer::token(const char c) {
+  // Ignore carriage returns
+  if (c == '\r') return;
+
+  if (!inRule_) {
+    // Handle AT-rules
+    if (inAtRule_) {
+      if (c == '{') {
+        braceCount_++;
+      } else if (c == '}') {
+        if (braceCount_ > 0) {
+          braceCount_--;
+          if (braceCount_ == 0) {
+            inAtRule_ = false;
+          }
+        }
+      } else if (c == ';' && braceCount_ == 0) {
+        inAtRule_ = false;
+      }
+      return;
+    }
+
+    if (c == '@') {
+      inAtRule_ = true;
+      braceCount_ = 0;
+      return;
+    }
+
+    if (c == '{') {
+      inRule_ = true;
+      braceCount_ = 1;
+      properties_.clear();
+      return;
+    }
+
+    selector_ += c;
+    return;
+  }
+
+  // Inside declaration block
+  if (!inString_ && (c == '"' || c == '\'')) {
+    inString_ = true;
+    stringQuote_ = c;
+  } else if (inString_ && c == stringQuote_) {
+    inString_ = false;
+    stringQuote_ = 0;
+  } else if (!inString_ && c == '{') {
+    braceCount_++;
+  } else if (!inString_ && c == '}') {
+    braceCount_--;
+    if (braceCount_ == 0) {
+      onRule_(selector_, properties_);
+      selector_.clear();
+      properties_.clear();
+      inRule_ = false;
+      return;
+    }
+  }
+
+  properties_ += c;
+}
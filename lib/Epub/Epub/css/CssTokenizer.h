@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+/**
+ * CssTokenizer - Streaming rule splitter for CssParser
+ *
+ * Consumes stylesheet bytes in blocks of any size and reports each top-level rule as
+ * (selector, declaration block), untrimmed. Comments, at-rules (including nested @media
+ * blocks) and carriage returns are dropped; quoted strings in declarations are kept intact.
+ * All state lives in the tokenizer, so a comment or rule may span block boundaries.
+ */
+class CssTokenizer {
+ public:
+  using RuleFn = std::function<void(const std::string& selector, const std::string& properties)>;
+
+  explicit CssTokenizer(RuleFn onRule) : onRule_(std::move(onRule)) {}
+
+  void feed(const char* data, size_t length);
+
+  /**
+   * End of input: flushes a trailing '/' and a rule left open at EOF
+   */
+  void finish();
+
+ private:
+  void put(char c);
+  void token(char c);
+
+  RuleFn onRule_;
+  std::string selector_;
+  std::string properties_;
+  bool pendingSlash_ = false;  // '/' seen outside a comment, next byte decides
+  bool pendingStar_ = false;   // '*' seen inside a comment, next byte decides
+  bool inComment_ = false;
+  bool inAtRule_ = false;
+  bool inRule_ = false;
+  bool inString_ = false;
+  char stringQuote_ = 0;
+  int braceCount_ = 0;
+};
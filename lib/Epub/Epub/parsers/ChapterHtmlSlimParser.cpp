@@ -5,12 +5,17 @@
 #include <GfxRenderer.h>
 #include <HardwareSerial.h>
 #include <ImageConverter.h>
+#include <PackedImage.h>
 #include <SDCardManager.h>
+#include <Serialization.h>
 #include <esp_heap_caps.h>
 #include <expat.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
+#include <algorithm>
+#include <cstring>
+
 #include "../Page.h"
 
 const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
@@ -66,7 +71,7 @@ void ChapterHtmlSlimParser::flushPartWordBuffer() {
   }
 
   partWordBuffer[partWordBufferIndex] = '\0';
-  currentTextBlock->addWord(partWordBuffer, fontStyle);
+  currentTextBlock->addWord(partWordBuffer, partWordBufferIndex, fontStyle);
   partWordBufferIndex = 0;
 }
 
@@ -99,6 +104,17 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     return;
   }
 
+  // Track open elements by name so a checkpoint can re-open them on resume.
+  // The root start tag ends the prolog that gets replayed verbatim.
+  if (self->elementStack_.empty() && self->prolog_.empty()) {
+    const uint32_t prologEnd = self->currentInputEnd();
+    if (prologEnd <= self->head_.size()) {
+      self->prolog_.assign(self->head_, 0, prologEnd);
+    }
+    std::string().swap(self->head_);
+  }
+  self->elementStack_.emplace_back(name);
+
   // Middle of skip
   if (self->skipUntilDepth < self->depth) {
     self->depth += 1;
@@ -216,9 +232,9 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     }
   }
 
-  // Extract class and style attributes for CSS lookup
-  std::string classAttr;
-  std::string styleAttr;
+  // Class and style attributes for CSS lookup (pointers into Expat's attribute array)
+  const char* classAttr = "";
+  const char* styleAttr = "";
   if (atts != nullptr) {
     for (int i = 0; atts[i]; i += 2) {
       if (strcmp(atts[i], "class") == 0) {
@@ -229,13 +245,13 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     }
   }
 
-  // Query CSS for combined style (tag + classes + inline)
+  // Query CSS for combined style (tag + classes + inline), memoized per chapter
   CssStyle cssStyle;
-  if (self->cssParser_) {
-    cssStyle = self->cssParser_->getCombinedStyle(name, classAttr);
+  if (self->cssParser_ && self->cssParser_->hasStyles()) {
+    cssStyle = self->cssStyleMemo_.getCombinedStyle(self->cssParser_->getSelectorTable(), name, classAttr);
   }
   // Inline styles override stylesheet rules (static method, no instance needed)
-  if (!styleAttr.empty()) {
+  if (*styleAttr) {
     cssStyle.merge(CssParser::parseInlineStyle(styleAttr));
   }
 
@@ -363,12 +379,9 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
     self->partWordBuffer[self->partWordBufferIndex++] = s[i];
   }
 
-  // If we have > 750 words buffered up, perform the layout and consume out all but the last line
-  // There should be enough here to build out 1-2 full pages and doing this will free up a lot of
-  // memory.
-  // Spotted when reading Intermezzo, there are some really long text blocks in there.
-  if (self->currentTextBlock && self->currentTextBlock->size() > 750) {
-    Serial.printf("[%lu] [EHP] Text block too long, splitting into multiple pages\n", millis());
+  // Long paragraphs stream out: once enough words are buffered, emit the lines later words can't change
+  // so a giant text block (spotted in Intermezzo) doesn't sit in memory before its first page is made
+  if (self->currentTextBlock && self->currentTextBlock->size() >= ParsedText::STREAM_LAYOUT_WORDS) {
     self->currentTextBlock->layoutAndExtractLines(
         self->renderer, self->config.fontId, self->config.monoFontId, self->config.viewportWidth,
         [self](const std::shared_ptr<TextBlock>& textBlock) { self->addLineToPage(textBlock); }, false);
@@ -394,6 +407,9 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
   }
 
   self->depth -= 1;
+  if (!self->elementStack_.empty()) {
+    self->elementStack_.pop_back();
+  }
 
   if (self->skipUntilDepth == self->depth) {
     self->skipUntilDepth = INT_MAX;
@@ -415,6 +431,219 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
   }
 }
 
+void XMLCALL ChapterHtmlSlimParser::startCdata(void* userData) {
+  static_cast<ChapterHtmlSlimParser*>(userData)->inCdata_ = true;
+}
+
+void XMLCALL ChapterHtmlSlimParser::endCdata(void* userData) {
+  static_cast<ChapterHtmlSlimParser*>(userData)->inCdata_ = false;
+}
+
+uint32_t ChapterHtmlSlimParser::currentInputEnd() const {
+  if (!xmlParser_) return stopOffset_;
+  const int64_t index = XML_GetCurrentByteIndex(xmlParser_);
+  if (index < 0) return stopOffset_;
+  return static_cast<uint32_t>(index + XML_GetCurrentByteCount(xmlParser_) + inputBase_);
+}
+
+void ChapterHtmlSlimParser::emitPage(std::unique_ptr<Page> page) {
+  if (stopRequested_) {
+    // Past the page limit - keep the page for the checkpoint instead of dropping it
+    pendingPages_.push_back(std::move(page));
+    return;
+  }
+
+  ++pagesCreated_;
+  if (!completePageFn(std::move(page))) {
+    stopRequested_ = true;
+    if (xmlParser_) {
+      // The current event finishes before Expat stops, so resume right after it
+      stopOffset_ = currentInputEnd();
+      stopInCdata_ = inCdata_;
+      XML_StopParser(xmlParser_, XML_FALSE);
+    }
+  }
+}
+
+bool ChapterHtmlSlimParser::restoreCheckpoint(const XML_Parser parser, FsFile& file) {
+  const std::unique_ptr<ChapterCheckpoint> cp = std::move(resumeFrom_);
+
+  if (streamFn_) {
+    // A resumed stream is restarted by the caller at the checkpoint offset
+    if (cp->inputOffset != sourceOffset_) {
+      Serial.printf("[%lu] [EHP] Stream starts at %u, checkpoint at %u\n", millis(), sourceOffset_, cp->inputOffset);
+      return false;
+    }
+  } else if (cp->inputOffset < sourceOffset_ || cp->inputOffset - sourceOffset_ > file.size()) {
+    Serial.printf("[%lu] [EHP] Checkpoint offset out of range (%u, file %u+%zu)\n", millis(), cp->inputOffset,
+                  sourceOffset_, file.size());
+    return false;
+  }
+
+  if (!cp->openElements.empty()) {
+    // Replay prolog with no handlers set, so XML decl, DOCTYPE and root attributes are restored silently
+    if (cp->prolog.empty() ||
+        XML_Parse(parser, cp->prolog.data(), static_cast<int>(cp->prolog.size()), XML_FALSE) == XML_STATUS_ERROR) {
+      Serial.printf("[%lu] [EHP] Checkpoint prolog replay failed\n", millis());
+      return false;
+    }
+
+    // Re-open the rest of the stack by name; attributes only mattered for the depth markers restored below
+    std::string reopen;
+    for (size_t i = 1; i < cp->openElements.size(); i++) {
+      reopen += '<';
+      reopen += cp->openElements[i];
+      reopen += '>';
+    }
+    if (!reopen.empty() &&
+        XML_Parse(parser, reopen.data(), static_cast<int>(reopen.size()), XML_FALSE) == XML_STATUS_ERROR) {
+      Serial.printf("[%lu] [EHP] Checkpoint element replay failed\n", millis());
+      return false;
+    }
+
+    inputBase_ = static_cast<int64_t>(cp->inputOffset) - static_cast<int64_t>(cp->prolog.size() + reopen.size());
+    if (!streamFn_ && !file.seek(cp->inputOffset - sourceOffset_)) {
+      return false;
+    }
+  }
+
+  elementStack_ = std::move(cp->openElements);
+  depth = static_cast<int>(elementStack_.size());
+  skipUntilDepth = cp->skipUntilDepth;
+  boldUntilDepth = cp->boldUntilDepth;
+  italicUntilDepth = cp->italicUntilDepth;
+  cssBoldUntilDepth = cp->cssBoldUntilDepth;
+  cssItalicUntilDepth = cp->cssItalicUntilDepth;
+  preUntilDepth = cp->preUntilDepth;
+
+  partWordBufferIndex = static_cast<int>(std::min<size_t>(cp->partWord.size(), MAX_WORD_SIZE));
+  memcpy(partWordBuffer, cp->partWord.data(), partWordBufferIndex);
+
+  // After the document ended there's no more text; an empty block would lay out as an extra blank page
+  currentTextBlock = std::move(cp->pendingText);
+  if (!currentTextBlock && !elementStack_.empty()) {
+    startNewTextBlock(static_cast<TextBlock::BLOCK_STYLE>(config.paragraphAlignment));
+  }
+  currentPage = std::move(cp->currentPage);
+  currentPageNextY = cp->currentPageNextY;
+  prolog_ = std::move(cp->prolog);
+  inputPos_ = cp->inputOffset;
+  stopOffset_ = cp->inputOffset;
+
+  // Pages completed past the previous limit go out first
+  for (auto& page : cp->pendingPages) {
+    emitPage(std::move(page));
+  }
+
+  Serial.printf("[%lu] [EHP] Resumed at offset %u, depth %d\n", millis(), cp->inputOffset, depth);
+  return true;
+}
+
+void ChapterHtmlSlimParser::captureCheckpoint() {
+  if (stopInCdata_) {
+    // A CDATA section can't be re-entered by replaying element names
+    Serial.printf("[%lu] [EHP] Stopped inside CDATA, no checkpoint\n", millis());
+    return;
+  }
+  if (!elementStack_.empty() && prolog_.empty()) {
+    Serial.printf("[%lu] [EHP] Prolog exceeds %zu bytes, no checkpoint\n", millis(), MAX_PROLOG_SIZE);
+    return;
+  }
+
+  auto cp = std::unique_ptr<ChapterCheckpoint>(new ChapterCheckpoint());
+  cp->inputOffset = stopOffset_;
+  cp->prolog = prolog_;
+  cp->openElements = std::move(elementStack_);
+  cp->skipUntilDepth = skipUntilDepth;
+  cp->boldUntilDepth = boldUntilDepth;
+  cp->italicUntilDepth = italicUntilDepth;
+  cp->cssBoldUntilDepth = cssBoldUntilDepth;
+  cp->cssItalicUntilDepth = cssItalicUntilDepth;
+  cp->preUntilDepth = preUntilDepth;
+  cp->partWord.assign(partWordBuffer, partWordBufferIndex);
+  cp->pendingText = std::move(currentTextBlock);
+  cp->pendingPages = std::move(pendingPages_);
+  cp->currentPage = std::move(currentPage);
+  cp->currentPageNextY = currentPageNextY;
+  checkpoint_ = std::move(cp);
+}
+
+bool ChapterCheckpoint::serialize(FsFile& file) const {
+  serialization::writePod(file, inputOffset);
+  serialization::writeString(file, prolog);
+  serialization::writePod(file, static_cast<uint16_t>(openElements.size()));
+  for (const auto& name : openElements) serialization::writeString(file, name);
+  serialization::writePod(file, skipUntilDepth);
+  serialization::writePod(file, boldUntilDepth);
+  serialization::writePod(file, italicUntilDepth);
+  serialization::writePod(file, cssBoldUntilDepth);
+  serialization::writePod(file, cssItalicUntilDepth);
+  serialization::writePod(file, preUntilDepth);
+  serialization::writeString(file, partWord);
+
+  serialization::writePod(file, static_cast<uint8_t>(pendingText ? 1 : 0));
+  if (pendingText && !pendingText->serialize(file)) return false;
+
+  serialization::writePod(file, static_cast<uint16_t>(pendingPages.size()));
+  for (const auto& page : pendingPages) {
+    if (!page->serialize(file)) return false;
+  }
+
+  serialization::writePod(file, static_cast<uint8_t>(currentPage ? 1 : 0));
+  if (currentPage && !currentPage->serialize(file)) return false;
+  serialization::writePod(file, currentPageNextY);
+  return true;
+}
+
+std::unique_ptr<ChapterCheckpoint> ChapterCheckpoint::deserialize(FsFile& file) {
+  auto cp = std::unique_ptr<ChapterCheckpoint>(new ChapterCheckpoint());
+  uint16_t elementCount;
+  if (!serialization::readPodChecked(file, cp->inputOffset) || !serialization::readString(file, cp->prolog) ||
+      !serialization::readPodChecked(file, elementCount) || elementCount > MAX_XML_DEPTH) {
+    return nullptr;
+  }
+
+  cp->openElements.resize(elementCount);
+  for (auto& name : cp->openElements) {
+    if (!serialization::readString(file, name)) return nullptr;
+  }
+
+  uint8_t hasText;
+  if (!serialization::readPodChecked(file, cp->skipUntilDepth) ||
+      !serialization::readPodChecked(file, cp->boldUntilDepth) ||
+      !serialization::readPodChecked(file, cp->italicUntilDepth) ||
+      !serialization::readPodChecked(file, cp->cssBoldUntilDepth) ||
+      !serialization::readPodChecked(file, cp->cssItalicUntilDepth) ||
+      !serialization::readPodChecked(file, cp->preUntilDepth) || !serialization::readString(file, cp->partWord) ||
+      !serialization::readPodChecked(file, hasText)) {
+    return nullptr;
+  }
+
+  if (hasText) {
+    cp->pendingText = ParsedText::deserialize(file);
+    if (!cp->pendingText) return nullptr;
+  }
+
+  uint16_t pendingCount;
+  if (!serialization::readPodChecked(file, pendingCount) || pendingCount > 64) {
+    return nullptr;
+  }
+  for (uint16_t i = 0; i < pendingCount; i++) {
+    auto page = Page::deserialize(file);
+    if (!page) return nullptr;
+    cp->pendingPages.push_back(std::move(page));
+  }
+
+  uint8_t hasPage;
+  if (!serialization::readPodChecked(file, hasPage)) return nullptr;
+  if (hasPage) {
+    cp->currentPage = Page::deserialize(file);
+    if (!cp->currentPage) return nullptr;
+  }
+  if (!serialization::readPodChecked(file, cp->currentPageNextY)) return nullptr;
+  return cp;
+}
+
 bool ChapterHtmlSlimParser::shouldAbort() const {
   // Check external abort callback first (cooperative cancellation)
   if (externalAbortCallback_ && externalAbortCallback_()) {
@@ -438,14 +667,129 @@ bool ChapterHtmlSlimParser::shouldAbort() const {
   return false;
 }
 
+// Receives decompressed chapter bytes and hands them to the parser
+class ChapterStreamSink final : public Print {
+  ChapterHtmlSlimParser& parser_;
+
+ public:
+  explicit ChapterStreamSink(ChapterHtmlSlimParser& parser) : parser_(parser) {}
+  size_t write(const uint8_t c) override { return parser_.consumeStream(&c, 1); }
+  size_t write(const uint8_t* buffer, const size_t size) override { return parser_.consumeStream(buffer, size); }
+};
+
+void ChapterHtmlSlimParser::reportProgress(const size_t bytesRead, const size_t totalSize) {
+  // Update progress (call every 10% change to avoid too frequent updates)
+  // Only show progress for larger chapters where rendering overhead is worth it
+  if (progressFn && totalSize >= MIN_SIZE_FOR_PROGRESS) {
+    const int progress = static_cast<int>((bytesRead * 100) / totalSize);
+    if (lastProgress_ / 10 != progress / 10) {
+      lastProgress_ = progress;
+      progressFn(progress);
+    }
+  }
+}
+
+ChapterHtmlSlimParser::FeedResult ChapterHtmlSlimParser::parseChunk(const void* buf, const int len,
+                                                                    const bool isFinal) {
+  // Keep the head of the document until the root start tag shows where the prolog ends
+  if (len > 0 && elementStack_.empty() && prolog_.empty() && head_.size() < MAX_PROLOG_SIZE) {
+    head_.append(static_cast<const char*>(buf), std::min<size_t>(len, MAX_PROLOG_SIZE - head_.size()));
+  }
+  inputPos_ += len;
+
+  if (XML_ParseBuffer(xmlParser_, len, isFinal) != XML_STATUS_ERROR) {
+    return FeedResult::Parsed;
+  }
+  if (stopRequested_ && XML_GetErrorCode(xmlParser_) == XML_ERROR_ABORTED) {
+    return FeedResult::Stopped;  // Page limit reached
+  }
+  Serial.printf("[%lu] [EHP] Parse error at line %lu:\n%s\n", millis(), XML_GetCurrentLineNumber(xmlParser_),
+                XML_ErrorString(XML_GetErrorCode(xmlParser_)));
+  return FeedResult::Failed;
+}
+
+bool ChapterHtmlSlimParser::beginSpill(const uint8_t* data, const size_t len) {
+  if (!SdMan.openFileForWrite("EHP", spillPath_, spillFile_)) {
+    spillFailed_ = true;
+    return false;
+  }
+  spilling_ = true;
+  Serial.printf("[%lu] [EHP] Keeping chapter from offset %u for resume\n", millis(), stopOffset_);
+  if (len > 0 && spillFile_.write(data, len) != len) {
+    spillFailed_ = true;
+    return false;
+  }
+  return true;
+}
+
+size_t ChapterHtmlSlimParser::consumeStream(const uint8_t* data, const size_t len) {
+  if (spilling_) {
+    if (spillFailed_ || spillFile_.write(data, len) != len) {
+      spillFailed_ = true;
+      return 0;
+    }
+    return len;
+  }
+  if (streamFailed_ || aborted_ || stopRequested_) {
+    return 0;
+  }
+
+  size_t pos = 0;
+  while (pos < len) {
+    // Periodic safety check and yield
+    if (++loopCounter_ % YIELD_CHECK_INTERVAL == 0) {
+      if (shouldAbort()) {
+        Serial.printf("[%lu] [EHP] Aborting parse, pages created: %u\n", millis(), pagesCreated_);
+        aborted_ = true;
+        return 0;
+      }
+      vTaskDelay(1);  // Yield to prevent watchdog reset
+    }
+
+    const size_t toFeed = std::min<size_t>(len - pos, 1024);
+    void* const buf = XML_GetBuffer(xmlParser_, static_cast<int>(toFeed));
+    if (!buf) {
+      Serial.printf("[%lu] [EHP] Couldn't allocate memory for buffer\n", millis());
+      streamFailed_ = true;
+      return 0;
+    }
+    memcpy(buf, data + pos, toFeed);
+
+    const uint32_t chunkStart = inputPos_;
+    const FeedResult result = parseChunk(buf, static_cast<int>(toFeed), false);
+    if (result == FeedResult::Failed) {
+      streamFailed_ = true;
+      return 0;
+    }
+    if (result == FeedResult::Stopped) {
+      // Whatever Expat didn't consume is still needed by the next chunk
+      if (spillPath_.empty() || stopOffset_ < chunkStart || stopOffset_ > chunkStart + toFeed) {
+        return 0;
+      }
+      const size_t consumed = stopOffset_ - chunkStart;
+      if (!beginSpill(data + pos + consumed, toFeed - consumed)) {
+        return 0;
+      }
+      pos += toFeed;
+      return consumeStream(data + pos, len - pos) == len - pos ? len : 0;
+    }
+    pos += toFeed;
+  }
+  return len;
+}
+
 bool ChapterHtmlSlimParser::parseAndBuildPages() {
   parseStartTime_ = millis();
   loopCounter_ = 0;
-  startNewTextBlock(static_cast<TextBlock::BLOCK_STYLE>(config.paragraphAlignment));
+  pagesCreated_ = 0;
+  lastProgress_ = -1;
+  aborted_ = false;
+  streamFailed_ = false;
+  spilling_ = false;
+  spillFailed_ = false;
+  checkpoint_.reset();
 
   const XML_Parser parser = XML_ParserCreate(nullptr);
-  xmlParser_ = parser;  // Store for stopping mid-parse
-  int done;
 
   if (!parser) {
     Serial.printf("[%lu] [EHP] Couldn't allocate memory for parser\n", millis());
@@ -453,122 +797,161 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   }
 
   FsFile file;
-  if (!SdMan.openFileForRead("EHP", filepath, file)) {
+  if (!streamFn_ && !SdMan.openFileForRead("EHP", filepath, file)) {
     XML_ParserFree(parser);
     return false;
   }
 
   // Get file size for progress calculation
-  const size_t totalSize = file.size();
-  size_t bytesRead = 0;
-  int lastProgress = -1;
-  pagesCreated_ = 0;
+  const size_t totalSize = streamFn_ ? 0 : file.size();
 
   XML_SetUserData(parser, this);
-  XML_SetElementHandler(parser, startElement, endElement);
-  XML_SetCharacterDataHandler(parser, characterData);
 
-  do {
-    // Periodic safety check and yield
-    if (++loopCounter_ % YIELD_CHECK_INTERVAL == 0) {
-      if (shouldAbort()) {
-        Serial.printf("[%lu] [EHP] Aborting parse, pages created: %u\n", millis(), pagesCreated_);
-        break;
-      }
-      vTaskDelay(1);  // Yield to prevent watchdog reset
-    }
-
-    void* const buf = XML_GetBuffer(parser, 1024);
-    if (!buf) {
-      Serial.printf("[%lu] [EHP] Couldn't allocate memory for buffer\n", millis());
-      XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
-      XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
-      XML_SetCharacterDataHandler(parser, nullptr);
+  // A checkpoint with no open elements was taken after the document ended - only pending output remains
+  bool tailOnly = false;
+  inputPos_ = sourceOffset_;
+  inputBase_ = sourceOffset_;
+  if (resumeFrom_) {
+    tailOnly = resumeFrom_->openElements.empty();
+    if (!restoreCheckpoint(parser, file)) {
       XML_ParserFree(parser);
-      xmlParser_ = nullptr;
       file.close();
       currentPage.reset();
       currentTextBlock.reset();
       return false;
     }
+  } else {
+    startNewTextBlock(static_cast<TextBlock::BLOCK_STYLE>(config.paragraphAlignment));
+  }
 
-    const size_t len = file.read(static_cast<uint8_t*>(buf), 1024);
-
-    if (len == 0) {
-      Serial.printf("[%lu] [EHP] File read error\n", millis());
-      XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
-      XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
-      XML_SetCharacterDataHandler(parser, nullptr);
-      XML_ParserFree(parser);
-      xmlParser_ = nullptr;
-      file.close();
-      currentPage.reset();
-      currentTextBlock.reset();
-      return false;
+  xmlParser_ = parser;  // Store for stopping mid-parse
+  XML_SetElementHandler(parser, startElement, endElement);
+  XML_SetCharacterDataHandler(parser, characterData);
+  XML_SetCdataSectionHandler(parser, startCdata, endCdata);
+
+  bool ok = true;
+  bool spillComplete = false;
+  if (streamFn_ && !tailOnly) {
+    ChapterStreamSink sink(*this);
+    const bool streamed = streamFn_(sink);
+
+    if (streamFailed_) {
+      ok = false;
+    } else if (!stopRequested_ && !aborted_) {
+      if (!streamed) {
+        Serial.printf("[%lu] [EHP] Chapter stream failed\n", millis());
+        ok = false;
+      } else if (parseChunk(nullptr, 0, true) == FeedResult::Failed) {
+        ok = false;
+      }
     }
 
-    // Update progress (call every 10% change to avoid too frequent updates)
-    // Only show progress for larger chapters where rendering overhead is worth it
-    bytesRead += len;
-    if (progressFn && totalSize >= MIN_SIZE_FOR_PROGRESS) {
-      const int progress = static_cast<int>((bytesRead * 100) / totalSize);
-      if (lastProgress / 10 != progress / 10) {
-        lastProgress = progress;
-        progressFn(progress);
+    // Stopped by the final parse call - nothing left to spill, but the (empty) tail must exist
+    if (ok && stopRequested_ && !spilling_ && !spillFailed_ && !spillPath_.empty()) {
+      beginSpill(nullptr, 0);
+    }
+    if (spilling_) {
+      spillFile_.close();
+      spillComplete = streamed && !spillFailed_;
+      if (!spillComplete) {
+        SdMan.remove(spillPath_.c_str());
       }
     }
+  } else if (!streamFn_) {
+    int done = 0;
+    // Pending pages from the checkpoint may already fill the page limit
+    while (!tailOnly && !stopRequested_ && !done) {
+      // Periodic safety check and yield
+      if (++loopCounter_ % YIELD_CHECK_INTERVAL == 0) {
+        if (shouldAbort()) {
+          Serial.printf("[%lu] [EHP] Aborting parse, pages created: %u\n", millis(), pagesCreated_);
+          aborted_ = true;
+          break;
+        }
+        vTaskDelay(1);  // Yield to prevent watchdog reset
+      }
 
-    done = file.available() == 0;
+      void* const buf = XML_GetBuffer(parser, 1024);
+      if (!buf) {
+        Serial.printf("[%lu] [EHP] Couldn't allocate memory for buffer\n", millis());
+        ok = false;
+        break;
+      }
 
-    if (XML_ParseBuffer(parser, static_cast<int>(len), done) == XML_STATUS_ERROR) {
-      Serial.printf("[%lu] [EHP] Parse error at line %lu:\n%s\n", millis(), XML_GetCurrentLineNumber(parser),
-                    XML_ErrorString(XML_GetErrorCode(parser)));
-      XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
-      XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
-      XML_SetCharacterDataHandler(parser, nullptr);
-      XML_ParserFree(parser);
-      xmlParser_ = nullptr;
-      file.close();
-      currentPage.reset();
-      currentTextBlock.reset();
-      return false;
+      const size_t len = file.read(static_cast<uint8_t*>(buf), 1024);
+
+      if (len == 0) {
+        Serial.printf("[%lu] [EHP] File read error\n", millis());
+        ok = false;
+        break;
+      }
+
+      reportProgress(file.position(), totalSize);
+      done = file.available() == 0;
+
+      const FeedResult result = parseChunk(buf, static_cast<int>(len), done);
+      if (result == FeedResult::Stopped) break;
+      if (result == FeedResult::Failed) {
+        ok = false;
+        break;
+      }
     }
-  } while (!done);
+  }
 
   XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
   XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
   XML_SetCharacterDataHandler(parser, nullptr);
+  XML_SetCdataSectionHandler(parser, nullptr, nullptr);
   XML_ParserFree(parser);
   xmlParser_ = nullptr;
   file.close();
+  std::string().swap(head_);
+
+  if (!ok) {
+    currentPage.reset();
+    currentTextBlock.reset();
+    pendingPages_.clear();
+    return false;
+  }
 
   // Process last page if there is still text
-  if (currentTextBlock && !stopRequested_) {
-    makePages();
-    if (!stopRequested_ && currentPage) {
-      completePageFn(std::move(currentPage));
+  if (!stopRequested_) {
+    stopOffset_ = inputPos_;
+    if (currentTextBlock) {
+      makePages();
+    }
+    if (currentPage) {
+      emitPage(std::move(currentPage));
     }
-    currentPage.reset();
     currentTextBlock.reset();
   }
 
+  // Page limit hit - keep everything not yet emitted so the next chunk can continue from here.
+  // An aborted parse flushed its text early. Without a complete spill the caller restarts the stream
+  // at the checkpoint offset instead.
+  if (stopRequested_ && !aborted_) {
+    if (streamFn_ && !spillComplete) {
+      Serial.printf("[%lu] [EHP] No retained tail, next chunk re-reads the stream from %u\n", millis(), stopOffset_);
+    }
+    captureCheckpoint();
+  }
+  currentPage.reset();
+  currentTextBlock.reset();
+  pendingPages_.clear();
+
   return true;
 }
 
 void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
-  if (stopRequested_) return;
-
   const int lineHeight = renderer.getLineHeight(config.fontId) * config.lineCompression;
 
+  if (!currentPage) {
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+
   if (currentPageNextY + lineHeight > config.viewportHeight) {
-    ++pagesCreated_;
-    if (!completePageFn(std::move(currentPage))) {
-      stopRequested_ = true;
-      if (xmlParser_) {
-        XML_StopParser(xmlParser_, XML_FALSE);
-      }
-      return;
-    }
+    emitPage(std::move(currentPage));
     currentPage.reset(new Page());
     currentPageNextY = 0;
   }
@@ -620,6 +1003,11 @@ std::string ChapterHtmlSlimParser::cacheImage(const std::string& src) {
   // Check if already cached
   if (SdMan.exists(cachedBmpPath.c_str())) {
     consecutiveImageFailures_ = 0;  // Reset on success
+    // Image caches from before packed images only have the BMP
+    const std::string packedPath = PackedImage::pathFor(cachedBmpPath);
+    if (!SdMan.exists(packedPath.c_str())) {
+      PackedImage::writeFromBmp(cachedBmpPath, packedPath);
+    }
     return cachedBmpPath;
   }
 
@@ -686,12 +1074,12 @@ std::string ChapterHtmlSlimParser::cacheImage(const std::string& src) {
 
   consecutiveImageFailures_ = 0;  // Reset on success
   Serial.printf("[%lu] [EHP] Cached image: %s\n", millis(), cachedBmpPath.c_str());
+  // Optional: pages fall back to the BMP if this fails
+  PackedImage::writeFromBmp(cachedBmpPath, PackedImage::pathFor(cachedBmpPath));
   return cachedBmpPath;
 }
 
 void ChapterHtmlSlimParser::addImageToPage(std::shared_ptr<ImageBlock> image) {
-  if (stopRequested_) return;
-
   const int imageHeight = image->getHeight();
   const int lineHeight = renderer.getLineHeight(config.fontId) * config.lineCompression;
 
@@ -702,13 +1090,7 @@ void ChapterHtmlSlimParser::addImageToPage(std::shared_ptr<ImageBlock> image) {
 
   // Check if image fits on current page
   if (currentPageNextY + imageHeight > config.viewportHeight) {
-    if (!completePageFn(std::move(currentPage))) {
-      stopRequested_ = true;
-      if (xmlParser_) {
-        XML_StopParser(xmlParser_, XML_FALSE);
-      }
-      return;
-    }
+    emitPage(std::move(currentPage));
     currentPage.reset(new Page());
     currentPageNextY = 0;
   }
@@ -6,6 +6,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "../ParsedText.h"
 #include "../RenderConfig.h"
@@ -20,6 +21,31 @@ class Print;
 #define MAX_WORD_SIZE 200
 constexpr int MAX_XML_DEPTH = 100;
 
+/**
+ * Parser state at the point a partial parse stopped.
+ * Expat state can't be saved, so resuming replays the document prolog and re-opens
+ * the element stack by name, then continues feeding input from inputOffset.
+ */
+struct ChapterCheckpoint {
+  uint32_t inputOffset = 0;  // Byte offset in the normalized chapter to continue from
+  std::string prolog;        // XML decl, DOCTYPE and root start tag, replayed verbatim
+  std::vector<std::string> openElements;  // Element names open at inputOffset, outermost first
+  int32_t skipUntilDepth = INT_MAX;
+  int32_t boldUntilDepth = INT_MAX;
+  int32_t italicUntilDepth = INT_MAX;
+  int32_t cssBoldUntilDepth = INT_MAX;
+  int32_t cssItalicUntilDepth = INT_MAX;
+  int32_t preUntilDepth = INT_MAX;
+  std::string partWord;
+  std::unique_ptr<ParsedText> pendingText;               // Words not yet laid out
+  std::vector<std::unique_ptr<Page>> pendingPages;       // Completed pages past the page limit
+  std::unique_ptr<Page> currentPage;                     // Page under construction
+  int16_t currentPageNextY = 0;
+
+  bool serialize(FsFile& file) const;
+  static std::unique_ptr<ChapterCheckpoint> deserialize(FsFile& file);
+};
+
 class ChapterHtmlSlimParser {
   const std::string& filepath;
   GfxRenderer& renderer;
@@ -48,11 +74,38 @@ class ChapterHtmlSlimParser {
 
   // CSS support
   const CssParser* cssParser_ = nullptr;
+  CssStyleMemo cssStyleMemo_;
 
   // XML parser handle for stopping mid-parse
   XML_Parser xmlParser_ = nullptr;
   bool stopRequested_ = false;
 
+  // Resume support - element stack and input positions in chapter coordinates
+  std::vector<std::string> elementStack_;
+  int64_t inputBase_ = 0;      // Chapter offset minus Expat byte index
+  uint32_t inputPos_ = 0;      // Chapter offset of the next byte handed to Expat
+  uint32_t sourceOffset_ = 0;  // Chapter offset of the first byte of filepath
+  uint32_t stopOffset_ = 0;
+  std::string prolog_;
+  std::string head_;  // First input bytes, kept until the root start tag ends the prolog
+  static constexpr size_t MAX_PROLOG_SIZE = 1024;
+  bool inCdata_ = false;
+  bool stopInCdata_ = false;
+  std::vector<std::unique_ptr<Page>> pendingPages_;
+  std::unique_ptr<ChapterCheckpoint> resumeFrom_;
+  std::unique_ptr<ChapterCheckpoint> checkpoint_;
+
+  // Streaming input - chapter bytes are pushed by streamFn_ instead of read from filepath.
+  // Input left over when the page limit stops the parse is spilled to spillPath_.
+  std::function<bool(Print&)> streamFn_;
+  std::string spillPath_;
+  FsFile spillFile_;
+  bool spilling_ = false;
+  bool spillFailed_ = false;
+  bool streamFailed_ = false;
+  bool aborted_ = false;
+  int lastProgress_ = -1;
+
   // External abort callback for cooperative cancellation
   std::function<bool()> externalAbortCallback_ = nullptr;
 
@@ -71,6 +124,16 @@ class ChapterHtmlSlimParser {
   // Check if parsing should abort due to timeout or memory pressure
   bool shouldAbort() const;
 
+  enum class FeedResult : uint8_t { Parsed, Stopped, Failed };
+
+  FeedResult parseChunk(const void* buf, int len, bool isFinal);
+  size_t consumeStream(const uint8_t* data, size_t len);
+  bool beginSpill(const uint8_t* data, size_t len);
+  void reportProgress(size_t bytesRead, size_t totalSize);
+  void emitPage(std::unique_ptr<Page> page);
+  uint32_t currentInputEnd() const;
+  bool restoreCheckpoint(XML_Parser parser, FsFile& file);
+  void captureCheckpoint();
   void startNewTextBlock(TextBlock::BLOCK_STYLE style);
   void flushPartWordBuffer();
   void makePages();
@@ -80,6 +143,10 @@ class ChapterHtmlSlimParser {
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
   static void XMLCALL endElement(void* userData, const XML_Char* name);
+  static void XMLCALL startCdata(void* userData);
+  static void XMLCALL endCdata(void* userData);
+
+  friend class ChapterStreamSink;
 
  public:
   explicit ChapterHtmlSlimParser(const std::string& filepath, GfxRenderer& renderer, const RenderConfig& config,
@@ -100,6 +167,20 @@ class ChapterHtmlSlimParser {
         cssParser_(cssParser),
         externalAbortCallback_(externalAbortCallback) {}
   ~ChapterHtmlSlimParser() = default;
+  // Continue from a checkpoint instead of the start of the file (call before parseAndBuildPages)
+  void setResumeFrom(std::unique_ptr<ChapterCheckpoint> checkpoint) { resumeFrom_ = std::move(checkpoint); }
+  // The file holds the chapter from this offset onward (a tail spilled by a streaming parse)
+  void setSourceOffset(const uint32_t offset) { sourceOffset_ = offset; }
+  // Parse bytes written by streamFn instead of reading the file. If the page limit stops the parse,
+  // the rest of the stream goes to spillPath, which then holds the chapter from the checkpoint onward.
+  // When the spill fails the checkpoint is still taken, and the caller restarts the stream at its offset.
+  // Combined with setResumeFrom, streamFn must start at the checkpoint offset (set with setSourceOffset).
+  void setStreamSource(std::function<bool(Print&)> streamFn, const std::string& spillPath) {
+    streamFn_ = std::move(streamFn);
+    spillPath_ = spillPath;
+  }
+  // State left by a parse that stopped at the page limit, nullptr if it can't be resumed
+  std::unique_ptr<ChapterCheckpoint> takeCheckpoint() { return std::move(checkpoint_); }
   bool parseAndBuildPages();
   void addLineToPage(std::shared_ptr<TextBlock> line);
 };
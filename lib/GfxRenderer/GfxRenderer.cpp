@@ -1,15 +1,75 @@
 #include "GfxRenderer.h"
 
 #include <ExternalFont.h>
+#include <SDCardManager.h>
 #include <ScriptDetector.h>
 #include <ThaiShaper.h>
 #include <Utf8.h>
 
-void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
+#include "PackedImage.h"
+
+static_assert(GlyphBlit::PANEL_WIDTH == EInkDisplay::DISPLAY_WIDTH &&
+                  GlyphBlit::PANEL_HEIGHT == EInkDisplay::DISPLAY_HEIGHT,
+              "GlyphBlit panel size does not match the display");
+static_assert(GfxRenderer::Portrait == 0 && GfxRenderer::LandscapeClockwise == 1 &&
+                  GfxRenderer::PortraitInverted == 2 && GfxRenderer::LandscapeCounterClockwise == 3,
+              "GlyphBlit::PanelMap is indexed by Orientation");
+
+void GfxRenderer::insertFont(const int fontId, const EpdFontFamily font) {
+  if (findFontSlot(fontId)) return;
+
+  int slot = 0;
+  while (slot < fontSlotCount_ && fontSlots_[slot].font) slot++;
+  if (slot == MAX_FONTS) {
+    Serial.printf("[%lu] [GFX] Font %d not registered: all %d slots in use\n", millis(), fontId, MAX_FONTS);
+    return;
+  }
+  if (slot == fontSlotCount_) fontSlotCount_++;
+
+  font.buildAdvanceTables();
+  FontSlot& entry = fontSlots_[slot];
+  entry.family = font;
+  const EpdFontData* data = font.getData(EpdFontFamily::REGULAR);
+  const EpdGlyph* space = font.getGlyph(' ', EpdFontFamily::REGULAR);
+  entry.font = {&entry.family, fontId, data->ascender, data->advanceY, space ? space->advanceX : 0};
+}
 
 void GfxRenderer::removeFont(const int fontId) {
-  fontMap.erase(fontId);
-  wordWidthCache.clear();
+  const FontSlot* slot = findFontSlot(fontId);
+  if (slot) fontSlots_[slot - fontSlots_].font = {};
+  widthCache_.clearFont(fontId);
+  // Atlas entries point at the removed font's glyphs
+  if (glyphAtlas_) glyphAtlas_->clear();
+}
+
+const GfxRenderer::FontSlot* GfxRenderer::findFontSlot(const int fontId) const {
+  for (int i = 0; i < fontSlotCount_; i++) {
+    if (fontSlots_[i].font && fontSlots_[i].font.id == fontId) return &fontSlots_[i];
+  }
+  return nullptr;
+}
+
+const GfxRenderer::Font& GfxRenderer::getFont(const int fontId) const {
+  static const Font NO_FONT;
+  const FontSlot* slot = findFontSlot(fontId);
+  if (!slot) {
+    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    return NO_FONT;
+  }
+  return slot->font;
+}
+
+void GfxRenderer::warmGlyphAtlas(const int fontId) const {
+  if (!glyphAtlas_ || glyphAtlas_->orientation() < 0) return;
+  const FontSlot* slot = findFontSlot(fontId);
+  if (!slot) return;
+
+  const EpdFontData* data = slot->family.getData(EpdFontFamily::REGULAR);
+  for (uint32_t cp = 0x20; cp <= 0x7E; cp++) {
+    const EpdGlyph* glyph = slot->family.getGlyph(cp, EpdFontFamily::REGULAR);
+    if (glyph) glyphAtlas_->get(glyph, &data->bitmap[glyph->dataOffset], data->is2Bit);
+  }
+  glyphAtlas_->logStats();
 }
 
 void GfxRenderer::rotateCoordinates(const int x, const int y, int* rotatedX, int* rotatedY) const {
@@ -76,27 +136,37 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
 
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
   if (!text || !*text) return 0;
+  return getTextWidth(getFont(fontId), text, style);
+}
 
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
-    return 0;
-  }
+int GfxRenderer::getTextWidth(const Font& font, const char* text, const EpdFontFamily::Style style) const {
+  if (!font || !text || !*text) return 0;
 
   // Check cache first (significant speedup during EPUB section creation)
-  const uint64_t key = makeWidthCacheKey(fontId, text, style);
-  auto it = wordWidthCache.find(key);
-  if (it != wordWidthCache.end()) {
-    return it->second;
+  int w;
+  if (widthCache_.lookup(font.id, style, text, &w)) {
+    return w;
   }
 
-  // Check if text contains Thai - use cluster-based width calculation
+  w = measureTextWidth(*font.family, font.id, text, style);
+  widthCache_.insert(font.id, style, text, w);
+  return w;
+}
+
+int GfxRenderer::measureTextWidth(const EpdFontFamily& font, const int fontId, const char* text,
+                                  const EpdFontFamily::Style style) const {
+  // Latin text: one pass over the dense advance table
   int w = 0;
+  if (font.getAdvanceWidth(text, &w, style)) {
+    return w;
+  }
+
+  // Check if text contains Thai - use cluster-based width calculation
   if (ScriptDetector::containsThai(text)) {
     w = getThaiTextWidth(fontId, text, style);
   } else {
     // Always use advanceX sum for correct layout width calculation
     // (getTextDimensions returns visual bounds which differs from advance width)
-    const auto& font = fontMap.at(fontId);
     const char* ptr = text;
     uint32_t cp;
     while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&ptr)))) {
@@ -125,13 +195,61 @@ int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontF
     }
   }
 
-  // Limit cache size to prevent heap fragmentation
-  if (wordWidthCache.size() >= MAX_WIDTH_CACHE_SIZE) {
-    wordWidthCache.clear();
+  return w;
+}
+
+// Identifies the glyph metrics a saved width cache was measured with; font ids are name hashes, so a
+// replaced font file under the same name must not reuse stale widths
+int32_t GfxRenderer::fontFingerprint(const int fontId) const {
+  static constexpr const char* SAMPLE = "The quick brown fox jumps over the lazy dog 0123456789";
+  const EpdFontFamily& font = findFontSlot(fontId)->family;
+  int32_t fingerprint = 0;
+  for (const auto style : {EpdFontFamily::REGULAR, EpdFontFamily::BOLD, EpdFontFamily::ITALIC}) {
+    fingerprint = fingerprint * 31 + measureTextWidth(font, fontId, SAMPLE, style);
+    fingerprint = fingerprint * 31 + font.getData(style)->advanceY;
+  }
+  return fingerprint;
+}
+
+bool GfxRenderer::saveWidthCache(const std::string& path, const int fontId) const {
+  if (!findFontSlot(fontId)) return false;
+
+  const std::string tmpPath = path + ".tmp";
+  FsFile file;
+  if (!SdMan.openFileForWrite("GFX", tmpPath, file)) {
+    return false;
   }
+  bool ok = widthCache_.save(file, fontId, fontFingerprint(fontId));
+  file.close();
 
-  wordWidthCache[key] = static_cast<int16_t>(w);
-  return w;
+  if (ok) {
+    if (SdMan.exists(path.c_str())) {
+      SdMan.remove(path.c_str());
+    }
+    ok = SdMan.rename(tmpPath.c_str(), path.c_str());
+  }
+  if (!ok) {
+    Serial.printf("[%lu] [GFX] Failed to write width cache %s\n", millis(), path.c_str());
+    SdMan.remove(tmpPath.c_str());
+  }
+  return ok;
+}
+
+bool GfxRenderer::loadWidthCache(const std::string& path, const int fontId) {
+  if (!findFontSlot(fontId)) return false;
+
+  FsFile file;
+  if (!SdMan.openFileForRead("GFX", path, file)) {
+    return false;
+  }
+  const bool ok = widthCache_.load(file, fontId, fontFingerprint(fontId));
+  file.close();
+  if (!ok) {
+    // Stale or partial: drop whatever was read and measure from scratch
+    widthCache_.clearFont(fontId);
+    Serial.printf("[%lu] [GFX] Ignoring width cache %s\n", millis(), path.c_str());
+  }
+  return ok;
 }
 
 void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* text, const bool black,
@@ -146,31 +264,36 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
   if (text == nullptr || *text == '\0') {
     return;
   }
+  drawText(getFont(fontId), x, y, text, black, style);
+}
 
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+void GfxRenderer::drawText(const Font& font, const int x, const int y, const char* text, const bool black,
+                           const EpdFontFamily::Style style) const {
+  // cannot draw a NULL / empty string; text without printable glyphs simply draws nothing
+  if (!font || text == nullptr || *text == '\0') {
     return;
   }
-  const auto font = fontMap.at(fontId);
 
-  // no printable characters
-  if (!font.hasPrintableChars(text, style)) {
+  // Check if text contains Thai script - use Thai rendering path if so
+  if (ScriptDetector::containsThai(text)) {
+    drawThaiText(font.id, x, y, text, black, style);
     return;
   }
 
-  // Check if text contains Thai script - use Thai rendering path if so
-  if (ScriptDetector::containsThai(text)) {
-    drawThaiText(fontId, x, y, text, black, style);
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer) {
+    Serial.printf("[%lu] [GFX] !! No framebuffer\n", millis());
     return;
   }
 
   // Standard rendering path for non-Thai text
-  const int yPos = y + getFontAscenderSize(fontId);
+  const int yPos = y + font.ascender;
   int xpos = x;
+  const GlyphBlit::Fn blit = GlyphBlit::forOrientation(orientation, font.family->getData(style)->is2Bit);
 
   uint32_t cp;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    renderChar(font, cp, &xpos, &yPos, black, style);
+    renderChar(*font.family, cp, &xpos, &yPos, black, style, blit, frameBuffer);
   }
 }
 
@@ -288,6 +411,47 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
   }
 }
 
+bool GfxRenderer::drawPackedImage(FsFile& file, const int x, const int y) const {
+  PackedImage::Header header;
+  if (file.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) != static_cast<int>(sizeof(header)) ||
+      header.magic != PackedImage::MAGIC || header.width == 0 || header.height == 0) {
+    return false;
+  }
+
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  const int rowBytes = PackedImage::rowBytes(header.width);
+  if (!frameBuffer || !bitmapRowBytes_ || rowBytes > static_cast<int>(BITMAP_ROW_BYTES_SIZE)) {
+    return false;
+  }
+
+  // Same ink rules as drawBitmap: BW inks all but white, the gray planes flag their levels
+  uint8_t inkMask = GlyphBlit::INK_BW;
+  bool setBits = false;
+  if (renderMode == GRAYSCALE_MSB) {
+    inkMask = GlyphBlit::INK_GRAYSCALE_MSB;
+    setBits = true;
+  } else if (renderMode == GRAYSCALE_LSB) {
+    inkMask = GlyphBlit::INK_GRAYSCALE_LSB;
+    setBits = true;
+  }
+
+  // Strips of whole rows through the bitmap row buffer; padded rows keep each strip byte-aligned
+  const GlyphBlit::Fn blit = GlyphBlit::forOrientation(orientation, true);
+  const int stripRows = static_cast<int>(BITMAP_ROW_BYTES_SIZE) / rowBytes;
+  const int screenHeight = getScreenHeight();
+  for (int row = 0; row < header.height && y + row < screenHeight; row += stripRows) {
+    const int rows = std::min(stripRows, header.height - row);
+    const int bytes = rows * rowBytes;
+    if (file.read(bitmapRowBytes_, bytes) != bytes) {
+      Serial.printf("[%lu] [GFX] Short read in packed image at row %d\n", millis(), row);
+      return false;
+    }
+    const GlyphBlit::Glyph strip = {bitmapRowBytes_, x, y + row, rowBytes * 4, rows};
+    blit(frameBuffer, strip, getScreenWidth(), screenHeight, inkMask, setBits);
+  }
+  return true;
+}
+
 void GfxRenderer::clearScreen(const uint8_t color) const { einkDisplay.clearScreen(color); }
 
 void GfxRenderer::clearArea(const int x, const int y, const int width, const int height, const uint8_t color) const {
@@ -335,6 +499,14 @@ void GfxRenderer::displayBuffer(const EInkDisplay::RefreshMode refreshMode, bool
   einkDisplay.displayBuffer(refreshMode, turnOffScreen);
 }
 
+void GfxRenderer::startDisplayBuffer(const EInkDisplay::RefreshMode refreshMode, bool turnOffScreen) const {
+  einkDisplay.startDisplayBuffer(refreshMode, turnOffScreen);
+}
+
+bool GfxRenderer::isRefreshing() const { return einkDisplay.isRefreshing(); }
+
+void GfxRenderer::waitForRefresh() const { einkDisplay.waitForRefresh(); }
+
 void GfxRenderer::displayWindow(int x, int y, int width, int height, bool turnOffScreen) const {
   einkDisplay.displayWindow(x, y, width, height, turnOffScreen);
 }
@@ -548,41 +720,18 @@ int GfxRenderer::getScreenHeight() const {
   return EInkDisplay::DISPLAY_WIDTH;
 }
 
-int GfxRenderer::getSpaceWidth(const int fontId) const {
-  auto it = fontMap.find(fontId);
-  if (it == fontMap.end()) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
-    return 0;
-  }
+int GfxRenderer::getSpaceWidth(const int fontId) const { return getFont(fontId).spaceWidth; }
 
-  const EpdGlyph* glyph = it->second.getGlyph(' ', EpdFontFamily::REGULAR);
-  return glyph ? glyph->advanceX : 0;
-}
+int GfxRenderer::getFontAscenderSize(const int fontId) const { return getFont(fontId).ascender; }
 
-int GfxRenderer::getFontAscenderSize(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
-    return 0;
-  }
-
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->ascender;
-}
-
-int GfxRenderer::getLineHeight(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
-    return 0;
-  }
-
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->advanceY;
-}
+int GfxRenderer::getLineHeight(const int fontId) const { return getFont(fontId).lineHeight; }
 
 bool GfxRenderer::fontSupportsGrayscale(const int fontId) const {
-  auto it = fontMap.find(fontId);
-  if (it == fontMap.end()) {
+  const FontSlot* slot = findFontSlot(fontId);
+  if (!slot) {
     return false;
   }
-  const EpdFontData* data = it->second.getData();
+  const EpdFontData* data = slot->family.getData();
   return data != nullptr && data->is2Bit;
 }
 
@@ -727,8 +876,73 @@ void GfxRenderer::cleanupGrayscaleWithFrameBuffer() const {
   }
 }
 
+void GfxRenderer::beginGrayscaleCapture() {
+  grayGlyphs_.clear();
+  grayGlyphs_.reserve(1024);
+  capturingGrayscale_ = true;
+}
+
+void GfxRenderer::captureGrayGlyph(const uint8_t* bitmap, const int x, const int y, const uint8_t width,
+                                   const uint8_t height) const {
+  if (width == 0 || height == 0) return;
+  grayGlyphs_.push_back({bitmap, static_cast<int16_t>(x), static_cast<int16_t>(y), width, height});
+}
+
+/**
+ * Sets the LSB/MSB bits of every captured gray pixel that lands in panel rows [stripY, stripY + rows).
+ * Bits match what the GRAYSCALE_LSB/GRAYSCALE_MSB passes draw into a frame buffer cleared to 0x00.
+ * Each glyph is clipped to the strip once and only its rows inside the strip are walked.
+ */
+void GfxRenderer::rasterizeGrayStrip(const int stripY, const int rows, uint8_t* lsbStrip, uint8_t* msbStrip) const {
+  const int screenHeight = getScreenHeight();
+  const int screenWidth = getScreenWidth();
+  const GlyphBlit::GrayStripFn strip = GlyphBlit::grayStripFor(orientation);
+
+  for (const auto& glyph : grayGlyphs_) {
+    const GlyphBlit::Glyph placed = {glyph.bitmap, glyph.x, glyph.y, glyph.width, glyph.height};
+    strip(lsbStrip, msbStrip, placed, screenWidth, screenHeight, stripY, rows);
+  }
+}
+
+/**
+ * Writes the captured LSB/MSB planes to display RAM strip by strip, leaving the frame buffer untouched.
+ * Follow with displayGrayBuffer() and cleanupGrayscaleWithFrameBuffer().
+ * Returns false if the strip buffers can't be allocated; the caller should fall back to the LSB/MSB passes.
+ */
+bool GfxRenderer::writeCapturedGrayscale() {
+  capturingGrayscale_ = false;
+
+  auto* lsbStrip = static_cast<uint8_t*>(malloc(GRAY_STRIP_SIZE));
+  auto* msbStrip = static_cast<uint8_t*>(malloc(GRAY_STRIP_SIZE));
+  if (!lsbStrip || !msbStrip) {
+    Serial.printf("[%lu] [GFX] !! Failed to allocate grayscale strips (%zu bytes each)\n", millis(), GRAY_STRIP_SIZE);
+    free(lsbStrip);
+    free(msbStrip);
+    std::vector<GrayGlyph>().swap(grayGlyphs_);
+    return false;
+  }
+
+  const unsigned long startTime = millis();
+  for (int stripY = 0; stripY < EInkDisplay::DISPLAY_HEIGHT; stripY += GRAY_STRIP_ROWS) {
+    const int rows = std::min(GRAY_STRIP_ROWS, EInkDisplay::DISPLAY_HEIGHT - stripY);
+    const size_t stripSize = static_cast<size_t>(rows) * EInkDisplay::DISPLAY_WIDTH_BYTES;
+    memset(lsbStrip, 0x00, stripSize);
+    memset(msbStrip, 0x00, stripSize);
+    rasterizeGrayStrip(stripY, rows, lsbStrip, msbStrip);
+    einkDisplay.copyGrayscaleStrip(stripY, rows, lsbStrip, msbStrip);
+  }
+
+  Serial.printf("[%lu] [GFX] Wrote grayscale planes for %zu glyphs in %lu ms\n", millis(), grayGlyphs_.size(),
+                millis() - startTime);
+  free(lsbStrip);
+  free(msbStrip);
+  std::vector<GrayGlyph>().swap(grayGlyphs_);
+  return true;
+}
+
 void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp, int* x, const int* y,
-                             const bool pixelState, const EpdFontFamily::Style style) const {
+                             const bool pixelState, const EpdFontFamily::Style style, const GlyphBlit::Fn blit,
+                             uint8_t* frameBuffer) const {
   const EpdGlyph* glyph = fontFamily.getGlyph(cp, style);
   if (!glyph) {
     // Try external font fallback (for CJK characters)
@@ -765,47 +979,32 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
   bitmap = &fontFamily.getData(style)->bitmap[offset];
 
   if (bitmap != nullptr) {
-    const int screenHeight = getScreenHeight();
-    const int screenWidth = getScreenWidth();
-
-    for (int glyphY = 0; glyphY < height; glyphY++) {
-      const int screenY = *y - glyph->top + glyphY;
-      if (screenY < 0 || screenY >= screenHeight) continue;
-
-      for (int glyphX = 0; glyphX < width; glyphX++) {
-        const int screenX = *x + left + glyphX;
-        if (screenX < 0 || screenX >= screenWidth) continue;
-
-        const int pixelPosition = glyphY * width + glyphX;
-
-        if (is2Bit) {
-          const uint8_t byte = bitmap[pixelPosition / 4];
-          const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
-          // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
-          // we swap this to better match the way images and screen think about colors:
-          // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
+    if (is2Bit && capturingGrayscale_ && renderMode == BW) {
+      captureGrayGlyph(bitmap, *x + left, *y - glyph->top, width, height);
+    }
 
-          if (renderMode == BW && bmpVal < 3) {
-            // Black (also paints over the grays in BW mode)
-            drawPixel(screenX, screenY, pixelState);
-          } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-            // Light gray (also mark the MSB if it's going to be a dark gray too)
-            // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
-            drawPixel(screenX, screenY, false);
-          } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
-            // Dark gray
-            drawPixel(screenX, screenY, false);
-          }
-        } else {
-          const uint8_t byte = bitmap[pixelPosition / 8];
-          const uint8_t bit_index = 7 - (pixelPosition % 8);
+    // Gray planes flag pixels in reverse: 0 leave alone, 1 update
+    uint8_t inkMask = GlyphBlit::INK_BW;
+    bool setBits = !pixelState;
+    if (is2Bit && renderMode == GRAYSCALE_MSB) {
+      inkMask = GlyphBlit::INK_GRAYSCALE_MSB;
+      setBits = true;
+    } else if (is2Bit && renderMode == GRAYSCALE_LSB) {
+      inkMask = GlyphBlit::INK_GRAYSCALE_LSB;
+      setBits = true;
+    }
+    const GlyphBlit::Glyph placed = {bitmap, *x + left, *y - glyph->top, width, height};
 
-          if ((byte >> bit_index) & 1) {
-            drawPixel(screenX, screenY, pixelState);
-          }
-        }
-      }
+    // Pre-rotated BW plane when the glyph needs no clipping; gray planes and edge glyphs take the blitter
+    const uint8_t* rotated = nullptr;
+    if (glyphAtlas_ && renderMode == BW && glyphAtlas_->orientation() == orientation && placed.x >= 0 &&
+        placed.y >= 0 && placed.x + width <= getScreenWidth() && placed.y + height <= getScreenHeight()) {
+      rotated = glyphAtlas_->get(glyph, bitmap, is2Bit);
+    }
+    if (rotated) {
+      GlyphBlit::blitRotated(frameBuffer, rotated, width, height, placed.x, placed.y, orientation, setBits);
+    } else {
+      blit(frameBuffer, placed, getScreenWidth(), getScreenHeight(), inkMask, setBits);
     }
   }
 
@@ -932,12 +1131,13 @@ int GfxRenderer::getThaiTextWidth(const int fontId, const char* text, const EpdF
     return 0;
   }
 
-  if (fontMap.count(fontId) == 0) {
+  const FontSlot* slot = findFontSlot(fontId);
+  if (!slot) {
     Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
     return 0;
   }
 
-  const auto& font = fontMap.at(fontId);
+  const EpdFontFamily& font = slot->family;
   int totalWidth = 0;
 
   // Build clusters and sum their widths
@@ -962,15 +1162,16 @@ int GfxRenderer::getThaiTextWidth(const int fontId, const char* text, const EpdF
 
 void GfxRenderer::drawThaiText(const int fontId, const int x, const int y, const char* text, const bool black,
                                const EpdFontFamily::Style style) const {
-  if (fontMap.count(fontId) == 0) {
+  const FontSlot* slot = findFontSlot(fontId);
+  if (!slot) {
     Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
     return;
   }
 
-  const int yPos = y + getFontAscenderSize(fontId);
+  const int yPos = y + slot->font.ascender;
   int xpos = x;
 
-  const auto font = fontMap.at(fontId);
+  const EpdFontFamily& font = slot->family;
 
   // Build Thai clusters from the text
   auto clusters = ThaiShaper::ThaiClusterBuilder::buildClusters(text);
@@ -1034,6 +1235,10 @@ void GfxRenderer::renderThaiCluster(const EpdFontFamily& fontFamily, const ThaiS
     }
     const uint8_t* bitmap = &fontData->bitmap[offset];
 
+    if (is2Bit && capturingGrayscale_ && renderMode == BW) {
+      captureGrayGlyph(bitmap, glyphX + left, glyphY - glyphData->top, width, height);
+    }
+
     const int screenHeight = getScreenHeight();
     const int screenWidth = getScreenWidth();
 
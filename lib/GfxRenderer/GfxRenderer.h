@@ -4,11 +4,13 @@
 #include <EpdFontFamily.h>
 #include <ThaiCluster.h>
 
-#include <map>
-#include <unordered_map>
+#include <string>
 #include <vector>
 
 #include "Bitmap.h"
+#include "GlyphAtlas.h"
+#include "GlyphBlit.h"
+#include "WordWidthCache.h"
 
 // Forward declaration for external CJK font support
 class ExternalFont;
@@ -25,6 +27,17 @@ class GfxRenderer {
     LandscapeCounterClockwise  // 800x480 logical coordinates, native panel orientation
   };
 
+  // A registered font resolved once by getFont(), with its REGULAR metrics cached. Text calls taking a
+  // Font skip the per-call fontId lookup; on an unknown id the Font is empty and they do nothing.
+  struct Font {
+    const EpdFontFamily* family = nullptr;
+    int id = 0;
+    int ascender = 0;
+    int lineHeight = 0;
+    int spaceWidth = 0;
+    explicit operator bool() const { return family != nullptr; }
+  };
+
  private:
   static constexpr size_t BW_BUFFER_CHUNK_SIZE = 8000;  // 8KB chunks to allow for non-contiguous memory
   static constexpr size_t BW_BUFFER_NUM_CHUNKS = EInkDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
@@ -35,8 +48,17 @@ class GfxRenderer {
   RenderMode renderMode;
   Orientation orientation;
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
-  std::map<int, EpdFontFamily> fontMap;
+  // Registered fonts in a fixed array; slots are reused after removeFont(), so a Font stays put
+  static constexpr int MAX_FONTS = 16;
+  struct FontSlot {
+    EpdFontFamily family{nullptr};
+    Font font;
+  };
+  FontSlot fontSlots_[MAX_FONTS];
+  int fontSlotCount_ = 0;  // High-water mark of used slots
+  const FontSlot* findFontSlot(int fontId) const;
   ExternalFont* _externalFont = nullptr;
+  GlyphAtlas* glyphAtlas_ = nullptr;
 
   // Pre-allocated row buffers for bitmap rendering (reduces heap fragmentation)
   // Sized for max screen dimension (800 pixels): outputRow = 800/4 = 200 bytes, rowBytes = 800*3 = 2400 bytes (24bpp)
@@ -47,30 +69,30 @@ class GfxRenderer {
   void allocateBitmapRowBuffers();
   void freeBitmapRowBuffers();
 
-  // Word width cache for performance optimization during EPUB section creation.
-  // Key: FNV-1a hash of (fontId, text, style). Value: measured width in pixels.
-  // Limited to MAX_WIDTH_CACHE_SIZE entries to prevent heap fragmentation.
-  static constexpr size_t MAX_WIDTH_CACHE_SIZE = 512;
-  mutable std::unordered_map<uint64_t, int16_t> wordWidthCache;
-
-  uint64_t makeWidthCacheKey(int fontId, const char* text, EpdFontFamily::Style style) const {
-    // FNV-1a hash
-    uint64_t hash = 14695981039346656037ULL;
-    hash ^= static_cast<uint64_t>(fontId);
-    hash *= 1099511628211ULL;
-    hash ^= static_cast<uint64_t>(style);
-    hash *= 1099511628211ULL;
-    if (text) {
-      while (*text) {
-        hash ^= static_cast<uint8_t>(*text++);
-        hash *= 1099511628211ULL;
-      }
-    }
-    return hash;
-  }
+  // Word widths measured during layout, shared by all fonts and kept across chapters
+  mutable WordWidthCache widthCache_;
+  int measureTextWidth(const EpdFontFamily& font, int fontId, const char* text, EpdFontFamily::Style style) const;
+  int32_t fontFingerprint(int fontId) const;
+
+  // Single-pass grayscale: 2-bit glyphs drawn in BW mode while capturing are recorded, so the LSB/MSB
+  // planes can be rasterized straight into display RAM in strips instead of walking the page twice more.
+  // Strips of 48 panel rows keep the two plane buffers at ~4.8KB each.
+  struct GrayGlyph {
+    const uint8_t* bitmap;
+    int16_t x;  // Logical top-left of the glyph bitmap
+    int16_t y;
+    uint8_t width;
+    uint8_t height;
+  };
+  static constexpr int GRAY_STRIP_ROWS = 48;
+  static constexpr size_t GRAY_STRIP_SIZE = EInkDisplay::DISPLAY_WIDTH_BYTES * GRAY_STRIP_ROWS;
+  bool capturingGrayscale_ = false;
+  mutable std::vector<GrayGlyph> grayGlyphs_;
+  void captureGrayGlyph(const uint8_t* bitmap, int x, int y, uint8_t width, uint8_t height) const;
+  void rasterizeGrayStrip(int stripY, int rows, uint8_t* lsbStrip, uint8_t* msbStrip) const;
 
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, const int* y, bool pixelState,
-                  EpdFontFamily::Style style) const;
+                  EpdFontFamily::Style style, GlyphBlit::Fn blit, uint8_t* frameBuffer) const;
   void renderThaiCluster(const EpdFontFamily& fontFamily, const ThaiShaper::ThaiCluster& cluster, int* x, int y,
                          bool pixelState, EpdFontFamily::Style style, int fontId) const;
   void renderExternalGlyph(uint32_t cp, int* x, int y, bool pixelState) const;
@@ -92,9 +114,17 @@ class GfxRenderer {
   // Setup
   void insertFont(int fontId, EpdFontFamily font);
   void removeFont(int fontId);
-  void clearWidthCache() { wordWidthCache.clear(); }
+  void clearWidthCache() { widthCache_.release(); }
+  void logWidthCacheStats() const { widthCache_.logStats(); }
+  // Persist one font's cached word widths (e.g. per book) so the next layout starts warm
+  bool saveWidthCache(const std::string& path, int fontId) const;
+  bool loadWidthCache(const std::string& path, int fontId);
   void setExternalFont(ExternalFont* font) { _externalFont = font; }
   ExternalFont* getExternalFont() const { return _externalFont; }
+  // Pre-rotated glyphs for portrait text; used while its orientation matches the renderer's
+  void setGlyphAtlas(GlyphAtlas* atlas) { glyphAtlas_ = atlas; }
+  // Pre-rotate printable ASCII of a font's regular style into the atlas
+  void warmGlyphAtlas(int fontId) const;
 
   // Orientation control (affects logical width/height and coordinate transforms)
   void setOrientation(const Orientation o) { orientation = o; }
@@ -105,6 +135,11 @@ class GfxRenderer {
   int getScreenHeight() const;
   void displayBuffer(EInkDisplay::RefreshMode refreshMode = EInkDisplay::FAST_REFRESH,
                      bool turnOffScreen = false) const;
+  // Returns once the refresh has started; drawing or the next panel operation waits for it to finish
+  void startDisplayBuffer(EInkDisplay::RefreshMode refreshMode = EInkDisplay::FAST_REFRESH,
+                          bool turnOffScreen = false) const;
+  bool isRefreshing() const;
+  void waitForRefresh() const;
   // EXPERIMENTAL: Windowed update - display only a rectangular region
   void displayWindow(int x, int y, int width, int height, bool turnOffScreen = false) const;
   void invertScreen() const;
@@ -118,8 +153,14 @@ class GfxRenderer {
   void fillRect(int x, int y, int width, int height, bool state = true) const;
   void drawImage(const uint8_t bitmap[], int x, int y, int width, int height) const;
   void drawBitmap(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight) const;
+  // Draw a PackedImage file at its stored size; false if the file is unreadable
+  bool drawPackedImage(FsFile& file, int x, int y) const;
 
   // Text
+  const Font& getFont(int fontId) const;
+  int getTextWidth(const Font& font, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  void drawText(const Font& font, int x, int y, const char* text, bool black = true,
+                EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   int getTextWidth(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   void drawCenteredText(int fontId, int y, const char* text, bool black = true,
                         EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
@@ -154,6 +195,13 @@ class GfxRenderer {
   bool storeBwBuffer();  // Returns true if buffer was stored successfully
   void restoreBwBuffer();
   void cleanupGrayscaleWithFrameBuffer() const;
+  // Single-pass alternative to the LSB/MSB passes: call beginGrayscaleCapture() before drawing text in BW
+  // mode and endGrayscaleCapture() after, then writeCapturedGrayscale() once the BW frame is displayed.
+  // The frame buffer keeps the BW frame, so cleanupGrayscaleWithFrameBuffer() replaces restoreBwBuffer().
+  // Only glyphs are captured; bitmaps still need the multi-pass path.
+  void beginGrayscaleCapture();
+  void endGrayscaleCapture() { capturingGrayscale_ = false; }
+  bool writeCapturedGrayscale();  // Returns false if the strip buffers couldn't be allocated
 
   // Low level functions
   uint8_t* getFrameBuffer() const;
@@ -0,0 +1,137 @@
+#include "GlyphAtlas.h"
+
+#include <HardwareSerial.h>
+
+#include <cstring>
+
+#include "GlyphBlit.h"
+
+void GlyphAtlas::configure(const int orientation, const size_t budgetBytes) {
+  free(storage_);
+  storage_ = nullptr;
+  entries_ = nullptr;
+  index_ = nullptr;
+  planes_ = nullptr;
+  orientation_ = -1;
+  budgetBytes_ = 0;
+  hits_ = 0;
+  misses_ = 0;
+  entryCount_ = 0;
+  arenaTop_ = 0;
+  usedBytes_ = 0;
+  if (budgetBytes == 0 || !GlyphBlit::hasRotatedLayout(orientation)) return;
+
+  // Entries first keeps their pointers aligned; plane offsets are 16-bit
+  const size_t budget = budgetBytes < UINT16_MAX ? budgetBytes : UINT16_MAX;
+  storage_ = static_cast<uint8_t*>(malloc(MAX_ENTRIES * sizeof(Entry) + INDEX_SLOTS * sizeof(uint16_t) + budget));
+  if (!storage_) {
+    Serial.printf("[%lu] [GFX] Glyph atlas: allocation of %u bytes failed\n", millis(),
+                  static_cast<unsigned>(budget));
+    return;
+  }
+  entries_ = reinterpret_cast<Entry*>(storage_);
+  index_ = reinterpret_cast<uint16_t*>(storage_ + MAX_ENTRIES * sizeof(Entry));
+  planes_ = storage_ + MAX_ENTRIES * sizeof(Entry) + INDEX_SLOTS * sizeof(uint16_t);
+  orientation_ = orientation;
+  budgetBytes_ = budget;
+  clear();
+}
+
+void GlyphAtlas::clear() {
+  entryCount_ = 0;
+  arenaTop_ = 0;
+  usedBytes_ = 0;
+  if (index_) memset(index_, 0xFF, INDEX_SLOTS * sizeof(uint16_t));
+}
+
+size_t GlyphAtlas::slotOf(const EpdGlyph* glyph) {
+  // Glyphs are array elements, so the low pointer bits carry little entropy
+  const auto key = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(glyph));
+  return ((key * 2654435761u) >> 16) & (INDEX_SLOTS - 1);
+}
+
+uint16_t GlyphAtlas::find(const EpdGlyph* glyph) const {
+  for (size_t slot = slotOf(glyph);; slot = (slot + 1) & (INDEX_SLOTS - 1)) {
+    const uint16_t entry = index_[slot];
+    if (entry == EMPTY_SLOT || entries_[entry].glyph == glyph) return entry;
+  }
+}
+
+void GlyphAtlas::insertIndex(const EpdGlyph* glyph, const uint16_t entry) {
+  size_t slot = slotOf(glyph);
+  while (index_[slot] != EMPTY_SLOT) slot = (slot + 1) & (INDEX_SLOTS - 1);
+  index_[slot] = entry;
+}
+
+const uint8_t* GlyphAtlas::get(const EpdGlyph* glyph, const uint8_t* bitmap, const bool is2Bit) {
+  if (orientation_ < 0 || !glyph) return nullptr;
+
+  const uint16_t found = find(glyph);
+  if (found != EMPTY_SLOT) {
+    Entry& entry = entries_[found];
+    entry.lastUsed = ++useCounter_;
+    hits_++;
+    return planes_ + entry.offset;
+  }
+
+  misses_++;
+  const size_t bytes = glyph->width * GlyphBlit::rotatedRowBytes(glyph->height);
+  if (bytes == 0 || bytes > budgetBytes_) return nullptr;
+  if (entryCount_ >= MAX_ENTRIES || arenaTop_ + bytes > budgetBytes_) makeRoom(bytes);
+
+  uint8_t* plane = planes_ + arenaTop_;
+  GlyphBlit::buildRotated(bitmap, glyph->width, glyph->height, is2Bit, orientation_, plane);
+
+  const auto entry = static_cast<uint16_t>(entryCount_++);
+  entries_[entry] = {glyph, ++useCounter_, static_cast<uint16_t>(arenaTop_), static_cast<uint16_t>(bytes)};
+  insertIndex(glyph, entry);
+  arenaTop_ += bytes;
+  usedBytes_ += bytes;
+  return plane;
+}
+
+// Evicts least recently used entries until a quarter of the entries and budget is free beyond the new
+// glyph, so a full atlas compacts once per batch of misses rather than on every one
+void GlyphAtlas::makeRoom(const size_t bytes) {
+  const size_t entryTarget = MAX_ENTRIES - MAX_ENTRIES / 4;
+  const size_t byteTarget = budgetBytes_ - budgetBytes_ / 4;
+  size_t live = entryCount_;
+  while (live > 0 && (live > entryTarget || usedBytes_ + bytes > byteTarget)) {
+    size_t oldest = entryCount_;
+    for (size_t i = 0; i < entryCount_; i++) {
+      if (entries_[i].glyph && (oldest == entryCount_ || entries_[i].lastUsed < entries_[oldest].lastUsed)) {
+        oldest = i;
+      }
+    }
+    entries_[oldest].glyph = nullptr;
+    usedBytes_ -= entries_[oldest].bytes;
+    live--;
+  }
+
+  // Entries are in arena order, so sliding survivors down never overwrites one not yet moved
+  memset(index_, 0xFF, INDEX_SLOTS * sizeof(uint16_t));
+  size_t kept = 0;
+  arenaTop_ = 0;
+  for (size_t i = 0; i < entryCount_; i++) {
+    Entry entry = entries_[i];
+    if (!entry.glyph) continue;
+    memmove(planes_ + arenaTop_, planes_ + entry.offset, entry.bytes);
+    entry.offset = static_cast<uint16_t>(arenaTop_);
+    arenaTop_ += entry.bytes;
+    entries_[kept] = entry;
+    insertIndex(entry.glyph, static_cast<uint16_t>(kept));
+    kept++;
+  }
+  entryCount_ = kept;
+}
+
+void GlyphAtlas::logStats() const {
+  if (orientation_ < 0) {
+    Serial.printf("[%lu] [GFX] Glyph atlas: disabled\n", millis());
+    return;
+  }
+  Serial.printf("[%lu] [GFX] Glyph atlas: %u glyphs, %u/%u bytes, %lu hits, %lu misses\n", millis(),
+                static_cast<unsigned>(entryCount_), static_cast<unsigned>(usedBytes_),
+                static_cast<unsigned>(budgetBytes_), static_cast<unsigned long>(hits_),
+                static_cast<unsigned long>(misses_));
+}
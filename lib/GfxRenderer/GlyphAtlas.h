@@ -0,0 +1,83 @@
+#pragma once
+
+#include <EpdFontData.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+/**
+ * Bounded LRU of pre-rotated glyph planes for the active portrait orientation.
+ *
+ * Portrait maps glyph columns onto panel rows, so the regular blitter has to assemble every frame buffer
+ * byte from pixels in different bitmap rows. The atlas keeps the BW plane of hot glyphs in panel-native
+ * order (GlyphBlit::buildRotated) so GfxRenderer can OR whole bytes instead, which makes portrait text as
+ * cheap as landscape. Entries are keyed by EpdGlyph pointer and are dropped when fonts are removed.
+ *
+ * Storage is one allocation made by configure(): the entry table, an open-addressed index and a plane
+ * arena filled bottom up, so building a glyph never touches the heap. When the arena is full the least
+ * recently used entries are dropped in a batch and the survivors are compacted to the bottom.
+ *
+ * Owned by FontManager, which sizes the budget from free heap once the reader has opened its book.
+ */
+class GlyphAtlas {
+ public:
+  GlyphAtlas() = default;
+  ~GlyphAtlas() { free(storage_); }
+  GlyphAtlas(const GlyphAtlas&) = delete;
+  GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+  /**
+   * Drop all entries and set up for an orientation.
+   * @param orientation GfxRenderer::Orientation value; only portrait orientations are cached
+   * @param budgetBytes Max bytes of rotated planes (up to 64KB); 0 disables the atlas
+   */
+  void configure(int orientation, size_t budgetBytes);
+
+  /** Drop all entries, keeping the configuration and storage. */
+  void clear();
+
+  /** Orientation the atlas serves, or -1 when disabled. */
+  int orientation() const { return orientation_; }
+
+  /**
+   * Rotated BW plane for a glyph, built on a miss (evicting least recently used entries to fit).
+   * The pointer is valid until the next get(), which may compact the arena.
+   * @return nullptr if the atlas is disabled or the glyph doesn't fit the budget
+   */
+  const uint8_t* get(const EpdGlyph* glyph, const uint8_t* bitmap, bool is2Bit);
+
+  size_t usedBytes() const { return usedBytes_; }
+  size_t entryCount() const { return entryCount_; }
+  void logStats() const;
+
+ private:
+  static constexpr size_t MAX_ENTRIES = 256;
+  static constexpr size_t INDEX_SLOTS = 512;  // Power of two, at most half full
+  static constexpr uint16_t EMPTY_SLOT = 0xFFFF;
+
+  struct Entry {
+    const EpdGlyph* glyph;  // nullptr once evicted, until the next compaction
+    uint32_t lastUsed;
+    uint16_t offset;  // Into planes_
+    uint16_t bytes;
+  };
+
+  static size_t slotOf(const EpdGlyph* glyph);
+  uint16_t find(const EpdGlyph* glyph) const;
+  void insertIndex(const EpdGlyph* glyph, uint16_t entry);
+  void makeRoom(size_t bytes);
+
+  uint8_t* storage_ = nullptr;  // entries_, index_ and planes_ in one block
+  Entry* entries_ = nullptr;    // MAX_ENTRIES, in arena order
+  uint16_t* index_ = nullptr;   // INDEX_SLOTS entry numbers, linear probing
+  uint8_t* planes_ = nullptr;   // budgetBytes_
+  size_t entryCount_ = 0;
+  size_t arenaTop_ = 0;
+  int orientation_ = -1;
+  size_t budgetBytes_ = 0;
+  size_t usedBytes_ = 0;
+  uint32_t useCounter_ = 0;
+  uint32_t hits_ = 0;
+  uint32_t misses_ = 0;
+};
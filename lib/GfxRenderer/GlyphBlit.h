@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+// Orientation-specialized glyph blitter for GfxRenderer::renderChar.
+// Each logical orientation maps the screen onto the 800x480 panel with a fixed rotation, so one axis of the
+// glyph always walks along a panel row. The blitter clips the glyph once, then walks that axis building one
+// byte mask at a time and does a single read-modify-write per frame buffer byte instead of one per pixel.
+// Picked once per drawText via GlyphBlit::forOrientation(). The gray planes of captured glyphs are clipped and
+// walked the same way, one strip of panel rows at a time (grayStripFor()).
+
+namespace GlyphBlit {
+
+constexpr int PANEL_WIDTH = 800;
+constexpr int PANEL_HEIGHT = 480;
+constexpr int PANEL_WIDTH_BYTES = PANEL_WIDTH / 8;
+
+// Ink masks for 2-bit glyphs, indexed by pixel value (0 black, 1 dark gray, 2 light gray, 3 white)
+constexpr uint8_t INK_BW = 0x07;             // Anything but white
+constexpr uint8_t INK_GRAYSCALE_MSB = 0x06;  // Both grays
+constexpr uint8_t INK_GRAYSCALE_LSB = 0x02;  // Dark gray
+
+struct Glyph {
+  const uint8_t* bitmap;
+  int x;  // Logical position of the bitmap's top-left pixel
+  int y;
+  int width;
+  int height;
+};
+
+// setBits: true sets inked bits (white / gray plane flag), false clears them (black)
+using Fn = void (*)(uint8_t* frameBuffer, const Glyph& glyph, int screenWidth, int screenHeight, uint8_t inkMask,
+                    bool setBits);
+
+// Logical (x, y) -> panel (col, row), matching GfxRenderer::rotateCoordinates.
+// RowsAlongY: logical y advances along a panel row (portrait orientations).
+// RowsReversed: the panel row falls as the other logical axis grows.
+template <int Orientation>
+struct PanelMap;
+
+template <>
+struct PanelMap<0> {  // Portrait
+  static constexpr bool RowsAlongY = true;
+  static constexpr bool RowsReversed = true;
+  static constexpr int Step = 1;
+  static int col(int, int y) { return y; }
+  static int row(int x, int) { return PANEL_HEIGHT - 1 - x; }
+};
+
+template <>
+struct PanelMap<1> {  // LandscapeClockwise
+  static constexpr bool RowsAlongY = false;
+  static constexpr bool RowsReversed = true;
+  static constexpr int Step = -1;
+  static int col(int x, int) { return PANEL_WIDTH - 1 - x; }
+  static int row(int, int y) { return PANEL_HEIGHT - 1 - y; }
+};
+
+template <>
+struct PanelMap<2> {  // PortraitInverted
+  static constexpr bool RowsAlongY = true;
+  static constexpr bool RowsReversed = false;
+  static constexpr int Step = -1;
+  static int col(int, int y) { return PANEL_WIDTH - 1 - y; }
+  static int row(int x, int) { return x; }
+};
+
+template <>
+struct PanelMap<3> {  // LandscapeCounterClockwise
+  static constexpr bool RowsAlongY = false;
+  static constexpr bool RowsReversed = false;
+  static constexpr int Step = 1;
+  static int col(int x, int) { return x; }
+  static int row(int, int y) { return y; }
+};
+
+template <bool Is2Bit>
+inline bool inked(const uint8_t* bitmap, int pixelPosition, uint8_t inkMask) {
+  if (Is2Bit) {
+    const uint8_t byte = bitmap[pixelPosition / 4];
+    const uint8_t bitIndex = (3 - pixelPosition % 4) * 2;
+    // Font values are 0 white .. 3 black; flip to 0 black .. 3 white like renderChar
+    const uint8_t bmpVal = 3 - ((byte >> bitIndex) & 0x3);
+    return (inkMask >> bmpVal) & 1;
+  }
+  return (bitmap[pixelPosition / 8] >> (7 - pixelPosition % 8)) & 1;
+}
+
+inline void flush(uint8_t* byte, uint8_t mask, bool setBits) {
+  if (!mask) return;
+  if (setBits) {
+    *byte |= mask;
+  } else {
+    *byte &= ~mask;
+  }
+}
+
+// Glyph-local ranges of a glyph clipped to a strip: the outer axis steps panel rows, the inner axis panel columns
+struct Span {
+  int outer0, outer1;
+  int inner0, inner1;
+  int innerStride;
+};
+
+// Clips the glyph once, to the screen and to the panel rows [rowBegin, rowEnd); false if nothing is left
+template <int Orientation>
+inline bool clip(const Glyph& glyph, const int screenWidth, const int screenHeight, const int rowBegin,
+                 const int rowEnd, Span* span) {
+  using Map = PanelMap<Orientation>;
+
+  // Visible glyph-local ranges
+  const int gx0 = std::max(0, -glyph.x);
+  const int gx1 = std::min(glyph.width, screenWidth - glyph.x);
+  const int gy0 = std::max(0, -glyph.y);
+  const int gy1 = std::min(glyph.height, screenHeight - glyph.y);
+
+  // Outer positions whose panel row lies in [rowBegin, rowEnd)
+  const int outerOrigin = Map::RowsAlongY ? glyph.x : glyph.y;
+  const int outerBegin = (Map::RowsReversed ? PANEL_HEIGHT - rowEnd : rowBegin) - outerOrigin;
+  const int outerEnd = (Map::RowsReversed ? PANEL_HEIGHT - rowBegin : rowEnd) - outerOrigin;
+
+  span->outer0 = std::max(Map::RowsAlongY ? gx0 : gy0, outerBegin);
+  span->outer1 = std::min(Map::RowsAlongY ? gx1 : gy1, outerEnd);
+  span->inner0 = Map::RowsAlongY ? gy0 : gx0;
+  span->inner1 = Map::RowsAlongY ? gy1 : gx1;
+  span->innerStride = Map::RowsAlongY ? glyph.width : 1;
+  return span->outer0 < span->outer1 && span->inner0 < span->inner1;
+}
+
+template <int Orientation, bool Is2Bit>
+void blit(uint8_t* frameBuffer, const Glyph& glyph, const int screenWidth, const int screenHeight,
+          const uint8_t inkMask, const bool setBits) {
+  using Map = PanelMap<Orientation>;
+
+  // Clip once: visible glyph-local ranges
+  const int gx0 = std::max(0, -glyph.x);
+  const int gx1 = std::min(glyph.width, screenWidth - glyph.x);
+  const int gy0 = std::max(0, -glyph.y);
+  const int gy1 = std::min(glyph.height, screenHeight - glyph.y);
+  if (gx0 >= gx1 || gy0 >= gy1) return;
+
+  // Outer axis steps panel rows, inner axis steps panel columns
+  const int outer0 = Map::RowsAlongY ? gx0 : gy0;
+  const int outer1 = Map::RowsAlongY ? gx1 : gy1;
+  const int inner0 = Map::RowsAlongY ? gy0 : gx0;
+  const int inner1 = Map::RowsAlongY ? gy1 : gx1;
+  const int innerStride = Map::RowsAlongY ? glyph.width : 1;
+
+  for (int outer = outer0; outer < outer1; outer++) {
+    const int firstX = glyph.x + (Map::RowsAlongY ? outer : inner0);
+    const int firstY = glyph.y + (Map::RowsAlongY ? inner0 : outer);
+    uint8_t* row = frameBuffer + Map::row(firstX, firstY) * PANEL_WIDTH_BYTES;
+    int col = Map::col(firstX, firstY);
+    int byteIndex = col >> 3;
+    uint8_t mask = 0;
+    int pixelPosition = Map::RowsAlongY ? inner0 * glyph.width + outer : outer * glyph.width + inner0;
+
+    for (int inner = inner0; inner < inner1; inner++) {
+      if ((col >> 3) != byteIndex) {
+        flush(row + byteIndex, mask, setBits);
+        mask = 0;
+        byteIndex = col >> 3;
+      }
+      if (inked<Is2Bit>(glyph.bitmap, pixelPosition, inkMask)) mask |= 0x80 >> (col & 7);
+      col += Map::Step;
+      pixelPosition += innerStride;
+    }
+    flush(row + byteIndex, mask, setBits);
+  }
+}
+
+// Both gray planes of a 2-bit glyph in one walk, for the panel rows [stripRow, stripRow + stripRows) a strip
+// buffer holds. Sets the bits the GRAYSCALE_LSB/GRAYSCALE_MSB blits set in a frame buffer cleared to 0x00.
+using GrayStripFn = void (*)(uint8_t* lsbStrip, uint8_t* msbStrip, const Glyph& glyph, int screenWidth,
+                             int screenHeight, int stripRow, int stripRows);
+
+template <int Orientation>
+void grayStrip(uint8_t* lsbStrip, uint8_t* msbStrip, const Glyph& glyph, const int screenWidth,
+               const int screenHeight, const int stripRow, const int stripRows) {
+  using Map = PanelMap<Orientation>;
+  Span span;
+  if (!clip<Orientation>(glyph, screenWidth, screenHeight, stripRow, stripRow + stripRows, &span)) return;
+
+  const int inner0 = span.inner0;
+  const int inner1 = span.inner1;
+  const int innerStride = span.innerStride;
+
+  for (int outer = span.outer0; outer < span.outer1; outer++) {
+    const int firstX = glyph.x + (Map::RowsAlongY ? outer : inner0);
+    const int firstY = glyph.y + (Map::RowsAlongY ? inner0 : outer);
+    const int stripOffset = (Map::row(firstX, firstY) - stripRow) * PANEL_WIDTH_BYTES;
+    uint8_t* lsbRow = lsbStrip + stripOffset;
+    uint8_t* msbRow = msbStrip + stripOffset;
+    int col = Map::col(firstX, firstY);
+    int byteIndex = col >> 3;
+    uint8_t lsb = 0;
+    uint8_t msb = 0;
+    int pixelPosition = Map::RowsAlongY ? inner0 * glyph.width + outer : outer * glyph.width + inner0;
+
+    for (int inner = inner0; inner < inner1; inner++) {
+      if ((col >> 3) != byteIndex) {
+        lsbRow[byteIndex] |= lsb;
+        msbRow[byteIndex] |= msb;
+        lsb = 0;
+        msb = 0;
+        byteIndex = col >> 3;
+      }
+      // Font values are 0 white .. 3 black; flip to 0 black .. 3 white like renderChar
+      const uint8_t value = 3 - ((glyph.bitmap[pixelPosition / 4] >> ((3 - pixelPosition % 4) * 2)) & 0x3);
+      const uint8_t bit = 0x80 >> (col & 7);
+      if ((INK_GRAYSCALE_LSB >> value) & 1) lsb |= bit;
+      if ((INK_GRAYSCALE_MSB >> value) & 1) msb |= bit;
+      col += Map::Step;
+      pixelPosition += innerStride;
+    }
+    lsbRow[byteIndex] |= lsb;
+    msbRow[byteIndex] |= msb;
+  }
+}
+
+// Pre-rotated BW plane (GlyphAtlas): one row per glyph column, packed MSB first in panel column order, so a
+// fully on-screen glyph is blitted with whole-byte shifts. Only portrait orientations need it; landscape glyph
+// rows already run along panel rows.
+inline bool hasRotatedLayout(const int orientation) { return orientation == 0 || orientation == 2; }
+
+inline int rotatedRowBytes(const int height) { return (height + 7) / 8; }
+
+// out must hold width * rotatedRowBytes(height) bytes
+inline void buildRotated(const uint8_t* bitmap, const int width, const int height, const bool is2Bit,
+                         const int orientation, uint8_t* out) {
+  const int rowBytes = rotatedRowBytes(height);
+  std::fill(out, out + width * rowBytes, 0);
+  for (int gx = 0; gx < width; gx++) {
+    uint8_t* row = out + gx * rowBytes;
+    for (int gy = 0; gy < height; gy++) {
+      const int pixelPosition = gy * width + gx;
+      const bool ink = is2Bit ? inked<true>(bitmap, pixelPosition, INK_BW) : inked<false>(bitmap, pixelPosition, 0);
+      if (!ink) continue;
+      // Portrait: panel column grows with y; PortraitInverted: it shrinks
+      const int bit = orientation == 0 ? gy : height - 1 - gy;
+      row[bit >> 3] |= 0x80 >> (bit & 7);
+    }
+  }
+}
+
+// Glyph must lie fully on screen (no clipping here)
+inline void blitRotated(uint8_t* frameBuffer, const uint8_t* plane, const int width, const int height, const int x,
+                        const int y, const int orientation, const bool setBits) {
+  const int rowBytes = rotatedRowBytes(height);
+  const int col0 = orientation == 0 ? y : PANEL_WIDTH - y - height;
+  const int shift = col0 & 7;
+  for (int gx = 0; gx < width; gx++) {
+    const int panelRow = orientation == 0 ? PANEL_HEIGHT - 1 - (x + gx) : x + gx;
+    uint8_t* dst = frameBuffer + panelRow * PANEL_WIDTH_BYTES + (col0 >> 3);
+    const uint8_t* src = plane + gx * rowBytes;
+    for (int b = 0; b < rowBytes; b++) {
+      const uint8_t bits = src[b];
+      if (!bits) continue;
+      // Bits past the glyph height are zero, so the spill byte is only touched inside the panel row
+      flush(dst + b, bits >> shift, setBits);
+      flush(dst + b + 1, static_cast<uint8_t>(bits << (8 - shift)), setBits);
+    }
+  }
+}
+
+// orientation is a GfxRenderer::Orientation value
+inline Fn forOrientation(const int orientation, const bool is2Bit) {
+  switch (orientation) {
+    case 1:
+      return is2Bit ? blit<1, true> : blit<1, false>;
+    case 2:
+      return is2Bit ? blit<2, true> : blit<2, false>;
+    case 3:
+      return is2Bit ? blit<3, true> : blit<3, false>;
+    case 0:
+    default:
+      return is2Bit ? blit<0, true> : blit<0, false>;
+  }
+}
+
+// orientation is a GfxRenderer::Orientation value
+inline GrayStripFn grayStripFor(const int orientation) {
+  switch (orientation) {
+    case 1:
+      return grayStrip<1>;
+    case 2:
+      return grayStrip<2>;
+    case 3:
+      return grayStrip<3>;
+    case 0:
+    default:
+      return grayStrip<0>;
+  }
+}
+
+}  // namespace GlyphBlit
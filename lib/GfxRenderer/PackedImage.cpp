@@ -0,0 +1,62 @@
+#include "PackedImage.h"
+
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+
+#include <memory>
+#include <new>
+
+#include "Bitmap.h"
+
+namespace PackedImage {
+
+bool writeFromBmp(const std::string& bmpPath, const std::string& outPath) {
+  FsFile bmpFile;
+  if (!SdMan.openFileForRead("PKI", bmpPath, bmpFile)) {
+    return false;
+  }
+  Bitmap bitmap(bmpFile);
+  if (bitmap.parseHeaders() != BmpReaderError::Ok || bitmap.getWidth() > UINT16_MAX ||
+      bitmap.getHeight() > UINT16_MAX) {
+    bmpFile.close();
+    return false;
+  }
+
+  const int width = bitmap.getWidth();
+  const int height = bitmap.getHeight();
+  const int packedBytes = rowBytes(width);
+  std::unique_ptr<uint8_t[]> fileRow(new (std::nothrow) uint8_t[bitmap.getRowBytes()]);
+  std::unique_ptr<uint8_t[]> bmpRow(new (std::nothrow) uint8_t[packedBytes]);
+  std::unique_ptr<uint8_t[]> packed(new (std::nothrow) uint8_t[packedBytes]);
+  FsFile out;
+  if (!fileRow || !bmpRow || !packed || !SdMan.openFileForWrite("PKI", outPath, out)) {
+    bmpFile.close();
+    return false;
+  }
+
+  const Header header = {MAGIC, static_cast<uint16_t>(width), static_cast<uint16_t>(height)};
+  bool ok = out.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header);
+
+  // Bottom-up BMPs are read backwards so the packed rows are always top-down
+  const size_t dataStart = bmpFile.position();
+  for (int y = 0; ok && y < height; y++) {
+    if (!bitmap.isTopDown()) {
+      ok = bmpFile.seek(dataStart + static_cast<size_t>(height - 1 - y) * bitmap.getRowBytes());
+    }
+    ok = ok && bitmap.readRow(bmpRow.get(), fileRow.get(), y) == BmpReaderError::Ok;
+    if (ok) {
+      packRow(bmpRow.get(), width, packed.get());
+      ok = out.write(packed.get(), packedBytes) == static_cast<size_t>(packedBytes);
+    }
+  }
+  out.close();
+  bmpFile.close();
+
+  if (!ok) {
+    Serial.printf("[%lu] [PKI] Failed to pack %s\n", millis(), bmpPath.c_str());
+    SdMan.remove(outPath.c_str());
+  }
+  return ok;
+}
+
+}  // namespace PackedImage
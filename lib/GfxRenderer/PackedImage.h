@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * Panel-ready cache of inline EPUB images.
+ *
+ * The dithered, viewport-sized BMP an image is converted to is decoded once more into the renderer's
+ * 2-bit glyph layout (0 white .. 3 black, MSB first), with rows padded to whole bytes using white. Pages
+ * then draw it strip by strip through GlyphBlit (GfxRenderer::drawPackedImage) instead of decoding BMP
+ * rows and calling drawPixel for every pixel in each of the BW, LSB and MSB passes.
+ *
+ * File: [Header][height rows of rowBytes(width) bytes], top-down.
+ */
+namespace PackedImage {
+
+constexpr uint32_t MAGIC = 0x32494B50;  // "PKI2"
+
+struct Header {
+  uint32_t magic;
+  uint16_t width;
+  uint16_t height;
+};
+
+inline int rowBytes(const int width) { return (width + 3) / 4; }
+
+/** Path of the packed image cached next to a BMP. */
+inline std::string pathFor(const std::string& bmpPath) {
+  const size_t dot = bmpPath.rfind('.');
+  const size_t slash = bmpPath.rfind('/');
+  const bool hasExt = dot != std::string::npos && (slash == std::string::npos || dot > slash);
+  return (hasExt ? bmpPath.substr(0, dot) : bmpPath) + ".pki";
+}
+
+/**
+ * Convert one Bitmap::readRow row (0 black .. 3 white) into the packed layout; padding pixels become
+ * white so they never ink.
+ */
+inline void packRow(const uint8_t* bmpRow, const int width, uint8_t* out) {
+  // Bitmap rows are 0 black .. 3 white, glyphs 0 white .. 3 black: the same bits inverted
+  const int bytes = rowBytes(width);
+  for (int i = 0; i < bytes; i++) out[i] = static_cast<uint8_t>(~bmpRow[i]);
+  const int tail = width % 4;
+  if (tail) out[bytes - 1] &= static_cast<uint8_t>(0xFF << (8 - tail * 2));
+}
+
+/** Convert a cached BMP; on failure no file is left behind. */
+bool writeFromBmp(const std::string& bmpPath, const std::string& outPath);
+
+}  // namespace PackedImage
@@ -0,0 +1,202 @@
+#include "WordWidthCache.h"
+
+#include <HardwareSerial.h>
+#include <Serialization.h>
+
+#include <cstring>
+#include <new>
+
+uint64_t WordWidthCache::hashKey(const int fontId, const EpdFontFamily::Style style, const char* text,
+                                 uint32_t* check) {
+  // FNV-1a hash; a 32-bit FNV-1a over style and text runs alongside it for the check word
+  uint64_t hash = 14695981039346656037ULL;
+  uint32_t second = 2166136261u;
+  hash ^= static_cast<uint64_t>(fontId);
+  hash *= 1099511628211ULL;
+  hash ^= static_cast<uint64_t>(style);
+  hash *= 1099511628211ULL;
+  second ^= static_cast<uint32_t>(style);
+  second *= 16777619u;
+  size_t length = 0;
+  for (; text[length]; length++) {
+    const auto c = static_cast<uint8_t>(text[length]);
+    hash ^= c;
+    hash *= 1099511628211ULL;
+    second ^= c;
+    second *= 16777619u;
+  }
+  *check = (second & 0xFFFFFF00u) | static_cast<uint32_t>(length < 0xFF ? length : 0xFF);
+  return hash;
+}
+
+bool WordWidthCache::lookup(const int fontId, const EpdFontFamily::Style style, const char* text, int* width) {
+  if (!entries_) {
+    misses_++;
+    return false;
+  }
+
+  uint32_t check;
+  const uint64_t hash = hashKey(fontId, style, text, &check);
+  const size_t set = hash & (SETS - 1);
+  const uint32_t tag = tagOf(hash);
+  const uint16_t font = fontTag(fontId);
+  const Entry* ways = entries_ + set * WAYS;
+  for (size_t w = 0; w < WAYS; w++) {
+    if (ways[w].tag == tag && ways[w].check == check && ways[w].font == font) {
+      clock_[set] |= 1 << w;
+      *width = ways[w].width;
+      hits_++;
+      return true;
+    }
+  }
+  misses_++;
+  return false;
+}
+
+void WordWidthCache::insert(const int fontId, const EpdFontFamily::Style style, const char* text, const int width) {
+  if (!entries_ && !allocate()) return;
+  uint32_t check;
+  const uint64_t hash = hashKey(fontId, style, text, &check);
+  place(hash & (SETS - 1), tagOf(hash), check, fontTag(fontId), static_cast<int16_t>(width));
+}
+
+void WordWidthCache::place(const size_t set, const uint32_t tag, const uint32_t check, const uint16_t font,
+                           const int16_t width) {
+  Entry* ways = entries_ + set * WAYS;
+  uint8_t& clock = clock_[set];
+
+  size_t way = WAYS;
+  for (size_t w = 0; w < WAYS && way == WAYS; w++) {
+    if (ways[w].tag == tag && ways[w].check == check && ways[w].font == font) way = w;
+  }
+  for (size_t w = 0; w < WAYS && way == WAYS; w++) {
+    if (ways[w].tag == 0) way = w;
+  }
+
+  if (way == WAYS) {
+    // CLOCK: referenced ways get a second chance, the first unreferenced one is replaced
+    size_t hand = (clock >> 4) & 0x03;
+    while (clock & (1 << hand)) {
+      clock &= ~(1 << hand);
+      hand = (hand + 1) % WAYS;
+    }
+    way = hand;
+    clock = (clock & 0x0F) | (((hand + 1) % WAYS) << 4);
+    evictions_++;
+  }
+
+  ways[way] = {tag, check, font, width};
+  clock &= ~(1 << way);  // New entries must earn their reference bit
+}
+
+bool WordWidthCache::allocate() {
+  entries_ = new (std::nothrow) Entry[SETS * WAYS];
+  clock_ = new (std::nothrow) uint8_t[SETS];
+  if (!entries_ || !clock_) {
+    Serial.printf("[%lu] [GFX] Width cache: allocation failed\n", millis());
+    release();
+    return false;
+  }
+  clear();
+  return true;
+}
+
+void WordWidthCache::clearFont(const int fontId) {
+  if (!entries_) return;
+  const uint16_t font = fontTag(fontId);
+  for (size_t i = 0; i < SETS * WAYS; i++) {
+    if (entries_[i].font == font) entries_[i].tag = 0;
+  }
+}
+
+void WordWidthCache::clear() {
+  if (!entries_) return;
+  memset(entries_, 0, SETS * WAYS * sizeof(Entry));
+  memset(clock_, 0, SETS);
+}
+
+void WordWidthCache::release() {
+  delete[] entries_;
+  delete[] clock_;
+  entries_ = nullptr;
+  clock_ = nullptr;
+}
+
+size_t WordWidthCache::entryCount() const {
+  if (!entries_) return 0;
+  size_t count = 0;
+  for (size_t i = 0; i < SETS * WAYS; i++) {
+    if (entries_[i].tag) count++;
+  }
+  return count;
+}
+
+bool WordWidthCache::save(FsFile& file, const int fontId, const int32_t fingerprint) const {
+  const uint16_t font = fontTag(fontId);
+  uint16_t count = 0;
+  if (entries_) {
+    for (size_t i = 0; i < SETS * WAYS; i++) {
+      if (entries_[i].tag && entries_[i].font == font) count++;
+    }
+  }
+
+  bool ok = true;
+  auto put = [&file, &ok](const auto& value) {
+    if (ok && file.write(reinterpret_cast<const uint8_t*>(&value), sizeof(value)) != sizeof(value)) ok = false;
+  };
+
+  put(FILE_VERSION);
+  put(static_cast<uint16_t>(SETS));
+  put(static_cast<int32_t>(fontId));
+  put(fingerprint);
+  put(count);
+  for (size_t i = 0; count > 0 && i < SETS * WAYS; i++) {
+    if (!entries_[i].tag || entries_[i].font != font) continue;
+    put(static_cast<uint8_t>(i / WAYS));
+    put(entries_[i].tag);
+    put(entries_[i].check);
+    put(entries_[i].width);
+  }
+  return ok;
+}
+
+bool WordWidthCache::load(FsFile& file, const int fontId, const int32_t fingerprint) {
+  uint8_t version;
+  uint16_t sets;
+  int32_t savedFontId;
+  int32_t savedFingerprint;
+  uint16_t count;
+  if (!serialization::readPodChecked(file, version) || !serialization::readPodChecked(file, sets) ||
+      !serialization::readPodChecked(file, savedFontId) || !serialization::readPodChecked(file, savedFingerprint) ||
+      !serialization::readPodChecked(file, count)) {
+    return false;
+  }
+  if (version != FILE_VERSION || sets != SETS || savedFontId != fontId || savedFingerprint != fingerprint ||
+      count > MAX_SAVED_ENTRIES) {
+    return false;
+  }
+  if (!entries_ && !allocate()) return false;
+
+  const uint16_t font = fontTag(fontId);
+  for (uint16_t i = 0; i < count; i++) {
+    uint8_t set;
+    uint32_t tag;
+    uint32_t check;
+    int16_t width;
+    if (!serialization::readPodChecked(file, set) || !serialization::readPodChecked(file, tag) ||
+        !serialization::readPodChecked(file, check) || !serialization::readPodChecked(file, width)) {
+      return false;
+    }
+    if (tag) place(set, tag, check, font, width);
+  }
+  return true;
+}
+
+void WordWidthCache::logStats() const {
+  const uint32_t lookups = hits_ + misses_;
+  Serial.printf("[%lu] [GFX] Width cache: %lu hits, %lu misses (%lu%% hit), %lu evictions, %u/%u entries\n", millis(),
+                static_cast<unsigned long>(hits_), static_cast<unsigned long>(misses_),
+                static_cast<unsigned long>(lookups ? hits_ * 100ULL / lookups : 0),
+                static_cast<unsigned long>(evictions_), static_cast<unsigned>(entryCount()),
+                static_cast<unsigned>(SETS * WAYS));
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+#include <SdFat.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Fixed-size cache of measured word widths, shared by every font and kept across chapters.
+ *
+ * Words are keyed by a 64-bit FNV-1a hash of (fontId, style, text): the low bits pick a 4-way set,
+ * the high 32 bits are stored as the tag. A hit also needs the font tag and a check word to match:
+ * 24 bits of a separate 32-bit FNV-1a over style and text, plus the text length. A false hit then takes
+ * two words of the same length agreeing on 64 hash bits, about 2^-62 per lookup across the 4 ways,
+ * which no book's vocabulary comes near. Storage is one 12 KB allocation made on first insert, so
+ * lookups and inserts never touch the heap. A full set evicts with CLOCK (second chance) rather than
+ * clearing the cache, so common words stay warm through a whole book.
+ *
+ * Entries of one font can be saved to a book's cache directory and loaded back, so the next session,
+ * chapter or font switch starts warm. GfxRenderer owns the cache and handles file paths.
+ */
+class WordWidthCache {
+ public:
+  static constexpr size_t WAYS = 4;
+  static constexpr size_t SETS = 256;
+
+  WordWidthCache() = default;
+  ~WordWidthCache() { release(); }
+  WordWidthCache(const WordWidthCache&) = delete;
+  WordWidthCache& operator=(const WordWidthCache&) = delete;
+
+  bool lookup(int fontId, EpdFontFamily::Style style, const char* text, int* width);
+  void insert(int fontId, EpdFontFamily::Style style, const char* text, int width);
+
+  /** Drop entries of one font (or all), keeping the storage. */
+  void clearFont(int fontId);
+  void clear();
+  /** Free the storage; the next insert allocates it again. */
+  void release();
+
+  /**
+   * Persist entries of one font. fingerprint identifies the font data the widths were measured with;
+   * load() rejects a file whose font id, fingerprint or layout differ.
+   */
+  bool save(FsFile& file, int fontId, int32_t fingerprint) const;
+  bool load(FsFile& file, int fontId, int32_t fingerprint);
+
+  size_t entryCount() const;
+  uint32_t hits() const { return hits_; }
+  uint32_t misses() const { return misses_; }
+  uint32_t evictions() const { return evictions_; }
+  void logStats() const;
+
+ private:
+  static constexpr uint8_t FILE_VERSION = 2;
+  static constexpr uint16_t MAX_SAVED_ENTRIES = SETS * WAYS;
+
+  struct Entry {
+    uint32_t tag;    // 0 = empty
+    uint32_t check;  // Second hash and text length from hashKey(), compared on every hit
+    uint16_t font;   // fontTag(fontId), for per-font clearing and saving
+    int16_t width;
+  };
+
+  // Returns the set/tag hash and stores the check word in *check
+  static uint64_t hashKey(int fontId, EpdFontFamily::Style style, const char* text, uint32_t* check);
+  static uint16_t fontTag(int fontId) { return static_cast<uint16_t>(fontId ^ (static_cast<uint32_t>(fontId) >> 16)); }
+  static uint32_t tagOf(uint64_t hash) {
+    const auto tag = static_cast<uint32_t>(hash >> 32);
+    return tag ? tag : 1;
+  }
+  bool allocate();
+  void place(size_t set, uint32_t tag, uint32_t check, uint16_t font, int16_t width);
+
+  Entry* entries_ = nullptr;  // SETS * WAYS
+  uint8_t* clock_ = nullptr;  // Per set: bits 0-3 referenced ways, bits 4-5 clock hand
+  uint32_t hits_ = 0;
+  uint32_t misses_ = 0;
+  uint32_t evictions_ = 0;
+};
@@ -13,10 +13,7 @@ namespace {
 constexpr const char* VOID_ELEMENTS[] = {"img",  "br",  "hr",    "input", "meta",   "link",  "area",
                                          "base", "col", "embed", "param", "source", "track", "wbr"};
 constexpr size_t VOID_ELEMENT_COUNT = sizeof(VOID_ELEMENTS) / sizeof(VOID_ELEMENTS[0]);
-constexpr size_t MAX_TAG_NAME_LENGTH = 8;
-constexpr size_t BUFFER_SIZE = 512;
-
-enum class State { Normal, InTagStart, InTagName, InTagAttrs, InQuote, InClosingTagName, InClosingTagRest };
+constexpr size_t FILE_READ_SIZE = 512;
 
 char toLowerAscii(char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c; }
 
@@ -38,241 +35,258 @@ bool isVoidElement(const char* name, size_t len) {
 
 }  // namespace
 
-bool normalizeVoidElements(const std::string& inputPath, const std::string& outputPath) {
-  FsFile inFile, outFile;
+size_t VoidElementNormalizer::write(const uint8_t c) { return write(&c, 1); }
 
-  if (!SdMan.openFileForRead("H5N", inputPath, inFile)) {
-    return false;
-  }
+size_t VoidElementNormalizer::write(const uint8_t* buffer, const size_t size) {
+  if (failed_) return 0;
 
-  if (!SdMan.openFileForWrite("H5N", outputPath, outFile)) {
-    inFile.close();
-    return false;
+  for (size_t i = 0; i < size; i++) {
+    if (!process(static_cast<char>(buffer[i]))) {
+      failed_ = true;
+      return 0;
+    }
   }
+  return size;
+}
 
-  State state = State::Normal;
-  char tagName[MAX_TAG_NAME_LENGTH + 1] = {0};
-  size_t tagNameLen = 0;
-  char closingTagWhitespace[8] = {0};  // Buffer for whitespace in closing tags
-  size_t closingTagWsLen = 0;
-  bool isCurrentTagVoid = false;
-  char quoteChar = 0;
-  char prevChar = 0;
-
-  uint8_t readBuffer[BUFFER_SIZE];
-  uint8_t writeBuffer[BUFFER_SIZE + 64];  // Extra space for insertions
-  size_t writePos = 0;
-
-  auto flushWrite = [&]() -> bool {
-    if (writePos > 0) {
-      if (outFile.write(writeBuffer, writePos) != writePos) {
-        return false;
-      }
-      writePos = 0;
+bool VoidElementNormalizer::flushWrite() {
+  if (writePos_ > 0) {
+    if (out_.write(writeBuffer_, writePos_) != writePos_) {
+      return false;
     }
-    return true;
-  };
+    writePos_ = 0;
+  }
+  return true;
+}
 
-  auto writeChar = [&](char c) -> bool {
-    writeBuffer[writePos++] = static_cast<uint8_t>(c);
-    if (writePos >= BUFFER_SIZE) {
-      return flushWrite();
-    }
+bool VoidElementNormalizer::writeChar(const char c) {
+  if (outputCount_++ < discardUntil_) {
     return true;
-  };
+  }
+  writeBuffer_[writePos_++] = static_cast<uint8_t>(c);
+  if (writePos_ >= BUFFER_SIZE) {
+    return flushWrite();
+  }
+  return true;
+}
 
-  while (inFile.available()) {
-    int bytesRead = inFile.read(readBuffer, BUFFER_SIZE);
-    if (bytesRead <= 0) break;
+bool VoidElementNormalizer::writeClosingTag(const bool withWhitespace) {
+  if (!writeChar('<') || !writeChar('/')) return false;
+  for (size_t j = 0; j < tagNameLen_; j++) {
+    if (!writeChar(tagName_[j])) return false;
+  }
+  if (withWhitespace) {
+    for (size_t j = 0; j < closingTagWsLen_; j++) {
+      if (!writeChar(closingTagWhitespace_[j])) return false;
+    }
+  }
+  return true;
+}
 
-    for (int i = 0; i < bytesRead; i++) {
-      char c = static_cast<char>(readBuffer[i]);
-
-      switch (state) {
-        case State::Normal:
-          if (c == '<') {
-            state = State::InTagStart;
-            tagNameLen = 0;
-            isCurrentTagVoid = false;
-            // Don't write '<' yet - might need to skip if it's a void element closing tag
-          } else {
-            if (!writeChar(c)) goto error;
-          }
-          break;
-
-        case State::InTagStart:
-          if (c == '/') {
-            // Closing tag - need to check if it's a void element
-            state = State::InClosingTagName;
-            tagNameLen = 0;
-            closingTagWsLen = 0;
-            // Don't write '</' yet - buffer it in case we need to skip
-          } else if (c == '!' || c == '?') {
-            // Comment or processing instruction - skip normalization
-            state = State::Normal;
-            if (!writeChar('<')) goto error;
-            if (!writeChar(c)) goto error;
-          } else if (std::isalpha(static_cast<unsigned char>(c))) {
-            state = State::InTagName;
-            tagName[0] = c;
-            tagNameLen = 1;
-            if (!writeChar('<')) goto error;
-            if (!writeChar(c)) goto error;
-          } else {
-            state = State::Normal;
-            if (!writeChar('<')) goto error;
-            if (!writeChar(c)) goto error;
-          }
-          break;
-
-        case State::InTagName:
-          if (std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == ':') {
-            if (tagNameLen < MAX_TAG_NAME_LENGTH) {
-              tagName[tagNameLen++] = c;
-            }
-            if (!writeChar(c)) goto error;
-          } else {
-            // End of tag name
-            tagName[tagNameLen] = '\0';
-            isCurrentTagVoid = isVoidElement(tagName, tagNameLen);
-
-            if (c == '>') {
-              // Tag ends immediately after name
-              if (isCurrentTagVoid && prevChar != '/') {
-                if (!writeChar(' ')) goto error;
-                if (!writeChar('/')) goto error;
-              }
-              if (!writeChar(c)) goto error;
-              state = State::Normal;
-            } else if (std::isspace(static_cast<unsigned char>(c))) {
-              state = State::InTagAttrs;
-              if (!writeChar(c)) goto error;
-            } else if (c == '/') {
-              // Self-closing indicator
-              if (!writeChar(c)) goto error;
-              state = State::InTagAttrs;
-            } else {
-              // Unexpected character
-              if (!writeChar(c)) goto error;
-              state = State::Normal;
-            }
-          }
-          break;
-
-        case State::InTagAttrs:
-          if (c == '"' || c == '\'') {
-            state = State::InQuote;
-            quoteChar = c;
-            if (!writeChar(c)) goto error;
-          } else if (c == '>') {
-            // End of tag - insert self-closing if needed
-            if (isCurrentTagVoid && prevChar != '/') {
-              if (!writeChar(' ')) goto error;
-              if (!writeChar('/')) goto error;
-            }
-            if (!writeChar(c)) goto error;
-            state = State::Normal;
-          } else {
-            if (!writeChar(c)) goto error;
-          }
-          break;
+bool VoidElementNormalizer::syncPointBefore(const uint32_t outputOffset, SyncPoint* point) const {
+  const size_t kept = std::min(syncCount_, SYNC_POINTS);
+  for (size_t i = 0; i < kept; i++) {
+    const SyncPoint& candidate = syncPoints_[(syncCount_ - 1 - i) % SYNC_POINTS];
+    if (candidate.output <= outputOffset) {
+      *point = candidate;
+      return true;
+    }
+  }
+  return false;
+}
 
-        case State::InQuote:
-          if (c == quoteChar) {
-            state = State::InTagAttrs;
-          }
-          if (!writeChar(c)) goto error;
-          break;
-
-        case State::InClosingTagName:
-          if (std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == ':') {
-            if (tagNameLen < MAX_TAG_NAME_LENGTH) {
-              tagName[tagNameLen++] = c;
-            } else {
-              // Tag too long to be void - flush buffer and passthrough
-              if (!writeChar('<')) goto error;
-              if (!writeChar('/')) goto error;
-              for (size_t j = 0; j < tagNameLen; j++) {
-                if (!writeChar(tagName[j])) goto error;
-              }
-              if (!writeChar(c)) goto error;
-              state = State::InClosingTagRest;
-            }
-          } else if (c == '>') {
-            // End of closing tag - check if it's a void element
-            tagName[tagNameLen] = '\0';
-            if (isVoidElement(tagName, tagNameLen)) {
-              // Skip the entire closing tag (don't output anything)
-            } else {
-              // Not a void element - output the buffered "</tagname>" with any whitespace
-              if (!writeChar('<')) goto error;
-              if (!writeChar('/')) goto error;
-              for (size_t j = 0; j < tagNameLen; j++) {
-                if (!writeChar(tagName[j])) goto error;
-              }
-              for (size_t j = 0; j < closingTagWsLen; j++) {
-                if (!writeChar(closingTagWhitespace[j])) goto error;
-              }
-              if (!writeChar('>')) goto error;
-            }
-            state = State::Normal;
-          } else if (std::isspace(static_cast<unsigned char>(c))) {
-            // Whitespace before '>' in closing tag (unusual but valid)
-            // Buffer it in case we need to replay for non-void elements
-            if (closingTagWsLen < sizeof(closingTagWhitespace)) {
-              closingTagWhitespace[closingTagWsLen++] = c;
-            }
-          } else {
-            // Unexpected character - output what we have and return to normal
-            if (!writeChar('<')) goto error;
-            if (!writeChar('/')) goto error;
-            for (size_t j = 0; j < tagNameLen; j++) {
-              if (!writeChar(tagName[j])) goto error;
-            }
-            if (!writeChar(c)) goto error;
-            state = State::Normal;
+bool VoidElementNormalizer::process(const char c) {
+  // Between tags nothing is buffered, so this is a point a fresh normalizer can start from
+  if (state_ == State::Normal && !holdSyncPoints_ &&
+      (syncCount_ == 0 || outputCount_ - syncPoints_[(syncCount_ - 1) % SYNC_POINTS].output >= SYNC_INTERVAL)) {
+    syncPoints_[syncCount_++ % SYNC_POINTS] = {inputCount_, outputCount_};
+  }
+  inputCount_++;
+
+  switch (state_) {
+    case State::Normal:
+      if (c == '<') {
+        state_ = State::InTagStart;
+        tagNameLen_ = 0;
+        isCurrentTagVoid_ = false;
+        // Don't write '<' yet - might need to skip if it's a void element closing tag
+      } else {
+        if (!writeChar(c)) return false;
+      }
+      break;
+
+    case State::InTagStart:
+      if (c == '/') {
+        // Closing tag - need to check if it's a void element
+        state_ = State::InClosingTagName;
+        tagNameLen_ = 0;
+        closingTagWsLen_ = 0;
+        // Don't write '</' yet - buffer it in case we need to skip
+      } else if (c == '!' || c == '?') {
+        // Comment or processing instruction - skip normalization
+        state_ = State::Normal;
+        if (!writeChar('<') || !writeChar(c)) return false;
+      } else if (std::isalpha(static_cast<unsigned char>(c))) {
+        state_ = State::InTagName;
+        tagName_[0] = c;
+        tagNameLen_ = 1;
+        if (!writeChar('<') || !writeChar(c)) return false;
+      } else {
+        state_ = State::Normal;
+        if (!writeChar('<') || !writeChar(c)) return false;
+      }
+      break;
+
+    case State::InTagName:
+      if (std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == ':') {
+        if (tagNameLen_ < MAX_TAG_NAME_LENGTH) {
+          tagName_[tagNameLen_++] = c;
+        }
+        if (!writeChar(c)) return false;
+      } else {
+        // End of tag name
+        tagName_[tagNameLen_] = '\0';
+        isCurrentTagVoid_ = isVoidElement(tagName_, tagNameLen_);
+
+        if (c == '>') {
+          // Tag ends immediately after name
+          if (isCurrentTagVoid_ && prevChar_ != '/') {
+            if (!writeChar(' ') || !writeChar('/')) return false;
           }
-          break;
+          if (!writeChar(c)) return false;
+          state_ = State::Normal;
+        } else if (std::isspace(static_cast<unsigned char>(c))) {
+          state_ = State::InTagAttrs;
+          if (!writeChar(c)) return false;
+        } else if (c == '/') {
+          // Self-closing indicator
+          if (!writeChar(c)) return false;
+          state_ = State::InTagAttrs;
+        } else {
+          // Unexpected character
+          if (!writeChar(c)) return false;
+          state_ = State::Normal;
+        }
+      }
+      break;
+
+    case State::InTagAttrs:
+      if (c == '"' || c == '\'') {
+        state_ = State::InQuote;
+        quoteChar_ = c;
+        if (!writeChar(c)) return false;
+      } else if (c == '>') {
+        // End of tag - insert self-closing if needed
+        if (isCurrentTagVoid_ && prevChar_ != '/') {
+          if (!writeChar(' ') || !writeChar('/')) return false;
+        }
+        if (!writeChar(c)) return false;
+        state_ = State::Normal;
+      } else {
+        if (!writeChar(c)) return false;
+      }
+      break;
 
-        case State::InClosingTagRest:
-          if (!writeChar(c)) goto error;
-          if (c == '>') {
-            state = State::Normal;
-          }
-          break;
+    case State::InQuote:
+      if (c == quoteChar_) {
+        state_ = State::InTagAttrs;
+      }
+      if (!writeChar(c)) return false;
+      break;
+
+    case State::InClosingTagName:
+      if (std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == ':') {
+        if (tagNameLen_ < MAX_TAG_NAME_LENGTH) {
+          tagName_[tagNameLen_++] = c;
+        } else {
+          // Tag too long to be void - flush buffer and passthrough
+          if (!writeClosingTag(false) || !writeChar(c)) return false;
+          state_ = State::InClosingTagRest;
+        }
+      } else if (c == '>') {
+        // End of closing tag - check if it's a void element
+        tagName_[tagNameLen_] = '\0';
+        if (!isVoidElement(tagName_, tagNameLen_)) {
+          // Not a void element - output the buffered "</tagname>" with any whitespace
+          if (!writeClosingTag(true) || !writeChar('>')) return false;
+        }
+        // Void element closing tags are skipped entirely
+        state_ = State::Normal;
+      } else if (std::isspace(static_cast<unsigned char>(c))) {
+        // Whitespace before '>' in closing tag (unusual but valid)
+        // Buffer it in case we need to replay for non-void elements
+        if (closingTagWsLen_ < sizeof(closingTagWhitespace_)) {
+          closingTagWhitespace_[closingTagWsLen_++] = c;
+        }
+      } else {
+        // Unexpected character - output what we have and return to normal
+        if (!writeClosingTag(false) || !writeChar(c)) return false;
+        state_ = State::Normal;
       }
+      break;
 
-      prevChar = c;
-    }
+    case State::InClosingTagRest:
+      if (!writeChar(c)) return false;
+      if (c == '>') {
+        state_ = State::Normal;
+      }
+      break;
   }
 
+  prevChar_ = c;
+  return true;
+}
+
+bool VoidElementNormalizer::finish() {
+  if (failed_) return false;
+
   // Handle EOF - flush any buffered but uncommitted content
-  if (state == State::InTagStart) {
+  bool ok = true;
+  if (state_ == State::InTagStart) {
     // We saw '<' but nothing else
-    if (!writeChar('<')) goto error;
-  } else if (state == State::InClosingTagName) {
+    ok = writeChar('<');
+  } else if (state_ == State::InClosingTagName) {
     // We were in the middle of a closing tag - output what we have
-    if (!writeChar('<')) goto error;
-    if (!writeChar('/')) goto error;
-    for (size_t j = 0; j < tagNameLen; j++) {
-      if (!writeChar(tagName[j])) goto error;
-    }
-    for (size_t j = 0; j < closingTagWsLen; j++) {
-      if (!writeChar(closingTagWhitespace[j])) goto error;
-    }
+    ok = writeClosingTag(true);
   }
+  state_ = State::Normal;
 
-  if (!flushWrite()) goto error;
-
-  inFile.close();
-  outFile.close();
+  if (!ok || !flushWrite()) {
+    failed_ = true;
+    return false;
+  }
   return true;
+}
+
+bool normalizeVoidElements(const std::string& inputPath, const std::string& outputPath) {
+  FsFile inFile, outFile;
+
+  if (!SdMan.openFileForRead("H5N", inputPath, inFile)) {
+    return false;
+  }
+
+  if (!SdMan.openFileForWrite("H5N", outputPath, outFile)) {
+    inFile.close();
+    return false;
+  }
+
+  VoidElementNormalizer normalizer(outFile);
+  uint8_t readBuffer[FILE_READ_SIZE];
+  bool ok = true;
+
+  while (ok && inFile.available()) {
+    const int bytesRead = inFile.read(readBuffer, FILE_READ_SIZE);
+    if (bytesRead <= 0) break;
+    ok = normalizer.write(readBuffer, bytesRead) == static_cast<size_t>(bytesRead);
+  }
+  ok = ok && normalizer.finish();
 
-error:
   inFile.close();
   outFile.close();
-  SdMan.remove(outputPath.c_str());
-  return false;
+  if (!ok) {
+    SdMan.remove(outputPath.c_str());
+  }
+  return ok;
 }
 
 }  // namespace html5
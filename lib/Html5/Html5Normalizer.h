@@ -1,8 +1,75 @@
 #pragma once
+#include <Print.h>
+
+#include <cstdint>
 #include <string>
 
 namespace html5 {
 
+// Streaming HTML5 void element normalizer
+// Bytes written to it are forwarded to `out` with <img src="x"> rewritten to <img src="x" />
+// and stray void closing tags (</br>) dropped. Call finish() after the last write.
+class VoidElementNormalizer final : public Print {
+ public:
+  // Input and output offsets where the normalizer is between tags, so a fresh normalizer fed the
+  // input from `input` on produces exactly the output from `output` on
+  struct SyncPoint {
+    uint32_t input;
+    uint32_t output;
+  };
+
+  explicit VoidElementNormalizer(Print& out) : out_(out) {}
+  // Restart at a sync point taken by an earlier pass, counting offsets in whole-document coordinates.
+  // Output before discardUntil is counted but not forwarded.
+  VoidElementNormalizer(Print& out, const SyncPoint& start, const uint32_t discardUntil)
+      : out_(out), inputCount_(start.input), outputCount_(start.output), discardUntil_(discardUntil) {}
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+
+  // Flush a tag left open at end of input and any buffered output. Returns false if the output failed.
+  bool finish();
+
+  // Stop recording sync points, so the ones around where the consumer stopped survive the rest of the input
+  void holdSyncPoints() { holdSyncPoints_ = true; }
+  // Latest recorded sync point at or before the output offset
+  bool syncPointBefore(uint32_t outputOffset, SyncPoint* point) const;
+
+ private:
+  static constexpr size_t MAX_TAG_NAME_LENGTH = 8;
+  static constexpr size_t BUFFER_SIZE = 512;
+  static constexpr uint32_t SYNC_INTERVAL = 1024;  // Output bytes between recorded sync points
+  static constexpr size_t SYNC_POINTS = 8;         // Recent sync points kept, oldest overwritten first
+
+  enum class State { Normal, InTagStart, InTagName, InTagAttrs, InQuote, InClosingTagName, InClosingTagRest };
+
+  bool process(char c);
+  bool writeChar(char c);
+  bool writeClosingTag(bool withWhitespace);
+  bool flushWrite();
+
+  Print& out_;
+  State state_ = State::Normal;
+  char tagName_[MAX_TAG_NAME_LENGTH + 1] = {0};
+  size_t tagNameLen_ = 0;
+  char closingTagWhitespace_[8] = {0};  // Buffer for whitespace in closing tags
+  size_t closingTagWsLen_ = 0;
+  bool isCurrentTagVoid_ = false;
+  char quoteChar_ = 0;
+  char prevChar_ = 0;
+  bool failed_ = false;
+
+  uint32_t inputCount_ = 0;
+  uint32_t outputCount_ = 0;
+  uint32_t discardUntil_ = 0;
+  SyncPoint syncPoints_[SYNC_POINTS] = {};
+  size_t syncCount_ = 0;
+  bool holdSyncPoints_ = false;
+
+  uint8_t writeBuffer_[BUFFER_SIZE + 64];  // Extra space for insertions
+  size_t writePos_ = 0;
+};
+
 // Normalize HTML5 void elements to XHTML self-closing format
 // Converts <img src="x"> to <img src="x" />
 // Processes file in streaming mode for memory efficiency
@@ -275,17 +275,6 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
   Serial.printf("[%lu] [JPG] JPEG dimensions: %dx%d, components: %d, MCUs: %dx%d\n", millis(), imageInfo.m_width,
                 imageInfo.m_height, imageInfo.m_comps, imageInfo.m_MCUSPerRow, imageInfo.m_MCUSPerCol);
 
-  // Safety limits to prevent memory issues on ESP32
-  constexpr int MAX_IMAGE_WIDTH = 2048;
-  constexpr int MAX_IMAGE_HEIGHT = 3072;
-  constexpr int MAX_MCU_ROW_BYTES = 65536;
-
-  if (imageInfo.m_width > MAX_IMAGE_WIDTH || imageInfo.m_height > MAX_IMAGE_HEIGHT) {
-    Serial.printf("[%lu] [JPG] Image too large (%dx%d), max supported: %dx%d\n", millis(), imageInfo.m_width,
-                  imageInfo.m_height, MAX_IMAGE_WIDTH, MAX_IMAGE_HEIGHT);
-    return false;
-  }
-
   // Calculate output dimensions (pre-scale to fit display exactly)
   int outWidth = imageInfo.m_width;
   int outHeight = imageInfo.m_height;
@@ -308,16 +297,52 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
     if (outWidth < 1) outWidth = 1;
     if (outHeight < 1) outHeight = 1;
 
-    // Calculate fixed-point scale factors (source pixels per output pixel)
-    // scaleX_fp = (srcWidth << 16) / outWidth
-    scaleX_fp = (static_cast<uint32_t>(imageInfo.m_width) << 16) / outWidth;
-    scaleY_fp = (static_cast<uint32_t>(imageInfo.m_height) << 16) / outHeight;
     needsScaling = true;
 
     Serial.printf("[%lu] [JPG] Pre-scaling %dx%d -> %dx%d (fit to %dx%d)\n", millis(), imageInfo.m_width,
                   imageInfo.m_height, outWidth, outHeight, targetWidth, targetHeight);
   }
 
+  // Let picojpeg do the first 2x-8x of a large downscale: it restarts on the same file at a reduced scale,
+  // and the fixed-point scaler below only covers what's left
+  const int decodeShift =
+      needsScaling ? decodeScaleShift(imageInfo.m_width, imageInfo.m_height, outWidth, outHeight) : 0;
+  if (decodeShift > 0) {
+    static constexpr unsigned char REDUCE_MODES[] = {PJPG_REDUCE_NONE, PJPG_REDUCE_HALF, PJPG_REDUCE_QUARTER,
+                                                     PJPG_REDUCE_EIGHTH};
+    jpegFile.seek(0);
+    context.bufferPos = 0;
+    context.bufferFilled = 0;
+    const unsigned char reducedStatus =
+        pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, REDUCE_MODES[decodeShift]);
+    if (reducedStatus != 0) {
+      Serial.printf("[%lu] [JPG] JPEG reduced decode init failed with error code: %d\n", millis(), reducedStatus);
+      return false;
+    }
+  }
+  const int srcWidth = (imageInfo.m_width + (1 << decodeShift) - 1) >> decodeShift;
+  const int srcHeight = (imageInfo.m_height + (1 << decodeShift) - 1) >> decodeShift;
+
+  // Safety limits to prevent memory issues on ESP32 (on the decoded size, so reduced decodes can exceed them)
+  constexpr int MAX_IMAGE_WIDTH = 2048;
+  constexpr int MAX_IMAGE_HEIGHT = 3072;
+  constexpr int MAX_MCU_ROW_BYTES = 65536;
+
+  if (srcWidth > MAX_IMAGE_WIDTH || srcHeight > MAX_IMAGE_HEIGHT) {
+    Serial.printf("[%lu] [JPG] Image too large (%dx%d), max supported: %dx%d\n", millis(), srcWidth, srcHeight,
+                  MAX_IMAGE_WIDTH, MAX_IMAGE_HEIGHT);
+    return false;
+  }
+
+  if (needsScaling) {
+    // Fixed-point scale factors (decoded pixels per output pixel)
+    scaleX_fp = (static_cast<uint32_t>(srcWidth) << 16) / outWidth;
+    scaleY_fp = (static_cast<uint32_t>(srcHeight) << 16) / outHeight;
+    if (decodeShift > 0) {
+      Serial.printf("[%lu] [JPG] Decoding at 1/%d (%dx%d)\n", millis(), 1 << decodeShift, srcWidth, srcHeight);
+    }
+  }
+
   // Write BMP header with output dimensions
   int bytesPerRow;
   if (USE_8BIT_OUTPUT && !oneBit) {
@@ -340,8 +365,8 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
 
   // Allocate a buffer for one MCU row worth of grayscale pixels
   // This is the minimal memory needed for streaming conversion
-  const int mcuPixelHeight = imageInfo.m_MCUHeight;
-  const int mcuRowPixels = imageInfo.m_width * mcuPixelHeight;
+  const int mcuPixelHeight = imageInfo.m_MCUHeight >> decodeShift;
+  const int mcuRowPixels = srcWidth * mcuPixelHeight;
 
   // Validate MCU row buffer size before allocation
   if (mcuRowPixels > MAX_MCU_ROW_BYTES) {
@@ -410,7 +435,10 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
   }
 
   // Process MCUs row-by-row and write to BMP as we go (top-down)
-  const int mcuPixelWidth = imageInfo.m_MCUWidth;
+  const int mcuPixelWidth = imageInfo.m_MCUWidth >> decodeShift;
+  const int blockPixels = 8 >> decodeShift;
+  // The 1/2 and 1/4 decodes only produce luma
+  const bool lumaOnly = imageInfo.m_comps == 1 || decodeShift == 1 || decodeShift == 2;
 
   for (int mcuY = 0; mcuY < imageInfo.m_MCUSPerCol; mcuY++) {
     // Clear the MCU row buffer
@@ -431,24 +459,22 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
         return false;
       }
 
-      // picojpeg stores MCU data in 8x8 blocks
+      // picojpeg stores MCU data in 8x8 blocks, reduced decodes at the top left of each
       // Block layout: H2V2(16x16)=0,64,128,192 H2V1(16x8)=0,64 H1V2(8x16)=0,128
       for (int blockY = 0; blockY < mcuPixelHeight; blockY++) {
         for (int blockX = 0; blockX < mcuPixelWidth; blockX++) {
           const int pixelX = mcuX * mcuPixelWidth + blockX;
-          if (pixelX >= imageInfo.m_width) continue;
+          if (pixelX >= srcWidth) continue;
 
           // Calculate proper block offset for picojpeg buffer
-          const int blockCol = blockX / 8;
-          const int blockRow = blockY / 8;
-          const int localX = blockX % 8;
-          const int localY = blockY % 8;
-          const int blocksPerRow = mcuPixelWidth / 8;
-          const int blockIndex = blockRow * blocksPerRow + blockCol;
-          const int pixelOffset = blockIndex * 64 + localY * 8 + localX;
+          const int blockCol = blockX / blockPixels;
+          const int blockRow = blockY / blockPixels;
+          const int localX = blockX % blockPixels;
+          const int localY = blockY % blockPixels;
+          const int pixelOffset = blockRow * 128 + blockCol * 64 + localY * 8 + localX;
 
           uint8_t gray;
-          if (imageInfo.m_comps == 1) {
+          if (lumaOnly) {
             gray = imageInfo.m_pMCUBufR[pixelOffset];
           } else {
             const uint8_t r = imageInfo.m_pMCUBufR[pixelOffset];
@@ -457,7 +483,7 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
             gray = rgbToGray(r, g, b);
           }
 
-          mcuRowBuffer[blockY * imageInfo.m_width + pixelX] = gray;
+          mcuRowBuffer[blockY * srcWidth + pixelX] = gray;
         }
       }
     }
@@ -466,7 +492,7 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
     const int startRow = mcuY * mcuPixelHeight;
     const int endRow = (mcuY + 1) * mcuPixelHeight;
 
-    for (int y = startRow; y < endRow && y < imageInfo.m_height; y++) {
+    for (int y = startRow; y < endRow && y < srcHeight; y++) {
       const int bufferY = y - startRow;
 
       if (!needsScaling) {
@@ -475,13 +501,13 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
 
         if (USE_8BIT_OUTPUT && !oneBit) {
           for (int x = 0; x < outWidth; x++) {
-            const uint8_t gray = mcuRowBuffer[bufferY * imageInfo.m_width + x];
+            const uint8_t gray = mcuRowBuffer[bufferY * srcWidth + x];
             rowBuffer[x] = adjustPixel(gray);
           }
         } else if (oneBit) {
           // 1-bit output with Atkinson dithering for better quality
           for (int x = 0; x < outWidth; x++) {
-            const uint8_t gray = mcuRowBuffer[bufferY * imageInfo.m_width + x];
+            const uint8_t gray = mcuRowBuffer[bufferY * srcWidth + x];
             const uint8_t bit =
                 atkinson1BitDitherer ? atkinson1BitDitherer->processPixel(gray, x) : quantize1bit(gray, x, y);
             // Pack 1-bit value: MSB first, 8 pixels per byte
@@ -493,7 +519,7 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
         } else {
           // 2-bit output
           for (int x = 0; x < outWidth; x++) {
-            const uint8_t gray = adjustPixel(mcuRowBuffer[bufferY * imageInfo.m_width + x]);
+            const uint8_t gray = adjustPixel(mcuRowBuffer[bufferY * srcWidth + x]);
             uint8_t twoBit;
             if (quickMode) {
               // Quick mode: simple threshold (faster, no dithering)
@@ -519,7 +545,7 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
         // Fixed-point area averaging for exact fit scaling
         // For each output pixel X, accumulate source pixels that map to it
         // srcX range for outX: [outX * scaleX_fp >> 16, (outX+1) * scaleX_fp >> 16)
-        const uint8_t* srcRow = mcuRowBuffer + bufferY * imageInfo.m_width;
+        const uint8_t* srcRow = mcuRowBuffer + bufferY * srcWidth;
 
         for (int outX = 0; outX < outWidth; outX++) {
           // Calculate source X range for this output pixel
@@ -529,13 +555,13 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
           // Accumulate all source pixels in this range
           int sum = 0;
           int count = 0;
-          for (int srcX = srcXStart; srcX < srcXEnd && srcX < imageInfo.m_width; srcX++) {
+          for (int srcX = srcXStart; srcX < srcXEnd && srcX < srcWidth; srcX++) {
             sum += srcRow[srcX];
             count++;
           }
 
           // Handle edge case: if no pixels in range, use nearest
-          if (count == 0 && srcXStart < imageInfo.m_width) {
+          if (count == 0 && srcXStart < srcWidth) {
             sum = srcRow[srcXStart];
             count = 1;
           }
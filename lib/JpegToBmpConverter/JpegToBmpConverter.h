@@ -20,4 +20,13 @@ class JpegToBmpConverter {
   static bool jpegFileTo1BitBmpStreamWithSize(FsFile& jpegFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
   // Quick preview mode: simple threshold instead of dithering (faster but lower quality)
   static bool jpegFileToBmpStreamQuick(FsFile& jpegFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
+  // picojpeg reduced decode used for a srcWidth x srcHeight JPEG scaled to outWidth x outHeight:
+  // 0 (full size) to 3 (1/8), the largest that still decodes at least the output size
+  static int decodeScaleShift(const int srcWidth, const int srcHeight, const int outWidth, const int outHeight) {
+    int shift = 0;
+    while (shift < 3 && (srcWidth >> (shift + 1)) >= outWidth && (srcHeight >> (shift + 1)) >= outHeight) {
+      shift++;
+    }
+    return shift;
+  }
 };
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
 
 class Page;
 class GfxRenderer;
@@ -43,4 +45,43 @@ class ContentParser {
    * Call this before re-parsing to extend cache.
    */
   virtual void reset() = 0;
+
+  /**
+   * Check if this parser can snapshot its state after a partial parse.
+   * Resumable parsers let PageCache::extend() continue from the last page
+   * instead of re-parsing from the start and discarding cached pages.
+   */
+  virtual bool canResume() const { return false; }
+
+  /**
+   * Side file a checkpoint may refer to, such as a retained copy of the unparsed input.
+   * PageCache removes it together with the checkpoint whenever the cache is cleared or rebuilt.
+   */
+  static std::string checkpointDataPath(const std::string& checkpointPath) { return checkpointPath + ".data"; }
+
+  /**
+   * Save the state left by the last partial parsePages() call.
+   * Input the checkpoint still needs goes to checkpointDataPath(path).
+   * @param path Checkpoint file path (owned by PageCache)
+   * @param pageCount Pages cached so far, stored to validate the checkpoint on load
+   * @return true if a checkpoint was written
+   */
+  virtual bool saveCheckpoint(const std::string& path, uint16_t pageCount) {
+    (void)path;
+    (void)pageCount;
+    return false;
+  }
+
+  /**
+   * Restore state from a checkpoint written by saveCheckpoint().
+   * On success the next parsePages() call continues where the checkpoint left off.
+   * @param path Checkpoint file path
+   * @param pageCount Pages currently cached; checkpoint is rejected if it doesn't match
+   * @return true if the checkpoint was valid and loaded
+   */
+  virtual bool loadCheckpoint(const std::string& path, uint16_t pageCount) {
+    (void)path;
+    (void)pageCount;
+    return false;
+  }
 };
@@ -5,9 +5,17 @@
 #include <GfxRenderer.h>
 #include <Html5Normalizer.h>
 #include <SDCardManager.h>
+#include <Serialization.h>
+#include <esp_heap_caps.h>
 
 #include <utility>
 
+namespace {
+constexpr uint8_t CHECKPOINT_FILE_VERSION = 4;  // v4: raw chapter resync point
+// Streaming keeps the 32KB inflate dictionary and decompressor alive next to Expat
+constexpr size_t MIN_HEAP_FOR_STREAMING = 48 * 1024;
+}  // namespace
+
 EpubChapterParser::EpubChapterParser(std::shared_ptr<Epub> epub, int spineIndex, GfxRenderer& renderer,
                                      const RenderConfig& config, const std::string& imageCachePath)
     : epub_(std::move(epub)),
@@ -16,25 +24,48 @@ EpubChapterParser::EpubChapterParser(std::shared_ptr<Epub> epub, int spineIndex,
       config_(config),
       imageCachePath_(imageCachePath) {}
 
-void EpubChapterParser::reset() { hasMore_ = true; }
+EpubChapterParser::~EpubChapterParser() { discardUnsavedSpill(); }
 
-bool EpubChapterParser::parsePages(const std::function<void(std::unique_ptr<Page>)>& onPageComplete, uint16_t maxPages,
-                                   const AbortCallback& shouldAbort) {
-  const auto localPath = epub_->getSpineItem(spineIndex_).href;
-  const auto tmpHtmlPath = epub_->getCachePath() + "/.tmp_" + std::to_string(spineIndex_) + ".html";
+void EpubChapterParser::reset() {
+  hasMore_ = true;
+  checkpoint_.reset();
+  resumeFrom_.reset();
+  discardUnsavedSpill();
+}
 
-  // Derive chapter base path for resolving relative image paths
-  std::string chapterBasePath;
-  {
-    size_t lastSlash = localPath.rfind('/');
-    if (lastSlash != std::string::npos) {
-      chapterBasePath = localPath.substr(0, lastSlash + 1);
-    }
+void EpubChapterParser::discardUnsavedSpill() {
+  // A saved checkpoint has moved the spill to its data path; anything still here belongs to no checkpoint
+  const auto normPath = normalizedPath();
+  if (SdMan.exists(normPath.c_str())) {
+    SdMan.remove(normPath.c_str());
   }
+}
+
+std::string EpubChapterParser::normalizedPath() const {
+  return epub_->getCachePath() + "/.norm_" + std::to_string(spineIndex_) + ".html";
+}
+
+bool EpubChapterParser::retainedFileValid(const std::string& path) const {
+  FsFile file;
+  if (!SdMan.exists(path.c_str()) || !SdMan.openFileForRead("EPUB", path, file)) {
+    return false;
+  }
+  const uint32_t size = file.size();
+  file.close();
+
+  if (size != retainedSize_) {
+    Serial.printf("[EPUB] Retained chapter size changed (%u != %u)\n", size, retainedSize_);
+    return false;
+  }
+  return true;
+}
+
+bool EpubChapterParser::prepareChapterFile(const std::string& normPath, bool* normalized) {
+  const auto localPath = epub_->getSpineItem(spineIndex_).href;
+  const auto tmpHtmlPath = epub_->getCachePath() + "/.tmp_" + std::to_string(spineIndex_) + ".html";
 
   // Stream HTML to temp file
   bool success = false;
-  uint32_t fileSize = 0;
   for (int attempt = 0; attempt < 3 && !success; attempt++) {
     if (attempt > 0) {
       Serial.printf("[EPUB] Retrying stream (attempt %d)...\n", attempt + 1);
@@ -50,7 +81,6 @@ bool EpubChapterParser::parsePages(const std::function<void(std::unique_ptr<Page
       continue;
     }
     success = epub_->readItemContentsToStream(localPath, tmpHtml, 4096);
-    fileSize = tmpHtml.size();
     tmpHtml.close();
 
     if (!success && SdMan.exists(tmpHtmlPath.c_str())) {
@@ -63,11 +93,49 @@ bool EpubChapterParser::parsePages(const std::function<void(std::unique_ptr<Page
     return false;
   }
 
-  // Normalize HTML5 void elements for Expat parser
-  const auto normalizedPath = epub_->getCachePath() + "/.norm_" + std::to_string(spineIndex_) + ".html";
-  std::string parseHtmlPath = tmpHtmlPath;
-  if (html5::normalizeVoidElements(tmpHtmlPath, normalizedPath)) {
-    parseHtmlPath = normalizedPath;
+  // Normalize HTML5 void elements for Expat parser. The parsed file always ends up at
+  // normPath so checkpoint offsets refer to one file regardless of normalization outcome.
+  *normalized = html5::normalizeVoidElements(tmpHtmlPath, normPath);
+  if (*normalized) {
+    SdMan.remove(tmpHtmlPath.c_str());
+  } else {
+    SdMan.remove(normPath.c_str());
+    if (!SdMan.rename(tmpHtmlPath.c_str(), normPath.c_str())) {
+      SdMan.remove(tmpHtmlPath.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+bool EpubChapterParser::parsePages(const std::function<void(std::unique_ptr<Page>)>& onPageComplete, uint16_t maxPages,
+                                   const AbortCallback& shouldAbort) {
+  const auto localPath = epub_->getSpineItem(spineIndex_).href;
+  const auto normPath = normalizedPath();
+
+  // Derive chapter base path for resolving relative image paths
+  std::string chapterBasePath;
+  {
+    size_t lastSlash = localPath.rfind('/');
+    if (lastSlash != std::string::npos) {
+      chapterBasePath = localPath.substr(0, lastSlash + 1);
+    }
+  }
+
+  checkpoint_.reset();
+
+  // A resumed parse reads the normalized chapter retained by the previous chunk. Without it, the chapter
+  // is streamed again from the resync point, which the ZIP seek index reaches without inflating from the start.
+  const bool canStream = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT) >= MIN_HEAP_FOR_STREAMING;
+  bool resumeFromZip = false;
+  if (resumeFrom_ && !retainedFileValid(retainedPath_)) {
+    resumeFromZip = resyncValid_ && resync_.output <= resumeFrom_->inputOffset && canStream;
+    if (!resumeFromZip) {
+      resumeFrom_.reset();
+      return false;
+    }
+    Serial.printf("[EPUB] Resuming offset %u from chapter offset %u in the ZIP\n", resumeFrom_->inputOffset,
+                  resync_.input);
   }
 
   // Create read callback for extracting images from EPUB
@@ -78,6 +146,7 @@ bool EpubChapterParser::parsePages(const std::function<void(std::unique_ptr<Page
   // Track pages for early termination
   uint16_t pagesCreated = 0;
   bool hitMaxPages = false;
+  std::unique_ptr<html5::VoidElementNormalizer> normalizer;
 
   auto wrappedCallback = [&](std::unique_ptr<Page> page) -> bool {
     if (hitMaxPages) return false;  // Signal parser to stop
@@ -87,25 +156,198 @@ bool EpubChapterParser::parsePages(const std::function<void(std::unique_ptr<Page
 
     if (maxPages > 0 && pagesCreated >= maxPages) {
       hitMaxPages = true;
+      // The stream goes on into the spill; keep the sync points around the stop offset
+      if (normalizer) normalizer->holdSyncPoints();
       return false;  // Signal parser to stop
     }
     return true;  // Continue parsing
   };
 
-  ChapterHtmlSlimParser parser(parseHtmlPath, renderer_, config_, wrappedCallback, nullptr, chapterBasePath,
-                               imageCachePath_, readItemFn, epub_->getCssParser(), shouldAbort);
+  auto runParser = [&](const std::string& sourcePath, const bool streaming) {
+    ChapterHtmlSlimParser parser(sourcePath, renderer_, config_, wrappedCallback, nullptr, chapterBasePath,
+                                 imageCachePath_, readItemFn, epub_->getCssParser(), shouldAbort);
+    if (streaming) {
+      // ZIP -> void element normalizer -> Expat, spilling to normPath only if the page limit stops it.
+      // A resumed stream restarts at the resync point and drops the output before the checkpoint.
+      const auto start = resync_;
+      const bool resuming = resumeFrom_ != nullptr;
+      const uint32_t resumeOffset = resuming ? resumeFrom_->inputOffset : 0;
+      if (resuming) {
+        parser.setSourceOffset(resumeOffset);
+        parser.setResumeFrom(std::move(resumeFrom_));
+      }
+      parser.setStreamSource(
+          [this, &localPath, &normalizer, start, resuming, resumeOffset](Print& out) {
+            normalizer.reset(new html5::VoidElementNormalizer(out, start, resumeOffset));
+            const bool streamed = resuming
+                                      ? epub_->readItemContentsToStream(localPath, *normalizer, 4096, start.input)
+                                      : epub_->readItemContentsToStream(localPath, *normalizer, 4096);
+            return streamed && normalizer->finish();
+          },
+          normPath);
+    } else if (resumeFrom_) {
+      parser.setSourceOffset(retainedBase_);
+      parser.setResumeFrom(std::move(resumeFrom_));
+    }
+
+    const bool ok = parser.parseAndBuildPages();
+    if (hitMaxPages) {
+      checkpoint_ = parser.takeCheckpoint();
+    }
+    // A streamed parse moves the resync point up to the new checkpoint. The sink the normalizer wrote to
+    // is gone, only its sync points are read here.
+    html5::VoidElementNormalizer::SyncPoint point;
+    if (checkpoint_ && normalizer && normalizer->syncPointBefore(checkpoint_->inputOffset, &point)) {
+      resync_ = point;
+    }
+    normalizer.reset();
+    return ok;
+  };
 
-  success = parser.parseAndBuildPages();
+  bool success = false;
+  if (resumeFromZip) {
+    success = runParser(normPath, true);
+    retainedPath_ = normPath;
+    if (checkpoint_) {
+      retainedBase_ = checkpoint_->inputOffset;
+    }
+  } else if (resumeFrom_) {
+    success = runParser(retainedPath_, false);
+  } else {
+    resync_ = {0, 0};
+    resyncValid_ = true;
+    if (canStream) {
+      success = runParser(normPath, true);
+      retainedPath_ = normPath;
+      if (checkpoint_) {
+        retainedBase_ = checkpoint_->inputOffset;
+      }
+    }
+
+    // Fall back to extracting the chapter to SD when streaming isn't possible or failed before any output
+    if (!success && pagesCreated == 0 && !(shouldAbort && shouldAbort())) {
+      if (canStream) {
+        Serial.printf("[EPUB] Streaming failed, falling back to extracted chapter\n");
+      }
+      if (!prepareChapterFile(normPath, &resyncValid_)) {
+        return false;
+      }
+      success = runParser(normPath, false);
+      retainedPath_ = normPath;
+      retainedBase_ = 0;
+    }
+  }
 
-  // Clean up temp files
-  SdMan.remove(tmpHtmlPath.c_str());
-  SdMan.remove(normalizedPath.c_str());
+  // Keep the normalized chapter only while a checkpoint refers to it. A checkpoint without one
+  // re-inflates the chapter from the resync point next time.
+  retainedSize_ = 0;
+  if (checkpoint_) {
+    FsFile normFile;
+    if (SdMan.openFileForRead("EPUB", retainedPath_, normFile)) {
+      retainedSize_ = normFile.size();
+      normFile.close();
+    } else if (resyncValid_) {
+      retainedPath_.clear();
+    } else {
+      checkpoint_.reset();
+    }
+  }
+  if (!checkpoint_ && SdMan.exists(normPath.c_str())) {
+    SdMan.remove(normPath.c_str());
+  }
 
-  // Clear word width cache
-  renderer_.clearWidthCache();
+  // Word widths stay cached for the next chapter
+  renderer_.logWidthCacheStats();
 
   // Only claim more content if we explicitly hit the page limit
   // If parsing failed/aborted (timeout, memory, error), don't retry - it will likely fail again
   hasMore_ = hitMaxPages;
   return success || pagesCreated > 0;
 }
+
+bool EpubChapterParser::saveCheckpoint(const std::string& path, const uint16_t pageCount) {
+  if (!checkpoint_) {
+    return false;
+  }
+
+  // The retained chapter lives next to the checkpoint from now on
+  const std::string dataPath = checkpointDataPath(path);
+  if (retainedPath_ != dataPath) {
+    if (SdMan.exists(dataPath.c_str())) {
+      SdMan.remove(dataPath.c_str());
+    }
+    if (!retainedPath_.empty() && !SdMan.rename(retainedPath_.c_str(), dataPath.c_str())) {
+      Serial.printf("[EPUB] Failed to keep retained chapter for checkpoint\n");
+      checkpoint_.reset();
+      return false;
+    }
+    retainedPath_ = dataPath;
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForWrite("EPUB", path, file)) {
+    return false;
+  }
+
+  serialization::writePod(file, CHECKPOINT_FILE_VERSION);
+  serialization::writePod(file, pageCount);
+  serialization::writePod(file, retainedBase_);
+  serialization::writePod(file, retainedSize_);
+  serialization::writePod(file, static_cast<uint8_t>(resyncValid_ ? 1 : 0));
+  serialization::writePod(file, resync_.input);
+  serialization::writePod(file, resync_.output);
+  const bool ok = checkpoint_->serialize(file);
+  file.close();
+  checkpoint_.reset();
+
+  if (!ok) {
+    SdMan.remove(path.c_str());
+    return false;
+  }
+  Serial.printf("[EPUB] Checkpoint saved at page %u\n", pageCount);
+  return true;
+}
+
+bool EpubChapterParser::loadCheckpoint(const std::string& path, const uint16_t pageCount) {
+  resumeFrom_.reset();
+  if (!SdMan.exists(path.c_str())) {
+    return false;
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForRead("EPUB", path, file)) {
+    return false;
+  }
+
+  uint8_t version;
+  uint16_t savedPageCount;
+  uint32_t savedBase;
+  uint32_t savedSize;
+  uint8_t resyncValid;
+  html5::VoidElementNormalizer::SyncPoint resync;
+  if (!serialization::readPodChecked(file, version) || version != CHECKPOINT_FILE_VERSION ||
+      !serialization::readPodChecked(file, savedPageCount) || savedPageCount != pageCount ||
+      !serialization::readPodChecked(file, savedBase) || !serialization::readPodChecked(file, savedSize) ||
+      !serialization::readPodChecked(file, resyncValid) || !serialization::readPodChecked(file, resync.input) ||
+      !serialization::readPodChecked(file, resync.output)) {
+    file.close();
+    Serial.printf("[EPUB] Stale checkpoint ignored\n");
+    return false;
+  }
+
+  auto checkpoint = ChapterCheckpoint::deserialize(file);
+  file.close();
+  if (!checkpoint) {
+    Serial.printf("[EPUB] Corrupt checkpoint ignored\n");
+    return false;
+  }
+
+  resumeFrom_ = std::move(checkpoint);
+  retainedPath_ = checkpointDataPath(path);
+  retainedBase_ = savedBase;
+  retainedSize_ = savedSize;
+  resyncValid_ = resyncValid != 0;
+  resync_ = resync;
+  hasMore_ = true;
+  return true;
+}
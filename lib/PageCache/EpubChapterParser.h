@@ -2,6 +2,7 @@
 
 #include <Epub.h>
 #include <Epub/RenderConfig.h>
+#include <Html5Normalizer.h>
 
 #include <memory>
 #include <string>
@@ -9,10 +10,16 @@
 #include "ContentParser.h"
 
 class GfxRenderer;
+struct ChapterCheckpoint;
 
 /**
  * Content parser for EPUB chapters.
  * Wraps ChapterHtmlSlimParser to implement ContentParser interface.
+ * Chapters stream from the ZIP through the void element normalizer into Expat without
+ * touching SD. Partial parses leave a checkpoint and keep the normalized rest of the
+ * chapter on SD, so extending the cache continues from the last page instead of byte zero.
+ * The retained copy moves next to the checkpoint when it is saved, so PageCache deletes both together.
+ * Without it, the chapter is re-inflated from a raw item offset through the ZIP seek index.
  */
 class EpubChapterParser : public ContentParser {
   std::shared_ptr<Epub> epub_;
@@ -21,14 +28,30 @@ class EpubChapterParser : public ContentParser {
   RenderConfig config_;
   std::string imageCachePath_;
   bool hasMore_ = true;
+  std::unique_ptr<ChapterCheckpoint> checkpoint_;  // Left by the last partial parse
+  std::unique_ptr<ChapterCheckpoint> resumeFrom_;  // Loaded for the next parse
+  std::string retainedPath_;                       // Retained normalized file: the spill, then the checkpoint data
+  uint32_t retainedBase_ = 0;                      // Chapter offset where the retained normalized file starts
+  uint32_t retainedSize_ = 0;                      // Size of the retained normalized file
+  // Where a fresh normalizer can restart on the raw chapter, at or before the checkpoint offset
+  html5::VoidElementNormalizer::SyncPoint resync_ = {0, 0};
+  bool resyncValid_ = false;  // False when the parsed chapter isn't normalizer output
+
+  std::string normalizedPath() const;
+  void discardUnsavedSpill();
+  bool prepareChapterFile(const std::string& normPath, bool* normalized);
+  bool retainedFileValid(const std::string& path) const;
 
  public:
   EpubChapterParser(std::shared_ptr<Epub> epub, int spineIndex, GfxRenderer& renderer, const RenderConfig& config,
                     const std::string& imageCachePath = "");
-  ~EpubChapterParser() override = default;
+  ~EpubChapterParser() override;
 
   bool parsePages(const std::function<void(std::unique_ptr<Page>)>& onPageComplete, uint16_t maxPages = 0,
                   const AbortCallback& shouldAbort = nullptr) override;
   bool hasMoreContent() const override { return hasMore_; }
   void reset() override;
+  bool canResume() const override { return true; }
+  bool saveCheckpoint(const std::string& path, uint16_t pageCount) override;
+  bool loadCheckpoint(const std::string& path, uint16_t pageCount) override;
 };
@@ -7,11 +7,12 @@
 #include "ContentParser.h"
 
 namespace {
-constexpr uint8_t CACHE_FILE_VERSION = 17;  // v17: Add monoFontId to cache validation
+constexpr uint8_t CACHE_FILE_VERSION = 19;  // v19: Flat page blobs
 
 // Header layout:
 // - version (1 byte)
 // - fontId (4 bytes)
+// - monoFontId (4 bytes)
 // - lineCompression (4 bytes)
 // - indentLevel (1 byte)
 // - spacingLevel (1 byte)
@@ -23,10 +24,29 @@ constexpr uint8_t CACHE_FILE_VERSION = 17;  // v17: Add monoFontId to cache vali
 // - pageCount (2 bytes)
 // - isPartial (1 byte)
 // - lutOffset (4 bytes)
-constexpr uint32_t HEADER_SIZE = 1 + 4 + 4 + 1 + 1 + 1 + 1 + 1 + 2 + 2 + 2 + 1 + 4;
+constexpr uint32_t HEADER_SIZE = 1 + 4 + 4 + 4 + 1 + 1 + 1 + 1 + 1 + 2 + 2 + 2 + 1 + 4;
 }  // namespace
 
-PageCache::PageCache(std::string cachePath) : cachePath_(std::move(cachePath)) {}
+PageCache::PageCache(std::string cachePath)
+    : cachePath_(std::move(cachePath)), checkpointPath_(cachePath_ + ".ckpt") {}
+
+PageCache::~PageCache() { closeReader(); }
+
+void PageCache::closeReader() {
+  if (reader_) {
+    reader_.close();
+  }
+}
+
+void PageCache::removeCheckpoint() {
+  if (SdMan.exists(checkpointPath_.c_str())) {
+    SdMan.remove(checkpointPath_.c_str());
+  }
+  const std::string dataPath = ContentParser::checkpointDataPath(checkpointPath_);
+  if (SdMan.exists(dataPath.c_str())) {
+    SdMan.remove(dataPath.c_str());
+  }
+}
 
 bool PageCache::writeHeader(bool isPartial) {
   file_.seek(0);
@@ -63,95 +83,112 @@ bool PageCache::writeLut(const std::vector<uint32_t>& lut) {
   serialization::writePod(file_, pageCount_);
   serialization::writePod(file_, static_cast<uint8_t>(isPartial_ ? 1 : 0));
   serialization::writePod(file_, lutOffset);
+  lutOffset_ = lutOffset;
 
   return true;
 }
 
-bool PageCache::loadLut(std::vector<uint32_t>& lut) {
-  if (!SdMan.openFileForRead("CACHE", cachePath_, file_)) {
-    return false;
-  }
-
-  const size_t fileSize = file_.size();
-  if (fileSize < HEADER_SIZE) {
-    Serial.printf("[CACHE] File too small: %zu (need %u)\n", fileSize, HEADER_SIZE);
-    file_.close();
-    return false;
-  }
-
-  // Read lutOffset from header
-  file_.seek(HEADER_SIZE - 4);
-  serialization::readPod(file_, lutOffset_);
-
+bool PageCache::readLut(const size_t fileSize) {
   // Validate lutOffset before seeking
-  if (lutOffset_ < HEADER_SIZE || lutOffset_ >= fileSize) {
+  if (lutOffset_ < HEADER_SIZE || lutOffset_ + static_cast<size_t>(pageCount_) * sizeof(uint32_t) > fileSize) {
     Serial.printf("[CACHE] Invalid lutOffset: %u (file size: %zu)\n", lutOffset_, fileSize);
-    file_.close();
     return false;
   }
 
-  // Read pageCount from header
-  file_.seek(HEADER_SIZE - 4 - 1 - 2);
-  serialization::readPod(file_, pageCount_);
-
-  // Read existing LUT entries
-  file_.seek(lutOffset_);
-  lut.reserve(pageCount_);
-  for (uint16_t i = 0; i < pageCount_; i++) {
-    uint32_t pos;
-    serialization::readPod(file_, pos);
-    lut.push_back(pos);
+  // The whole LUT in one read, kept for the life of the cache
+  lut_.resize(pageCount_);
+  const size_t lutBytes = lut_.size() * sizeof(uint32_t);
+  reader_.seek(lutOffset_);
+  if (lutBytes > 0 &&
+      reader_.read(reinterpret_cast<uint8_t*>(lut_.data()), lutBytes) != static_cast<int>(lutBytes)) {
+    Serial.printf("[CACHE] Failed to read LUT\n");
+    lut_.clear();
+    return false;
   }
 
-  file_.close();
+  // Pages are appended in order, each before the current LUT
+  uint32_t prev = 0;
+  for (const uint32_t pos : lut_) {
+    if (pos < HEADER_SIZE || pos >= lutOffset_ || pos <= prev) {
+      Serial.printf("[CACHE] Invalid page position in LUT: %u\n", pos);
+      lut_.clear();
+      return false;
+    }
+    prev = pos;
+  }
   return true;
 }
 
 bool PageCache::load(const RenderConfig& config) {
-  if (!SdMan.openFileForRead("CACHE", cachePath_, file_)) {
+  closeReader();
+  if (!SdMan.openFileForRead("CACHE", cachePath_, reader_)) {
     return false;
   }
 
   // Read and validate header
   uint8_t version;
-  serialization::readPod(file_, version);
+  serialization::readPod(reader_, version);
   if (version != CACHE_FILE_VERSION) {
-    file_.close();
+    reader_.close();
     Serial.printf("[CACHE] Version mismatch: got %u, expected %u\n", version, CACHE_FILE_VERSION);
     clear();
     return false;
   }
 
   RenderConfig fileConfig;
-  serialization::readPod(file_, fileConfig.fontId);
-  serialization::readPod(file_, fileConfig.monoFontId);
-  serialization::readPod(file_, fileConfig.lineCompression);
-  serialization::readPod(file_, fileConfig.indentLevel);
-  serialization::readPod(file_, fileConfig.spacingLevel);
-  serialization::readPod(file_, fileConfig.paragraphAlignment);
-  serialization::readPod(file_, fileConfig.hyphenation);
-  serialization::readPod(file_, fileConfig.showImages);
-  serialization::readPod(file_, fileConfig.viewportWidth);
-  serialization::readPod(file_, fileConfig.viewportHeight);
+  serialization::readPod(reader_, fileConfig.fontId);
+  serialization::readPod(reader_, fileConfig.monoFontId);
+  serialization::readPod(reader_, fileConfig.lineCompression);
+  serialization::readPod(reader_, fileConfig.indentLevel);
+  serialization::readPod(reader_, fileConfig.spacingLevel);
+  serialization::readPod(reader_, fileConfig.paragraphAlignment);
+  serialization::readPod(reader_, fileConfig.hyphenation);
+  serialization::readPod(reader_, fileConfig.showImages);
+  serialization::readPod(reader_, fileConfig.viewportWidth);
+  serialization::readPod(reader_, fileConfig.viewportHeight);
 
   if (config != fileConfig) {
-    file_.close();
+    reader_.close();
     Serial.printf("[CACHE] Config mismatch, invalidating cache\n");
     clear();
     return false;
   }
 
-  serialization::readPod(file_, pageCount_);
+  serialization::readPod(reader_, pageCount_);
   uint8_t partial;
-  serialization::readPod(file_, partial);
+  serialization::readPod(reader_, partial);
   isPartial_ = (partial != 0);
+  serialization::readPod(reader_, lutOffset_);
+
+  if (!readLut(reader_.size())) {
+    reader_.close();
+    clear();
+    return false;
+  }
   config_ = config;
 
-  file_.close();
+  // Read handle stays open for loadPage
   Serial.printf("[CACHE] Loaded: %d pages, partial=%d\n", pageCount_, isPartial_);
   return true;
 }
 
+bool PageCache::openForAppend(std::vector<uint32_t>& lut) {
+  closeReader();
+  if (lut_.size() != pageCount_ || lutOffset_ == 0) {
+    Serial.printf("[CACHE] No LUT loaded for extend\n");
+    return false;
+  }
+  lut = lut_;
+
+  // Append new pages AFTER old LUT (crash-safe: old LUT remains valid until header update)
+  if (!file_.open(cachePath_.c_str(), O_RDWR)) {
+    Serial.printf("[CACHE] Failed to open cache file for append\n");
+    return false;
+  }
+  file_.seekEnd();  // Append after old LUT
+  return true;
+}
+
 bool PageCache::create(ContentParser& parser, const RenderConfig& config, uint16_t maxPages, uint16_t skipPages,
                        const AbortCallback& shouldAbort) {
   const unsigned long startMs = millis();
@@ -160,19 +197,14 @@ bool PageCache::create(ContentParser& parser, const RenderConfig& config, uint16
 
   if (skipPages > 0) {
     // Extending: load existing LUT
-    if (!loadLut(lut)) {
-      Serial.printf("[CACHE] Failed to load existing LUT for extend\n");
-      return false;
-    }
-
-    // Append new pages AFTER old LUT (crash-safe: old LUT remains valid until header update)
-    if (!file_.open(cachePath_.c_str(), O_RDWR)) {
-      Serial.printf("[CACHE] Failed to open cache file for append\n");
+    if (!openForAppend(lut)) {
       return false;
     }
-    file_.seekEnd();  // Append after old LUT
   } else {
     // Fresh create
+    closeReader();
+    lut_.clear();
+    lutOffset_ = 0;
     if (!SdMan.openFileForWrite("CACHE", cachePath_, file_)) {
       Serial.printf("[CACHE] Failed to open cache file for writing\n");
       return false;
@@ -182,10 +214,30 @@ bool PageCache::create(ContentParser& parser, const RenderConfig& config, uint16
     pageCount_ = 0;
     isPartial_ = false;
 
+    // Any checkpoint belongs to the cache being replaced
+    removeCheckpoint();
+
     // Write placeholder header
     writeHeader(false);
   }
 
+  return parseAndFinalize(parser, lut, maxPages, skipPages, false, startMs, shouldAbort);
+}
+
+bool PageCache::resume(ContentParser& parser, uint16_t maxPages, const AbortCallback& shouldAbort) {
+  const unsigned long startMs = millis();
+
+  std::vector<uint32_t> lut;
+  if (!openForAppend(lut)) {
+    return false;
+  }
+
+  return parseAndFinalize(parser, lut, maxPages, 0, true, startMs, shouldAbort);
+}
+
+bool PageCache::parseAndFinalize(ContentParser& parser, std::vector<uint32_t>& lut, uint16_t maxPages,
+                                 uint16_t skipPages, bool resumed, unsigned long startMs,
+                                 const AbortCallback& shouldAbort) {
   // Check for abort before starting expensive parsing
   if (shouldAbort && shouldAbort()) {
     file_.close();
@@ -193,10 +245,14 @@ bool PageCache::create(ContentParser& parser, const RenderConfig& config, uint16
     return false;
   }
 
+  const uint16_t startPages = pageCount_;
   uint16_t parsedPages = 0;
   bool hitMaxPages = false;
   bool aborted = false;
 
+  // A resumed parser only produces new pages, so its limit is relative to what's cached
+  const uint16_t parserMaxPages = (resumed && maxPages > 0) ? maxPages - startPages : maxPages;
+
   bool success = parser.parsePages(
       [this, &lut, &hitMaxPages, &parsedPages, maxPages, skipPages](std::unique_ptr<Page> page) {
         if (hitMaxPages) return;
@@ -223,7 +279,7 @@ bool PageCache::create(ContentParser& parser, const RenderConfig& config, uint16
           hitMaxPages = true;
         }
       },
-      maxPages, shouldAbort);
+      parserMaxPages, shouldAbort);
 
   // Check if we were aborted
   if (shouldAbort && shouldAbort()) {
@@ -231,10 +287,18 @@ bool PageCache::create(ContentParser& parser, const RenderConfig& config, uint16
     Serial.printf("[CACHE] Aborted during parsing\n");
   }
 
+  if (resumed && !success && pageCount_ == startPages && !aborted) {
+    // Header and LUT untouched - caller falls back to a full re-parse
+    file_.close();
+    Serial.printf("[CACHE] Resume produced no pages\n");
+    return false;
+  }
+
   if ((!success && pageCount_ == 0) || aborted) {
     file_.close();
     // Remove file to prevent corrupt/incomplete cache
     SdMan.remove(cachePath_.c_str());
+    removeCheckpoint();
     Serial.printf("[CACHE] Parsing failed or aborted with %d pages\n", pageCount_);
     return false;
   }
@@ -244,11 +308,25 @@ bool PageCache::create(ContentParser& parser, const RenderConfig& config, uint16
   if (!writeLut(lut)) {
     file_.close();
     SdMan.remove(cachePath_.c_str());
+    removeCheckpoint();
     return false;
   }
 
   file_.close();
-  Serial.printf("[CACHE] Created in %lu ms: %d pages, partial=%d\n", millis() - startMs, pageCount_, isPartial_);
+  lut_.swap(lut);
+
+  // Checkpoint is written after the header so a crash in between leaves a stale
+  // page count in it, which loadCheckpoint() rejects
+  if (isPartial_ && parser.canResume()) {
+    if (!parser.saveCheckpoint(checkpointPath_, pageCount_)) {
+      removeCheckpoint();
+    }
+  } else {
+    removeCheckpoint();
+  }
+
+  Serial.printf("[CACHE] %s in %lu ms: %d pages (+%d), partial=%d\n", resumed ? "Resumed" : "Created",
+                millis() - startMs, pageCount_, pageCount_ - startPages, isPartial_);
   return true;
 }
 
@@ -262,56 +340,59 @@ bool PageCache::extend(ContentParser& parser, uint16_t additionalPages, const Ab
   const uint16_t targetPages = pageCount_ + additionalPages;
   Serial.printf("[CACHE] Extending from %d to %d pages\n", currentPages, targetPages);
 
+  // Continue from where the last chunk stopped when the parser left a checkpoint
+  if (parser.canResume() && parser.loadCheckpoint(checkpointPath_, currentPages)) {
+    if (resume(parser, targetPages, shouldAbort)) {
+      return true;
+    }
+    if (shouldAbort && shouldAbort()) {
+      return false;
+    }
+    Serial.printf("[CACHE] Resume failed, re-parsing from start\n");
+  }
+
   // Re-parse from start but skip serializing already-cached pages
   parser.reset();
   return create(parser, config_, targetPages, currentPages, shouldAbort);
 }
 
-std::unique_ptr<Page> PageCache::loadPage(uint16_t pageNum) {
-  if (pageNum >= pageCount_) {
+bool PageCache::loadPage(uint16_t pageNum, PageView& page) {
+  if (pageNum >= pageCount_ || pageNum >= lut_.size()) {
     Serial.printf("[CACHE] Page %d out of range (max %d)\n", pageNum, pageCount_);
-    return nullptr;
+    return false;
   }
 
-  if (!SdMan.openFileForRead("CACHE", cachePath_, file_)) {
-    return nullptr;
+  const unsigned long startMs = millis();
+  unsigned opens = 0;
+  if (!reader_) {
+    if (!SdMan.openFileForRead("CACHE", cachePath_, reader_)) {
+      return false;
+    }
+    opens++;
   }
 
-  const size_t fileSize = file_.size();
-
-  // Read LUT offset from header
-  file_.seek(HEADER_SIZE - 4);
-  uint32_t lutOffset;
-  serialization::readPod(file_, lutOffset);
-
-  // Validate LUT offset
-  if (lutOffset < HEADER_SIZE || lutOffset >= fileSize) {
-    Serial.printf("[CACHE] Invalid LUT offset: %u (file size: %zu)\n", lutOffset, fileSize);
-    file_.close();
-    return nullptr;
+  // A page runs up to the next page, or to the LUT written after the last one
+  const uint32_t pagePos = lut_[pageNum];
+  const uint32_t pageEnd = pageNum + 1u < lut_.size() ? lut_[pageNum + 1] : lutOffset_;
+  if (!reader_.seek(pagePos)) {
+    Serial.printf("[CACHE] Seek to page %d failed\n", pageNum);
+    closeReader();
+    return false;
   }
 
-  // Read page position from LUT
-  file_.seek(lutOffset + static_cast<size_t>(pageNum) * sizeof(uint32_t));
-  uint32_t pagePos;
-  serialization::readPod(file_, pagePos);
-
-  // Validate page position
-  if (pagePos < HEADER_SIZE || pagePos >= fileSize) {
-    Serial.printf("[CACHE] Invalid page position: %u (file size: %zu)\n", pagePos, fileSize);
-    file_.close();
-    return nullptr;
+  const bool ok = page.load(reader_, pageEnd > pagePos ? pageEnd - pagePos : 0);
+  Serial.printf("[%lu] [CACHE] Page %d loaded: %u open, 1 seek, %u read, %zu bytes in %lu ms\n", millis(), pageNum,
+                opens, page.readCalls(), page.blobSize(), millis() - startMs);
+  if (!ok) {
+    closeReader();
   }
-
-  // Read page
-  file_.seek(pagePos);
-  auto page = Page::deserialize(file_);
-  file_.close();
-
-  return page;
+  return ok;
 }
 
-bool PageCache::clear() const {
+bool PageCache::clear() {
+  closeReader();
+  lut_.clear();
+  removeCheckpoint();
   if (!SdMan.exists(cachePath_.c_str())) {
     return true;
   }
@@ -13,6 +13,7 @@
 class ContentParser;
 class GfxRenderer;
 class Page;
+class PageView;
 
 /**
  * Unified page cache for all content types (EPUB, TXT, Markdown).
@@ -27,19 +28,28 @@ class PageCache {
 
  private:
   std::string cachePath_;
-  FsFile file_;
+  std::string checkpointPath_;  // Parser resume state, valid only while cache is partial
+  FsFile file_;                 // Write handle while creating or extending
+  FsFile reader_;               // Read handle kept open across page turns, closed before any write
   uint16_t pageCount_ = 0;
   bool isPartial_ = false;
   RenderConfig config_;
-  uint32_t lutOffset_ = 0;  // Cached LUT offset for extend operations
+  uint32_t lutOffset_ = 0;     // Offset of the current LUT, also the end of the last page
+  std::vector<uint32_t> lut_;  // Resident page positions, 4 bytes per page
 
   bool writeHeader(bool isPartial);
   bool writeLut(const std::vector<uint32_t>& lut);
-  bool loadLut(std::vector<uint32_t>& lut);  // Load existing LUT for extend
+  bool readLut(size_t fileSize);  // Load LUT through reader_ after the header
+  bool openForAppend(std::vector<uint32_t>& lut);
+  void closeReader();
+  void removeCheckpoint();  // Checkpoint and the parser data it refers to
+  bool parseAndFinalize(ContentParser& parser, std::vector<uint32_t>& lut, uint16_t maxPages, uint16_t skipPages,
+                        bool resumed, unsigned long startMs, const AbortCallback& shouldAbort);
+  bool resume(ContentParser& parser, uint16_t maxPages, const AbortCallback& shouldAbort);
 
  public:
   explicit PageCache(std::string cachePath);
-  ~PageCache() = default;
+  ~PageCache();
 
   /**
    * Try to load existing cache from disk.
@@ -62,8 +72,9 @@ class PageCache {
 
   /**
    * Extend cache with more pages.
-   * Re-parses content but skips already-cached pages, then appends new pages.
-   * @param parser Content parser (will be reset)
+   * Resumes from the parser checkpoint when one is available; otherwise re-parses
+   * content, skipping already-cached pages, then appends new pages.
+   * @param parser Content parser (restored from checkpoint or reset)
    * @param additionalPages Number of additional pages to cache
    * @param shouldAbort Optional callback to check for cancellation
    * @return true on success
@@ -73,16 +84,18 @@ class PageCache {
 
   /**
    * Load a specific page from cache.
+   * Uses the resident LUT and the open read handle: one seek and one read per page.
    * @param pageNum Page number (0-indexed)
-   * @return Page object or nullptr on error
+   * @param page View to load into; its buffer is reused across calls
+   * @return true on success
    */
-  std::unique_ptr<Page> loadPage(uint16_t pageNum);
+  bool loadPage(uint16_t pageNum, PageView& page);
 
   /**
-   * Clear cache from disk.
+   * Clear cache (and any parser checkpoint with its data) from disk.
    * @return true on success
    */
-  bool clear() const;
+  bool clear();
 
   // Accessors
   uint16_t pageCount() const { return pageCount_; }
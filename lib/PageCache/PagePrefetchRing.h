@@ -0,0 +1,136 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <cstdint>
+#include <utility>
+
+/**
+ * Pages around the current one, decoded ahead of a page turn so it renders from RAM instead of SD.
+ * PageT is PageView in the reader; it must provide isLoaded() and release() and be swappable.
+ * Not thread safe: the owner of the page cache owns the ring too.
+ */
+template <typename PageT>
+class PagePrefetchRing {
+ public:
+  static constexpr int kAhead = 2;
+  static constexpr int kBehind = 1;
+  static constexpr int kSlots = kAhead + kBehind;
+  static constexpr uint32_t kMinFreeHeap = 48 * 1024;  // Stop prefetching below this
+
+  /**
+   * Moves the ring's copy of sectionPage into current. Swaps rather than copies: the slot keeps the
+   * outgoing page, ready for a page back.
+   * @return false if the ring doesn't hold sectionPage (current is left untouched)
+   */
+  bool take(const int sectionPage, PageT& current, int& currentPage) {
+    for (auto& slot : slots_) {
+      if (slot.sectionPage == sectionPage && slot.page.isLoaded()) {
+        std::swap(slot.page, current);
+        std::swap(slot.sectionPage, currentPage);
+        if (!slot.page.isLoaded()) slot.sectionPage = -1;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Loads the pages around sectionPage that the ring doesn't hold yet, nearest first and forward before
+   * backward, so low heap trims the least useful pages. Pages outside the window are dropped first.
+   * @param currentPage Page already held by the caller (never loaded into the ring), -1 if none
+   * @param load bool(int page, PageT& out), reads one page
+   * @param freeHeap uint32_t(), free heap; prefetching stops below kMinFreeHeap
+   * @param shouldStop bool(), checked before each load
+   */
+  template <typename LoadFn, typename FreeHeapFn, typename StopFn>
+  void fill(const int sectionPage, const int currentPage, const int pageCount, LoadFn load, FreeHeapFn freeHeap,
+            StopFn shouldStop) {
+    if (sectionPage < 0) return;
+
+    int wanted[kSlots + 1];
+    int wantedCount = 0;
+    if (currentPage != sectionPage) wanted[wantedCount++] = sectionPage;
+    for (int i = 1; i <= kAhead; i++) wanted[wantedCount++] = sectionPage + i;
+    for (int i = 1; i <= kBehind; i++) wanted[wantedCount++] = sectionPage - i;
+
+    auto isWanted = [&](int page) {
+      for (int i = 0; i < wantedCount; i++) {
+        if (wanted[i] == page) return true;
+      }
+      return false;
+    };
+
+    // Drop pages that fell out of the window so their memory counts towards the heap check
+    for (auto& slot : slots_) {
+      if (slot.sectionPage >= 0 && !isWanted(slot.sectionPage)) {
+        slot.sectionPage = -1;
+        if (freeHeap() < kMinFreeHeap) slot.page.release();
+      }
+    }
+
+    for (int i = 0; i < wantedCount; i++) {
+      const int page = wanted[i];
+      if (shouldStop()) return;
+      if (page < 0 || page >= pageCount || page == currentPage) continue;
+
+      Slot* target = nullptr;
+      bool present = false;
+      for (auto& slot : slots_) {
+        if (slot.sectionPage == page) {
+          present = true;
+          break;
+        }
+        if (!target && slot.sectionPage < 0) target = &slot;
+      }
+      if (present) continue;
+      if (!target) break;
+
+      const uint32_t heap = freeHeap();
+      if (heap < kMinFreeHeap) {
+        Serial.printf("[CACHE] Prefetch stopped at page %d: low heap (%lu)\n", page, static_cast<unsigned long>(heap));
+        for (auto& slot : slots_) {
+          if (slot.sectionPage < 0) slot.page.release();
+        }
+        return;
+      }
+
+      if (load(page, target->page)) {
+        target->sectionPage = page;
+      } else {
+        target->page.release();
+        return;
+      }
+    }
+  }
+
+  // Drops every page and frees its buffer, e.g. when the page cache they were read from goes away
+  void clear() {
+    for (auto& slot : slots_) {
+      slot.sectionPage = -1;
+      slot.page.release();
+    }
+  }
+
+  // Number of pages the ring holds
+  int size() const {
+    int count = 0;
+    for (const auto& slot : slots_) count += slot.sectionPage >= 0 ? 1 : 0;
+    return count;
+  }
+
+  // Whether the ring holds sectionPage
+  bool holds(const int sectionPage) const {
+    for (const auto& slot : slots_) {
+      if (slot.sectionPage == sectionPage && sectionPage >= 0) return true;
+    }
+    return false;
+  }
+
+ private:
+  struct Slot {
+    int sectionPage = -1;
+    PageT page;
+  };
+  Slot slots_[kSlots];
+};
@@ -70,7 +70,8 @@ bool PlainTextParser::parsePages(const std::function<void(std::unique_ptr<Page>)
     return true;
   };
 
-  auto flushBlock = [&]() -> bool {
+  // Until the paragraph ends, only lines later words can't change are emitted
+  auto layoutBlock = [&](const bool paragraphComplete) -> bool {
     if (!currentBlock || currentBlock->isEmpty()) return true;
 
     bool continueProcessing = true;
@@ -80,12 +81,30 @@ bool PlainTextParser::parsePages(const std::function<void(std::unique_ptr<Page>)
                                           if (!addLineToPage(line)) {
                                             continueProcessing = false;
                                           }
-                                        });
+                                        },
+                                        paragraphComplete);
+    return continueProcessing;
+  };
 
+  auto flushBlock = [&]() -> bool {
+    const bool continueProcessing = layoutBlock(true);
     currentBlock.reset();
     return continueProcessing;
   };
 
+  // Max pages reached with input byte i of the current chunk consumed
+  auto stopAfter = [&](const size_t i, const size_t bytesRead) {
+    currentOffset_ = file.position() - (bytesRead - i - 1);
+    hasMore_ = true;
+    file.close();
+
+    // Complete final page if it has content
+    if (currentPage && !currentPage->elements.empty()) {
+      onPageComplete(std::move(currentPage));
+    }
+    return true;
+  };
+
   startNewPage();
   currentBlock.reset(new ParsedText(static_cast<TextBlock::BLOCK_STYLE>(config_.paragraphAlignment),
                                     config_.indentLevel, config_.hyphenation, true));
@@ -118,15 +137,7 @@ bool PlainTextParser::parsePages(const std::function<void(std::unique_ptr<Page>)
 
         // Flush current block (paragraph)
         if (!flushBlock()) {
-          currentOffset_ = file.position() - (bytesRead - i - 1);
-          hasMore_ = true;
-          file.close();
-
-          // Complete final page if it has content
-          if (currentPage && !currentPage->elements.empty()) {
-            onPageComplete(std::move(currentPage));
-          }
-          return true;
+          return stopAfter(i, bytesRead);
         }
 
         // Start new paragraph
@@ -149,6 +160,11 @@ bool PlainTextParser::parsePages(const std::function<void(std::unique_ptr<Page>)
         if (!partialWord.empty()) {
           currentBlock->addWord(partialWord, EpdFontFamily::REGULAR);
           partialWord.clear();
+
+          // A file without line breaks is one giant paragraph; stream its lines out as they become final
+          if (currentBlock->size() >= ParsedText::STREAM_LAYOUT_WORDS && !layoutBlock(false)) {
+            return stopAfter(i, bytesRead);
+          }
         }
         continue;
       }
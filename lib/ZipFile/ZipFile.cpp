@@ -30,57 +30,154 @@ bool inflateOneShot(const uint8_t* inputBuf, const size_t deflatedSize, uint8_t*
   return true;
 }
 
-bool ZipFile::loadAllFileStatSlims() {
-  const bool wasOpen = isOpen();
-  if (!wasOpen && !open()) {
+ZipFile::CentralDirReader::CentralDirReader(FsFile& file, const ZipDetails& details, const size_t budget)
+    : file(file), filePos(details.centralDirOffset), remaining(details.centralDirSize) {
+  if (!file.seek(details.centralDirOffset)) {
+    return;
+  }
+
+  valid = true;
+  if (remaining == 0) {
+    return;
+  }
+
+  capacity = std::min<size_t>(remaining, std::max(budget, MIN_CAPACITY));
+  buffer = static_cast<uint8_t*>(malloc(capacity));
+  if (!buffer && capacity > MIN_CAPACITY) {
+    capacity = MIN_CAPACITY;
+    buffer = static_cast<uint8_t*>(malloc(capacity));
+  }
+  if (!buffer) {
+    Serial.printf("[%lu] [ZIP] Failed to allocate central directory buffer\n", millis());
+    valid = false;
+  }
+}
+
+ZipFile::CentralDirReader::~CentralDirReader() { free(buffer); }
+
+bool ZipFile::CentralDirReader::fill(const size_t needed) {
+  if (end - start >= needed) {
+    return true;
+  }
+  if (needed > capacity) {
     return false;
   }
 
-  if (!loadZipDetails()) {
-    if (!wasOpen) {
-      close();
+  if (start > 0) {
+    memmove(buffer, buffer + start, end - start);
+    end -= start;
+    start = 0;
+  }
+
+  while (end < needed && remaining > 0) {
+    size_t toRead = std::min<size_t>(capacity - end, remaining);
+    // End chunks on a sector boundary so the following reads stay aligned
+    if (toRead < remaining) {
+      const size_t misalignment = (filePos + toRead) % 512;
+      if (toRead > misalignment && end + toRead - misalignment >= needed) {
+        toRead -= misalignment;
+      }
     }
-    return false;
+
+    const int bytesRead = file.read(buffer + end, toRead);
+    if (bytesRead <= 0) {
+      remaining = 0;
+      break;
+    }
+    end += bytesRead;
+    filePos += bytesRead;
+    remaining -= bytesRead;
   }
 
-  file.seek(zipDetails.centralDirOffset);
+  return end - start >= needed;
+}
 
-  uint32_t sig;
-  char itemName[256];
-  fileStatSlimCache.clear();
-  fileStatSlimCache.reserve(zipDetails.totalEntries);
+bool ZipFile::CentralDirReader::skip(size_t count) {
+  const size_t buffered = end - start;
+  if (count <= buffered) {
+    start += count;
+    return true;
+  }
 
-  while (file.available()) {
-    file.read(&sig, 4);
-    if (sig != 0x02014b50) break;  // End of list
+  count -= buffered;
+  start = end = 0;
+  if (count > remaining) {
+    remaining = 0;
+    return false;
+  }
+  filePos += count;
+  remaining -= count;
+  return file.seek(filePos);
+}
+
+bool ZipFile::CentralDirReader::next(Entry* entry) {
+  constexpr size_t headerSize = 46;
 
-    FileStatSlim fileStat = {};
+  while (valid && fill(headerSize)) {
+    const uint8_t* header = buffer + start;
+    uint32_t sig;
+    memcpy(&sig, header, 4);
+    if (sig != 0x02014b50) return false;  // End of central directory
 
-    file.seekCur(6);
-    file.read(&fileStat.method, 2);
-    file.seekCur(8);
-    file.read(&fileStat.compressedSize, 4);
-    file.read(&fileStat.uncompressedSize, 4);
     uint16_t nameLen, m, k;
-    file.read(&nameLen, 2);
-    file.read(&m, 2);
-    file.read(&k, 2);
-    file.seekCur(8);
-    file.read(&fileStat.localHeaderOffset, 4);
+    entry->stat = {};
+    memcpy(&entry->stat.method, header + 10, 2);
+    memcpy(&entry->stat.compressedSize, header + 20, 4);
+    memcpy(&entry->stat.uncompressedSize, header + 24, 4);
+    memcpy(&nameLen, header + 28, 2);
+    memcpy(&m, header + 30, 2);
+    memcpy(&k, header + 32, 2);
+    memcpy(&entry->stat.localHeaderOffset, header + 42, 4);
+    start += headerSize;
 
     // Bounds check to prevent buffer overflow
     if (nameLen >= 255) {
-      file.seekCur(nameLen + m + k);  // Skip this entry entirely
+      if (!skip(nameLen + m + k)) return false;  // Skip this entry entirely
       continue;
     }
 
-    file.read(itemName, nameLen);
-    itemName[nameLen] = '\0';
+    if (!fill(nameLen)) return false;
+    memcpy(name, buffer + start, nameLen);
+    name[nameLen] = '\0';
+    start += nameLen;
+
+    entry->nameLen = nameLen;
+    entry->name = name;
+
+    // Skip the rest of this entry (extra field + comment); a truncated tail ends the walk on the next call
+    skip(m + k);
+    return true;
+  }
+  return false;
+}
+
+bool ZipFile::loadAllFileStatSlims() {
+  const bool wasOpen = isOpen();
+  if (!wasOpen && !open()) {
+    return false;
+  }
+
+  if (!loadZipDetails()) {
+    if (!wasOpen) {
+      close();
+    }
+    return false;
+  }
+
+  CentralDirReader reader(file, zipDetails, centralDirReadBudget);
+  if (!reader.ok()) {
+    if (!wasOpen) {
+      close();
+    }
+    return false;
+  }
 
-    fileStatSlimCache.emplace(itemName, fileStat);
+  fileStatSlimCache.clear();
+  fileStatSlimCache.reserve(zipDetails.totalEntries);
 
-    // Skip the rest of this entry (extra field + comment)
-    file.seekCur(m + k);
+  CentralDirReader::Entry entry;
+  while (reader.next(&entry)) {
+    fileStatSlimCache.emplace(entry.name, entry.stat);
   }
 
   if (!wasOpen) {
@@ -99,6 +196,14 @@ bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
     return false;
   }
 
+  if (!indexPath.empty()) {
+    const int result = lookupIndex(filename, fileStat);
+    if (result >= 0) {
+      return result == 1;
+    }
+    // Index can't answer this lookup, fall back to scanning the central directory
+  }
+
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
     return false;
@@ -111,44 +216,17 @@ bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
     return false;
   }
 
-  file.seek(zipDetails.centralDirOffset);
-
-  uint32_t sig;
-  char itemName[256];
+  CentralDirReader reader(file, zipDetails, centralDirReadBudget);
+  const size_t filenameLen = strlen(filename);
   bool found = false;
 
-  while (file.available()) {
-    file.read(&sig, 4);
-    if (sig != 0x02014b50) break;  // End of list
-
-    file.seekCur(6);
-    file.read(&fileStat->method, 2);
-    file.seekCur(8);
-    file.read(&fileStat->compressedSize, 4);
-    file.read(&fileStat->uncompressedSize, 4);
-    uint16_t nameLen, m, k;
-    file.read(&nameLen, 2);
-    file.read(&m, 2);
-    file.read(&k, 2);
-    file.seekCur(8);
-    file.read(&fileStat->localHeaderOffset, 4);
-
-    // Bounds check to prevent buffer overflow
-    if (nameLen >= 255) {
-      file.seekCur(nameLen + m + k);  // Skip this entry entirely
-      continue;
-    }
-
-    file.read(itemName, nameLen);
-    itemName[nameLen] = '\0';
-
-    if (strcmp(itemName, filename) == 0) {
+  CentralDirReader::Entry entry;
+  while (reader.next(&entry)) {
+    if (entry.nameLen == filenameLen && memcmp(entry.name, filename, filenameLen) == 0) {
+      *fileStat = entry.stat;
       found = true;
       break;
     }
-
-    // Skip the rest of this entry (extra field + comment)
-    file.seekCur(m + k);
   }
 
   if (!wasOpen) {
@@ -158,6 +236,10 @@ bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
 }
 
 long ZipFile::getDataOffset(const FileStatSlim& fileStat) {
+  if (fileStat.dataOffset != 0) {
+    return fileStat.dataOffset;
+  }
+
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
     return -1;
@@ -246,9 +328,17 @@ bool ZipFile::loadZipDetails() {
   // Now extract the values we need from the EOCD record
   // Relative positions within EOCD:
   // Offset 10: Total number of entries (2 bytes)
+  // Offset 12: Size of the central directory (4 bytes)
   // Offset 16: Offset of start of central directory with respect to the starting disk number (4 bytes)
   memcpy(&zipDetails.totalEntries, &buffer[foundOffset + 10], sizeof(zipDetails.totalEntries));
+  memcpy(&zipDetails.centralDirSize, &buffer[foundOffset + 12], sizeof(zipDetails.centralDirSize));
   memcpy(&zipDetails.centralDirOffset, &buffer[foundOffset + 16], sizeof(zipDetails.centralDirOffset));
+  // Bound the directory by the file if the recorded size is missing or bogus
+  if (zipDetails.centralDirOffset > fileSize) {
+    zipDetails.centralDirSize = 0;
+  } else if (zipDetails.centralDirSize == 0 || zipDetails.centralDirSize > fileSize - zipDetails.centralDirOffset) {
+    zipDetails.centralDirSize = fileSize - zipDetails.centralDirOffset;
+  }
   zipDetails.isSet = true;
 
   free(buffer);
@@ -265,6 +355,225 @@ uint16_t ZipFile::getTotalEntries() {
   return zipDetails.totalEntries;
 }
 
+bool ZipFile::openIndex(const std::string& path, FsFile& indexFile, IndexHeader* header) {
+  if (!SdMan.openFileForRead("ZIP", path, indexFile)) {
+    return false;
+  }
+
+  if (indexFile.read(header, sizeof(IndexHeader)) != sizeof(IndexHeader) || header->version != INDEX_VERSION ||
+      indexFile.size() != sizeof(IndexHeader) + header->entryCount * sizeof(IndexEntry)) {
+    indexFile.close();
+    return false;
+  }
+  return true;
+}
+
+int ZipFile::findIndexEntry(FsFile& indexFile, const uint16_t entryCount, const uint64_t hash, const uint16_t len,
+                            IndexEntry* entry) {
+  uint32_t lo = 0;
+  uint32_t hi = entryCount;
+  while (lo < hi) {
+    const uint32_t mid = lo + (hi - lo) / 2;
+    IndexEntry probe;
+    if (!indexFile.seek(sizeof(IndexHeader) + mid * sizeof(IndexEntry)) ||
+        indexFile.read(&probe, sizeof(IndexEntry)) != sizeof(IndexEntry)) {
+      return -1;
+    }
+
+    if (probe.hash == hash && probe.len == len) {
+      if (probe.method == INDEX_AMBIGUOUS) {
+        return -1;
+      }
+      *entry = probe;
+      return 1;
+    }
+
+    if (probe.hash < hash || (probe.hash == hash && probe.len < len)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return 0;
+}
+
+int ZipFile::lookupIndex(const char* filename, FileStatSlim* fileStat) const {
+  const size_t len = strlen(filename);
+  if (len >= 255) {
+    return 0;  // Never indexed, matches the central directory scan which skips these too
+  }
+
+  FsFile indexFile;
+  IndexHeader header;
+  if (!openIndex(indexPath, indexFile, &header)) {
+    return -1;
+  }
+
+  IndexEntry entry;
+  const int result = findIndexEntry(indexFile, header.entryCount, fnvHash64(filename, len), len, &entry);
+  indexFile.close();
+
+  if (result == 1) {
+    fileStat->method = entry.method;
+    fileStat->compressedSize = entry.compressedSize;
+    fileStat->uncompressedSize = entry.uncompressedSize;
+    fileStat->localHeaderOffset = 0;
+    fileStat->dataOffset = entry.dataOffset;
+  }
+  return result;
+}
+
+bool ZipFile::checkIndex(const std::string& indexPath) {
+  if (!SdMan.exists(indexPath.c_str())) {
+    return false;
+  }
+
+  const bool wasOpen = isOpen();
+  if (!wasOpen && !open()) {
+    return false;
+  }
+
+  const bool detailsLoaded = loadZipDetails();
+  const uint32_t zipSize = file.size();
+  if (!wasOpen) {
+    close();
+  }
+  if (!detailsLoaded) {
+    return false;
+  }
+
+  FsFile indexFile;
+  IndexHeader header;
+  if (!openIndex(indexPath, indexFile, &header)) {
+    return false;
+  }
+  indexFile.close();
+
+  return header.centralDirOffset == zipDetails.centralDirOffset && header.zipSize == zipSize;
+}
+
+bool ZipFile::buildIndex(const std::string& indexPath) {
+  const unsigned long startMs = millis();
+
+  const bool wasOpen = isOpen();
+  if (!wasOpen && !open()) {
+    return false;
+  }
+
+  if (!loadZipDetails()) {
+    if (!wasOpen) {
+      close();
+    }
+    return false;
+  }
+
+  const std::string tmpPath = indexPath + ".tmp";
+  FsFile indexFile;
+  if (!SdMan.openFileForWrite("ZIP", tmpPath, indexFile)) {
+    if (!wasOpen) {
+      close();
+    }
+    return false;
+  }
+
+  IndexHeader header = {INDEX_VERSION, 0, 0, zipDetails.centralDirOffset, static_cast<uint32_t>(file.size())};
+  bool ok = indexFile.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header);
+
+  // Entries are collected in passes over disjoint ranges of the top hash byte so that at most
+  // INDEX_BUILD_BUDGET of records is held at once. Ranges ascend, so the concatenated passes are sorted.
+  constexpr size_t entriesPerPass = INDEX_BUILD_BUDGET / sizeof(IndexEntry);
+  const int passes = std::max<int>(1, (zipDetails.totalEntries + entriesPerPass - 1) / entriesPerPass);
+  uint32_t written = 0;
+  std::vector<IndexEntry> entries;
+  entries.reserve(std::min<size_t>(zipDetails.totalEntries, entriesPerPass));
+
+  for (int pass = 0; ok && pass < passes; pass++) {
+    const uint32_t rangeStart = pass * 256 / passes;
+    const uint32_t rangeEnd = (pass + 1) * 256 / passes;
+    entries.clear();
+
+    CentralDirReader reader(file, zipDetails, centralDirReadBudget);
+    if (!reader.ok()) {
+      ok = false;
+      break;
+    }
+
+    CentralDirReader::Entry dirEntry;
+    while (reader.next(&dirEntry)) {
+      const uint64_t hash = fnvHash64(dirEntry.name, dirEntry.nameLen);
+      const uint32_t bucket = static_cast<uint32_t>(hash >> 56);
+      if (bucket < rangeStart || bucket >= rangeEnd) continue;
+
+      // Local header offset goes in dataOffset until resolved below
+      entries.push_back({hash, dirEntry.nameLen, dirEntry.stat.method, dirEntry.stat.compressedSize,
+                         dirEntry.stat.uncompressedSize, dirEntry.stat.localHeaderOffset});
+    }
+
+    // Resolve data offsets in file order so local header reads only seek forward
+    std::sort(entries.begin(), entries.end(),
+              [](const IndexEntry& a, const IndexEntry& b) { return a.dataOffset < b.dataOffset; });
+    for (auto& entry : entries) {
+      FileStatSlim fileStat = {};
+      fileStat.localHeaderOffset = entry.dataOffset;
+      const long dataOffset = getDataOffset(fileStat);
+      if (dataOffset <= 0) {
+        ok = false;
+        break;
+      }
+      entry.dataOffset = static_cast<uint32_t>(dataOffset);
+    }
+    if (!ok) break;
+
+    std::sort(entries.begin(), entries.end(), [](const IndexEntry& a, const IndexEntry& b) {
+      return a.hash < b.hash || (a.hash == b.hash && a.len < b.len);
+    });
+
+    // Colliding (hash, len) pairs can't be told apart without the name; lookups fall back to a scan
+    for (size_t i = 1; i < entries.size(); i++) {
+      if (entries[i].hash == entries[i - 1].hash && entries[i].len == entries[i - 1].len) {
+        entries[i].method = INDEX_AMBIGUOUS;
+        entries[i - 1].method = INDEX_AMBIGUOUS;
+      }
+    }
+
+    const size_t bytes = entries.size() * sizeof(IndexEntry);
+    if (bytes > 0 && indexFile.write(reinterpret_cast<const uint8_t*>(entries.data()), bytes) != bytes) {
+      ok = false;
+    }
+    written += entries.size();
+  }
+
+  if (!wasOpen) {
+    close();
+  }
+
+  if (ok && written <= 0xFFFF) {
+    header.entryCount = static_cast<uint16_t>(written);
+    ok = indexFile.seek(0) &&
+         indexFile.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header);
+  } else {
+    ok = false;
+  }
+  indexFile.close();
+
+  if (ok) {
+    if (SdMan.exists(indexPath.c_str())) {
+      SdMan.remove(indexPath.c_str());
+    }
+    ok = SdMan.rename(tmpPath.c_str(), indexPath.c_str());
+  }
+
+  if (!ok) {
+    Serial.printf("[%lu] [ZIP] Failed to build central directory index\n", millis());
+    SdMan.remove(tmpPath.c_str());
+    return false;
+  }
+
+  Serial.printf("[%lu] [ZIP] Indexed %u entries in %d pass(es) in %lu ms\n", millis(), written, passes,
+                millis() - startMs);
+  return true;
+}
+
 bool ZipFile::open() {
   if (!SdMan.openFileForRead("ZIP", filePath, file)) {
     return false;
@@ -294,6 +603,31 @@ int ZipFile::fillUncompressedSizes(std::vector<SizeTarget>& targets, std::vector
     return 0;
   }
 
+  if (!indexPath.empty()) {
+    FsFile indexFile;
+    IndexHeader header;
+    if (openIndex(indexPath, indexFile, &header)) {
+      int matched = 0;
+      bool answered = true;
+      for (const auto& target : targets) {
+        IndexEntry entry;
+        const int result = findIndexEntry(indexFile, header.entryCount, target.hash, target.len, &entry);
+        if (result < 0) {
+          answered = false;
+          break;
+        }
+        if (result == 1 && target.index < sizes.size()) {
+          sizes[target.index] = entry.uncompressedSize;
+          matched++;
+        }
+      }
+      indexFile.close();
+      if (answered) {
+        return matched;
+      }
+    }
+  }
+
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
     return 0;
@@ -306,56 +640,26 @@ int ZipFile::fillUncompressedSizes(std::vector<SizeTarget>& targets, std::vector
     return 0;
   }
 
-  file.seek(zipDetails.centralDirOffset);
-
-  uint32_t sig;
-  char itemName[256];
+  CentralDirReader reader(file, zipDetails, centralDirReadBudget);
   int matched = 0;
 
-  while (file.available()) {
-    if (file.read(&sig, 4) != 4) break;
-    if (sig != 0x02014b50) break;  // End of central directory
-
-    // Skip: version made by (2), version needed (2), flags (2), method (2), time (2), date (2), crc32 (4)
-    file.seekCur(16);
-    // Skip compressedSize (4), read uncompressedSize (4)
-    file.seekCur(4);
-    uint32_t uncompressedSize;
-    if (file.read(&uncompressedSize, 4) != 4) break;
-    uint16_t nameLen, m, k;
-    if (file.read(&nameLen, 2) != 2) break;
-    if (file.read(&m, 2) != 2) break;
-    if (file.read(&k, 2) != 2) break;
-    // Skip: comment len already read in k, disk# (2), internal attr (2), external attr (4), local header offset (4)
-    file.seekCur(12);
-
-    // Bounds check to prevent buffer overflow
-    if (nameLen >= 255) {
-      file.seekCur(nameLen + m + k);  // Skip this entry entirely
-      continue;
-    }
-
-    if (file.read(itemName, nameLen) != nameLen) break;
-    itemName[nameLen] = '\0';
-
+  CentralDirReader::Entry entry;
+  while (reader.next(&entry)) {
     // Compute hash on-the-fly from filename
-    const uint64_t entryHash = fnvHash64(itemName, nameLen);
+    const uint64_t entryHash = fnvHash64(entry.name, entry.nameLen);
 
     // Binary search for matching target
-    SizeTarget key = {entryHash, nameLen, 0};
+    SizeTarget key = {entryHash, entry.nameLen, 0};
     auto it = std::lower_bound(targets.begin(), targets.end(), key);
 
     // Check for match (hash and len must match)
-    if (it != targets.end() && it->hash == entryHash && it->len == nameLen) {
+    if (it != targets.end() && it->hash == entryHash && it->len == entry.nameLen) {
       // Bounds check before write
       if (it->index < sizes.size()) {
-        sizes[it->index] = uncompressedSize;
+        sizes[it->index] = entry.stat.uncompressedSize;
         matched++;
       }
     }
-
-    // Skip the rest of this entry (extra field + comment)
-    file.seekCur(m + k);
   }
 
   if (!wasOpen) {
@@ -369,6 +673,33 @@ int ZipFile::findFirstExisting(const char* const* paths, int pathCount) {
     return -1;
   }
 
+  if (!indexPath.empty()) {
+    FsFile indexFile;
+    IndexHeader header;
+    if (openIndex(indexPath, indexFile, &header)) {
+      // Paths are in priority order, so the first hit wins
+      int foundIndex = -1;
+      bool answered = true;
+      for (int i = 0; i < pathCount && foundIndex < 0; i++) {
+        if (!paths[i]) continue;
+        const size_t len = strlen(paths[i]);
+        if (len >= 255) continue;
+        IndexEntry entry;
+        const int result =
+            findIndexEntry(indexFile, header.entryCount, fnvHash64(paths[i], len), static_cast<uint16_t>(len), &entry);
+        if (result < 0) {
+          answered = false;
+          break;
+        }
+        if (result == 1) foundIndex = i;
+      }
+      indexFile.close();
+      if (answered) {
+        return foundIndex;
+      }
+    }
+  }
+
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
     return -1;
@@ -387,51 +718,28 @@ int ZipFile::findFirstExisting(const char* const* paths, int pathCount) {
     const char* path = paths[i];
     if (!path) continue;
     const size_t len = strlen(path);
-    if (len > 255) continue;  // Skip paths that are too long for itemName[256]
+    if (len >= 255) continue;  // Longer names are never matched by the directory walk
     targets.push_back({fnvHash64(path, len), static_cast<uint16_t>(len), static_cast<uint16_t>(i)});
   }
   std::sort(targets.begin(), targets.end());
 
-  file.seek(zipDetails.centralDirOffset);
-
-  uint32_t sig;
-  char itemName[256];
+  CentralDirReader reader(file, zipDetails, centralDirReadBudget);
   int foundIndex = -1;
   int lowestPriority = pathCount;  // Lower index = higher priority
 
-  while (file.available()) {
-    if (file.read(&sig, 4) != 4) break;
-    if (sig != 0x02014b50) break;  // End of central directory
-
-    // Skip to name length (skip 24 bytes from after signature)
-    if (!file.seekCur(24)) break;
-    uint16_t nameLen, m, k;
-    if (file.read(&nameLen, 2) != 2) break;
-    if (file.read(&m, 2) != 2) break;
-    if (file.read(&k, 2) != 2) break;
-    // Skip remaining header (12 bytes)
-    if (!file.seekCur(12)) break;
-
-    // Bounds check to prevent buffer overflow
-    if (nameLen > 255) {
-      file.seekCur(nameLen + m + k);
-      continue;
-    }
-
-    if (file.read(itemName, nameLen) != nameLen) break;
-    itemName[nameLen] = '\0';
-
+  CentralDirReader::Entry entry;
+  while (reader.next(&entry)) {
     // Compute hash on-the-fly from filename
-    const uint64_t entryHash = fnvHash64(itemName, nameLen);
+    const uint64_t entryHash = fnvHash64(entry.name, entry.nameLen);
 
     // Binary search for matching target
-    SizeTarget key = {entryHash, nameLen, 0};
+    SizeTarget key = {entryHash, entry.nameLen, 0};
     auto it = std::lower_bound(targets.begin(), targets.end(), key);
 
     // Check for match (hash and len must match)
-    if (it != targets.end() && it->hash == entryHash && it->len == nameLen) {
+    if (it != targets.end() && it->hash == entryHash && it->len == entry.nameLen) {
       // Verify string match (hash collision protection) with bounds check
-      if (it->index < pathCount && strcmp(itemName, paths[it->index]) == 0) {
+      if (it->index < pathCount && strcmp(entry.name, paths[it->index]) == 0) {
         // Keep track of lowest index (highest priority)
         if (it->index < lowestPriority) {
           lowestPriority = it->index;
@@ -440,9 +748,6 @@ int ZipFile::findFirstExisting(const char* const* paths, int pathCount) {
         }
       }
     }
-
-    // Skip the rest of this entry (extra field + comment)
-    file.seekCur(m + k);
   }
 
   if (!wasOpen) {
@@ -548,7 +853,43 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
   return data;
 }
 
-bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t chunkSize) {
+bool ZipFile::openSeekIndex(const std::string& path, const FileStatSlim& fileStat, const uint32_t dataOffset,
+                            FsFile& seekFile, SeekIndexHeader* header) {
+  seekFile = SdMan.open(path.c_str(), O_RDWR | O_CREAT);
+  if (!seekFile) {
+    Serial.printf("[%lu] [ZIP] Failed to open seek index %s\n", millis(), path.c_str());
+    return false;
+  }
+
+  constexpr size_t recordSize = sizeof(SeekPoint) + sizeof(tinfl_decompressor) + TINFL_LZ_DICT_SIZE;
+  if (seekFile.size() >= sizeof(SeekIndexHeader) &&
+      seekFile.read(header, sizeof(SeekIndexHeader)) == sizeof(SeekIndexHeader) &&
+      header->version == SEEK_INDEX_VERSION && header->interval == SEEK_INDEX_INTERVAL &&
+      header->stateSize == sizeof(tinfl_decompressor) && header->compressedSize == fileStat.compressedSize &&
+      header->uncompressedSize == fileStat.uncompressedSize && header->dataOffset == dataOffset &&
+      seekFile.size() >= sizeof(SeekIndexHeader) + header->pointCount * recordSize) {
+    return true;
+  }
+
+  // Missing or stale, start over with no snapshots
+  *header = {SEEK_INDEX_VERSION,
+             0,
+             0,
+             SEEK_INDEX_INTERVAL,
+             sizeof(tinfl_decompressor),
+             fileStat.compressedSize,
+             fileStat.uncompressedSize,
+             dataOffset};
+  if (!seekFile.truncate(0) || !seekFile.seek(0) ||
+      seekFile.write(reinterpret_cast<const uint8_t*>(header), sizeof(SeekIndexHeader)) != sizeof(SeekIndexHeader)) {
+    seekFile.close();
+    return false;
+  }
+  return true;
+}
+
+bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t chunkSize, const uint32_t fromOffset,
+                               const std::string& seekIndexPath) {
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
     return false;
@@ -561,7 +902,7 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
   }
 
   const long fileOffset = getDataOffset(fileStat);
-  if (fileOffset < 0) {
+  if (fileOffset < 0 || fromOffset > fileStat.uncompressedSize) {
     if (!wasOpen) close();
     return false;
   }
@@ -581,7 +922,8 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
       return false;
     }
 
-    size_t remaining = inflatedDataSize;
+    file.seek(fileOffset + fromOffset);
+    size_t remaining = inflatedDataSize - fromOffset;
     while (remaining > 0) {
       const size_t dataRead = file.read(buffer, remaining < chunkSize ? remaining : chunkSize);
       if (dataRead == 0) {
@@ -646,11 +988,52 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
     size_t fileReadBufferCursor = 0;
     size_t outputCursor = 0;  // Current offset in the circular dictionary
 
+    // Seek index: restart from the closest snapshot at or before fromOffset, append snapshots past its end
+    constexpr size_t recordSize = sizeof(SeekPoint) + sizeof(tinfl_decompressor) + TINFL_LZ_DICT_SIZE;
+    FsFile seekFile;
+    SeekIndexHeader seekHeader = {};
+    bool indexing = !seekIndexPath.empty() && inflatedDataSize >= SEEK_INDEX_MIN_ENTRY_SIZE &&
+                    openSeekIndex(seekIndexPath, fileStat, fileOffset, seekFile, &seekHeader);
+    uint16_t pointCount = indexing ? seekHeader.pointCount : 0;
+
+    if (indexing && pointCount > 0 && fromOffset >= SEEK_INDEX_INTERVAL) {
+      int point = std::min<int>(pointCount, fromOffset / SEEK_INDEX_INTERVAL) - 1;
+      SeekPoint seekPoint = {};
+      for (; point >= 0; point--) {
+        if (!seekFile.seek(sizeof(SeekIndexHeader) + point * recordSize) ||
+            seekFile.read(&seekPoint, sizeof(SeekPoint)) != sizeof(SeekPoint)) {
+          point = -1;
+          break;
+        }
+        if (seekPoint.outOffset <= fromOffset) break;
+      }
+
+      if (point >= 0) {
+        if (seekFile.read(inflator, sizeof(tinfl_decompressor)) == sizeof(tinfl_decompressor) &&
+            seekFile.read(outputBuffer, TINFL_LZ_DICT_SIZE) == TINFL_LZ_DICT_SIZE &&
+            file.seek(fileOffset + seekPoint.inOffset)) {
+          fileRemainingBytes = deflatedDataSize - seekPoint.inOffset;
+          processedOutputBytes = seekPoint.outOffset;
+          outputCursor = seekPoint.dictCursor;
+          Serial.printf("[%lu] [ZIP] Inflating from snapshot at %u for offset %u\n", millis(), seekPoint.outOffset,
+                        fromOffset);
+        } else {
+          // Partially restored state is unusable, inflate from the start
+          memset(inflator, 0, sizeof(tinfl_decompressor));
+          tinfl_init(inflator);
+          memset(outputBuffer, 0, TINFL_LZ_DICT_SIZE);
+          file.seek(fileOffset);
+        }
+      }
+    }
+
+    bool success = false;
     while (true) {
       // Load more compressed bytes when needed
       if (fileReadBufferCursor >= fileReadBufferFilledBytes) {
         if (fileRemainingBytes == 0) {
           // Should not be hit, but a safe protection
+          Serial.printf("[%lu] [ZIP] Unexpected EOF\n", millis());
           break;  // EOF
         }
 
@@ -661,6 +1044,7 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
 
         if (fileReadBufferFilledBytes == 0) {
           // Bad read
+          Serial.printf("[%lu] [ZIP] Unexpected EOF\n", millis());
           break;  // EOF
         }
       }
@@ -677,18 +1061,16 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
       // Update input position
       fileReadBufferCursor += inBytes;
 
-      // Write output chunk
+      // Write output chunk, skipping anything before fromOffset
       if (outBytes > 0) {
+        const size_t chunkStart = processedOutputBytes;
         processedOutputBytes += outBytes;
-        if (out.write(outputBuffer + outputCursor, outBytes) != outBytes) {
-          Serial.printf("[%lu] [ZIP] Failed to write all output bytes to stream\n", millis());
-          if (!wasOpen) {
-            close();
+        if (processedOutputBytes > fromOffset) {
+          const size_t skip = chunkStart < fromOffset ? fromOffset - chunkStart : 0;
+          if (out.write(outputBuffer + outputCursor + skip, outBytes - skip) != outBytes - skip) {
+            Serial.printf("[%lu] [ZIP] Failed to write all output bytes to stream\n", millis());
+            break;
           }
-          free(outputBuffer);
-          free(fileReadBuffer);
-          free(inflator);
-          return false;
         }
         // Update output position in buffer (with wraparound)
         outputCursor = (outputCursor + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
@@ -696,37 +1078,52 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
 
       if (status < 0) {
         Serial.printf("[%lu] [ZIP] tinfl_decompress() failed with status %d\n", millis(), status);
-        if (!wasOpen) {
-          close();
-        }
-        free(outputBuffer);
-        free(fileReadBuffer);
-        free(inflator);
-        return false;
+        break;
       }
 
       if (status == TINFL_STATUS_DONE) {
         Serial.printf("[%lu] [ZIP] Decompressed %d bytes into %d bytes\n", millis(), deflatedDataSize,
                       inflatedDataSize);
-        if (!wasOpen) {
-          close();
+        success = true;
+        break;
+      }
+
+      // Between calls the inflater state, dictionary and input position fully describe the stream
+      if (indexing && processedOutputBytes >= (pointCount + 1u) * SEEK_INDEX_INTERVAL && pointCount < 0xFFFF) {
+        const SeekPoint seekPoint = {
+            static_cast<uint32_t>(processedOutputBytes),
+            static_cast<uint32_t>(deflatedDataSize - fileRemainingBytes -
+                                  (fileReadBufferFilledBytes - fileReadBufferCursor)),
+            static_cast<uint32_t>(outputCursor)};
+        if (seekFile.seek(sizeof(SeekIndexHeader) + pointCount * recordSize) &&
+            seekFile.write(reinterpret_cast<const uint8_t*>(&seekPoint), sizeof(SeekPoint)) == sizeof(SeekPoint) &&
+            seekFile.write(reinterpret_cast<const uint8_t*>(inflator), sizeof(tinfl_decompressor)) ==
+                sizeof(tinfl_decompressor) &&
+            seekFile.write(outputBuffer, TINFL_LZ_DICT_SIZE) == TINFL_LZ_DICT_SIZE) {
+          pointCount++;
+        } else {
+          Serial.printf("[%lu] [ZIP] Failed to write seek index snapshot, indexing stopped\n", millis());
+          indexing = false;
         }
-        free(inflator);
-        free(fileReadBuffer);
-        free(outputBuffer);
-        return true;
       }
     }
 
-    // If we get here, EOF reached without TINFL_STATUS_DONE
-    Serial.printf("[%lu] [ZIP] Unexpected EOF\n", millis());
+    if (seekFile) {
+      if (pointCount != seekHeader.pointCount) {
+        seekHeader.pointCount = pointCount;
+        seekFile.seek(0);
+        seekFile.write(reinterpret_cast<const uint8_t*>(&seekHeader), sizeof(SeekIndexHeader));
+      }
+      seekFile.close();
+    }
+
     if (!wasOpen) {
       close();
     }
     free(outputBuffer);
     free(fileReadBuffer);
     free(inflator);
-    return false;
+    return success;
   }
 
   if (!wasOpen) {
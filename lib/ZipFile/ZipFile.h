@@ -12,10 +12,12 @@ class ZipFile {
     uint32_t compressedSize;     // Compressed size
     uint32_t uncompressedSize;   // Uncompressed size
     uint32_t localHeaderOffset;  // Offset of local file header
+    uint32_t dataOffset;         // Offset of entry data (0 until resolved from the local header)
   };
 
   struct ZipDetails {
     uint32_t centralDirOffset;
+    uint32_t centralDirSize;
     uint16_t totalEntries;
     bool isSet;
   };
@@ -43,17 +45,117 @@ class ZipFile {
   }
 
  private:
+  // Block-buffered central directory walker. Pulls the directory in large sector-aligned chunks (in a
+  // single read when it fits the budget) and parses entries from memory instead of ~8 small reads each.
+  class CentralDirReader {
+   public:
+    struct Entry {
+      FileStatSlim stat;  // dataOffset is left 0
+      uint16_t nameLen;
+      const char* name;  // NUL-terminated, valid until the next call to next()
+    };
+
+    CentralDirReader(FsFile& file, const ZipDetails& details, size_t budget);
+    ~CentralDirReader();
+    CentralDirReader(const CentralDirReader&) = delete;
+    CentralDirReader& operator=(const CentralDirReader&) = delete;
+
+    bool ok() const { return valid; }
+    // Advance to the next entry, skipping names too long for the name buffer.
+    // Returns false at the end of the directory or on a read error.
+    bool next(Entry* entry);
+
+   private:
+    static constexpr size_t MIN_CAPACITY = 512;
+
+    bool fill(size_t needed);
+    bool skip(size_t count);
+
+    FsFile& file;
+    uint8_t* buffer = nullptr;
+    size_t capacity = 0;
+    size_t start = 0;         // First unparsed byte in buffer
+    size_t end = 0;           // End of buffered bytes
+    uint32_t filePos = 0;     // File offset of the next directory byte to read
+    uint32_t remaining = 0;   // Directory bytes not yet read
+    bool valid = false;
+    char name[256];
+  };
+
+  // On-SD central directory index record, sorted by (hash, len)
+  struct IndexEntry {
+    uint64_t hash;
+    uint16_t len;
+    uint16_t method;  // INDEX_AMBIGUOUS when several entries share hash and length
+    uint32_t compressedSize;
+    uint32_t uncompressedSize;
+    uint32_t dataOffset;
+  };
+  static_assert(sizeof(IndexEntry) == 24, "IndexEntry must be packed");
+
+  struct IndexHeader {
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t entryCount;
+    uint32_t centralDirOffset;
+    uint32_t zipSize;
+  };
+  static_assert(sizeof(IndexHeader) == 12, "IndexHeader must be packed");
+
+  static constexpr uint8_t INDEX_VERSION = 1;
+  static constexpr uint16_t INDEX_AMBIGUOUS = 0xFFFF;
+  // Heap budget for index records held while building (entries are collected in hash-range passes)
+  static constexpr size_t INDEX_BUILD_BUDGET = 16 * 1024;
+
+  // Inflate seek index: inflater state and dictionary window snapshots taken every `interval` bytes of output,
+  // so a deflated entry can be streamed from any uncompressed offset without re-inflating everything before it.
+  // Each record is a SeekPoint followed by the tinfl_decompressor and the TINFL_LZ_DICT_SIZE window.
+  struct SeekIndexHeader {
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t pointCount;
+    uint32_t interval;
+    uint32_t stateSize;  // sizeof(tinfl_decompressor) of the build that wrote the snapshots
+    uint32_t compressedSize;
+    uint32_t uncompressedSize;
+    uint32_t dataOffset;
+  };
+
+  struct SeekPoint {
+    uint32_t outOffset;   // Uncompressed bytes produced when the snapshot was taken
+    uint32_t inOffset;    // Compressed bytes consumed, relative to the entry data
+    uint32_t dictCursor;  // Write position in the dictionary window
+  };
+
+  static constexpr uint8_t SEEK_INDEX_VERSION = 1;
+  static constexpr uint32_t SEEK_INDEX_INTERVAL = 256 * 1024;
+  // Entries smaller than this inflate from the start quickly enough to not need snapshots
+  static constexpr uint32_t SEEK_INDEX_MIN_ENTRY_SIZE = 2 * SEEK_INDEX_INTERVAL;
+
+  static constexpr size_t DEFAULT_CENTRAL_DIR_READ_BUDGET = 16 * 1024;
+
   const std::string& filePath;
+  std::string indexPath;
   FsFile file;
-  ZipDetails zipDetails = {0, 0, false};
+  ZipDetails zipDetails = {0, 0, 0, false};
+  size_t centralDirReadBudget = DEFAULT_CENTRAL_DIR_READ_BUDGET;
   std::unordered_map<std::string, FileStatSlim> fileStatSlimCache;
 
   bool loadFileStatSlim(const char* filename, FileStatSlim* fileStat);
   long getDataOffset(const FileStatSlim& fileStat);
   bool loadZipDetails();
+  static bool openIndex(const std::string& path, FsFile& indexFile, IndexHeader* header);
+  // Returns 1 if found, 0 if not in the index, -1 if the index can't answer (unreadable or ambiguous entry)
+  static int findIndexEntry(FsFile& indexFile, uint16_t entryCount, uint64_t hash, uint16_t len, IndexEntry* entry);
+  int lookupIndex(const char* filename, FileStatSlim* fileStat) const;
+  static bool openSeekIndex(const std::string& path, const FileStatSlim& fileStat, uint32_t dataOffset,
+                            FsFile& seekFile, SeekIndexHeader* header);
 
  public:
-  explicit ZipFile(const std::string& filePath) : filePath(filePath) {}
+  // indexPath: optional central directory index written by buildIndex(); lookups binary-search it
+  // instead of scanning the central directory
+  explicit ZipFile(const std::string& filePath, std::string indexPath = "")
+      : filePath(filePath), indexPath(std::move(indexPath)) {}
   ~ZipFile() = default;
   // Zip file can be opened and closed by hand in order to allow for quick calculation of inflated file size
   // It is NOT recommended to pre-open it for any kind of inflation due to memory constraints
@@ -62,6 +164,12 @@ class ZipFile {
   bool close();
   bool loadAllFileStatSlims();
   uint16_t getTotalEntries();
+  // Largest buffer used to read the central directory; directories that fit are read in one call
+  void setCentralDirReadBudget(const size_t bytes) { centralDirReadBudget = bytes; }
+  // Central directory index: entries sorted by path hash with sizes and precomputed data offsets.
+  // checkIndex() returns true if indexPath was built for this zip file.
+  bool buildIndex(const std::string& indexPath);
+  bool checkIndex(const std::string& indexPath);
   bool getInflatedFileSize(const char* filename, size_t* size);
   // Batch lookup: scan ZIP central dir once and fill sizes for matching targets.
   // targets must be sorted by (hash, len). sizes[target.index] receives uncompressedSize.
@@ -73,5 +181,9 @@ class ZipFile {
   // Due to the memory required to run each of these, it is recommended to not preopen the zip file for multiple
   // These functions will open and close the zip as needed
   uint8_t* readFileToMemory(const char* filename, size_t* size = nullptr, bool trailingNullByte = false);
-  bool readFileToStream(const char* filename, Print& out, size_t chunkSize);
+  // Stream an entry starting at uncompressed offset fromOffset. For large deflated entries, seekIndexPath names an
+  // optional seek index: inflation restarts from the closest snapshot at or before fromOffset, and snapshots past
+  // the end of the index are appended as inflation proceeds.
+  bool readFileToStream(const char* filename, Print& out, size_t chunkSize, uint32_t fromOffset = 0,
+                        const std::string& seekIndexPath = "");
 };
@@ -223,6 +223,7 @@ static pjpeg_need_bytes_callback_t g_pNeedBytesCallback;
 static void* g_pCallback_data;
 static uint8 gCallbackStatus;
 static uint8 gReduce;
+static uint8 gScaledSize;
 //------------------------------------------------------------------------------
 static void fillInBuf(void) {
   unsigned char status;
@@ -1907,6 +1908,57 @@ static void transformBlockReduce(uint8 mcuBlock) {
   }
 }
 //------------------------------------------------------------------------------
+// Reduced IDCT tables: 256 * cos((2x+1)u*pi/2N) / cos(u*pi/16), rows u, columns x. Dividing by cos(u*pi/16)
+// undoes the Winograd scale folded into the quantization tables (DC is scaled by 1, see gWinogradQuant).
+static const int16 gScaledIdct4[16] = {
+    256, 256, 256, 256, 241, 100, -100, -241, 196, -196, -196, 196, 118, -284, 284, -118,
+};
+static const int16 gScaledIdct2[4] = {256, 256, 185, -185};
+
+// Luma-only reduced IDCT: the low-frequency gScaledSize x gScaledSize corner of the coefficients becomes a
+// gScaledSize x gScaledSize block of Y pixels at the top left of the block's 8x8 slot in gMCUBufR.
+static void transformBlockScaled(uint8 mcuBlock) {
+  const int16* pTab = (gScaledSize == 4) ? gScaledIdct4 : gScaledIdct2;
+  const uint8 n = gScaledSize;
+  long rows[16];
+  uint8* pDst;
+  uint8 u, v, x, y;
+
+  switch (gScanType) {
+    case PJPG_YH1V2:
+      pDst = gMCUBufR + mcuBlock * 128;
+      break;
+    case PJPG_YH2V1:
+    case PJPG_YH2V2:
+      pDst = gMCUBufR + mcuBlock * 64;
+      break;
+    default:
+      pDst = gMCUBufR;
+      break;
+  }
+
+  for (v = 0; v < n; v++) {
+    for (x = 0; x < n; x++) {
+      long sum = 128L;
+      for (u = 0; u < n; u++) sum += (long)gCoeffBuf[v * 8 + u] * pTab[u * n + x];
+      rows[v * n + x] = PJPG_ARITH_SHIFT_RIGHT_8_L(sum);
+    }
+  }
+
+  for (y = 0; y < n; y++) {
+    for (x = 0; x < n; x++) {
+      long sum = 128L;
+      for (v = 0; v < n; v++) sum += rows[v * n + x] * pTab[v * n + y];
+      sum = PJPG_ARITH_SHIFT_RIGHT_8_L(sum);
+      if (sum > 32000L)
+        sum = 32000L;
+      else if (sum < -32000L)
+        sum = -32000L;
+      pDst[y * 8 + x] = clamp(PJPG_DESCALE((int16)sum) + 128);
+    }
+  }
+}
+//------------------------------------------------------------------------------
 static uint8 decodeNextMCU(void) {
   uint8 status;
   uint8 mcuBlock;
@@ -1969,6 +2021,50 @@ static uint8 decodeNextMCU(void) {
       }
 
       transformBlockReduce(mcuBlock);
+    } else if (gScaledSize) {
+      // Decode every AC coefficient, but only keep the low-frequency corner of luma blocks.
+      const uint8 keep = (componentID == 0);
+
+      if (keep) {
+        for (k = 1; k < 64; k++) {
+          if ((k & 7) < gScaledSize && (k >> 3) < gScaledSize) gCoeffBuf[k] = 0;
+        }
+      }
+
+      for (k = 1; k < 64; k++) {
+        uint16 extraBits;
+
+        s = huffDecode(compACTab ? &gHuffTab3 : &gHuffTab2, compACTab ? gHuffVal3 : gHuffVal2);
+
+        extraBits = 0;
+        numExtraBits = s & 0xF;
+        if (numExtraBits) extraBits = getBits2(numExtraBits);
+
+        r = s >> 4;
+        s &= 15;
+
+        if (s) {
+          if (r) {
+            if ((k + r) > 63) return PJPG_DECODE_ERROR;
+
+            k = (uint8)(k + r);
+          }
+
+          if (keep) {
+            uint8 z = (uint8)ZAG[k];
+            if ((z & 7) < gScaledSize && (z >> 3) < gScaledSize) gCoeffBuf[z] = huffExtend(extraBits, s) * pQ[k];
+          }
+        } else {
+          if (r == 15) {
+            if ((k + 16) > 64) return PJPG_DECODE_ERROR;
+
+            k += (16 - 1);  // - 1 because the loop counter is k
+          } else
+            break;
+        }
+      }
+
+      if (keep) transformBlockScaled(mcuBlock);
     } else {
       // Decode and dequantize AC coefficients
       for (k = 1; k < 64; k++) {
@@ -2057,7 +2153,8 @@ unsigned char pjpeg_decode_init(pjpeg_image_info_t* pInfo, pjpeg_need_bytes_call
   g_pNeedBytesCallback = pNeed_bytes_callback;
   g_pCallback_data = pCallback_data;
   gCallbackStatus = 0;
-  gReduce = reduce;
+  gReduce = (reduce == PJPG_REDUCE_EIGHTH);
+  gScaledSize = (reduce == PJPG_REDUCE_HALF) ? 4 : (reduce == PJPG_REDUCE_QUARTER) ? 2 : 0;
 
   status = init();
   if ((status) || (gCallbackStatus)) return gCallbackStatus ? gCallbackStatus : status;
@@ -102,13 +102,19 @@ typedef struct {
   unsigned char* m_pMCUBufB;
 } pjpeg_image_info_t;
 
+// Values for pjpeg_decode_init's reduce argument
+enum { PJPG_REDUCE_NONE = 0, PJPG_REDUCE_EIGHTH = 1, PJPG_REDUCE_QUARTER = 2, PJPG_REDUCE_HALF = 3 };
+
 typedef unsigned char (*pjpeg_need_bytes_callback_t)(unsigned char* pBuf, unsigned char buf_size,
                                                      unsigned char* pBytes_actually_read, void* pCallback_data);
 
 // Initializes the decompressor. Returns 0 on success, or one of the above error codes on failure.
 // pNeed_bytes_callback will be called to fill the decompressor's internal input buffer.
-// If reduce is 1, only the first pixel of each block will be decoded. This mode is much faster because it skips the AC
-// dequantization, IDCT and chroma upsampling of every image pixel. Not thread safe.
+// If reduce is 1 (PJPG_REDUCE_EIGHTH), only the first pixel of each block will be decoded. This mode is much faster
+// because it skips the AC dequantization, IDCT and chroma upsampling of every image pixel.
+// PJPG_REDUCE_QUARTER and PJPG_REDUCE_HALF decode 2x2 or 4x4 pixels per block with a reduced IDCT over the
+// low-frequency coefficients, luma only: each block's pixels are at the top left of its 8x8 slot (row stride 8) and
+// only m_pMCUBufR is valid, for color images too. Not thread safe.
 unsigned char pjpeg_decode_init(pjpeg_image_info_t* pInfo, pjpeg_need_bytes_callback_t pNeed_bytes_callback,
                                 void* pCallback_data, unsigned char reduce);
 
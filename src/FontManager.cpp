@@ -3,6 +3,7 @@
 #include <EpdFontLoader.h>
 #include <SDCardManager.h>
 
+#include <algorithm>
 #include <cstring>
 
 #include "config.h"
@@ -19,7 +20,10 @@ FontManager::~FontManager() {
   unloadExternalFont();
 }
 
-void FontManager::init(GfxRenderer& r) { renderer = &r; }
+void FontManager::init(GfxRenderer& r) {
+  renderer = &r;
+  renderer->setGlyphAtlas(&glyphAtlas);
+}
 
 bool FontManager::loadFontFamily(const char* familyName, int fontId) {
   if (!renderer || !familyName || !*familyName) {
@@ -279,6 +283,25 @@ void FontManager::unloadExternalFont() {
   }
 }
 
+void FontManager::configureGlyphAtlas() {
+  if (!renderer) return;
+
+  const int orientation = renderer->getOrientation();
+  size_t budget = 0;
+  if (GlyphBlit::hasRotatedLayout(orientation)) {
+    // The arena is a single block, so it must also leave most of the largest free one to others
+    budget = std::min<size_t>({GLYPH_ATLAS_MAX_BYTES, ESP.getFreeHeap() / 8, ESP.getMaxAllocHeap() / 2});
+    if (budget < GLYPH_ATLAS_MIN_BYTES) budget = 0;
+  }
+  glyphAtlas.configure(orientation, budget);
+  Serial.printf("[FONT] Glyph atlas: %u byte budget for orientation %d\n", static_cast<unsigned>(budget),
+                orientation);
+}
+
+void FontManager::warmGlyphAtlas(int fontId) {
+  if (renderer) renderer->warmGlyphAtlas(fontId);
+}
+
 void FontManager::logFontInfo() const {
   Serial.println("[FONT] === Current Font Configuration ===");
 
@@ -298,5 +321,7 @@ void FontManager::logFontInfo() const {
     _externalFont->logCacheStats();
   }
 
+  glyphAtlas.logStats();
+
   Serial.println("[FONT] =====================================");
 }
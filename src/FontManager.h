@@ -117,6 +117,23 @@ class FontManager {
    */
   ExternalFont* getExternalFont() { return (_externalFont && _externalFont->isLoaded()) ? _externalFont : nullptr; }
 
+  /**
+   * Size the glyph atlas for the renderer's current orientation.
+   * Call after changing orientation, once the reader's book and first page are loaded;
+   * landscape or low heap disables it.
+   */
+  void configureGlyphAtlas();
+
+  /**
+   * Pre-rotate a font's common glyphs into the atlas (no-op when disabled).
+   */
+  void warmGlyphAtlas(int fontId);
+
+  /**
+   * Free the glyph atlas when leaving the reader.
+   */
+  void releaseGlyphAtlas() { glyphAtlas.configure(-1, 0); }
+
   /**
    * Log information about all loaded fonts.
    */
@@ -152,6 +169,11 @@ class FontManager {
   // External font for CJK fallback (pointer to avoid 54KB allocation when unused)
   ExternalFont* _externalFont = nullptr;
 
+  // Pre-rotated glyphs for portrait reading, handed to the renderer in init()
+  GlyphAtlas glyphAtlas;
+  static constexpr size_t GLYPH_ATLAS_MAX_BYTES = 32 * 1024;
+  static constexpr size_t GLYPH_ATLAS_MIN_BYTES = 4 * 1024;
+
   LoadedFont loadSingleFont(const char* path);
   void freeFont(LoadedFont& font);
 };
@@ -20,6 +20,7 @@
 #include "../core/BootMode.h"
 #include "../core/Core.h"
 #include "../ui/Elements.h"
+#include "FontManager.h"
 #include "ThemeManager.h"
 
 namespace papyrix {
@@ -39,6 +40,10 @@ inline std::string epubSectionCachePath(const std::string& epubCachePath, int sp
 inline std::string contentCachePath(const char* cacheDir, int fontId) {
   return std::string(cacheDir) + "/pages_" + std::to_string(fontId) + ".bin";
 }
+
+inline std::string widthCachePath(const char* cacheDir, int fontId) {
+  return std::string(cacheDir) + "/widths_" + std::to_string(fontId) + ".bin";
+}
 }  // namespace
 
 int ReaderState::calcFirstContentSpine(bool hasCover, int textStartIndex, size_t spineCount) {
@@ -96,7 +101,7 @@ void ReaderState::backgroundCacheImpl(ParserT& parser, const std::string& cacheP
 
   // Check for abort after setup
   if (cacheTask_.shouldStop()) {
-    pageCache_.reset();
+    resetPageCache();
     Serial.println("[READER] Background cache aborted after setup");
     return;
   }
@@ -111,7 +116,7 @@ void ReaderState::backgroundCacheImpl(ParserT& parser, const std::string& cacheP
 
     if (!success || cacheTask_.shouldStop()) {
       Serial.println("[READER] Cache creation failed or aborted, clearing pageCache");
-      pageCache_.reset();
+      resetPageCache();
     }
   }
 }
@@ -147,9 +152,10 @@ void ReaderState::enter(Core& core) {
 
   contentLoaded_ = false;
   loadFailed_ = false;
+  glyphAtlasReady_ = false;
   needsRender_ = true;
   stopBackgroundCaching();  // Ensure any previous task is stopped
-  pageCache_.reset();       // Safe - task is stopped
+  resetPageCache();         // Safe - task is stopped
   currentSpineIndex_ = 0;
   currentSectionPage_ = 0;  // Will be set to -1 after progress load if at start
 
@@ -242,6 +248,10 @@ void ReaderState::enter(Core& core) {
       break;
   }
 
+  // Start layout with the word widths measured in this book's last session
+  const int readerFontId = core.settings.getReaderFontId(THEME_MANAGER.current());
+  renderer_.loadWidthCache(widthCachePath(core.content.cacheDir(), readerFontId), readerFontId);
+
   // Load saved progress
   ContentType type = core.content.metadata().type;
   auto progress = ProgressManager::load(core, core.content.cacheDir(), type);
@@ -281,8 +291,13 @@ void ReaderState::exit(Core& core) {
     progress.flatPage = currentPage_;
     ProgressManager::save(core, core.content.cacheDir(), core.content.metadata().type, progress);
 
+    const int fontId = core.settings.getReaderFontId(THEME_MANAGER.current());
+    renderer_.logWidthCacheStats();
+    renderer_.saveWidthCache(widthCachePath(core.content.cacheDir(), fontId), fontId);
+
     // Safe to reset - task is stopped, we own pageCache_
-    pageCache_.reset();
+    resetPageCache();
+    pageView_.release();
     core.content.close();
   }
 
@@ -291,6 +306,8 @@ void ReaderState::exit(Core& core) {
 
   // Reset orientation to Portrait for UI
   renderer_.setOrientation(GfxRenderer::Orientation::Portrait);
+  FONT_MANAGER.releaseGlyphAtlas();
+  glyphAtlasReady_ = false;
 }
 
 StateTransition ReaderState::update(Core& core) {
@@ -383,7 +400,7 @@ void ReaderState::navigateNext(Core& core) {
       ScopedMutex lock(core.renderMutex);
       if (firstContentSpine != currentSpineIndex_) {
         currentSpineIndex_ = firstContentSpine;
-        pageCache_.reset();
+        resetPageCache();
       }
       currentSectionPage_ = 0;
       needsRender_ = true;
@@ -420,7 +437,7 @@ void ReaderState::navigatePrev(Core& core) {
       ScopedMutex lock(core.renderMutex);
       currentSpineIndex_ = 0;
       currentSectionPage_ = -1;
-      pageCache_.reset();  // Don't need cache for cover
+      resetPageCache();  // Don't need cache for cover
       needsRender_ = true;
     }
     return;  // At start of book either way
@@ -451,7 +468,7 @@ void ReaderState::applyNavResult(const ReaderNavigation::NavResult& result, Core
     currentPage_ = result.position.flatPage;
     needsRender_ = result.needsRender;
     if (result.needsCacheReset) {
-      pageCache_.reset();
+      resetPageCache();
     }
   }
   startBackgroundCaching(core);  // Resume caching
@@ -570,45 +587,95 @@ void ReaderState::renderCachedPage(Core& core) {
   }
 
   // Load and render page (cache is now guaranteed to exist, we own it)
+  // Prefer the page already in pageView_ or the prefetch ring over a read from SD
   size_t pageCount = pageCache_ ? pageCache_->pageCount() : 0;
-  auto page = pageCache_ ? pageCache_->loadPage(currentSectionPage_) : nullptr;
+  bool pageLoaded = pageCache_ && pageView_.isLoaded() && pageViewPage_ == currentSectionPage_;
+  if (!pageLoaded && pageCache_) {
+    pageLoaded = prefetch_.take(currentSectionPage_, pageView_, pageViewPage_);
+    if (pageLoaded) Serial.printf("[READER] Page %d served from prefetch ring\n", currentSectionPage_);
+  }
+  if (!pageLoaded && pageCache_) {
+    pageLoaded = pageCache_->loadPage(currentSectionPage_, pageView_);
+    pageViewPage_ = pageLoaded ? currentSectionPage_ : -1;
+  }
 
-  if (!page) {
+  if (!pageLoaded) {
     Serial.println("[READER] Failed to load page, clearing cache");
     if (pageCache_) {
       pageCache_->clear();
-      pageCache_.reset();
+      resetPageCache();
     }
     needsRender_ = true;
     return;
   }
 
   const int fontId = core.settings.getReaderFontId(theme);
+  const bool antiAliasing = core.settings.textAntiAliasing && renderer_.fontSupportsGrayscale(fontId);
+  // Text-only pages get their gray planes from the BW walk; images still need the LSB/MSB passes
+  const bool singlePassGray = antiAliasing && !pageView_.hasImages();
 
-  renderPageContents(core, *page, vp.marginTop, vp.marginRight, vp.marginBottom, vp.marginLeft);
+  if (singlePassGray) renderer_.beginGrayscaleCapture();
+  renderPageContents(core, pageView_, vp.marginTop, vp.marginRight, vp.marginBottom, vp.marginLeft);
+  if (singlePassGray) renderer_.endGrayscaleCapture();
   renderStatusBar(core, vp.marginRight, vp.marginBottom, vp.marginLeft);
 
-  displayWithRefresh(core);
+  startDisplayWithRefresh(core);
+
+  // Decode the next pages into the prefetch ring during the waveform. The frame buffer still holds the frame
+  // being refreshed, so the grayscale passes below only start drawing once the panel is done.
+  prefetchPages(currentSectionPage_, true);
 
   // Grayscale text rendering (anti-aliasing)
-  if (core.settings.textAntiAliasing && renderer_.fontSupportsGrayscale(fontId) && renderer_.storeBwBuffer()) {
+  const bool turnOffScreen = core.settings.sunlightFadingFix != 0;
+  if (singlePassGray && renderer_.writeCapturedGrayscale()) {
+    renderer_.displayGrayBuffer(turnOffScreen);
+    renderer_.cleanupGrayscaleWithFrameBuffer();
+  } else if (antiAliasing && renderer_.storeBwBuffer()) {
     renderer_.clearScreen(0x00);
     renderer_.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    page->render(renderer_, fontId, vp.marginLeft, vp.marginTop, theme.primaryTextBlack, theme.monoFontId);
+    pageView_.render(renderer_, fontId, vp.marginLeft, vp.marginTop, theme.primaryTextBlack, theme.monoFontId);
     renderer_.copyGrayscaleLsbBuffers();
 
     renderer_.clearScreen(0x00);
     renderer_.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    page->render(renderer_, fontId, vp.marginLeft, vp.marginTop, theme.primaryTextBlack, theme.monoFontId);
+    pageView_.render(renderer_, fontId, vp.marginLeft, vp.marginTop, theme.primaryTextBlack, theme.monoFontId);
     renderer_.copyGrayscaleMsbBuffers();
 
-    const bool turnOffScreen = core.settings.sunlightFadingFix != 0;
     renderer_.displayGrayBuffer(turnOffScreen);
     renderer_.setRenderMode(GfxRenderer::BW);
     renderer_.restoreBwBuffer();
   }
 
   Serial.printf("[READER] Rendered page %d/%d\n", currentSectionPage_ + 1, pageCount);
+
+  // The atlas arena is allocated once the book and its first page are cached, so it is sized from the heap
+  // they left and its block can't split free memory that opening the book still needed
+  if (!glyphAtlasReady_) {
+    FONT_MANAGER.configureGlyphAtlas();
+    FONT_MANAGER.warmGlyphAtlas(fontId);
+    glyphAtlasReady_ = true;
+  }
+
+  // Fill the prefetch ring while the user reads this page
+  startBackgroundCaching(core);
+}
+
+void ReaderState::prefetchPages(int sectionPage, bool whileRefreshing) {
+  // Called from background task - owns pageCache_ and the ring while running
+  // (or from renderCachedPage with the task stopped, while the panel refreshes)
+  if (!pageCache_) return;
+  prefetch_.fill(
+      sectionPage, pageViewPage_, static_cast<int>(pageCache_->pageCount()),
+      [this](int page, PageView& out) { return pageCache_->loadPage(page, out); },
+      []() { return static_cast<uint32_t>(ESP.getFreeHeap()); },
+      [this, whileRefreshing]() { return whileRefreshing ? !renderer_.isRefreshing() : cacheTask_.shouldStop(); });
+}
+
+void ReaderState::resetPageCache() {
+  // Caller must own pageCache_; pages decoded from it go with it
+  pageCache_.reset();
+  pageViewPage_ = -1;
+  prefetch_.clear();
 }
 
 bool ReaderState::ensurePageCached(Core& core, uint16_t pageNum) {
@@ -674,7 +741,7 @@ void ReaderState::loadCacheFromDisk(Core& core) {
   if (!pageCache_) {
     pageCache_.reset(new PageCache(cachePath));
     if (!pageCache_->load(config)) {
-      pageCache_.reset();
+      resetPageCache();
     }
   }
 }
@@ -706,8 +773,8 @@ void ReaderState::createOrExtendCache(Core& core) {
   }
 }
 
-void ReaderState::renderPageContents(Core& core, Page& page, int marginTop, int marginRight, int marginBottom,
-                                     int marginLeft) {
+void ReaderState::renderPageContents(Core& core, const PageView& page, int marginTop, int marginRight,
+                                     int marginBottom, int marginLeft) {
   (void)marginRight;
   (void)marginBottom;
 
@@ -782,12 +849,17 @@ void ReaderState::renderXtcPage(Core& core) {
 }
 
 void ReaderState::displayWithRefresh(Core& core) {
+  startDisplayWithRefresh(core);
+  renderer_.waitForRefresh();
+}
+
+void ReaderState::startDisplayWithRefresh(Core& core) {
   const bool turnOffScreen = core.settings.sunlightFadingFix != 0;
   if (pagesUntilFullRefresh_ <= 1) {
-    renderer_.displayBuffer(EInkDisplay::HALF_REFRESH, turnOffScreen);
+    renderer_.startDisplayBuffer(EInkDisplay::HALF_REFRESH, turnOffScreen);
     pagesUntilFullRefresh_ = core.settings.getPagesPerRefreshValue();
   } else {
-    renderer_.displayBuffer(EInkDisplay::FAST_REFRESH, turnOffScreen);
+    renderer_.startDisplayBuffer(EInkDisplay::FAST_REFRESH, turnOffScreen);
     pagesUntilFullRefresh_--;
   }
 }
@@ -893,6 +965,11 @@ void ReaderState::startBackgroundCaching(Core& core) {
           }
         }
 
+        // Decode neighbouring pages so the next page turn doesn't wait on SD
+        if (pageCache_ && !cacheTask_.shouldStop()) {
+          prefetchPages(sectionPage);
+        }
+
         // Generate thumbnail from cover for HomeState (lower priority than page cache)
         if (!cacheTask_.shouldStop()) {
           std::string coverPath = coreRef.content.getCoverPath();
@@ -1052,7 +1129,7 @@ void ReaderState::jumpToTocEntry(Core& core, int tocIndex) {
         ScopedMutex lock(core.renderMutex);
         currentSpineIndex_ = chapter.pageNum;
         currentSectionPage_ = 0;
-        pageCache_.reset();
+        resetPageCache();
         needsRender_ = true;
       }
       startBackgroundCaching(core);
@@ -1107,8 +1184,13 @@ void ReaderState::exitToUI(Core& core) {
     progress.flatPage = currentPage_;
     ProgressManager::save(core, core.content.cacheDir(), core.content.metadata().type, progress);
 
+    const int fontId = core.settings.getReaderFontId(THEME_MANAGER.current());
+    renderer_.logWidthCacheStats();
+    renderer_.saveWidthCache(widthCachePath(core.content.cacheDir(), fontId), fontId);
+
     // Safe to reset - task is stopped, we own pageCache_
-    pageCache_.reset();
+    resetPageCache();
+    pageView_.release();
     core.content.close();
   }
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <BackgroundTask.h>
+#include <Epub/Page.h>
+#include <PagePrefetchRing.h>
 
 #include <cstdint>
 #include <memory>
@@ -13,7 +15,6 @@
 
 class GfxRenderer;
 class PageCache;
-class Page;
 struct RenderConfig;
 
 namespace papyrix {
@@ -53,6 +54,7 @@ class ReaderState : public State {
   bool needsRender_;
   bool contentLoaded_;
   bool loadFailed_ = false;  // Track if content loading failed (for error state transition)
+  bool glyphAtlasReady_ = false;  // Sized and warmed after the first cached page, see renderCachedPage
 
   // Reading position (maps to ReaderNavigation::Position)
   int currentSpineIndex_;
@@ -73,8 +75,18 @@ class ReaderState : public State {
   //                  background task owns pageCache_ when cacheTask_.isRunning()
   // Navigation ALWAYS stops task first, then accesses cache
   std::unique_ptr<PageCache> pageCache_;
+  PageView pageView_;  // Reused across page turns so rendering a page doesn't allocate per word
+  int pageViewPage_ = -1;  // Section page held by pageView_ (-1 if none)
   uint8_t pagesUntilFullRefresh_;
 
+  // Prefetch ring: pages around the current one, loaded while the panel refreshes and by the background
+  // task after a render so a page turn renders from RAM. Same ownership as pageCache_; slots are only
+  // valid for the current pageCache_, so every cache reset goes through resetPageCache().
+  PagePrefetchRing<PageView> prefetch_;
+  // whileRefreshing: called from the render path, stop once the panel refresh completes
+  void prefetchPages(int sectionPage, bool whileRefreshing = false);
+  void resetPageCache();
+
   // Background caching (uses BackgroundTask for proper lifecycle management)
   BackgroundTask cacheTask_;
   Core* coreForCacheTask_ = nullptr;
@@ -93,7 +105,8 @@ class ReaderState : public State {
   bool renderCoverPage(Core& core);
 
   // Helpers
-  void renderPageContents(Core& core, Page& page, int marginTop, int marginRight, int marginBottom, int marginLeft);
+  void renderPageContents(Core& core, const PageView& page, int marginTop, int marginRight, int marginBottom,
+                          int marginLeft);
   void renderStatusBar(Core& core, int marginRight, int marginBottom, int marginLeft);
 
   // Cache management
@@ -111,6 +124,7 @@ class ReaderState : public State {
 
   // Display helpers
   void displayWithRefresh(Core& core);
+  void startDisplayWithRefresh(Core& core);
 
   // Viewport calculation
   struct Viewport {
@@ -11,52 +11,55 @@ void title(const GfxRenderer& r, const Theme& t, int y, const char* text) {
 }
 
 void menuItem(const GfxRenderer& r, const Theme& t, int y, const char* text, bool selected) {
+  const auto& uiFont = r.getFont(t.uiFontId);
   const int x = t.screenMarginSide;
   const int w = r.getScreenWidth() - 2 * t.screenMarginSide;
   const int h = t.itemHeight;
-  const int textY = y + (h - r.getLineHeight(t.uiFontId)) / 2;
+  const int textY = y + (h - uiFont.lineHeight) / 2;
 
   if (selected) {
     r.fillRect(x, y, w, h, t.selectionFillBlack);
-    r.drawText(t.uiFontId, x + t.itemPaddingX, textY, text, t.selectionTextBlack);
+    r.drawText(uiFont, x + t.itemPaddingX, textY, text, t.selectionTextBlack);
   } else {
-    r.drawText(t.uiFontId, x + t.itemPaddingX, textY, text, t.primaryTextBlack);
+    r.drawText(uiFont, x + t.itemPaddingX, textY, text, t.primaryTextBlack);
   }
 }
 
 void toggle(const GfxRenderer& r, const Theme& t, int y, const char* label, bool value, bool selected) {
+  const auto& uiFont = r.getFont(t.uiFontId);
   const int x = t.screenMarginSide;
   const int w = r.getScreenWidth() - 2 * t.screenMarginSide;
   const int h = t.itemHeight;
   const int valueX = r.getScreenWidth() - t.screenMarginSide - 50;
-  const int textY = y + (h - r.getLineHeight(t.uiFontId)) / 2;
+  const int textY = y + (h - uiFont.lineHeight) / 2;
 
   if (selected) {
     r.fillRect(x, y, w, h, t.selectionFillBlack);
-    r.drawText(t.uiFontId, x + t.itemPaddingX, textY, label, t.selectionTextBlack);
-    r.drawText(t.uiFontId, valueX, textY, value ? "ON" : "OFF", t.selectionTextBlack);
+    r.drawText(uiFont, x + t.itemPaddingX, textY, label, t.selectionTextBlack);
+    r.drawText(uiFont, valueX, textY, value ? "ON" : "OFF", t.selectionTextBlack);
   } else {
-    r.drawText(t.uiFontId, x + t.itemPaddingX, textY, label, t.primaryTextBlack);
-    r.drawText(t.uiFontId, valueX, textY, value ? "ON" : "OFF", t.secondaryTextBlack);
+    r.drawText(uiFont, x + t.itemPaddingX, textY, label, t.primaryTextBlack);
+    r.drawText(uiFont, valueX, textY, value ? "ON" : "OFF", t.secondaryTextBlack);
   }
 }
 
 void enumValue(const GfxRenderer& r, const Theme& t, int y, const char* label, const char* value, bool selected) {
+  const auto& uiFont = r.getFont(t.uiFontId);
   const int x = t.screenMarginSide;
   const int w = r.getScreenWidth() - 2 * t.screenMarginSide;
   const int h = t.itemHeight;
-  const int textY = y + (h - r.getLineHeight(t.uiFontId)) / 2;
+  const int textY = y + (h - uiFont.lineHeight) / 2;
 
-  const int valueWidth = r.getTextWidth(t.uiFontId, value);
+  const int valueWidth = r.getTextWidth(uiFont, value);
   const int valueX = r.getScreenWidth() - t.screenMarginSide - valueWidth - t.itemValuePadding;
 
   if (selected) {
     r.fillRect(x, y, w, h, t.selectionFillBlack);
-    r.drawText(t.uiFontId, x + t.itemPaddingX, textY, label, t.selectionTextBlack);
-    r.drawText(t.uiFontId, valueX, textY, value, t.selectionTextBlack);
+    r.drawText(uiFont, x + t.itemPaddingX, textY, label, t.selectionTextBlack);
+    r.drawText(uiFont, valueX, textY, value, t.selectionTextBlack);
   } else {
-    r.drawText(t.uiFontId, x + t.itemPaddingX, textY, label, t.primaryTextBlack);
-    r.drawText(t.uiFontId, valueX, textY, value, t.secondaryTextBlack);
+    r.drawText(uiFont, x + t.itemPaddingX, textY, label, t.primaryTextBlack);
+    r.drawText(uiFont, valueX, textY, value, t.secondaryTextBlack);
   }
 }
 
@@ -101,13 +104,14 @@ void text(const GfxRenderer& r, const Theme& t, int y, const char* str) {
 }
 
 int textWrapped(const GfxRenderer& r, const Theme& t, int y, const char* str, int maxLines) {
+  const auto& uiFont = r.getFont(t.uiFontId);
   const int maxWidth = r.getScreenWidth() - 2 * (t.screenMarginSide + t.itemPaddingX);
   const auto lines = r.wrapTextWithHyphenation(t.uiFontId, str, maxWidth, maxLines);
-  const int lineHeight = r.getLineHeight(t.uiFontId);
+  const int lineHeight = uiFont.lineHeight;
 
   int currentY = y;
   for (const auto& line : lines) {
-    r.drawText(t.uiFontId, t.screenMarginSide + t.itemPaddingX, currentY, line.c_str(), t.primaryTextBlack);
+    r.drawText(uiFont, t.screenMarginSide + t.itemPaddingX, currentY, line.c_str(), t.primaryTextBlack);
     currentY += lineHeight;
   }
   return static_cast<int>(lines.size());
@@ -120,6 +124,7 @@ void image(const GfxRenderer& r, int x, int y, const uint8_t* data, int w, int h
 }
 
 void dialog(const GfxRenderer& r, const Theme& t, const char* titleText, const char* msg, int selected) {
+  const auto& uiFont = r.getFont(t.uiFontId);
   const int screenW = r.getScreenWidth();
   const int screenH = r.getScreenHeight();
 
@@ -143,7 +148,7 @@ void dialog(const GfxRenderer& r, const Theme& t, const char* titleText, const c
   const int btnW = 80;
   const int btnH = 30;
   const int btnY = dialogY + dialogH - 50;
-  const int btnTextY = btnY + (btnH - r.getLineHeight(t.uiFontId)) / 2;
+  const int btnTextY = btnY + (btnH - uiFont.lineHeight) / 2;
   const int yesX = dialogX + (dialogW / 2) - btnW - 20;
   const int noX = dialogX + (dialogW / 2) + 20;
 
@@ -154,7 +159,7 @@ void dialog(const GfxRenderer& r, const Theme& t, const char* titleText, const c
   } else {
     r.drawRect(yesX, btnY, btnW, btnH, t.primaryTextBlack);
   }
-  r.drawText(t.uiFontId, yesX + (btnW - r.getTextWidth(t.uiFontId, "Yes")) / 2, btnTextY, "Yes",
+  r.drawText(uiFont, yesX + (btnW - r.getTextWidth(uiFont, "Yes")) / 2, btnTextY, "Yes",
              selected == 0 ? t.selectionTextBlack : t.primaryTextBlack);
 
   // No button
@@ -163,7 +168,7 @@ void dialog(const GfxRenderer& r, const Theme& t, const char* titleText, const c
   } else {
     r.drawRect(noX, btnY, btnW, btnH, t.primaryTextBlack);
   }
-  r.drawText(t.uiFontId, noX + (btnW - r.getTextWidth(t.uiFontId, "No")) / 2, btnTextY, "No",
+  r.drawText(uiFont, noX + (btnW - r.getTextWidth(uiFont, "No")) / 2, btnTextY, "No",
              selected == 1 ? t.selectionTextBlack : t.primaryTextBlack);
 }
 
@@ -249,6 +254,7 @@ void KeyboardState::moveRight() {
 }
 
 void keyboard(const GfxRenderer& r, const Theme& t, int y, const KeyboardState& state) {
+  const auto& uiFont = r.getFont(t.uiFontId);
   const int screenW = r.getScreenWidth();
   const int borderPadding = 10;
   const int gridWidth = screenW - 2 * t.screenMarginSide - 2 * borderPadding;
@@ -271,29 +277,29 @@ void keyboard(const GfxRenderer& r, const Theme& t, int y, const KeyboardState&
       const int bsWidth = 3 * keyW + 2 * keySpacingH;
       const bool bsSelected = state.isOnBackspace();
       if (bsSelected) {
-        r.drawText(t.uiFontId, currentX, currentY, "[Backspace]", t.primaryTextBlack);
+        r.drawText(uiFont, currentX, currentY, "[Backspace]", t.primaryTextBlack);
       } else {
-        r.drawText(t.uiFontId, currentX + 5, currentY, "Backspace", t.primaryTextBlack);
+        r.drawText(uiFont, currentX + 5, currentY, "Backspace", t.primaryTextBlack);
       }
       currentX += bsWidth + keySpacingH;
 
       // Space (4 keys wide)
       const int spWidth = 4 * keyW + 3 * keySpacingH;
       const bool spSelected = state.isOnSpace();
-      const int spTextX = currentX + (spWidth - r.getTextWidth(t.uiFontId, "Space")) / 2;
+      const int spTextX = currentX + (spWidth - r.getTextWidth(uiFont, "Space")) / 2;
       if (spSelected) {
-        r.drawText(t.uiFontId, spTextX - 6, currentY, "[Space]", t.primaryTextBlack);
+        r.drawText(uiFont, spTextX - 6, currentY, "[Space]", t.primaryTextBlack);
       } else {
-        r.drawText(t.uiFontId, spTextX, currentY, "Space", t.primaryTextBlack);
+        r.drawText(uiFont, spTextX, currentY, "Space", t.primaryTextBlack);
       }
       currentX += spWidth + keySpacingH;
 
       // Confirm (3 keys wide)
       const bool cfSelected = state.isOnConfirm();
       if (cfSelected) {
-        r.drawText(t.uiFontId, currentX, currentY, "[Confirm]", t.primaryTextBlack);
+        r.drawText(uiFont, currentX, currentY, "[Confirm]", t.primaryTextBlack);
       } else {
-        r.drawText(t.uiFontId, currentX + 5, currentY, "Confirm", t.primaryTextBlack);
+        r.drawText(uiFont, currentX + 5, currentY, "Confirm", t.primaryTextBlack);
       }
     } else {
       // Regular character rows
@@ -304,15 +310,15 @@ void keyboard(const GfxRenderer& r, const Theme& t, int y, const KeyboardState&
         const bool isSelected = (state.cursorY == row && state.cursorX == col);
 
         // Center character in key
-        const int charW = r.getTextWidth(t.uiFontId, keyStr);
+        const int charW = r.getTextWidth(uiFont, keyStr);
         const int charX = keyX + (keyW - charW) / 2;
 
         if (isSelected) {
-          r.drawText(t.uiFontId, charX - 6, currentY, "[", t.primaryTextBlack);
-          r.drawText(t.uiFontId, charX, currentY, keyStr, t.primaryTextBlack);
-          r.drawText(t.uiFontId, charX + charW, currentY, "]", t.primaryTextBlack);
+          r.drawText(uiFont, charX - 6, currentY, "[", t.primaryTextBlack);
+          r.drawText(uiFont, charX, currentY, keyStr, t.primaryTextBlack);
+          r.drawText(uiFont, charX + charW, currentY, "]", t.primaryTextBlack);
         } else {
-          r.drawText(t.uiFontId, charX, currentY, keyStr, t.primaryTextBlack);
+          r.drawText(uiFont, charX, currentY, keyStr, t.primaryTextBlack);
         }
       }
     }
@@ -370,6 +376,7 @@ void battery(const GfxRenderer& r, const Theme& t, int x, int y, int percent) {
 }
 
 void statusBar(const GfxRenderer& r, const Theme& t, int page, int total, int percent) {
+  const auto& smallFont = r.getFont(t.smallFontId);
   const int y = r.getScreenHeight() - 25;
   const int x = t.screenMarginSide;
   const int screenW = r.getScreenWidth();
@@ -377,17 +384,18 @@ void statusBar(const GfxRenderer& r, const Theme& t, int page, int total, int pe
   // Page numbers on left
   char pageStr[32];
   snprintf(pageStr, sizeof(pageStr), "%d / %d", page, total);
-  r.drawText(t.smallFontId, x + 5, y, pageStr, t.primaryTextBlack);
+  r.drawText(smallFont, x + 5, y, pageStr, t.primaryTextBlack);
 
   // Percentage on right
   char percentStr[8];
   snprintf(percentStr, sizeof(percentStr), "%d%%", percent);
-  const int percentW = r.getTextWidth(t.smallFontId, percentStr);
-  r.drawText(t.smallFontId, screenW - x - percentW - 5, y, percentStr, t.primaryTextBlack);
+  const int percentW = r.getTextWidth(smallFont, percentStr);
+  r.drawText(smallFont, screenW - x - percentW - 5, y, percentStr, t.primaryTextBlack);
 }
 
 void bookCard(const GfxRenderer& r, const Theme& t, int y, const char* titleText, const char* author,
               const uint8_t* cover, int coverW, int coverH) {
+  const auto& readerFont = r.getFont(t.readerFontId);
   const int x = t.screenMarginSide + 10;
   const int screenW = r.getScreenWidth();
 
@@ -416,10 +424,10 @@ void bookCard(const GfxRenderer& r, const Theme& t, int y, const char* titleText
   const int maxTextW = screenW - textX - t.screenMarginSide - 10;
   const auto titleLines = r.wrapTextWithHyphenation(t.readerFontId, titleText, maxTextW, 2, EpdFontFamily::BOLD);
   int textY = y + 10;
-  const int lineHeight = r.getLineHeight(t.readerFontId);
+  const int lineHeight = readerFont.lineHeight;
 
   for (const auto& line : titleLines) {
-    r.drawText(t.readerFontId, textX, textY, line.c_str(), t.primaryTextBlack, EpdFontFamily::BOLD);
+    r.drawText(readerFont, textX, textY, line.c_str(), t.primaryTextBlack, EpdFontFamily::BOLD);
     textY += lineHeight;
   }
 
@@ -431,10 +439,11 @@ void bookCard(const GfxRenderer& r, const Theme& t, int y, const char* titleText
 }
 
 void fileEntry(const GfxRenderer& r, const Theme& t, int y, const char* name, bool isDir, bool selected) {
+  const auto& uiFont = r.getFont(t.uiFontId);
   const int x = t.screenMarginSide;
   const int w = r.getScreenWidth() - 2 * t.screenMarginSide;
   const int h = t.itemHeight;
-  const int textY = y + (h - r.getLineHeight(t.uiFontId)) / 2;
+  const int textY = y + (h - uiFont.lineHeight) / 2;
 
   if (selected) {
     r.fillRect(x, y, w, h, t.selectionFillBlack);
@@ -453,18 +462,19 @@ void fileEntry(const GfxRenderer& r, const Theme& t, int y, const char* name, bo
   const int maxTextW = w - 2 * t.itemPaddingX;
   const auto truncated = r.truncatedText(t.uiFontId, displayName, maxTextW);
 
-  r.drawText(t.uiFontId, x + t.itemPaddingX, textY, truncated.c_str(),
+  r.drawText(uiFont, x + t.itemPaddingX, textY, truncated.c_str(),
              selected ? t.selectionTextBlack : t.primaryTextBlack);
 }
 
 void chapterItem(const GfxRenderer& r, const Theme& t, int y, const char* title, uint8_t depth, bool selected,
                  bool isCurrent) {
+  const auto& uiFont = r.getFont(t.uiFontId);
   constexpr int depthIndent = 12;
   constexpr int minWidth = 50;
   const int x = t.screenMarginSide + depth * depthIndent;
   const int w = std::max(minWidth, r.getScreenWidth() - x - t.screenMarginSide);
   const int h = t.itemHeight;
-  const int textY = y + (h - r.getLineHeight(t.uiFontId)) / 2;
+  const int textY = y + (h - uiFont.lineHeight) / 2;
 
   // Selection highlight
   if (selected) {
@@ -473,21 +483,22 @@ void chapterItem(const GfxRenderer& r, const Theme& t, int y, const char* title,
 
   // Current chapter indicator
   if (isCurrent) {
-    r.drawText(t.uiFontId, t.screenMarginSide, textY, ">", t.primaryTextBlack);
+    r.drawText(uiFont, t.screenMarginSide, textY, ">", t.primaryTextBlack);
   }
 
   // Truncated title
   const int maxTitleW = w - t.itemPaddingX * 2;
   const auto truncTitle = r.truncatedText(t.uiFontId, title, maxTitleW);
-  r.drawText(t.uiFontId, x + t.itemPaddingX, textY, truncTitle.c_str(),
+  r.drawText(uiFont, x + t.itemPaddingX, textY, truncTitle.c_str(),
              selected ? t.selectionTextBlack : t.primaryTextBlack);
 }
 
 void wifiEntry(const GfxRenderer& r, const Theme& t, int y, const char* ssid, int signal, bool locked, bool selected) {
+  const auto& uiFont = r.getFont(t.uiFontId);
   const int x = t.screenMarginSide;
   const int w = r.getScreenWidth() - 2 * t.screenMarginSide;
   const int h = t.itemHeight;
-  const int textY = y + (h - r.getLineHeight(t.uiFontId)) / 2;
+  const int textY = y + (h - uiFont.lineHeight) / 2;
 
   if (selected) {
     r.fillRect(x, y, w, h, t.selectionFillBlack);
@@ -498,7 +509,7 @@ void wifiEntry(const GfxRenderer& r, const Theme& t, int y, const char* ssid, in
   // SSID name
   const int maxSsidW = w - 80;
   const auto truncatedSsid = r.truncatedText(t.uiFontId, ssid, maxSsidW);
-  r.drawText(t.uiFontId, x + t.itemPaddingX, textY, truncatedSsid.c_str(), textColor);
+  r.drawText(uiFont, x + t.itemPaddingX, textY, truncatedSsid.c_str(), textColor);
 
   // Signal strength indicator (simple bars)
   const int signalX = w - 45;
@@ -537,6 +548,7 @@ void centeredMessage(const GfxRenderer& r, const Theme& t, int fontId, const cha
 }
 
 void bookPlaceholder(const GfxRenderer& r, const Theme& t, int x, int y, int width, int height) {
+  const auto& uiFont = r.getFont(t.uiFontId);
   if (width <= 0 || height <= 0) {
     return;
   }
@@ -613,34 +625,37 @@ void bookPlaceholder(const GfxRenderer& r, const Theme& t, int x, int y, int wid
   const int coverCenterX = sx(35) + sw(295) / 2;
   const int coverCenterY = sy(35) + sw(430) / 2;
   const char* noCoverText = "No Cover";
-  const int textWidth = r.getTextWidth(t.uiFontId, noCoverText);
+  const int textWidth = r.getTextWidth(uiFont, noCoverText);
   const int textX = coverCenterX - textWidth / 2;
-  const int textY = coverCenterY - r.getLineHeight(t.uiFontId) / 2;
-  r.drawText(t.uiFontId, textX, textY, noCoverText, fgColor);
+  const int textY = coverCenterY - uiFont.lineHeight / 2;
+  r.drawText(uiFont, textX, textY, noCoverText, fgColor);
 }
 
 void overlayBox(const GfxRenderer& r, const Theme& t, int fontId, int y, const char* message) {
   constexpr int boxMargin = 20;
-  const int textWidth = r.getTextWidth(fontId, message);
+  const auto& font = r.getFont(fontId);
+  const int textWidth = r.getTextWidth(font, message);
   const int boxWidth = textWidth + boxMargin * 2;
-  const int boxHeight = r.getLineHeight(fontId) + boxMargin * 2;
+  const int boxHeight = font.lineHeight + boxMargin * 2;
   const int boxX = (r.getScreenWidth() - boxWidth) / 2;
 
   r.fillRect(boxX, y, boxWidth, boxHeight, !t.primaryTextBlack);
-  r.drawText(fontId, boxX + boxMargin, y + boxMargin, message, t.primaryTextBlack);
+  r.drawText(font, boxX + boxMargin, y + boxMargin, message, t.primaryTextBlack);
   r.drawRect(boxX + 5, y + 5, boxWidth - 10, boxHeight - 10, t.primaryTextBlack);
 }
 
 void twoColumnRow(const GfxRenderer& r, const Theme& t, int y, const char* label, const char* value) {
+  const auto& uiFont = r.getFont(t.uiFontId);
   const int labelX = t.screenMarginSide + t.itemPaddingX;
   const int valueX = r.getScreenWidth() / 2;
 
-  r.drawText(t.uiFontId, labelX, y, label, t.primaryTextBlack);
-  r.drawText(t.uiFontId, valueX, y, value, t.secondaryTextBlack);
+  r.drawText(uiFont, labelX, y, label, t.primaryTextBlack);
+  r.drawText(uiFont, valueX, y, value, t.secondaryTextBlack);
 }
 
 void readerStatusBar(const GfxRenderer& r, const Theme& t, int marginLeft, int marginRight, int marginBottom,
                      const ReaderStatusBarData& data) {
+  const auto& smallFont = r.getFont(t.smallFontId);
   if (data.mode == 0) return;  // StatusNone
 
   const auto screenHeight = r.getScreenHeight();
@@ -657,8 +672,8 @@ void readerStatusBar(const GfxRenderer& r, const Theme& t, int marginLeft, int m
   } else {
     snprintf(percentageText, sizeof(percentageText), "%d%%", percentage);
   }
-  percentageTextWidth = r.getTextWidth(t.smallFontId, percentageText);
-  r.drawText(t.smallFontId, 20 + marginLeft, textY, percentageText, t.primaryTextBlack);
+  percentageTextWidth = r.getTextWidth(smallFont, percentageText);
+  r.drawText(smallFont, 20 + marginLeft, textY, percentageText, t.primaryTextBlack);
 
   // Battery icon (15x10 px)
   constexpr int batteryWidth = 15;
@@ -691,8 +706,8 @@ void readerStatusBar(const GfxRenderer& r, const Theme& t, int marginLeft, int m
   } else {
     snprintf(pageStr, sizeof(pageStr), "%d/%d", data.currentPage, data.totalPages);
   }
-  int pageTextWidth = r.getTextWidth(t.smallFontId, pageStr);
-  r.drawText(t.smallFontId, screenWidth - marginRight - pageTextWidth, textY, pageStr, t.primaryTextBlack);
+  int pageTextWidth = r.getTextWidth(smallFont, pageStr);
+  r.drawText(smallFont, screenWidth - marginRight - pageTextWidth, textY, pageStr, t.primaryTextBlack);
 
   // 3. Title (center)
   if (data.title && data.title[0] != '\0') {
@@ -704,23 +719,23 @@ void readerStatusBar(const GfxRenderer& r, const Theme& t, int marginLeft, int m
     if (availableTextWidth <= 0) return;
 
     std::string titleStr = data.title;
-    int titleWidth = r.getTextWidth(t.smallFontId, titleStr.c_str());
+    int titleWidth = r.getTextWidth(smallFont, titleStr.c_str());
 
     // Truncate title if too wide
     if (titleWidth > availableTextWidth && titleStr.length() > 3) {
-      const int ellipsisWidth = r.getTextWidth(t.smallFontId, "...");
+      const int ellipsisWidth = r.getTextWidth(smallFont, "...");
       if (ellipsisWidth > availableTextWidth) {
         return;  // Can't fit even ellipsis, skip title
       }
       while (titleWidth + ellipsisWidth > availableTextWidth && titleStr.length() > 0) {
         titleStr.pop_back();
-        titleWidth = r.getTextWidth(t.smallFontId, titleStr.c_str());
+        titleWidth = r.getTextWidth(smallFont, titleStr.c_str());
       }
       titleStr += "...";
       titleWidth += ellipsisWidth;
     }
 
-    r.drawText(t.smallFontId, titleMarginLeft + (availableTextWidth - titleWidth) / 2, textY, titleStr.c_str(),
+    r.drawText(smallFont, titleMarginLeft + (availableTextWidth - titleWidth) / 2, textY, titleStr.c_str(),
                t.primaryTextBlack);
   }
 }
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/BackgroundTaskTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/BackgroundTaskTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/BackgroundTaskTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/BackgroundTaskTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/BackgroundTaskTest.dir/unit/asynctask/BackgroundTaskTest.cpp.o"
+  "CMakeFiles/BackgroundTaskTest.dir/unit/asynctask/BackgroundTaskTest.cpp.o.d"
+  "bin/BackgroundTaskTest"
+  "bin/BackgroundTaskTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BackgroundTaskTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/BitmapHelpersTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/BitmapHelpersTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/BitmapHelpersTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/BitmapHelpersTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/BitmapHelpersTest.dir/unit/gfxrenderer/BitmapHelpersTest.cpp.o"
+  "CMakeFiles/BitmapHelpersTest.dir/unit/gfxrenderer/BitmapHelpersTest.cpp.o.d"
+  "bin/BitmapHelpersTest"
+  "bin/BitmapHelpersTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BitmapHelpersTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
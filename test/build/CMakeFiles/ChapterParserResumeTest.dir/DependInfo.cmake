@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/expat/xmlparse.c" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/expat/xmlparse.c.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/expat/xmlparse.c.o.d"
+  "/root/repo/lib/expat/xmlrole.c" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/expat/xmlrole.c.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/expat/xmlrole.c.o.d"
+  "/root/repo/lib/expat/xmltok.c" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/expat/xmltok.c.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/expat/xmltok.c.o.d"
+  "/root/repo/test/common/test_utils.cpp" "CMakeFiles/ChapterParserResumeTest.dir/common/test_utils.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/common/test_utils.cpp.o.d"
+  "/root/repo/test/mocks/platform_stubs.cpp" "CMakeFiles/ChapterParserResumeTest.dir/mocks/platform_stubs.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/mocks/platform_stubs.cpp.o.d"
+  "/root/repo/test/mocks/renderer/image_stubs.cpp" "CMakeFiles/ChapterParserResumeTest.dir/mocks/renderer/image_stubs.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/mocks/renderer/image_stubs.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/KnuthPlass.cpp" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/KnuthPlass.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/KnuthPlass.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/Page.cpp" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/Page.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/Page.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/ParsedText.cpp" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/ParsedText.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/ParsedText.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/blocks/ImageBlock.cpp" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/blocks/ImageBlock.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/blocks/ImageBlock.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/css/CssParser.cpp" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/css/CssParser.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/css/CssParser.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/css/CssSelectorTable.cpp" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/css/CssSelectorTable.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/css/CssSelectorTable.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/css/CssTokenizer.cpp" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/css/CssTokenizer.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/css/CssTokenizer.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp.o.d"
+  "/root/repo/lib/FsHelpers/FsHelpers.cpp" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/FsHelpers/FsHelpers.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/FsHelpers/FsHelpers.cpp.o.d"
+  "/root/repo/lib/Html5/Html5Normalizer.cpp" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Html5/Html5Normalizer.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Html5/Html5Normalizer.cpp.o.d"
+  "/root/repo/lib/Utf8/Utf8.cpp" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Utf8/Utf8.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Utf8/Utf8.cpp.o.d"
+  "/root/repo/test/unit/epub/ChapterParserResumeTest.cpp" "CMakeFiles/ChapterParserResumeTest.dir/unit/epub/ChapterParserResumeTest.cpp.o" "gcc" "CMakeFiles/ChapterParserResumeTest.dir/unit/epub/ChapterParserResumeTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
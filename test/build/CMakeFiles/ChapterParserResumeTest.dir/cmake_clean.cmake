@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ChapterParserResumeTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/mocks/renderer/image_stubs.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/mocks/renderer/image_stubs.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/KnuthPlass.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/KnuthPlass.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/Page.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/Page.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/ParsedText.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/ParsedText.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/blocks/ImageBlock.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/blocks/ImageBlock.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/css/CssParser.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/css/CssParser.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/css/CssSelectorTable.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/css/CssSelectorTable.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/css/CssTokenizer.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/css/CssTokenizer.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/FsHelpers/FsHelpers.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/FsHelpers/FsHelpers.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Html5/Html5Normalizer.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Html5/Html5Normalizer.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Utf8/Utf8.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/Utf8/Utf8.cpp.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/expat/xmlparse.c.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/expat/xmlparse.c.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/expat/xmlrole.c.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/expat/xmlrole.c.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/expat/xmltok.c.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/root/repo/lib/expat/xmltok.c.o.d"
+  "CMakeFiles/ChapterParserResumeTest.dir/unit/epub/ChapterParserResumeTest.cpp.o"
+  "CMakeFiles/ChapterParserResumeTest.dir/unit/epub/ChapterParserResumeTest.cpp.o.d"
+  "bin/ChapterParserResumeTest"
+  "bin/ChapterParserResumeTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/ChapterParserResumeTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
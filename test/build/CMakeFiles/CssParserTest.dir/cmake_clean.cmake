@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CssParserTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/CssParserTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/CssParserTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/CssParserTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/CssParserTest.dir/unit/css/CssParserTest.cpp.o"
+  "CMakeFiles/CssParserTest.dir/unit/css/CssParserTest.cpp.o.d"
+  "bin/CssParserTest"
+  "bin/CssParserTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CssParserTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
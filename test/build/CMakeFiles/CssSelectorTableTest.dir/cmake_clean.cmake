@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CssSelectorTableTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/CssSelectorTableTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/CssSelectorTableTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/CssSelectorTableTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/CssSelectorTableTest.dir/root/repo/lib/Epub/Epub/css/CssSelectorTable.cpp.o"
+  "CMakeFiles/CssSelectorTableTest.dir/root/repo/lib/Epub/Epub/css/CssSelectorTable.cpp.o.d"
+  "CMakeFiles/CssSelectorTableTest.dir/unit/css/CssSelectorTableTest.cpp.o"
+  "CMakeFiles/CssSelectorTableTest.dir/unit/css/CssSelectorTableTest.cpp.o.d"
+  "bin/CssSelectorTableTest"
+  "bin/CssSelectorTableTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CssSelectorTableTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CssStyleCacheTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/CssStyleCacheTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/CssStyleCacheTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/CssStyleCacheTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/CssStyleCacheTest.dir/root/repo/lib/Epub/Epub/css/CssParser.cpp.o"
+  "CMakeFiles/CssStyleCacheTest.dir/root/repo/lib/Epub/Epub/css/CssParser.cpp.o.d"
+  "CMakeFiles/CssStyleCacheTest.dir/root/repo/lib/Epub/Epub/css/CssSelectorTable.cpp.o"
+  "CMakeFiles/CssStyleCacheTest.dir/root/repo/lib/Epub/Epub/css/CssSelectorTable.cpp.o.d"
+  "CMakeFiles/CssStyleCacheTest.dir/root/repo/lib/Epub/Epub/css/CssTokenizer.cpp.o"
+  "CMakeFiles/CssStyleCacheTest.dir/root/repo/lib/Epub/Epub/css/CssTokenizer.cpp.o.d"
+  "CMakeFiles/CssStyleCacheTest.dir/unit/css/CssStyleCacheTest.cpp.o"
+  "CMakeFiles/CssStyleCacheTest.dir/unit/css/CssStyleCacheTest.cpp.o.d"
+  "bin/CssStyleCacheTest"
+  "bin/CssStyleCacheTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CssStyleCacheTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
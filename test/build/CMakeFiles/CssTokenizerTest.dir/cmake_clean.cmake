@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CssTokenizerTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/CssTokenizerTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/CssTokenizerTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/CssTokenizerTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/CssTokenizerTest.dir/root/repo/lib/Epub/Epub/css/CssTokenizer.cpp.o"
+  "CMakeFiles/CssTokenizerTest.dir/root/repo/lib/Epub/Epub/css/CssTokenizer.cpp.o.d"
+  "CMakeFiles/CssTokenizerTest.dir/unit/css/CssTokenizerTest.cpp.o"
+  "CMakeFiles/CssTokenizerTest.dir/unit/css/CssTokenizerTest.cpp.o.d"
+  "bin/CssTokenizerTest"
+  "bin/CssTokenizerTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CssTokenizerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
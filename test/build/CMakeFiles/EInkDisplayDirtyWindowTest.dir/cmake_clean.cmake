@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EInkDisplayDirtyWindowTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/EInkDisplayDirtyWindowTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/EInkDisplayDirtyWindowTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/EInkDisplayDirtyWindowTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/EInkDisplayDirtyWindowTest.dir/root/repo/lib/EInkDisplay/src/EInkDisplay.cpp.o"
+  "CMakeFiles/EInkDisplayDirtyWindowTest.dir/root/repo/lib/EInkDisplay/src/EInkDisplay.cpp.o.d"
+  "CMakeFiles/EInkDisplayDirtyWindowTest.dir/unit/einkdisplay/EInkDisplayDirtyWindowTest.cpp.o"
+  "CMakeFiles/EInkDisplayDirtyWindowTest.dir/unit/einkdisplay/EInkDisplayDirtyWindowTest.cpp.o.d"
+  "bin/EInkDisplayDirtyWindowTest"
+  "bin/EInkDisplayDirtyWindowTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EInkDisplayDirtyWindowTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EInkDisplayRefreshTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/EInkDisplayRefreshTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/EInkDisplayRefreshTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/EInkDisplayRefreshTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/EInkDisplayRefreshTest.dir/root/repo/lib/EInkDisplay/src/EInkDisplay.cpp.o"
+  "CMakeFiles/EInkDisplayRefreshTest.dir/root/repo/lib/EInkDisplay/src/EInkDisplay.cpp.o.d"
+  "CMakeFiles/EInkDisplayRefreshTest.dir/unit/einkdisplay/EInkDisplayRefreshTest.cpp.o"
+  "CMakeFiles/EInkDisplayRefreshTest.dir/unit/einkdisplay/EInkDisplayRefreshTest.cpp.o.d"
+  "bin/EInkDisplayRefreshTest"
+  "bin/EInkDisplayRefreshTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EInkDisplayRefreshTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
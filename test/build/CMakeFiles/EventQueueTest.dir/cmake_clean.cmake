@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EventQueueTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/EventQueueTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/EventQueueTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/EventQueueTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/EventQueueTest.dir/unit/eventqueue/EventQueueTest.cpp.o"
+  "CMakeFiles/EventQueueTest.dir/unit/eventqueue/EventQueueTest.cpp.o.d"
+  "bin/EventQueueTest"
+  "bin/EventQueueTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EventQueueTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/common/test_utils.cpp" "CMakeFiles/GlyphAdvanceTest.dir/common/test_utils.cpp.o" "gcc" "CMakeFiles/GlyphAdvanceTest.dir/common/test_utils.cpp.o.d"
+  "/root/repo/test/mocks/platform_stubs.cpp" "CMakeFiles/GlyphAdvanceTest.dir/mocks/platform_stubs.cpp.o" "gcc" "CMakeFiles/GlyphAdvanceTest.dir/mocks/platform_stubs.cpp.o.d"
+  "/root/repo/lib/EpdFont/EpdFont.cpp" "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/EpdFont/EpdFont.cpp.o" "gcc" "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/EpdFont/EpdFont.cpp.o.d"
+  "/root/repo/lib/EpdFont/EpdFontFamily.cpp" "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/EpdFont/EpdFontFamily.cpp.o" "gcc" "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/EpdFont/EpdFontFamily.cpp.o.d"
+  "/root/repo/lib/ScriptDetector/ScriptDetector.cpp" "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/ScriptDetector/ScriptDetector.cpp.o" "gcc" "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/ScriptDetector/ScriptDetector.cpp.o.d"
+  "/root/repo/lib/Utf8/Utf8.cpp" "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/Utf8/Utf8.cpp.o" "gcc" "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/Utf8/Utf8.cpp.o.d"
+  "/root/repo/test/unit/gfxrenderer/GlyphAdvanceTest.cpp" "CMakeFiles/GlyphAdvanceTest.dir/unit/gfxrenderer/GlyphAdvanceTest.cpp.o" "gcc" "CMakeFiles/GlyphAdvanceTest.dir/unit/gfxrenderer/GlyphAdvanceTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
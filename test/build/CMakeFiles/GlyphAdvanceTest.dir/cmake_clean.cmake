@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GlyphAdvanceTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/GlyphAdvanceTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/GlyphAdvanceTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/GlyphAdvanceTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/EpdFont/EpdFont.cpp.o"
+  "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/EpdFont/EpdFont.cpp.o.d"
+  "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/EpdFont/EpdFontFamily.cpp.o"
+  "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/EpdFont/EpdFontFamily.cpp.o.d"
+  "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/ScriptDetector/ScriptDetector.cpp.o"
+  "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/ScriptDetector/ScriptDetector.cpp.o.d"
+  "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/Utf8/Utf8.cpp.o"
+  "CMakeFiles/GlyphAdvanceTest.dir/root/repo/lib/Utf8/Utf8.cpp.o.d"
+  "CMakeFiles/GlyphAdvanceTest.dir/unit/gfxrenderer/GlyphAdvanceTest.cpp.o"
+  "CMakeFiles/GlyphAdvanceTest.dir/unit/gfxrenderer/GlyphAdvanceTest.cpp.o.d"
+  "bin/GlyphAdvanceTest"
+  "bin/GlyphAdvanceTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GlyphAdvanceTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
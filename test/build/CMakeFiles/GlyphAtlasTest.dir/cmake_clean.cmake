@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GlyphAtlasTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/GlyphAtlasTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/GlyphAtlasTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/GlyphAtlasTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/GlyphAtlasTest.dir/root/repo/lib/GfxRenderer/GlyphAtlas.cpp.o"
+  "CMakeFiles/GlyphAtlasTest.dir/root/repo/lib/GfxRenderer/GlyphAtlas.cpp.o.d"
+  "CMakeFiles/GlyphAtlasTest.dir/unit/gfxrenderer/GlyphAtlasTest.cpp.o"
+  "CMakeFiles/GlyphAtlasTest.dir/unit/gfxrenderer/GlyphAtlasTest.cpp.o.d"
+  "bin/GlyphAtlasTest"
+  "bin/GlyphAtlasTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GlyphAtlasTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
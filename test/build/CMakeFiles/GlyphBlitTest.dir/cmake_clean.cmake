@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GlyphBlitTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/GlyphBlitTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/GlyphBlitTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/GlyphBlitTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/GlyphBlitTest.dir/root/repo/lib/GfxRenderer/GlyphAtlas.cpp.o"
+  "CMakeFiles/GlyphBlitTest.dir/root/repo/lib/GfxRenderer/GlyphAtlas.cpp.o.d"
+  "CMakeFiles/GlyphBlitTest.dir/unit/gfxrenderer/GlyphBlitTest.cpp.o"
+  "CMakeFiles/GlyphBlitTest.dir/unit/gfxrenderer/GlyphBlitTest.cpp.o.d"
+  "bin/GlyphBlitTest"
+  "bin/GlyphBlitTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GlyphBlitTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
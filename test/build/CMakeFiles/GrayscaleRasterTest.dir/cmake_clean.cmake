@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GrayscaleRasterTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/GrayscaleRasterTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/GrayscaleRasterTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/GrayscaleRasterTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/GrayscaleRasterTest.dir/unit/gfxrenderer/GrayscaleRasterTest.cpp.o"
+  "CMakeFiles/GrayscaleRasterTest.dir/unit/gfxrenderer/GrayscaleRasterTest.cpp.o.d"
+  "bin/GrayscaleRasterTest"
+  "bin/GrayscaleRasterTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GrayscaleRasterTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
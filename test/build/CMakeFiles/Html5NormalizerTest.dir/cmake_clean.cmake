@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Html5NormalizerTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/Html5NormalizerTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/Html5NormalizerTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/Html5NormalizerTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/Html5NormalizerTest.dir/root/repo/lib/Html5/Html5Normalizer.cpp.o"
+  "CMakeFiles/Html5NormalizerTest.dir/root/repo/lib/Html5/Html5Normalizer.cpp.o.d"
+  "CMakeFiles/Html5NormalizerTest.dir/unit/html5/Html5NormalizerTest.cpp.o"
+  "CMakeFiles/Html5NormalizerTest.dir/unit/html5/Html5NormalizerTest.cpp.o.d"
+  "bin/Html5NormalizerTest"
+  "bin/Html5NormalizerTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Html5NormalizerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IniParserTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/IniParserTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/IniParserTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/IniParserTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/IniParserTest.dir/unit/ini/IniParserTest.cpp.o"
+  "CMakeFiles/IniParserTest.dir/unit/ini/IniParserTest.cpp.o.d"
+  "bin/IniParserTest"
+  "bin/IniParserTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IniParserTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
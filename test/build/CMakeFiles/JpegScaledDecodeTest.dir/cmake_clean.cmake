@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/JpegScaledDecodeTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/JpegScaledDecodeTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/JpegScaledDecodeTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/JpegScaledDecodeTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/JpegScaledDecodeTest.dir/root/repo/lib/picojpeg/picojpeg.c.o"
+  "CMakeFiles/JpegScaledDecodeTest.dir/root/repo/lib/picojpeg/picojpeg.c.o.d"
+  "CMakeFiles/JpegScaledDecodeTest.dir/unit/jpeg/JpegScaledDecodeTest.cpp.o"
+  "CMakeFiles/JpegScaledDecodeTest.dir/unit/jpeg/JpegScaledDecodeTest.cpp.o.d"
+  "bin/JpegScaledDecodeTest"
+  "bin/JpegScaledDecodeTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/JpegScaledDecodeTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/KnuthPlassTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/KnuthPlassTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/KnuthPlassTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/KnuthPlassTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/KnuthPlassTest.dir/root/repo/lib/Epub/Epub/KnuthPlass.cpp.o"
+  "CMakeFiles/KnuthPlassTest.dir/root/repo/lib/Epub/Epub/KnuthPlass.cpp.o.d"
+  "CMakeFiles/KnuthPlassTest.dir/unit/epub/KnuthPlassTest.cpp.o"
+  "CMakeFiles/KnuthPlassTest.dir/unit/epub/KnuthPlassTest.cpp.o.d"
+  "bin/KnuthPlassTest"
+  "bin/KnuthPlassTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/KnuthPlassTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
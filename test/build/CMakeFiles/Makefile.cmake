@@ -0,0 +1,80 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/BackgroundTaskTest.dir/DependInfo.cmake"
+  "CMakeFiles/ScopedMutexTest.dir/DependInfo.cmake"
+  "CMakeFiles/CssParserTest.dir/DependInfo.cmake"
+  "CMakeFiles/CssSelectorTableTest.dir/DependInfo.cmake"
+  "CMakeFiles/CssStyleCacheTest.dir/DependInfo.cmake"
+  "CMakeFiles/CssTokenizerTest.dir/DependInfo.cmake"
+  "CMakeFiles/EInkDisplayDirtyWindowTest.dir/DependInfo.cmake"
+  "CMakeFiles/EInkDisplayRefreshTest.dir/DependInfo.cmake"
+  "CMakeFiles/ChapterParserResumeTest.dir/DependInfo.cmake"
+  "CMakeFiles/KnuthPlassTest.dir/DependInfo.cmake"
+  "CMakeFiles/ParsedTextArenaTest.dir/DependInfo.cmake"
+  "CMakeFiles/ParsedTextTest.dir/DependInfo.cmake"
+  "CMakeFiles/EventQueueTest.dir/DependInfo.cmake"
+  "CMakeFiles/BitmapHelpersTest.dir/DependInfo.cmake"
+  "CMakeFiles/GlyphAdvanceTest.dir/DependInfo.cmake"
+  "CMakeFiles/GlyphAtlasTest.dir/DependInfo.cmake"
+  "CMakeFiles/GlyphBlitTest.dir/DependInfo.cmake"
+  "CMakeFiles/GrayscaleRasterTest.dir/DependInfo.cmake"
+  "CMakeFiles/PackedImageTest.dir/DependInfo.cmake"
+  "CMakeFiles/WordWidthCacheTest.dir/DependInfo.cmake"
+  "CMakeFiles/Html5NormalizerTest.dir/DependInfo.cmake"
+  "CMakeFiles/IniParserTest.dir/DependInfo.cmake"
+  "CMakeFiles/JpegScaledDecodeTest.dir/DependInfo.cmake"
+  "CMakeFiles/MarkdownParserTest.dir/DependInfo.cmake"
+  "CMakeFiles/PageBlobTest.dir/DependInfo.cmake"
+  "CMakeFiles/PageCacheLutTest.dir/DependInfo.cmake"
+  "CMakeFiles/PageCacheRaceTest.dir/DependInfo.cmake"
+  "CMakeFiles/PagePrefetchRingTest.dir/DependInfo.cmake"
+  "CMakeFiles/SerializationTest.dir/DependInfo.cmake"
+  "CMakeFiles/TxtTest.dir/DependInfo.cmake"
+  "CMakeFiles/Utf8Test.dir/DependInfo.cmake"
+  "CMakeFiles/ZipCentralDirTest.dir/DependInfo.cmake"
+  "CMakeFiles/ZipIndexTest.dir/DependInfo.cmake"
+  "CMakeFiles/ZipSeekIndexTest.dir/DependInfo.cmake"
+  )
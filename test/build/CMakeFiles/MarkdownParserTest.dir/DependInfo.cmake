@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/Markdown/md_parser.c" "CMakeFiles/MarkdownParserTest.dir/root/repo/lib/Markdown/md_parser.c.o" "gcc" "CMakeFiles/MarkdownParserTest.dir/root/repo/lib/Markdown/md_parser.c.o.d"
+  "/root/repo/test/common/test_utils.cpp" "CMakeFiles/MarkdownParserTest.dir/common/test_utils.cpp.o" "gcc" "CMakeFiles/MarkdownParserTest.dir/common/test_utils.cpp.o.d"
+  "/root/repo/test/mocks/platform_stubs.cpp" "CMakeFiles/MarkdownParserTest.dir/mocks/platform_stubs.cpp.o" "gcc" "CMakeFiles/MarkdownParserTest.dir/mocks/platform_stubs.cpp.o.d"
+  "/root/repo/test/unit/markdown/MarkdownParserTest.cpp" "CMakeFiles/MarkdownParserTest.dir/unit/markdown/MarkdownParserTest.cpp.o" "gcc" "CMakeFiles/MarkdownParserTest.dir/unit/markdown/MarkdownParserTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
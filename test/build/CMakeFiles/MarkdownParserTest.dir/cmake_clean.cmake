@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MarkdownParserTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/MarkdownParserTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/MarkdownParserTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/MarkdownParserTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/MarkdownParserTest.dir/root/repo/lib/Markdown/md_parser.c.o"
+  "CMakeFiles/MarkdownParserTest.dir/root/repo/lib/Markdown/md_parser.c.o.d"
+  "CMakeFiles/MarkdownParserTest.dir/unit/markdown/MarkdownParserTest.cpp.o"
+  "CMakeFiles/MarkdownParserTest.dir/unit/markdown/MarkdownParserTest.cpp.o.d"
+  "bin/MarkdownParserTest"
+  "bin/MarkdownParserTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/MarkdownParserTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
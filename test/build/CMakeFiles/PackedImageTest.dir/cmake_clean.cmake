@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PackedImageTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/PackedImageTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/PackedImageTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/PackedImageTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/PackedImageTest.dir/unit/gfxrenderer/PackedImageTest.cpp.o"
+  "CMakeFiles/PackedImageTest.dir/unit/gfxrenderer/PackedImageTest.cpp.o.d"
+  "bin/PackedImageTest"
+  "bin/PackedImageTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PackedImageTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PageBlobTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/PageBlobTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/PageBlobTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/PageBlobTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/PageBlobTest.dir/unit/pagecache/PageBlobTest.cpp.o"
+  "CMakeFiles/PageBlobTest.dir/unit/pagecache/PageBlobTest.cpp.o.d"
+  "bin/PageBlobTest"
+  "bin/PageBlobTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PageBlobTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/common/test_utils.cpp" "CMakeFiles/PageCacheLutTest.dir/common/test_utils.cpp.o" "gcc" "CMakeFiles/PageCacheLutTest.dir/common/test_utils.cpp.o.d"
+  "/root/repo/test/mocks/platform_stubs.cpp" "CMakeFiles/PageCacheLutTest.dir/mocks/platform_stubs.cpp.o" "gcc" "CMakeFiles/PageCacheLutTest.dir/mocks/platform_stubs.cpp.o.d"
+  "/root/repo/test/mocks/renderer/image_stubs.cpp" "CMakeFiles/PageCacheLutTest.dir/mocks/renderer/image_stubs.cpp.o" "gcc" "CMakeFiles/PageCacheLutTest.dir/mocks/renderer/image_stubs.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/Page.cpp" "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/Epub/Epub/Page.cpp.o" "gcc" "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/Epub/Epub/Page.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/blocks/ImageBlock.cpp" "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/Epub/Epub/blocks/ImageBlock.cpp.o" "gcc" "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/Epub/Epub/blocks/ImageBlock.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp" "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp.o" "gcc" "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp.o.d"
+  "/root/repo/lib/PageCache/PageCache.cpp" "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/PageCache/PageCache.cpp.o" "gcc" "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/PageCache/PageCache.cpp.o.d"
+  "/root/repo/test/unit/pagecache/PageCacheLutTest.cpp" "CMakeFiles/PageCacheLutTest.dir/unit/pagecache/PageCacheLutTest.cpp.o" "gcc" "CMakeFiles/PageCacheLutTest.dir/unit/pagecache/PageCacheLutTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PageCacheLutTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/PageCacheLutTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/PageCacheLutTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/PageCacheLutTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/PageCacheLutTest.dir/mocks/renderer/image_stubs.cpp.o"
+  "CMakeFiles/PageCacheLutTest.dir/mocks/renderer/image_stubs.cpp.o.d"
+  "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/Epub/Epub/Page.cpp.o"
+  "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/Epub/Epub/Page.cpp.o.d"
+  "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/Epub/Epub/blocks/ImageBlock.cpp.o"
+  "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/Epub/Epub/blocks/ImageBlock.cpp.o.d"
+  "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp.o"
+  "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp.o.d"
+  "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/PageCache/PageCache.cpp.o"
+  "CMakeFiles/PageCacheLutTest.dir/root/repo/lib/PageCache/PageCache.cpp.o.d"
+  "CMakeFiles/PageCacheLutTest.dir/unit/pagecache/PageCacheLutTest.cpp.o"
+  "CMakeFiles/PageCacheLutTest.dir/unit/pagecache/PageCacheLutTest.cpp.o.d"
+  "bin/PageCacheLutTest"
+  "bin/PageCacheLutTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PageCacheLutTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
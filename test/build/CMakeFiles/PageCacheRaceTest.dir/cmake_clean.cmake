@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PageCacheRaceTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/PageCacheRaceTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/PageCacheRaceTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/PageCacheRaceTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/PageCacheRaceTest.dir/unit/pagecache/PageCacheRaceTest.cpp.o"
+  "CMakeFiles/PageCacheRaceTest.dir/unit/pagecache/PageCacheRaceTest.cpp.o.d"
+  "bin/PageCacheRaceTest"
+  "bin/PageCacheRaceTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PageCacheRaceTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/expat/xmlparse.c" "CMakeFiles/PageCacheResumeTest.dir/root/repo/lib/expat/xmlparse.c.o" "gcc" "CMakeFiles/PageCacheResumeTest.dir/root/repo/lib/expat/xmlparse.c.o.d"
+  "/root/repo/lib/expat/xmlrole.c" "CMakeFiles/PageCacheResumeTest.dir/root/repo/lib/expat/xmlrole.c.o" "gcc" "CMakeFiles/PageCacheResumeTest.dir/root/repo/lib/expat/xmlrole.c.o.d"
+  "/root/repo/lib/expat/xmltok.c" "CMakeFiles/PageCacheResumeTest.dir/root/repo/lib/expat/xmltok.c.o" "gcc" "CMakeFiles/PageCacheResumeTest.dir/root/repo/lib/expat/xmltok.c.o.d"
+  "/root/repo/test/common/test_utils.cpp" "CMakeFiles/PageCacheResumeTest.dir/common/test_utils.cpp.o" "gcc" "CMakeFiles/PageCacheResumeTest.dir/common/test_utils.cpp.o.d"
+  "/root/repo/test/mocks/platform_stubs.cpp" "CMakeFiles/PageCacheResumeTest.dir/mocks/platform_stubs.cpp.o" "gcc" "CMakeFiles/PageCacheResumeTest.dir/mocks/platform_stubs.cpp.o.d"
+  "/root/repo/test/unit/pagecache/PageCacheResumeTest.cpp" "CMakeFiles/PageCacheResumeTest.dir/unit/pagecache/PageCacheResumeTest.cpp.o" "gcc" "CMakeFiles/PageCacheResumeTest.dir/unit/pagecache/PageCacheResumeTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PageCacheResumeTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/PageCacheResumeTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/PageCacheResumeTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/PageCacheResumeTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/PageCacheResumeTest.dir/root/repo/lib/expat/xmlparse.c.o"
+  "CMakeFiles/PageCacheResumeTest.dir/root/repo/lib/expat/xmlparse.c.o.d"
+  "CMakeFiles/PageCacheResumeTest.dir/root/repo/lib/expat/xmlrole.c.o"
+  "CMakeFiles/PageCacheResumeTest.dir/root/repo/lib/expat/xmlrole.c.o.d"
+  "CMakeFiles/PageCacheResumeTest.dir/root/repo/lib/expat/xmltok.c.o"
+  "CMakeFiles/PageCacheResumeTest.dir/root/repo/lib/expat/xmltok.c.o.d"
+  "CMakeFiles/PageCacheResumeTest.dir/unit/pagecache/PageCacheResumeTest.cpp.o"
+  "CMakeFiles/PageCacheResumeTest.dir/unit/pagecache/PageCacheResumeTest.cpp.o.d"
+  "bin/PageCacheResumeTest"
+  "bin/PageCacheResumeTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/PageCacheResumeTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PagePrefetchRingTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/PagePrefetchRingTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/PagePrefetchRingTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/PagePrefetchRingTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/PagePrefetchRingTest.dir/unit/pagecache/PagePrefetchRingTest.cpp.o"
+  "CMakeFiles/PagePrefetchRingTest.dir/unit/pagecache/PagePrefetchRingTest.cpp.o.d"
+  "bin/PagePrefetchRingTest"
+  "bin/PagePrefetchRingTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PagePrefetchRingTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
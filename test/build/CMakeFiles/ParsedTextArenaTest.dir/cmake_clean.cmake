@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ParsedTextArenaTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/ParsedTextArenaTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/ParsedTextArenaTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/ParsedTextArenaTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/ParsedTextArenaTest.dir/unit/epub/ParsedTextArenaTest.cpp.o"
+  "CMakeFiles/ParsedTextArenaTest.dir/unit/epub/ParsedTextArenaTest.cpp.o.d"
+  "bin/ParsedTextArenaTest"
+  "bin/ParsedTextArenaTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParsedTextArenaTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
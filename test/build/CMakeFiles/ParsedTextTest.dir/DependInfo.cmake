@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/common/test_utils.cpp" "CMakeFiles/ParsedTextTest.dir/common/test_utils.cpp.o" "gcc" "CMakeFiles/ParsedTextTest.dir/common/test_utils.cpp.o.d"
+  "/root/repo/test/mocks/platform_stubs.cpp" "CMakeFiles/ParsedTextTest.dir/mocks/platform_stubs.cpp.o" "gcc" "CMakeFiles/ParsedTextTest.dir/mocks/platform_stubs.cpp.o.d"
+  "/root/repo/test/unit/epub/ParsedTextTest.cpp" "CMakeFiles/ParsedTextTest.dir/unit/epub/ParsedTextTest.cpp.o" "gcc" "CMakeFiles/ParsedTextTest.dir/unit/epub/ParsedTextTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
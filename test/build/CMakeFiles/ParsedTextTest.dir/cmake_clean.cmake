@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ParsedTextTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/ParsedTextTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/ParsedTextTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/ParsedTextTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/ParsedTextTest.dir/unit/epub/ParsedTextTest.cpp.o"
+  "CMakeFiles/ParsedTextTest.dir/unit/epub/ParsedTextTest.cpp.o.d"
+  "bin/ParsedTextTest"
+  "bin/ParsedTextTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParsedTextTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ScopedMutexTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/ScopedMutexTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/ScopedMutexTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/ScopedMutexTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/ScopedMutexTest.dir/unit/asynctask/ScopedMutexTest.cpp.o"
+  "CMakeFiles/ScopedMutexTest.dir/unit/asynctask/ScopedMutexTest.cpp.o.d"
+  "bin/ScopedMutexTest"
+  "bin/ScopedMutexTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ScopedMutexTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SerializationTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/SerializationTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/SerializationTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/SerializationTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/SerializationTest.dir/unit/serialization/SerializationTest.cpp.o"
+  "CMakeFiles/SerializationTest.dir/unit/serialization/SerializationTest.cpp.o.d"
+  "bin/SerializationTest"
+  "bin/SerializationTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SerializationTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
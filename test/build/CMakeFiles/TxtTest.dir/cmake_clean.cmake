@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TxtTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/TxtTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/TxtTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/TxtTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/TxtTest.dir/unit/txt/TxtTest.cpp.o"
+  "CMakeFiles/TxtTest.dir/unit/txt/TxtTest.cpp.o.d"
+  "bin/TxtTest"
+  "bin/TxtTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TxtTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
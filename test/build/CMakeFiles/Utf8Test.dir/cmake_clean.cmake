@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Utf8Test.dir/common/test_utils.cpp.o"
+  "CMakeFiles/Utf8Test.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/Utf8Test.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/Utf8Test.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/Utf8Test.dir/unit/utf8/Utf8Test.cpp.o"
+  "CMakeFiles/Utf8Test.dir/unit/utf8/Utf8Test.cpp.o.d"
+  "bin/Utf8Test"
+  "bin/Utf8Test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Utf8Test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
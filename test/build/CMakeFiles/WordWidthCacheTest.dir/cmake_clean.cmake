@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WordWidthCacheTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/WordWidthCacheTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/WordWidthCacheTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/WordWidthCacheTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/WordWidthCacheTest.dir/root/repo/lib/GfxRenderer/WordWidthCache.cpp.o"
+  "CMakeFiles/WordWidthCacheTest.dir/root/repo/lib/GfxRenderer/WordWidthCache.cpp.o.d"
+  "CMakeFiles/WordWidthCacheTest.dir/unit/gfxrenderer/WordWidthCacheTest.cpp.o"
+  "CMakeFiles/WordWidthCacheTest.dir/unit/gfxrenderer/WordWidthCacheTest.cpp.o.d"
+  "bin/WordWidthCacheTest"
+  "bin/WordWidthCacheTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WordWidthCacheTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ZipCentralDirTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/ZipCentralDirTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/ZipCentralDirTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/ZipCentralDirTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/ZipCentralDirTest.dir/unit/zip/ZipCentralDirTest.cpp.o"
+  "CMakeFiles/ZipCentralDirTest.dir/unit/zip/ZipCentralDirTest.cpp.o.d"
+  "bin/ZipCentralDirTest"
+  "bin/ZipCentralDirTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ZipCentralDirTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ZipIndexTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/ZipIndexTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/ZipIndexTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/ZipIndexTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/ZipIndexTest.dir/unit/zip/ZipIndexTest.cpp.o"
+  "CMakeFiles/ZipIndexTest.dir/unit/zip/ZipIndexTest.cpp.o.d"
+  "bin/ZipIndexTest"
+  "bin/ZipIndexTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ZipIndexTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
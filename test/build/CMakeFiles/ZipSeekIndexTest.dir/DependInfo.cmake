@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/miniz/miniz.c" "CMakeFiles/ZipSeekIndexTest.dir/root/repo/lib/miniz/miniz.c.o" "gcc" "CMakeFiles/ZipSeekIndexTest.dir/root/repo/lib/miniz/miniz.c.o.d"
+  "/root/repo/test/common/test_utils.cpp" "CMakeFiles/ZipSeekIndexTest.dir/common/test_utils.cpp.o" "gcc" "CMakeFiles/ZipSeekIndexTest.dir/common/test_utils.cpp.o.d"
+  "/root/repo/test/mocks/platform_stubs.cpp" "CMakeFiles/ZipSeekIndexTest.dir/mocks/platform_stubs.cpp.o" "gcc" "CMakeFiles/ZipSeekIndexTest.dir/mocks/platform_stubs.cpp.o.d"
+  "/root/repo/test/unit/zip/ZipSeekIndexTest.cpp" "CMakeFiles/ZipSeekIndexTest.dir/unit/zip/ZipSeekIndexTest.cpp.o" "gcc" "CMakeFiles/ZipSeekIndexTest.dir/unit/zip/ZipSeekIndexTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ZipSeekIndexTest.dir/common/test_utils.cpp.o"
+  "CMakeFiles/ZipSeekIndexTest.dir/common/test_utils.cpp.o.d"
+  "CMakeFiles/ZipSeekIndexTest.dir/mocks/platform_stubs.cpp.o"
+  "CMakeFiles/ZipSeekIndexTest.dir/mocks/platform_stubs.cpp.o.d"
+  "CMakeFiles/ZipSeekIndexTest.dir/root/repo/lib/miniz/miniz.c.o"
+  "CMakeFiles/ZipSeekIndexTest.dir/root/repo/lib/miniz/miniz.c.o.d"
+  "CMakeFiles/ZipSeekIndexTest.dir/unit/zip/ZipSeekIndexTest.cpp.o"
+  "CMakeFiles/ZipSeekIndexTest.dir/unit/zip/ZipSeekIndexTest.cpp.o.d"
+  "bin/ZipSeekIndexTest"
+  "bin/ZipSeekIndexTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/ZipSeekIndexTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
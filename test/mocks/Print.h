@@ -0,0 +1,4 @@
+#pragma once
+
+// Arduino Print shim for host tests; the Print base class lives with the other platform stubs
+#include "platform_stubs.h"
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "SdFat.h"
+
+// SDCardManager shim for host tests: an in-memory card that starts out empty. A file opened for write
+// becomes visible to readers when it is closed. Files live in mockCardFiles(), so FsFile::open sees them too.
+class SDCardManager {
+ public:
+  static SDCardManager& getInstance() {
+    static SDCardManager instance;
+    return instance;
+  }
+
+  bool exists(const char* path) const { return mockCardFiles().count(path) != 0; }
+
+  bool remove(const char* path) { return mockCardFiles().erase(path) != 0; }
+
+  bool rename(const char* path, const char* newPath) {
+    auto& files = mockCardFiles();
+    auto it = files.find(path);
+    if (it == files.end()) return false;
+    auto data = it->second;
+    files.erase(it);
+    files[newPath] = data;
+    return true;
+  }
+
+  bool openFileForRead(const char* moduleName, const std::string& path, FsFile& file) {
+    (void)moduleName;
+    auto& files = mockCardFiles();
+    auto it = files.find(path);
+    if (it == files.end()) return false;
+    file.setBuffer(*it->second);
+    readOpens_++;
+    return true;
+  }
+
+  bool openFileForWrite(const char* moduleName, const std::string& path, FsFile& file) {
+    (void)moduleName;
+    auto data = std::make_shared<std::string>();
+    mockCardFiles()[path] = data;
+    file.setBuffer("");
+    file.bindStore(data);
+    return true;
+  }
+
+  // Test helpers
+  void writeFile(const std::string& path, const std::string& contents) {
+    mockCardFiles()[path] = std::make_shared<std::string>(contents);
+  }
+  std::string readFile(const std::string& path) const {
+    const auto& files = mockCardFiles();
+    auto it = files.find(path);
+    return it == files.end() ? std::string() : *it->second;
+  }
+  void clear() {
+    mockCardFiles().clear();
+    readOpens_ = 0;
+  }
+  // openFileForRead() calls that found their file
+  int readOpens() const { return readOpens_; }
+
+ private:
+  int readOpens_ = 0;
+};
+
+#define SdMan SDCardManager::getInstance()
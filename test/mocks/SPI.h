@@ -0,0 +1,4 @@
+#pragma once
+
+// Arduino SPI shim for host tests; MockSPI lives with the other platform stubs
+#include "platform_stubs.h"
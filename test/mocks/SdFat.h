@@ -3,9 +3,13 @@
 #include <cstdint>
 #include <cstring>
 #include <fstream>
+#include <map>
+#include <memory>
 #include <sstream>
 #include <string>
 
+#include "platform_stubs.h"
+
 // File open mode flags
 #define O_RDONLY 0x00
 #define O_WRONLY 0x01
@@ -13,8 +17,14 @@
 #define O_CREAT 0x40
 #define O_TRUNC 0x80
 
-// Mock FsFile for testing serialization
-class FsFile {
+// Files on the in-memory card, shared by FsFile::open and the SDCardManager shim
+inline std::map<std::string, std::shared_ptr<std::string>>& mockCardFiles() {
+  static std::map<std::string, std::shared_ptr<std::string>> files;
+  return files;
+}
+
+// Mock FsFile for testing serialization; a Print like the SdFat one, so it can sit behind stream filters
+class FsFile : public Print {
  public:
   FsFile() = default;
 
@@ -27,16 +37,30 @@ class FsFile {
 
   std::string getBuffer() const { return buffer_; }
 
+  // Simulates a full card: writes stop short once the file reaches limit bytes
+  void setWriteLimit(const size_t limit) { writeLimit_ = limit; }
+
+  // Copy the contents into store on close(), as SDCardManager does for files opened for write
+  void bindStore(std::shared_ptr<std::string> store) { store_ = std::move(store); }
+
   operator bool() const { return isOpen_; }
 
+  // Opens a file on the in-memory card; writes become visible there on close()
   bool open(const char* path, int mode) {
-    (void)path;
-    (void)mode;
-    isOpen_ = true;
+    auto& files = mockCardFiles();
+    auto it = files.find(path);
+    if (it == files.end()) {
+      if (!(mode & O_CREAT)) return false;
+      it = files.emplace(path, std::make_shared<std::string>()).first;
+    }
+    setBuffer((mode & O_TRUNC) ? std::string() : *it->second);
+    if (mode & (O_WRONLY | O_RDWR)) bindStore(it->second);
     return true;
   }
 
   void close() {
+    if (isOpen_ && store_) *store_ = buffer_;
+    store_.reset();
     isOpen_ = false;
     pos_ = 0;
   }
@@ -45,6 +69,11 @@ class FsFile {
 
   size_t position() const { return pos_; }
 
+  bool seekEnd() {
+    pos_ = buffer_.size();
+    return true;
+  }
+
   bool seek(size_t pos) {
     if (pos > buffer_.size()) return false;
     pos_ = pos;
@@ -65,8 +94,11 @@ class FsFile {
     return static_cast<int>(toRead);
   }
 
-  size_t write(const uint8_t* buf, size_t len) {
+  size_t write(uint8_t c) override { return write(&c, 1); }
+
+  size_t write(const uint8_t* buf, size_t len) override {
     if (!isOpen_) return 0;
+    if (pos_ + len > writeLimit_) len = pos_ < writeLimit_ ? writeLimit_ - pos_ : 0;
     // Extend buffer if needed
     if (pos_ + len > buffer_.size()) {
       buffer_.resize(pos_ + len);
@@ -82,4 +114,6 @@ class FsFile {
   std::string buffer_;
   size_t pos_ = 0;
   bool isOpen_ = false;
+  size_t writeLimit_ = SIZE_MAX;
+  std::shared_ptr<std::string> store_;
 };
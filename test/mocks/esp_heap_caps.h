@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// ESP-IDF heap capabilities shim for host tests: the largest free block is always 256KB
+#define MALLOC_CAP_8BIT (1 << 2)
+
+inline size_t heap_caps_get_largest_free_block(uint32_t caps) {
+  (void)caps;
+  return 256 * 1024;
+}
@@ -9,6 +9,7 @@
 // Global mock instances
 MockSerial Serial;
 MockSPI SPI;
+MockGpio Gpio;
 MockESP ESP;
 
 void MockSerial::printf(const char* fmt, ...) {
@@ -53,3 +54,9 @@ unsigned long millis() {
   static const auto start = steady_clock::now();
   return static_cast<unsigned long>(duration_cast<milliseconds>(steady_clock::now() - start).count());
 }
+
+unsigned long micros() {
+  using namespace std::chrono;
+  static const auto start = steady_clock::now();
+  return static_cast<unsigned long>(duration_cast<microseconds>(steady_clock::now() - start).count());
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <cstdarg>
 #include <cstdint>
@@ -20,20 +21,25 @@ struct SPISettings {
   SPISettings(uint32_t, int, int) {}
 };
 
-// Minimal SPI mock
+// Minimal SPI mock; tests can observe traffic through the optional hooks and the transaction count
 struct MockSPI {
+  void (*onTransfer)(uint8_t) = nullptr;
+  void (*onWriteBytes)(const uint8_t*, size_t) = nullptr;
+  size_t transactions = 0;
+
   void begin(int sclk = -1, int miso = -1, int mosi = -1, int ssel = -1) {
     (void)sclk;
     (void)miso;
     (void)mosi;
     (void)ssel;
   }
-  void beginTransaction(const SPISettings&) {}
+  void beginTransaction(const SPISettings&) { transactions++; }
   void endTransaction() {}
-  void transfer(uint8_t) {}
+  void transfer(uint8_t data) {
+    if (onTransfer) onTransfer(data);
+  }
   void writeBytes(const uint8_t* data, size_t length) {
-    (void)data;
-    (void)length;
+    if (onWriteBytes) onWriteBytes(data, length);
   }
 };
 
@@ -50,10 +56,33 @@ extern MockSPI SPI;
 // Forward-declare Arduino-like String used by test WString.h
 class String;
 
+// Mock GPIO: digitalRead() returns the last digitalWrite() level, except that a pin can be held HIGH for
+// a number of reads to model a peripheral's BUSY line
+struct MockGpio {
+  static constexpr int PIN_COUNT = 64;
+  int level[PIN_COUNT] = {};
+  int highReads[PIN_COUNT] = {};
+};
+
+extern MockGpio Gpio;
+
+// Arduino's min/max, which the core pulls in from <algorithm>
+using std::max;
+using std::min;
+
 // Arduino GPIO and timing stubs
 inline void pinMode(int, int) {}
-inline void digitalWrite(int, int) {}
-inline int digitalRead(int) { return 0; }
+inline void digitalWrite(int pin, int value) {
+  if (pin >= 0 && pin < MockGpio::PIN_COUNT) Gpio.level[pin] = value;
+}
+inline int digitalRead(int pin) {
+  if (pin < 0 || pin >= MockGpio::PIN_COUNT) return 0;
+  if (Gpio.highReads[pin] > 0) {
+    Gpio.highReads[pin]--;
+    return 1;
+  }
+  return Gpio.level[pin];
+}
 inline void delay(unsigned long) {}
 
 // Arduino constants
@@ -99,6 +128,7 @@ struct MockSerial : public Print {
     putchar(c);
     return 1;
   }
+  explicit operator bool() const { return true; }
 };
 
 extern MockSerial Serial;
@@ -112,8 +142,9 @@ struct MockESP {
 
 extern MockESP ESP;
 
-// Host millis() declaration
+// Host millis()/micros() declarations
 unsigned long millis();
+unsigned long micros();
 
 // strcasecmp for Windows
 #ifdef _WIN32
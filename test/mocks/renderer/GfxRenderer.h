@@ -0,0 +1,112 @@
+#pragma once
+
+// Layout-only GfxRenderer for host tests of the chapter parser: every codepoint is GLYPH_WIDTH wide,
+// lines are LINE_HEIGHT tall and drawing does nothing. Tests that use it put this directory ahead of
+// lib/GfxRenderer on the include path.
+
+#include <EpdFontFamily.h>
+#include <SdFat.h>
+
+#include <string>
+#include <vector>
+
+#include "Bitmap.h"
+
+class GfxRenderer {
+ public:
+  static constexpr int GLYPH_WIDTH = 8;
+  static constexpr int LINE_HEIGHT = 20;
+
+  struct Font {
+    const EpdFontFamily* family = nullptr;
+    int id = 0;
+    int ascender = 0;
+    int lineHeight = 0;
+    int spaceWidth = 0;
+    explicit operator bool() const { return family != nullptr; }
+  };
+
+  const Font& getFont(int fontId) const {
+    font_.id = fontId;
+    font_.ascender = LINE_HEIGHT - 4;
+    font_.lineHeight = LINE_HEIGHT;
+    font_.spaceWidth = GLYPH_WIDTH;
+    return font_;
+  }
+
+  int getTextWidth(const Font& font, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const {
+    return getTextWidth(font.id, text, style);
+  }
+  int getTextWidth(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const {
+    (void)fontId;
+    (void)style;
+    int width = 0;
+    for (const char* p = text; *p; p++) {
+      if ((static_cast<uint8_t>(*p) & 0xC0) != 0x80) width += GLYPH_WIDTH;
+    }
+    return width;
+  }
+  int getSpaceWidth(int fontId) const {
+    (void)fontId;
+    return GLYPH_WIDTH;
+  }
+  int getLineHeight(int fontId) const {
+    (void)fontId;
+    return LINE_HEIGHT;
+  }
+
+  // Splits at codepoint boundaries, ending every chunk but the last with "-"
+  std::vector<std::string> breakWordWithHyphenation(int fontId, const char* word, int maxWidth,
+                                                    EpdFontFamily::Style style = EpdFontFamily::REGULAR) const {
+    (void)fontId;
+    (void)style;
+    const int perChunk = maxWidth / GLYPH_WIDTH - 1 > 0 ? maxWidth / GLYPH_WIDTH - 1 : 1;
+    std::vector<std::string> chunks;
+    if (!word || *word == '\0') return chunks;
+    std::string chunk;
+    int count = 0;
+    for (const char* p = word; *p; p++) {
+      const bool lead = (static_cast<uint8_t>(*p) & 0xC0) != 0x80;
+      if (lead && count == perChunk) {
+        chunks.push_back(chunk + "-");
+        chunk.clear();
+        count = 0;
+      }
+      chunk += *p;
+      if (lead) count++;
+    }
+    chunks.push_back(chunk);
+    return chunks;
+  }
+
+  void drawText(const Font& font, int x, int y, const char* text, bool black = true,
+                EpdFontFamily::Style style = EpdFontFamily::REGULAR) const {
+    (void)font;
+    (void)x;
+    (void)y;
+    (void)text;
+    (void)black;
+    (void)style;
+  }
+  void drawText(int fontId, int x, int y, const char* text, bool black = true,
+                EpdFontFamily::Style style = EpdFontFamily::REGULAR) const {
+    drawText(getFont(fontId), x, y, text, black, style);
+  }
+  void drawBitmap(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight) const {
+    (void)bitmap;
+    (void)x;
+    (void)y;
+    (void)maxWidth;
+    (void)maxHeight;
+  }
+  bool drawPackedImage(FsFile& file, int x, int y) const {
+    (void)file;
+    (void)x;
+    (void)y;
+    return false;
+  }
+  void logWidthCacheStats() const {}
+
+ private:
+  mutable Font font_;
+};
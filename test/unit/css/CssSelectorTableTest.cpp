@@ -0,0 +1,281 @@
+#include "test_utils.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "CssSelectorTable.h"
+#include "CssStyle.h"
+
+// Checks CssSelectorTable and CssStyleMemo against the string-map lookup they replaced in
+// CssParser::getCombinedStyle, over a class-heavy chapter's start tags, and counts heap allocations
+// per element for each path (including the attribute copies startElement used to make).
+
+static size_t g_allocations = 0;
+
+void* operator new(size_t size) {
+  g_allocations++;
+  void* p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+namespace {
+
+using StyleMap = std::map<std::string, CssStyle>;
+
+// Mirrors the old CssParser::getStyleForClass / getCombinedStyle
+const CssStyle* getStyleForClass(const StyleMap& styleMap, const std::string& className) {
+  auto it = styleMap.find(className);
+  return it != styleMap.end() ? &it->second : nullptr;
+}
+
+CssStyle getCombinedStyleMap(const StyleMap& styleMap, const std::string& tagName, const std::string& classNames) {
+  CssStyle combined;
+  const CssStyle* tagStyle = getStyleForClass(styleMap, tagName);
+  if (tagStyle) combined.merge(*tagStyle);
+
+  size_t start = 0;
+  const size_t len = classNames.length();
+  while (start < len) {
+    while (start < len && std::isspace(static_cast<unsigned char>(classNames[start]))) ++start;
+    if (start >= len) break;
+    size_t end = start;
+    while (end < len && !std::isspace(static_cast<unsigned char>(classNames[end]))) ++end;
+    if (end > start) {
+      const std::string className = classNames.substr(start, end - start);
+      const CssStyle* classOnly = getStyleForClass(styleMap, "." + className);
+      if (classOnly) combined.merge(*classOnly);
+      const CssStyle* tagAndClass = getStyleForClass(styleMap, tagName + "." + className);
+      if (tagAndClass) combined.merge(*tagAndClass);
+    }
+    start = end;
+  }
+  return combined;
+}
+
+bool sameStyle(const CssStyle& a, const CssStyle& b) {
+  return a.textAlign == b.textAlign && a.hasTextAlign == b.hasTextAlign && a.fontStyle == b.fontStyle &&
+         a.hasFontStyle == b.hasFontStyle && a.fontWeight == b.fontWeight && a.hasFontWeight == b.hasFontWeight &&
+         a.textIndent == b.textIndent && a.hasTextIndent == b.hasTextIndent && a.marginTop == b.marginTop &&
+         a.hasMarginTop == b.hasMarginTop && a.marginBottom == b.marginBottom && a.hasMarginBottom == b.hasMarginBottom;
+}
+
+CssStyle align(TextAlign value) {
+  CssStyle style;
+  style.textAlign = value;
+  style.hasTextAlign = true;
+  return style;
+}
+
+CssStyle indent(float value) {
+  CssStyle style;
+  style.textIndent = value;
+  style.hasTextIndent = true;
+  return style;
+}
+
+CssStyle bold() {
+  CssStyle style;
+  style.fontWeight = CssFontWeight::Bold;
+  style.hasFontWeight = true;
+  return style;
+}
+
+CssStyle italic() {
+  CssStyle style;
+  style.fontStyle = CssFontStyle::Italic;
+  style.hasFontStyle = true;
+  return style;
+}
+
+// Rules as a converted-from-Word ebook stylesheet leaves them, including selectors that never match
+StyleMap makeStyleMap() {
+  StyleMap styles;
+  styles["p"] = indent(24.0f);
+  styles["h1"] = align(TextAlign::Center);
+  styles[".calibre1"] = align(TextAlign::Justify);
+  styles[".calibre2"] = indent(0.0f);
+  styles[".bold"] = bold();
+  styles[".italic"] = italic();
+  styles["p.noindent"] = indent(0.0f);
+  styles["p.center"] = align(TextAlign::Center);
+  styles["span.italic"] = bold();
+  styles[".chapter.title"] = align(TextAlign::Right);  // Class token "chapter.title"
+  styles["h1.title"] = italic();
+  styles["div p"] = bold();      // Descendant selector, never matched
+  styles["a:hover"] = italic();  // Pseudo-class, never matched
+  styles["#toc"] = align(TextAlign::Left);
+  for (int i = 0; i < 60; i++) styles[".s" + std::to_string(i)] = indent(static_cast<float>(i));
+  return styles;
+}
+
+struct Element {
+  const char* tag;
+  const char* classAttr;
+};
+
+// Start tags of a class-heavy chapter: a few combinations repeated, as Calibre output does
+std::vector<Element> makeChapter() {
+  const Element pattern[] = {
+      {"p", "calibre1"},
+      {"span", "italic bold"},
+      {"p", "calibre1 noindent"},
+      {"span", "s12"},
+      {"p", "calibre2  center "},
+      {"a", ""},
+      {"span", "italic"},
+      {"h1", "title chapter.title"},
+      {"p", "unknown-class calibre1 s59"},
+      {"div", "calibre1"},
+      {"p", "noindent"},
+      {"span", "s3 s4 s5"},
+      {"p", "\tcalibre2\n"},
+      {"img", "calibre-image-with-a-rather-long-generated-class-name"},
+  };
+  std::vector<Element> chapter;
+  for (int i = 0; i < 300; i++) {
+    for (const auto& e : pattern) chapter.push_back(e);
+  }
+  return chapter;
+}
+
+double perElement(size_t count, size_t elements) { return static_cast<double>(count) / elements; }
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("CSS Selector Table");
+  const StyleMap styles = makeStyleMap();
+  const auto chapter = makeChapter();
+
+  CssSelectorTable table;
+  table.build(styles);
+  runner.expectEq(static_cast<size_t>(73), table.selectorCount(), "Descendant selectors not compiled");
+
+  // Test 1: table and memo give the map's result for every element
+  {
+    CssStyleMemo memo;
+    bool tableMatches = true;
+    bool memoMatches = true;
+    for (const auto& e : chapter) {
+      const CssStyle expected = getCombinedStyleMap(styles, e.tag, e.classAttr);
+      if (!sameStyle(expected, table.getCombinedStyle(e.tag, e.classAttr))) tableMatches = false;
+      if (!sameStyle(expected, memo.getCombinedStyle(table, e.tag, e.classAttr))) memoMatches = false;
+    }
+    runner.expectTrue(tableMatches, "Selector table matches string map lookups");
+    runner.expectTrue(memoMatches, "Memoized lookups match string map lookups");
+  }
+
+  // Test 2: precedence - later classes override earlier, tag.class overrides .class
+  {
+    StyleMap precedence;
+    precedence[".a"] = align(TextAlign::Left);
+    precedence[".b"] = align(TextAlign::Right);
+    precedence["p.a"] = align(TextAlign::Center);
+    precedence["p"] = align(TextAlign::Justify);
+    CssSelectorTable t;
+    t.build(precedence);
+    runner.expectTrue(t.getCombinedStyle("p", "a").textAlign == TextAlign::Center, "tag.class beats .class");
+    runner.expectTrue(t.getCombinedStyle("p", "a b").textAlign == TextAlign::Right, "Later class wins");
+    runner.expectTrue(t.getCombinedStyle("p", "").textAlign == TextAlign::Justify, "Tag rule alone");
+    runner.expectTrue(t.getCombinedStyle("div", "a").textAlign == TextAlign::Left, "Other tag gets .class only");
+    runner.expectFalse(t.getCombinedStyle("p", "ab").textAlign == TextAlign::Left, "Class prefix doesn't match");
+    runner.expectFalse(t.getCombinedStyle("div", nullptr).hasTextAlign, "No class attribute");
+  }
+
+  // Test 3: the table alone round trips, so the parser can release its style map once compiled
+  {
+    StyleMap exported;
+    table.forEachSelector([&exported](const std::string& selector, const CssStyle& style) {
+      exported.emplace(selector, style);
+    });
+    runner.expectEq(table.selectorCount(), exported.size(), "Every compiled rule exported");
+    runner.expectTrue(exported.count(".chapter.title") == 1, "Dotted class token keeps its selector text");
+    CssSelectorTable rebuilt;
+    rebuilt.build(exported);
+    bool matches = true;
+    for (const auto& e : chapter) {
+      if (!sameStyle(table.getCombinedStyle(e.tag, e.classAttr), rebuilt.getCombinedStyle(e.tag, e.classAttr))) {
+        matches = false;
+      }
+    }
+    runner.expectTrue(matches, "Table rebuilt from its own export matches");
+
+    const CssStyle* tagAndClass = table.findStyle("p.noindent");
+    runner.expectTrue(tagAndClass && tagAndClass->hasTextIndent && tagAndClass->textIndent == 0.0f, "Finds tag.class");
+    runner.expectTrue(table.findStyle(".s42") != nullptr, "Finds .class");
+    runner.expectTrue(table.findStyle("h1") != nullptr, "Finds tag");
+    runner.expectTrue(table.findStyle("div p") == nullptr, "Uncompiled selector not found");
+    runner.expectTrue(table.findStyle("p.unknown") == nullptr, "Unknown class not found");
+  }
+
+  // Test 4: allocations per element
+  {
+    size_t before = g_allocations;
+    for (const auto& e : chapter) {
+      // startElement copied both attributes into strings before the lookup
+      const std::string classAttr = e.classAttr;
+      const std::string styleAttr;
+      getCombinedStyleMap(styles, e.tag, classAttr);
+    }
+    const size_t mapAllocs = g_allocations - before;
+
+    before = g_allocations;
+    for (const auto& e : chapter) table.getCombinedStyle(e.tag, e.classAttr);
+    const size_t tableAllocs = g_allocations - before;
+
+    CssStyleMemo memo;
+    before = g_allocations;
+    for (const auto& e : chapter) memo.getCombinedStyle(table, e.tag, e.classAttr);
+    const size_t memoAllocs = g_allocations - before;
+
+    std::cout << "\n    Path             Allocations/element\n";
+    printf("    %-16s %19.2f\n", "string map", perElement(mapAllocs, chapter.size()));
+    printf("    %-16s %19.2f\n", "selector table", perElement(tableAllocs, chapter.size()));
+    printf("    %-16s %19.2f\n", "table + memo", perElement(memoAllocs, chapter.size()));
+
+    runner.expectEq(static_cast<size_t>(0), tableAllocs, "Selector table lookups allocate nothing");
+    runner.expectTrue(memoAllocs <= 1, "Memo allocates its slots once per chapter",
+                      std::to_string(memoAllocs) + " allocations");
+    // Short names fit the string small-buffer; long class attributes and selector keys don't
+    runner.expectTrue(mapAllocs > 0, "String map allocated for long names", std::to_string(mapAllocs));
+  }
+
+  // Benchmark: lookups per second
+  {
+    constexpr int RUNS = 20;
+    auto time = [&](auto lookup) {
+      const auto start = std::chrono::steady_clock::now();
+      for (int r = 0; r < RUNS; r++) {
+        for (const auto& e : chapter) lookup(e);
+      }
+      const auto us =
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+      return us > 0 ? chapter.size() * RUNS * 1e6 / us : 0.0;
+    };
+    int sink = 0;
+    const double mapRate = time([&](const Element& e) {
+      sink += getCombinedStyleMap(styles, e.tag, std::string(e.classAttr)).hasTextAlign;
+    });
+    const double tableRate =
+        time([&](const Element& e) { sink += table.getCombinedStyle(e.tag, e.classAttr).hasTextAlign; });
+    CssStyleMemo memo;
+    const double memoRate =
+        time([&](const Element& e) { sink += memo.getCombinedStyle(table, e.tag, e.classAttr).hasTextAlign; });
+    printf("\n    Path             Elements/s\n");
+    printf("    %-16s %10.0f\n", "string map", mapRate);
+    printf("    %-16s %10.0f\n", "selector table", tableRate);
+    printf("    %-16s %10.0f\n\n", "table + memo", memoRate);
+    (void)sink;
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+#include "test_utils.h"
+
+#include <CssParser.h>
+#include <SDCardManager.h>
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+
+// Round trips the real CssParser::saveToCache / loadFromCache (the css.bin written next to book.bin) through
+// the mock card: every compiled rule, value and has-flag survives, and a cache from another version, a
+// truncated or otherwise damaged one is rejected without leaving a partial table behind.
+
+namespace {
+
+const char* const CSS_PATH = "/book/style.css";
+const char* const CACHE_PATH = "/book/css.bin";
+
+// Mirrors the layout CssParser.cpp writes: version byte, then the rule count
+constexpr uint8_t STYLE_CACHE_VERSION = 1;
+constexpr uint32_t MAX_CACHED_RULES = 8192;
+
+// A stylesheet like a typical ebook ships; the table drops the descendant selector, margin-top: 0 leaves no flag
+const char* const STYLESHEET =
+    "p { text-indent: 1.5em; text-align: justify; }\n"
+    ".center { text-align: center; }\n"
+    "h2.chapter-title { font-weight: bold; margin-top: 2em; margin-bottom: 1em; }\n"
+    ".emphasis, em.strong { font-style: italic; }\n"
+    ".noindent { text-indent: -3.5px; margin-top: 0; }\n"
+    "div p { text-align: right; }\n"
+    "a:hover { font-weight: bold; }\n";
+
+using StyleMap = std::map<std::string, CssStyle>;
+
+StyleMap compiledRules(const CssParser& parser) {
+  StyleMap rules;
+  parser.getSelectorTable().forEachSelector(
+      [&rules](const std::string& selector, const CssStyle& style) { rules[selector] = style; });
+  return rules;
+}
+
+bool sameStyle(const CssStyle& a, const CssStyle& b) {
+  return a.textAlign == b.textAlign && a.hasTextAlign == b.hasTextAlign && a.fontStyle == b.fontStyle &&
+         a.hasFontStyle == b.hasFontStyle && a.fontWeight == b.fontWeight && a.hasFontWeight == b.hasFontWeight &&
+         a.textIndent == b.textIndent && a.hasTextIndent == b.hasTextIndent && a.marginTop == b.marginTop &&
+         a.hasMarginTop == b.hasMarginTop && a.marginBottom == b.marginBottom && a.hasMarginBottom == b.hasMarginBottom;
+}
+
+bool sameRules(const StyleMap& a, const StyleMap& b) {
+  if (a.size() != b.size()) return false;
+  for (const auto& entry : a) {
+    const auto it = b.find(entry.first);
+    if (it == b.end() || !sameStyle(entry.second, it->second)) return false;
+  }
+  return true;
+}
+
+// Loading damaged bytes must fail and leave the parser without styles, even one that had some before
+bool rejects(const std::string& bytes) {
+  SdMan.writeFile(CACHE_PATH, bytes);
+  CssParser parser;
+  SdMan.writeFile(CSS_PATH, ".stale { text-align: center; }");
+  parser.parseFile(CSS_PATH);
+  const bool ok = parser.loadFromCache(CACHE_PATH);
+  return !ok && !parser.hasStyles() && parser.getStyleCount() == 0;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("CSS Style Cache");
+  SdMan.clear();
+  SdMan.writeFile(CSS_PATH, STYLESHEET);
+
+  CssParser parsed;
+  runner.expectTrue(parsed.parseFile(CSS_PATH), "Stylesheet parses");
+  const StyleMap rules = compiledRules(parsed);
+  runner.expectTrue(rules.size() >= 5, "Stylesheet compiles to several rules", std::to_string(rules.size()));
+  runner.expectTrue(parsed.saveToCache(CACHE_PATH), "Style table saves");
+  runner.expectFalse(SdMan.exists((std::string(CACHE_PATH) + ".tmp").c_str()), "Temporary file renamed away");
+  const std::string good = SdMan.readFile(CACHE_PATH);
+
+  // Test 1: round trip restores every rule, value and has-flag
+  {
+    CssParser loaded;
+    runner.expectTrue(loaded.loadFromCache(CACHE_PATH), "Style table loads");
+    runner.expectEq(parsed.getStyleCount(), loaded.getStyleCount(), "Same number of rules");
+    runner.expectTrue(sameRules(rules, compiledRules(loaded)), "Loaded table identical to the compiled one");
+    runner.expectTrue(sameStyle(parsed.getCombinedStyle("h2", "chapter-title emphasis"),
+                                loaded.getCombinedStyle("h2", "chapter-title emphasis")),
+                      "Combined lookups agree after the round trip");
+
+    // Saving what was loaded reproduces the file byte for byte
+    runner.expectTrue(loaded.saveToCache(CACHE_PATH), "Loaded table saves again");
+    runner.expectTrue(SdMan.readFile(CACHE_PATH) == good, "Second save is byte-identical");
+  }
+
+  // Test 2: an empty table still round trips (books with no stylesheets keep a valid cache)
+  {
+    CssParser empty;
+    runner.expectTrue(empty.saveToCache("/book/empty.bin"), "Empty table saves");
+    CssParser loaded;
+    runner.expectTrue(loaded.loadFromCache("/book/empty.bin"), "Empty table loads");
+    runner.expectFalse(loaded.hasStyles(), "Empty table has no rules");
+  }
+
+  // Test 3: stale or damaged caches are rejected and leave no partial table
+  {
+    std::string otherVersion = good;
+    otherVersion[0] = STYLE_CACHE_VERSION + 1;
+    runner.expectTrue(rejects(otherVersion), "Other cache version rejected");
+    runner.expectTrue(rejects(good.substr(0, good.size() - 3)), "Truncated cache rejected");
+    runner.expectTrue(rejects(good.substr(0, 3)), "Cache truncated inside the header rejected");
+    runner.expectTrue(rejects(""), "Empty file rejected");
+
+    std::string hugeCount = good;
+    const uint32_t count = MAX_CACHED_RULES + 1;
+    memcpy(&hugeCount[1], &count, sizeof(count));
+    runner.expectTrue(rejects(hugeCount), "Implausible rule count rejected");
+
+    // First rule's textAlign byte: version, count, selector length + selector, flags
+    uint32_t firstSelectorLen = 0;
+    memcpy(&firstSelectorLen, &good[1 + 4], sizeof(firstSelectorLen));
+    std::string badEnum = good;
+    badEnum[1 + 4 + 4 + firstSelectorLen + 1] = 42;
+    runner.expectTrue(rejects(badEnum), "Out-of-range enum rejected");
+
+    SdMan.remove(CACHE_PATH);
+    CssParser missing;
+    runner.expectFalse(missing.loadFromCache(CACHE_PATH), "Missing cache rejected");
+  }
+
+  SdMan.clear();
+  return runner.allPassed() ? 0 : 1;
+}
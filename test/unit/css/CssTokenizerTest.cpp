@@ -0,0 +1,260 @@
+#include "test_utils.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Include mocks
+#include "SdFat.h"
+
+#include "CssTokenizer.h"
+
+// Checks CssTokenizer against the byte-at-a-time loop it replaced in CssParser::parseFile (file.read() per
+// byte with a one-byte pushback for comment detection), feeding the same stylesheet in blocks of every
+// size so comments, strings and rules split across block boundaries. Also times both read patterns.
+
+namespace {
+
+using Rules = std::vector<std::string>;
+
+// Mirrors the old CssParser::parseFile loop; records untrimmed (selector, properties) pairs
+Rules parseByteAtATime(FsFile& file) {
+  Rules rules;
+  std::string selector;
+  std::string properties;
+  bool inComment = false;
+  bool inAtRule = false;
+  bool inRule = false;
+  bool inString = false;
+  char stringQuote = 0;
+  int braceCount = 0;
+
+  int pushback = -1;
+  while (file.available() || pushback != -1) {
+    char c;
+    if (pushback != -1) {
+      c = static_cast<char>(pushback);
+      pushback = -1;
+    } else {
+      c = static_cast<char>(file.read());
+    }
+
+    if (!inComment && c == '/') {
+      int next = -1;
+      if (file.available()) next = file.read();
+      if (next == '*') {
+        inComment = true;
+        continue;
+      }
+      if (next != -1) pushback = next;
+    }
+
+    if (inComment) {
+      if (c == '*') {
+        int next = -1;
+        if (file.available()) next = file.read();
+        if (next == '/') {
+          inComment = false;
+        } else if (next != -1) {
+          pushback = next;
+        }
+      }
+      continue;
+    }
+
+    if (c == '\r') continue;
+
+    if (!inRule) {
+      if (inAtRule) {
+        if (c == '{') {
+          braceCount++;
+        } else if (c == '}') {
+          if (braceCount > 0) {
+            braceCount--;
+            if (braceCount == 0) inAtRule = false;
+          }
+        } else if (c == ';' && braceCount == 0) {
+          inAtRule = false;
+        }
+        continue;
+      }
+      if (c == '@') {
+        inAtRule = true;
+        braceCount = 0;
+        continue;
+      }
+      if (c == '{') {
+        inRule = true;
+        braceCount = 1;
+        properties.clear();
+        continue;
+      }
+      selector += c;
+    } else {
+      if (!inString && (c == '"' || c == '\'')) {
+        inString = true;
+        stringQuote = c;
+        properties += c;
+        continue;
+      } else if (inString && c == stringQuote) {
+        inString = false;
+        stringQuote = 0;
+        properties += c;
+        continue;
+      }
+      if (!inString) {
+        if (c == '{') {
+          braceCount++;
+          properties += c;
+          continue;
+        } else if (c == '}') {
+          braceCount--;
+          if (braceCount == 0) {
+            rules.push_back(selector + "|" + properties);
+            selector.clear();
+            properties.clear();
+            inRule = false;
+            continue;
+          }
+        }
+      }
+      properties += c;
+    }
+  }
+
+  if (inRule && !properties.empty()) rules.push_back(selector + "|" + properties);
+  return rules;
+}
+
+// Block reads as CssParser::parseFile now does them
+Rules parseBlocks(FsFile& file, size_t blockSize) {
+  Rules rules;
+  CssTokenizer tokenizer([&rules](const std::string& selector, const std::string& properties) {
+    rules.push_back(selector + "|" + properties);
+  });
+  std::vector<uint8_t> block(blockSize);
+  int n;
+  while ((n = file.read(block.data(), block.size())) > 0) {
+    tokenizer.feed(reinterpret_cast<const char*>(block.data()), n);
+  }
+  tokenizer.finish();
+  return rules;
+}
+
+const char* const TRICKY_CSS =
+    "/* Publisher stylesheet */\r\n"
+    "@charset \"utf-8\";\n"
+    "@import url(\"fonts.css\");\n"
+    "body { font: 12px/1.5 serif; background: url(img/bg.png) }\n"
+    "p.note, .aside{text-indent:1em;/* inline */margin-top:1em}\n"
+    "@media screen and (min-width: 600px) { p { text-align: left } h1 { font-weight: bold } }\n"
+    "h1 { content: \"a } b /* not a comment */\"; text-align: center }\n"
+    "h2 { content: 'it''s'; font-style: italic }\n"
+    "/**/ .a/**/{ text-align : justify } /***/\n"
+    "div / p { margin-bottom: 2em }\n"
+    "span { x: 1 } / / /*/ still comment */ .b { font-weight: 700 }\n"
+    "@font-face { font-family: X; src: url(x.ttf) }\n"
+    ".unterminated { text-align: right; margin-top: 1em /";
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("CSS Tokenizer");
+
+  // Test 1: every block size gives the old loop's rules
+  {
+    FsFile file;
+    file.setBuffer(TRICKY_CSS);
+    const Rules expected = parseByteAtATime(file);
+    runner.expectEq(static_cast<size_t>(9), expected.size(), "Reference loop finds the stylesheet's rules");
+
+    bool allMatch = true;
+    size_t firstMismatch = 0;
+    const size_t length = std::string(TRICKY_CSS).size();
+    for (size_t blockSize = 1; blockSize <= length + 1; blockSize++) {
+      file.seek(0);
+      if (parseBlocks(file, blockSize) != expected) {
+        if (allMatch) firstMismatch = blockSize;
+        allMatch = false;
+      }
+    }
+    runner.expectTrue(allMatch, "Rules identical for every block size",
+                      allMatch ? "" : "first mismatch at block size " + std::to_string(firstMismatch));
+  }
+
+  // Test 2: comment and string handling
+  {
+    auto rulesOf = [](const std::string& css) {
+      Rules rules;
+      CssTokenizer tokenizer([&rules](const std::string& selector, const std::string& properties) {
+        rules.push_back(selector + "|" + properties);
+      });
+      tokenizer.feed(css.data(), css.size());
+      tokenizer.finish();
+      return rules;
+    };
+    runner.expectTrue(rulesOf("a{b:c}") == Rules{"a|b:c"}, "Simple rule");
+    runner.expectTrue(rulesOf("/* a{b:c} */d{e:f}") == Rules{"d|e:f"}, "Rule inside comment dropped");
+    runner.expectTrue(rulesOf("a{b:\"}\"}") == Rules{"a|b:\"}\""}, "Brace inside string kept");
+    runner.expectTrue(rulesOf("@media x { a{b:c} } d{e:f}") == Rules{" d|e:f"}, "Nested at-rule skipped");
+    runner.expectTrue(rulesOf("a{b:1/2}") == Rules{"a|b:1/2"}, "Slash in value kept");
+    runner.expectTrue(rulesOf("a{b:c").size() == 1, "Unterminated rule flushed at EOF");
+    runner.expectTrue(rulesOf("a{b:c}/").size() == 1, "Trailing slash harmless");
+  }
+
+  // Test 3: the tokenizer is reusable after finish()
+  {
+    Rules rules;
+    CssTokenizer tokenizer([&rules](const std::string& selector, const std::string& properties) {
+      rules.push_back(selector + "|" + properties);
+    });
+    const std::string first = "a{b:c} /* open comment";
+    const std::string second = "d{e:f}";
+    tokenizer.feed(first.data(), first.size());
+    tokenizer.finish();
+    tokenizer.feed(second.data(), second.size());
+    tokenizer.finish();
+    runner.expectTrue(rules == Rules{"a|b:c", "d|e:f"}, "State reset between stylesheets");
+  }
+
+  // Benchmark: a 100+ KB publisher stylesheet, byte reads vs 512-byte block reads
+  {
+    std::string big;
+    int i = 0;
+    while (big.size() < 120 * 1024) {
+      big += "/* section " + std::to_string(i) + " */\n.calibre" + std::to_string(i) +
+             ", p.c" + std::to_string(i) + " {\n  text-indent: 1.5em;\n  margin-top: 0.5em;\n"
+             "  font-family: \"Georgia\", serif;\n  text-align: justify\n}\n";
+      i++;
+    }
+    FsFile file;
+    file.setBuffer(big);
+
+    constexpr int RUNS = 5;
+    size_t byteRules = 0;
+    size_t blockRules = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; r++) {
+      file.seek(0);
+      byteRules = parseByteAtATime(file).size();
+    }
+    const auto byteUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; r++) {
+      file.seek(0);
+      blockRules = parseBlocks(file, 512).size();
+    }
+    const auto blockUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    printf("\n    Stylesheet: %zu bytes, %zu rules\n", big.size(), blockRules);
+    printf("    %-18s %10.1f ms\n", "byte reads", byteUs / 1000.0 / RUNS);
+    printf("    %-18s %10.1f ms\n\n", "512-byte blocks", blockUs / 1000.0 / RUNS);
+    runner.expectEq(byteRules, blockRules, "Large stylesheet: same rule count");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
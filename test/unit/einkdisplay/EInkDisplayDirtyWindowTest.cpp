@@ -0,0 +1,263 @@
+#include "test_utils.h"
+
+#include <EInkDisplay.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Runs typical UI transitions through the single buffer EInkDisplay against a model of the SSD1677 RAM
+// (address window, X-increment/Y-decrement counters, BW and RED planes) and counts the bytes each one
+// sends over SPI. Every fast refresh used to send the whole frame to BW RAM and then sync it to RED RAM;
+// with dirty windows only the changed rectangle goes out, and the model RAM must still match the frame.
+// Each plane or window is streamed in DMA-sized chunks within a single SPI transaction.
+
+namespace {
+
+constexpr int8_t PIN_DC = 4;
+constexpr int8_t PIN_BUSY = 6;
+constexpr int WIDTH = EInkDisplay::DISPLAY_WIDTH;
+constexpr int HEIGHT = EInkDisplay::DISPLAY_HEIGHT;
+constexpr int WIDTH_BYTES = EInkDisplay::DISPLAY_WIDTH_BYTES;
+constexpr size_t FULL_FAST_REFRESH_BYTES = EInkDisplay::BUFFER_SIZE * 2;  // BW write + RED sync
+
+struct Controller {
+  std::vector<uint8_t> bw = std::vector<uint8_t>(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> red = std::vector<uint8_t>(EInkDisplay::BUFFER_SIZE);
+  uint8_t command = 0;
+  uint8_t params[4] = {};
+  int paramCount = 0;
+  int xStart = 0, xEnd = WIDTH - 1, yStart = HEIGHT - 1, yEnd = 0;
+  int xCounter = 0, yCounter = HEIGHT - 1;
+  int refreshes = 0;
+  size_t ramBytes = 0;
+  uint8_t updateMode = 0;  // Last Display Update Control 2 value
+
+  void onCommand(const uint8_t cmd) {
+    command = cmd;
+    paramCount = 0;
+    if (cmd == 0x20) {
+      refreshes++;
+      Gpio.highReads[PIN_BUSY] = 10;
+    }
+  }
+
+  void onData(const uint8_t data) {
+    if (command == 0x24 || command == 0x26) {
+      // Gates are reversed: frame row 0 is gate HEIGHT - 1
+      (command == 0x24 ? bw : red)[(HEIGHT - 1 - yCounter) * WIDTH_BYTES + xCounter / 8] = data;
+      ramBytes++;
+      xCounter += 8;
+      if (xCounter > xEnd) {
+        // Past the end of the window the counters wrap back to its start
+        xCounter = xStart;
+        if (--yCounter < yEnd) yCounter = yStart;
+      }
+      return;
+    }
+    if (command == 0x22) updateMode = data;
+    if (paramCount < 4) params[paramCount] = data;
+    paramCount++;
+    if (command == 0x44 && paramCount == 4) {
+      xStart = params[0] | params[1] << 8;
+      xEnd = params[2] | params[3] << 8;
+    } else if (command == 0x45 && paramCount == 4) {
+      yStart = params[0] | params[1] << 8;
+      yEnd = params[2] | params[3] << 8;
+    } else if (command == 0x4E && paramCount == 2) {
+      xCounter = params[0] | params[1] << 8;
+    } else if (command == 0x4F && paramCount == 2) {
+      yCounter = params[0] | params[1] << 8;
+    }
+  }
+} controller;
+
+void onTransfer(const uint8_t data) {
+  if (Gpio.level[PIN_DC] == LOW) {
+    controller.onCommand(data);
+  } else {
+    controller.onData(data);
+  }
+}
+
+size_t chunkCount = 0;
+size_t largestChunk = 0;
+
+void onWriteBytes(const uint8_t* data, const size_t length) {
+  chunkCount++;
+  largestChunk = std::max(largestChunk, length);
+  for (size_t i = 0; i < length; i++) controller.onData(data[i]);
+}
+
+EInkDisplay display(8, 10, 21, PIN_DC, 5, PIN_BUSY);
+
+// Portrait UI coordinates, as GfxRenderer::rotateCoordinates maps them onto the panel
+void fillPortrait(const int x, const int y, const int w, const int h, const bool black) {
+  uint8_t* frame = display.getFrameBuffer();
+  for (int py = y; py < y + h; py++) {
+    for (int px = x; px < x + w; px++) {
+      const int panelX = py;
+      const int panelY = HEIGHT - 1 - px;
+      uint8_t& byte = frame[panelY * WIDTH_BYTES + panelX / 8];
+      const uint8_t bit = 1 << (7 - panelX % 8);
+      byte = black ? (byte & ~bit) : (byte | bit);
+    }
+  }
+}
+
+void drawText(const int x, const int y, const int w, const int h, uint32_t seed) {
+  for (int py = y; py < y + h; py += 2) {
+    for (int px = x; px < x + w; px += 3) {
+      seed = seed * 1103515245 + 12345;
+      if ((seed >> 16) % 3 == 0) fillPortrait(px, py, 2, 2, true);
+    }
+  }
+}
+
+struct Transition {
+  int refreshes;
+  size_t bytes;
+  size_t transactions;
+};
+
+Transition show() {
+  const int refreshes = controller.refreshes;
+  const size_t bytes = controller.ramBytes;
+  const size_t transactions = SPI.transactions;
+  display.displayBuffer(EInkDisplay::FAST_REFRESH);
+  return {controller.refreshes - refreshes, controller.ramBytes - bytes, SPI.transactions - transactions};
+}
+
+bool ramMatchesFrame() {
+  const uint8_t* frame = display.getFrameBuffer();
+  return std::equal(controller.bw.begin(), controller.bw.end(), frame) &&
+         std::equal(controller.red.begin(), controller.red.end(), frame);
+}
+
+void report(const char* name, const Transition& t) {
+  printf("    %-22s %6zu -> %6zu bytes\n", name, FULL_FAST_REFRESH_BYTES, t.bytes);
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("EInkDisplayDirtyWindow");
+
+  SPI.onTransfer = onTransfer;
+  SPI.onWriteBytes = onWriteBytes;
+  display.begin();
+
+  // A menu: eight items, a status bar and a battery icon
+  display.clearScreen(0xFF);
+  for (int item = 0; item < 8; item++) drawText(20, 120 + item * 60, 440, 30, item + 1);
+  fillPortrait(430, 8, 40, 18, true);
+  display.displayBuffer(EInkDisplay::HALF_REFRESH);
+  runner.expectTrue(ramMatchesFrame(), "Full refresh fills both planes");
+
+  printf("\n    SPI bytes per fast refresh (before -> after):\n");
+
+  // Test 1: Moving the menu cursor only sends the two rows it touches
+  {
+    fillPortrait(0, 115, 480, 40, true);
+    const Transition first = show();
+    fillPortrait(0, 115, 480, 40, false);
+    drawText(20, 120, 440, 30, 1);
+    fillPortrait(0, 175, 480, 40, true);
+    const Transition t = show();
+    report("Menu cursor move", t);
+    runner.expectEq(1, first.refreshes, "Cursor shown");
+    runner.expectEq(1, t.refreshes, "Cursor moved");
+    runner.expectTrue(t.bytes < FULL_FAST_REFRESH_BYTES / 4, "Cursor move sends a window");
+    // 480 window rows per plane, but one transaction for each
+    runner.expectTrue(t.transactions < 100, "Window rows share a transaction");
+    runner.expectTrue(ramMatchesFrame(), "RAM matches after cursor move");
+  }
+
+  // Test 2: A battery icon tick sends a few hundred bytes
+  {
+    fillPortrait(432, 10, 10, 14, false);
+    const Transition t = show();
+    report("Battery icon tick", t);
+    runner.expectEq(1, t.refreshes, "Battery refreshed");
+    runner.expectTrue(t.bytes < 1024, "Battery tick is tiny");
+    runner.expectTrue(ramMatchesFrame(), "RAM matches after battery tick");
+  }
+
+  // Test 3: A status bar page number
+  {
+    drawText(200, 775, 60, 20, 42);
+    const Transition t = show();
+    report("Status bar page number", t);
+    runner.expectTrue(t.bytes < 2 * 8 * HEIGHT, "Page number sends one column band");
+    runner.expectTrue(ramMatchesFrame(), "RAM matches after page number");
+  }
+
+  // Test 4: Redrawing the same frame sends nothing and skips the refresh
+  {
+    const Transition t = show();
+    report("Unchanged redraw", t);
+    runner.expectEq(0, t.refreshes, "No refresh");
+    runner.expectEq(static_cast<size_t>(0), t.bytes, "No bytes");
+  }
+
+  // Test 5: A page turn changes most of the screen and goes out whole
+  {
+    display.clearScreen(0xFF);
+    drawText(10, 10, 460, 760, 99);
+    chunkCount = 0;
+    largestChunk = 0;
+    const Transition t = show();
+    report("Page turn", t);
+    runner.expectEq(FULL_FAST_REFRESH_BYTES, t.bytes, "Full frame fallback");
+    // 48000 bytes per plane as 11 chunks of 4092 and one of 2988
+    runner.expectEq(static_cast<size_t>(24), chunkCount, "Planes streamed in chunks");
+    runner.expectEq(static_cast<size_t>(4092), largestChunk, "Chunks fit a DMA descriptor");
+    runner.expectTrue(ramMatchesFrame(), "RAM matches after page turn");
+  }
+
+  // Test 6: Changes in opposite corners are sent as their bounding window
+  {
+    fillPortrait(0, 0, 8, 8, true);
+    fillPortrait(472, 792, 8, 8, true);
+    const Transition t = show();
+    runner.expectEq(FULL_FAST_REFRESH_BYTES, t.bytes, "Bounding window spans the frame");
+    fillPortrait(100, 300, 8, 8, true);
+    fillPortrait(140, 340, 8, 8, true);
+    const Transition small = show();
+    runner.expectEq(static_cast<size_t>(2 * 8 * 48), small.bytes, "Bounding window of two marks");
+    runner.expectTrue(ramMatchesFrame(), "RAM matches after scattered marks");
+  }
+
+  // Test 7: After a grayscale pass the displayed frame is unknown, so the next refresh is full
+  {
+    display.displayGrayBuffer();
+    display.cleanupGrayscaleBuffers(display.getFrameBuffer());
+    fillPortrait(432, 10, 10, 14, true);
+    const Transition t = show();
+    runner.expectEq(FULL_FAST_REFRESH_BYTES, t.bytes, "Full refresh after grayscale");
+    runner.expectTrue(ramMatchesFrame(), "RAM matches after grayscale");
+  }
+
+  // Test 8: An unchanged frame skips the refresh but still powers the panel down when asked
+  {
+    const int activations = controller.refreshes;
+    const size_t bytes = controller.ramBytes;
+    display.displayBuffer(EInkDisplay::FAST_REFRESH, true);
+    runner.expectEq(static_cast<size_t>(0), controller.ramBytes - bytes, "Unchanged frame sends no RAM");
+    runner.expectEq(1, controller.refreshes - activations, "Power-down activated");
+    runner.expectEq(0x03, static_cast<int>(controller.updateMode), "Only the power-off bits");
+    // A panel that was powered down can't fast refresh against RED RAM
+    fillPortrait(432, 10, 10, 14, false);
+    const Transition t = show();
+    // Half refresh: both planes, then the RED sync after it
+    runner.expectEq(static_cast<size_t>(3 * EInkDisplay::BUFFER_SIZE), t.bytes,
+                    "Next refresh after power-down is half");
+    runner.expectTrue((controller.updateMode & 0xC0) == 0xC0, "Next refresh powers the panel back on");
+    runner.expectTrue(ramMatchesFrame(), "RAM matches after power-down");
+  }
+
+  printf("\n");
+  return runner.allPassed() ? 0 : 1;
+}
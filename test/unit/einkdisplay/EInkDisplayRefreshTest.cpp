@@ -0,0 +1,126 @@
+#include "test_utils.h"
+
+#include <EInkDisplay.h>
+
+#include <cstdint>
+#include <string>
+
+// Drives the single buffer EInkDisplay against a mock SSD1677: MASTER_ACTIVATION (0x20) holds the BUSY line
+// HIGH for WAVEFORM_READS polls, and every command sent while it is still HIGH is counted as lost. Checks
+// that startDisplayBuffer() leaves the waveform running for the caller and that whatever comes next (an
+// explicit wait, a panel command, drawing the next page) finishes it and the RED RAM sync first. Every refresh
+// shows a new full-screen frame, since an unchanged one is skipped and a small change is sent as a window.
+
+namespace {
+
+constexpr int8_t PIN_DC = 4;
+constexpr int8_t PIN_BUSY = 6;
+constexpr int WAVEFORM_READS = 200;
+constexpr uint8_t CMD_MASTER_ACTIVATION = 0x20;
+constexpr uint8_t CMD_WRITE_RAM_BW = 0x24;
+constexpr uint8_t CMD_WRITE_RAM_RED = 0x26;
+
+struct Panel {
+  int refreshes = 0;
+  int commandsWhileBusy = 0;
+  uint8_t lastCommand = 0;
+  size_t bwBytes = 0;
+  size_t redBytes = 0;
+  bool redAllWhite = true;
+} panel;
+
+void onTransfer(const uint8_t data) {
+  if (Gpio.level[PIN_DC] != LOW) return;
+  if (Gpio.highReads[PIN_BUSY] > 0) panel.commandsWhileBusy++;
+  panel.lastCommand = data;
+  if (data == CMD_MASTER_ACTIVATION) {
+    panel.refreshes++;
+    Gpio.highReads[PIN_BUSY] = WAVEFORM_READS;
+  }
+}
+
+void onWriteBytes(const uint8_t* data, const size_t length) {
+  if (panel.lastCommand == CMD_WRITE_RAM_BW) {
+    panel.bwBytes += length;
+  } else if (panel.lastCommand == CMD_WRITE_RAM_RED) {
+    panel.redBytes += length;
+    for (size_t i = 0; i < length; i++) panel.redAllWhite &= data[i] == 0xFF;
+  }
+}
+
+void resetPanel() { panel = Panel(); }
+
+EInkDisplay display(8, 10, 21, PIN_DC, 5, PIN_BUSY);
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("EInkDisplayRefresh");
+
+  SPI.onTransfer = onTransfer;
+  SPI.onWriteBytes = onWriteBytes;
+  display.begin();
+
+  // Test 1: displayBuffer() still blocks until the panel is idle and RED RAM holds the frame
+  {
+    resetPanel();
+    display.displayBuffer(EInkDisplay::HALF_REFRESH);
+    runner.expectEq(1, panel.refreshes, "One refresh");
+    runner.expectFalse(display.isRefreshing(), "Idle on return");
+    runner.expectEq(0, Gpio.highReads[PIN_BUSY], "BUSY waited out");
+    runner.expectEq(static_cast<size_t>(EInkDisplay::BUFFER_SIZE), panel.bwBytes, "BW RAM written");
+    runner.expectEq(static_cast<size_t>(EInkDisplay::BUFFER_SIZE * 2), panel.redBytes, "RED written and synced");
+    runner.expectEq(0, panel.commandsWhileBusy, "No command while busy");
+  }
+
+  // Test 2: startDisplayBuffer() returns with the waveform running; the caller's work overlaps it
+  {
+    display.clearScreen(0x00);
+    resetPanel();
+    display.startDisplayBuffer(EInkDisplay::FAST_REFRESH);
+    runner.expectEq(1, panel.refreshes, "Refresh started");
+    runner.expectTrue(display.isRefreshing(), "Refreshing on return");
+    runner.expectEq(static_cast<size_t>(0), panel.redBytes, "RED sync deferred");
+
+    int overlappedWork = 1;
+    while (display.isRefreshing()) overlappedWork++;
+    runner.expectEq(WAVEFORM_READS, overlappedWork, "Work ran for the whole waveform");
+
+    display.waitForRefresh();
+    runner.expectEq(static_cast<size_t>(EInkDisplay::BUFFER_SIZE), panel.redBytes, "RED synced after wait");
+    runner.expectEq(0, panel.commandsWhileBusy, "No command while busy");
+
+    display.waitForRefresh();
+    runner.expectEq(static_cast<size_t>(EInkDisplay::BUFFER_SIZE), panel.redBytes, "Second wait is a no-op");
+  }
+
+  // Test 3: Drawing the next page waits, so the RED sync still sees the displayed frame
+  {
+    display.clearScreen(0xFF);
+    resetPanel();
+    display.startDisplayBuffer(EInkDisplay::FAST_REFRESH);
+    display.clearScreen(0x00);
+    runner.expectFalse(display.isRefreshing(), "Drawing finished the refresh");
+    runner.expectEq(static_cast<size_t>(EInkDisplay::BUFFER_SIZE), panel.redBytes, "RED synced before drawing");
+    runner.expectTrue(panel.redAllWhite, "RED holds the displayed frame");
+    runner.expectEq(0x00, static_cast<int>(display.getFrameBuffer()[0]), "Next page drawn");
+  }
+
+  // Test 4: Any panel command finishes a pending refresh before it is sent
+  {
+    resetPanel();
+    display.startDisplayBuffer(EInkDisplay::FAST_REFRESH);
+    display.cleanupGrayscaleBuffers(display.getFrameBuffer());
+    display.clearScreen(0xFF);
+    display.startDisplayBuffer(EInkDisplay::FAST_REFRESH);
+    display.displayGrayBuffer();
+    display.clearScreen(0x00);
+    display.startDisplayBuffer(EInkDisplay::FAST_REFRESH);
+    display.deepSleep();
+    runner.expectEq(5, panel.refreshes, "Every refresh ran");
+    runner.expectFalse(display.isRefreshing(), "Idle after deep sleep");
+    runner.expectEq(0, panel.commandsWhileBusy, "No command while busy");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,295 @@
+#include "test_utils.h"
+
+#include <GfxRenderer.h>
+#include <Html5Normalizer.h>
+#include <Page.h>
+#include <SDCardManager.h>
+#include <parsers/ChapterHtmlSlimParser.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Drives the real ChapterHtmlSlimParser and VoidElementNormalizer across suspend/resume boundaries the way
+// EpubChapterParser does: the raw chapter streams through the normalizer into the parser, the page limit stops
+// it, the checkpoint goes through serialize/deserialize on the card, and the next chunk resumes either from the
+// spilled tail or by streaming the raw chapter again from a normalizer sync point. The pages of every chunked
+// parse must be byte-identical to an uninterrupted one. Layout runs on the fixed-pitch host renderer.
+
+namespace {
+
+const char* const SPILL_PATH = "/chapter.norm.html";
+const char* const CHECKPOINT_PATH = "/chapter.ckpt";
+
+RenderConfig testConfig() { return RenderConfig(1, 1.0f, 1, 1, 0, false, false, 240, 200); }
+
+// HTML5-style chapter: void elements without a slash, inline styles crossing paragraphs, entities, <pre>
+std::string buildChapter() {
+  std::string html =
+      "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+      "<html xmlns=\"http://www.w3.org/1999/xhtml\">\n"
+      "<head><title>Resume</title><meta charset=\"utf-8\"><link rel=\"stylesheet\" href=\"s.css\"></head>\n"
+      "<body>\n<h1>Chapter One</h1>\n<div class=\"text\">\n";
+  for (int i = 0; i < 60; i++) {
+    html += "<p>Paragraph " + std::to_string(i) + " opens with plain words &amp; entities, then ";
+    html += (i % 3 == 0) ? "<b>a bold run that goes on for a while <i>and turns italic</i></b>"
+                         : "<i>an italic run</i>";
+    html += " before it ends.<br>Second line after a break, with a longwordthatmustbehyphenatedacrosslines";
+    html += " and caf\xC3\xA9 text.</p>\n";
+    if (i % 7 == 6) html += "<hr><pre>  keep   spacing\n  as is</pre>\n";
+    if (i % 11 == 10) html += "<img src=\"images/fig.png\" alt=\"figure\">\n";
+  }
+  html += "</div>\n</body>\n</html>\n";
+  return html;
+}
+
+std::string serializePage(const Page& page) {
+  FsFile file;
+  file.setBuffer("");
+  page.serialize(file);
+  return file.getBuffer();
+}
+
+// Pushes the raw chapter into out in odd-sized pieces, like the ZIP inflater
+bool pushChapter(const std::string& raw, const size_t from, Print& out) {
+  constexpr size_t PIECE = 173;
+  for (size_t pos = from; pos < raw.size(); pos += PIECE) {
+    const size_t len = std::min(PIECE, raw.size() - pos);
+    if (out.write(reinterpret_cast<const uint8_t*>(raw.data() + pos), len) != len) return false;
+  }
+  return true;
+}
+
+std::vector<std::string> parseUninterrupted(GfxRenderer& renderer, const std::string& raw) {
+  std::vector<std::string> pages;
+  const std::string path = SPILL_PATH;
+  ChapterHtmlSlimParser parser(path, renderer, testConfig(), [&pages](std::unique_ptr<Page> page) {
+    pages.push_back(serializePage(*page));
+    return true;
+  });
+  parser.setStreamSource(
+      [&raw](Print& out) {
+        html5::VoidElementNormalizer normalizer(out);
+        return pushChapter(raw, 0, normalizer) && normalizer.finish();
+      },
+      path);
+  if (!parser.parseAndBuildPages()) pages.clear();
+  return pages;
+}
+
+// Round trip through the card, as PageCache does between chunks
+std::unique_ptr<ChapterCheckpoint> storeAndReload(const ChapterCheckpoint& checkpoint) {
+  FsFile out;
+  if (!SdMan.openFileForWrite("TEST", CHECKPOINT_PATH, out)) return nullptr;
+  const bool ok = checkpoint.serialize(out);
+  out.close();
+  FsFile in;
+  if (!ok || !SdMan.openFileForRead("TEST", CHECKPOINT_PATH, in)) return nullptr;
+  auto loaded = ChapterCheckpoint::deserialize(in);
+  in.close();
+  return loaded;
+}
+
+enum class ResumeFrom { Spill, Stream, Alternate };
+
+struct ChunkedResult {
+  std::vector<std::string> pages;
+  int chunks = 0;
+  int streamedResumes = 0;
+  bool ok = true;
+};
+
+// Mirrors EpubChapterParser::parsePages: maxPages per chunk, resuming from the spill or from the raw chapter
+ChunkedResult parseChunked(GfxRenderer& renderer, const std::string& raw, const uint16_t maxPages,
+                           const ResumeFrom mode) {
+  SdMan.clear();
+  ChunkedResult result;
+  std::unique_ptr<ChapterCheckpoint> resumeFrom;
+  html5::VoidElementNormalizer::SyncPoint resync = {0, 0};
+  uint32_t retainedBase = 0;
+  const std::string spillPath = SPILL_PATH;
+
+  while (result.chunks < 1000) {
+    const bool resuming = resumeFrom != nullptr;
+    const bool stream = !resuming || mode == ResumeFrom::Stream || (mode == ResumeFrom::Alternate && result.chunks % 2);
+    uint16_t pagesCreated = 0;
+    bool hitMaxPages = false;
+    std::unique_ptr<html5::VoidElementNormalizer> normalizer;
+
+    ChapterHtmlSlimParser parser(spillPath, renderer, testConfig(), [&](std::unique_ptr<Page> page) {
+      if (hitMaxPages) return false;
+      result.pages.push_back(serializePage(*page));
+      if (++pagesCreated >= maxPages) {
+        hitMaxPages = true;
+        if (normalizer) normalizer->holdSyncPoints();
+        return false;
+      }
+      return true;
+    });
+
+    if (stream) {
+      const auto start = resync;
+      const uint32_t resumeOffset = resuming ? resumeFrom->inputOffset : 0;
+      if (resuming) {
+        parser.setSourceOffset(resumeOffset);
+        parser.setResumeFrom(std::move(resumeFrom));
+        result.streamedResumes++;
+      }
+      parser.setStreamSource(
+          [&raw, &normalizer, start, resumeOffset](Print& out) {
+            normalizer.reset(new html5::VoidElementNormalizer(out, start, resumeOffset));
+            return pushChapter(raw, start.input, *normalizer) && normalizer->finish();
+          },
+          spillPath);
+    } else {
+      parser.setSourceOffset(retainedBase);
+      parser.setResumeFrom(std::move(resumeFrom));
+    }
+
+    result.ok = parser.parseAndBuildPages() && result.ok;
+    result.chunks++;
+    if (!hitMaxPages) break;
+
+    auto checkpoint = parser.takeCheckpoint();
+    if (!checkpoint) {
+      result.ok = false;
+      break;
+    }
+    html5::VoidElementNormalizer::SyncPoint point;
+    if (normalizer && normalizer->syncPointBefore(checkpoint->inputOffset, &point)) {
+      resync = point;
+    }
+    if (stream) retainedBase = checkpoint->inputOffset;
+    resumeFrom = storeAndReload(*checkpoint);
+    if (!resumeFrom) {
+      result.ok = false;
+      break;
+    }
+  }
+  return result;
+}
+
+bool samePages(const std::vector<std::string>& expected, const std::vector<std::string>& actual) {
+  if (expected.size() != actual.size()) return false;
+  for (size_t i = 0; i < expected.size(); i++) {
+    if (expected[i] != actual[i]) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("ChapterParserResume");
+
+  GfxRenderer renderer;
+  const std::string raw = buildChapter();
+  const std::vector<std::string> reference = parseUninterrupted(renderer, raw);
+
+  // Test 1: The uninterrupted parse produces enough pages to split and leaves nothing on the card
+  {
+    runner.expectTrue(reference.size() > 20, "Reference parse spans many pages");
+    runner.expectFalse(SdMan.exists(SPILL_PATH), "No spill without a page limit");
+  }
+
+  // Test 2: The file pass the stream replaced parses to the same pages
+  {
+    SdMan.clear();
+    SdMan.writeFile("/raw.html", raw);
+    runner.expectTrue(html5::normalizeVoidElements("/raw.html", SPILL_PATH), "File normalize succeeds");
+    std::vector<std::string> pages;
+    const std::string path = SPILL_PATH;
+    ChapterHtmlSlimParser parser(path, renderer, testConfig(), [&pages](std::unique_ptr<Page> page) {
+      pages.push_back(serializePage(*page));
+      return true;
+    });
+    runner.expectTrue(parser.parseAndBuildPages(), "File parse succeeds");
+    runner.expectTrue(samePages(reference, pages), "File parse matches streamed parse");
+  }
+
+  // Test 3: Resuming from the spilled tail reproduces the uninterrupted pages
+  for (const uint16_t maxPages : {1, 2, 5}) {
+    const auto result = parseChunked(renderer, raw, maxPages, ResumeFrom::Spill);
+    const std::string label = "Spill resume, " + std::to_string(maxPages) + " pages per chunk";
+    runner.expectTrue(result.ok, label + ": every chunk parses");
+    runner.expectTrue(result.chunks > 2, label + ": parse was split");
+    runner.expectTrue(samePages(reference, result.pages), label + ": pages match");
+  }
+
+  // Test 4: Streaming the raw chapter again from the sync point reproduces the uninterrupted pages
+  for (const uint16_t maxPages : {1, 3}) {
+    const auto result = parseChunked(renderer, raw, maxPages, ResumeFrom::Stream);
+    const std::string label = "Stream resume, " + std::to_string(maxPages) + " pages per chunk";
+    runner.expectTrue(result.ok, label + ": every chunk parses");
+    runner.expectEq(result.chunks - 1, result.streamedResumes, label + ": every resume streamed");
+    runner.expectTrue(samePages(reference, result.pages), label + ": pages match");
+  }
+
+  // Test 5: Alternating between the two keeps the retained base and the sync point consistent
+  {
+    const auto result = parseChunked(renderer, raw, 2, ResumeFrom::Alternate);
+    runner.expectTrue(result.ok, "Alternating resume: every chunk parses");
+    runner.expectTrue(result.streamedResumes > 1, "Alternating resume: some resumes streamed");
+    runner.expectTrue(samePages(reference, result.pages), "Alternating resume: pages match");
+  }
+
+  // Test 6: A checkpoint that doesn't survive the card (truncated) is rejected rather than resumed
+  {
+    SdMan.clear();
+    std::vector<std::string> pages;
+    const std::string path = SPILL_PATH;
+    ChapterHtmlSlimParser parser(path, renderer, testConfig(), [&pages](std::unique_ptr<Page> page) {
+      pages.push_back(serializePage(*page));
+      return pages.size() < 2;
+    });
+    parser.setStreamSource(
+        [&raw](Print& out) {
+          html5::VoidElementNormalizer normalizer(out);
+          return pushChapter(raw, 0, normalizer) && normalizer.finish();
+        },
+        path);
+    parser.parseAndBuildPages();
+    auto checkpoint = parser.takeCheckpoint();
+    runner.expectTrue(checkpoint != nullptr, "Page limit leaves a checkpoint");
+    runner.expectTrue(SdMan.exists(SPILL_PATH), "Page limit spills the tail");
+    if (checkpoint) {
+      FsFile out;
+      SdMan.openFileForWrite("TEST", CHECKPOINT_PATH, out);
+      checkpoint->serialize(out);
+      out.close();
+      const std::string full = SdMan.readFile(CHECKPOINT_PATH);
+      FsFile in;
+      in.setBuffer(full.substr(0, full.size() / 2));
+      runner.expectTrue(ChapterCheckpoint::deserialize(in) == nullptr, "Truncated checkpoint is rejected");
+    }
+  }
+
+  // Test 7: Pending words that don't fit on the card fail to serialize instead of leaving a short record
+  {
+    ParsedText text(TextBlock::JUSTIFIED, 1, true, false);
+    for (const char* word : {"Pending", "words", "caf\xC3\xA9", "\xE6\x97\xA5\xE6\x9C\xAC"}) {
+      text.addWord(word, EpdFontFamily::ITALIC);
+    }
+    FsFile full;
+    full.setBuffer("");
+    runner.expectTrue(text.serialize(full), "Pending words serialize");
+    const std::string bytes = full.getBuffer();
+    FsFile in;
+    in.setBuffer(bytes);
+    const auto loaded = ParsedText::deserialize(in);
+    runner.expectTrue(loaded && loaded->size() == text.size(), "Pending words round trip");
+
+    bool everyCutFails = true;
+    for (size_t limit = 0; limit < bytes.size(); limit++) {
+      FsFile out;
+      out.setBuffer("");
+      out.setWriteLimit(limit);
+      if (text.serialize(out)) everyCutFails = false;
+    }
+    runner.expectTrue(everyCutFails, "Short write anywhere in the record fails serialize");
+  }
+
+  SdMan.clear();
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,356 @@
+#include "test_utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "KnuthPlass.h"
+
+// Checks the bounded-window KnuthPlass engine against a full-paragraph DP using the same integer
+// demerits, against the float DP it replaced in ParsedText::computeLineBreaks, and times both
+// alongside greedy breaking on a 5000-word paragraph with peak heap use per engine.
+
+static size_t g_liveBytes = 0;
+static size_t g_peakBytes = 0;
+
+void* operator new(size_t size) {
+  auto* p = static_cast<size_t*>(malloc(sizeof(size_t) * 2 + size));
+  if (!p) throw std::bad_alloc();
+  p[0] = size;
+  g_liveBytes += size;
+  if (g_liveBytes > g_peakBytes) g_peakBytes = g_liveBytes;
+  return p + 2;
+}
+void operator delete(void* p) noexcept {
+  if (!p) return;
+  auto* header = static_cast<size_t*>(p) - 2;
+  g_liveBytes -= header[0];
+  free(header);
+}
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+
+namespace {
+
+using Breaks = std::vector<size_t>;
+using Widths = std::vector<uint16_t>;
+
+// Mirrors the old ParsedText::computeLineBreaks (float demerits, n+1 arrays)
+constexpr float INFINITY_PENALTY = 10000.0f;
+constexpr float LINE_PENALTY = 50.0f;
+
+float calculateBadness(int lineWidth, int targetWidth) {
+  if (targetWidth <= 0) return INFINITY_PENALTY;
+  if (lineWidth > targetWidth) return INFINITY_PENALTY;
+  if (lineWidth == targetWidth) return 0.0f;
+  float ratio = static_cast<float>(targetWidth - lineWidth) / static_cast<float>(targetWidth);
+  return ratio * ratio * ratio * 100.0f;
+}
+
+float calculateDemerits(float badness, bool isLastLine) {
+  if (badness >= INFINITY_PENALTY) return INFINITY_PENALTY;
+  if (isLastLine) return 0.0f;
+  return (1.0f + badness) * (1.0f + badness);
+}
+
+Breaks computeLineBreaksFloat(int pageWidth, int spaceWidth, const Widths& wordWidths) {
+  const size_t n = wordWidths.size();
+  if (n == 0) return {};
+
+  std::vector<float> minDemerits(n + 1, INFINITY_PENALTY);
+  std::vector<int> prevBreak(n + 1, -1);
+  minDemerits[0] = 0.0f;
+
+  for (size_t i = 0; i < n; i++) {
+    if (minDemerits[i] >= INFINITY_PENALTY) continue;
+    int lineWidth = -spaceWidth;
+    for (size_t j = i; j < n; j++) {
+      lineWidth += wordWidths[j] + spaceWidth;
+      if (lineWidth > pageWidth) {
+        if (j == i) {
+          float demerits = 100.0f + LINE_PENALTY;
+          if (minDemerits[i] + demerits < minDemerits[j + 1]) {
+            minDemerits[j + 1] = minDemerits[i] + demerits;
+            prevBreak[j + 1] = static_cast<int>(i);
+          }
+        }
+        break;
+      }
+      float demerits = calculateDemerits(calculateBadness(lineWidth, pageWidth), j == n - 1) + LINE_PENALTY;
+      if (minDemerits[i] + demerits < minDemerits[j + 1]) {
+        minDemerits[j + 1] = minDemerits[i] + demerits;
+        prevBreak[j + 1] = static_cast<int>(i);
+      }
+    }
+  }
+
+  Breaks breaks;
+  int pos = static_cast<int>(n);
+  while (pos > 0 && prevBreak[pos] >= 0) {
+    breaks.push_back(static_cast<size_t>(pos));
+    pos = prevBreak[pos];
+  }
+  std::reverse(breaks.begin(), breaks.end());
+  if (breaks.empty() || pos != 0) {
+    breaks.clear();
+    for (size_t i = 1; i <= n; i++) breaks.push_back(i);
+  }
+  return breaks;
+}
+
+// Full-paragraph DP with KnuthPlass's integer demerits: what the windowed engine must reproduce
+Breaks computeLineBreaksFull(int pageWidth, int spaceWidth, const Widths& wordWidths) {
+  const size_t n = wordWidths.size();
+  std::vector<uint64_t> minDemerits(n + 1, UINT64_MAX);
+  std::vector<size_t> prevBreak(n + 1, 0);
+  minDemerits[0] = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (minDemerits[i] == UINT64_MAX) continue;
+    int lineWidth = -spaceWidth;
+    for (size_t j = i; j < n; j++) {
+      lineWidth += wordWidths[j] + spaceWidth;
+      uint64_t demerits;
+      if (lineWidth > pageWidth) {
+        if (j != i) break;
+        demerits = KnuthPlass::OVERSIZED_DEMERITS;
+      } else {
+        demerits = KnuthPlass::lineDemerits(lineWidth, pageWidth, j == n - 1);
+      }
+      if (minDemerits[i] + demerits < minDemerits[j + 1]) {
+        minDemerits[j + 1] = minDemerits[i] + demerits;
+        prevBreak[j + 1] = i;
+      }
+      if (lineWidth > pageWidth) break;
+    }
+  }
+  Breaks breaks;
+  for (size_t pos = n; pos > 0; pos = prevBreak[pos]) breaks.push_back(pos);
+  std::reverse(breaks.begin(), breaks.end());
+  return breaks;
+}
+
+Breaks computeLineBreaksGreedy(int pageWidth, int spaceWidth, const Widths& wordWidths) {
+  Breaks breaks;
+  int lineWidth = -spaceWidth;
+  for (size_t i = 0; i < wordWidths.size(); i++) {
+    if (lineWidth + wordWidths[i] + spaceWidth > pageWidth && lineWidth > 0) {
+      breaks.push_back(i);
+      lineWidth = wordWidths[i];
+    } else {
+      lineWidth += wordWidths[i] + spaceWidth;
+    }
+  }
+  breaks.push_back(wordWidths.size());
+  return breaks;
+}
+
+// Total float demerits of a set of breaks under the old cost function
+float floatDemerits(int pageWidth, int spaceWidth, const Widths& widths, const Breaks& breaks) {
+  float total = 0.0f;
+  size_t start = 0;
+  for (size_t b = 0; b < breaks.size(); b++) {
+    int lineWidth = -spaceWidth;
+    for (size_t i = start; i < breaks[b]; i++) lineWidth += widths[i] + spaceWidth;
+    if (lineWidth > pageWidth) {
+      total += 100.0f + LINE_PENALTY;
+    } else {
+      total += calculateDemerits(calculateBadness(lineWidth, pageWidth), b == breaks.size() - 1) + LINE_PENALTY;
+    }
+    start = breaks[b];
+  }
+  return total;
+}
+
+// Every line fits or holds a single word, and breaks run in order to the last word
+bool validBreaks(int pageWidth, int spaceWidth, const Widths& widths, const Breaks& breaks) {
+  if (breaks.empty() || breaks.back() != widths.size()) return false;
+  size_t start = 0;
+  for (const size_t end : breaks) {
+    if (end <= start) return false;
+    int lineWidth = -spaceWidth;
+    for (size_t i = start; i < end; i++) lineWidth += widths[i] + spaceWidth;
+    if (lineWidth > pageWidth && end - start > 1) return false;
+    start = end;
+  }
+  return true;
+}
+
+// Word widths of English prose in a ~20px serif: mostly short words, the occasional long one
+Widths makeParagraph(size_t words, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> letters(1, 12);
+  std::uniform_int_distribution<int> letterWidth(7, 13);
+  Widths widths;
+  widths.reserve(words);
+  for (size_t i = 0; i < words; i++) {
+    int width = 0;
+    const int count = letters(rng) / (i % 3 == 0 ? 2 : 1) + 1;
+    for (int c = 0; c < count; c++) width += letterWidth(rng);
+    widths.push_back(static_cast<uint16_t>(width));
+  }
+  return widths;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Knuth-Plass");
+  constexpr int PAGE_WIDTH = 464;
+  constexpr int SPACE_WIDTH = 6;
+
+  // Test 1: windowed engine reproduces the full-paragraph DP
+  {
+    bool allMatch = true;
+    bool allValid = true;
+    size_t peak = 0;
+    for (uint32_t seed = 1; seed <= 40; seed++) {
+      const Widths widths = makeParagraph(seed * 50, seed);
+      KnuthPlass engine(PAGE_WIDTH, SPACE_WIDTH);
+      const Breaks breaks = engine.breakLines(widths);
+      if (breaks != computeLineBreaksFull(PAGE_WIDTH, SPACE_WIDTH, widths)) allMatch = false;
+      if (!validBreaks(PAGE_WIDTH, SPACE_WIDTH, widths, breaks)) allValid = false;
+      if (engine.peakNodes() > peak) peak = engine.peakNodes();
+    }
+    runner.expectTrue(allMatch, "Same breaks as the full-paragraph DP (50-2000 words)");
+    runner.expectTrue(allValid, "Every line fits");
+    runner.expectTrue(peak <= KnuthPlass::MAX_NODES, "Node pool stays bounded", std::to_string(peak) + " nodes");
+  }
+
+  // Test 2: fixed-point demerits choose breaks as good as the old float DP
+  {
+    bool asGood = true;
+    size_t identical = 0;
+    constexpr int PARAGRAPHS = 200;
+    for (uint32_t seed = 1; seed <= PARAGRAPHS; seed++) {
+      const Widths widths = makeParagraph(20 + seed % 100, seed * 7919);
+      const Breaks oldBreaks = computeLineBreaksFloat(PAGE_WIDTH, SPACE_WIDTH, widths);
+      const Breaks newBreaks = KnuthPlass(PAGE_WIDTH, SPACE_WIDTH).breakLines(widths);
+      const float oldTotal = floatDemerits(PAGE_WIDTH, SPACE_WIDTH, widths, oldBreaks);
+      const float newTotal = floatDemerits(PAGE_WIDTH, SPACE_WIDTH, widths, newBreaks);
+      if (newTotal > oldTotal * 1.001f + 0.01f) asGood = false;
+      if (oldBreaks == newBreaks) identical++;
+    }
+    runner.expectTrue(asGood, "Float demerits within 0.1% of the float DP");
+    runner.expectTrue(identical >= PARAGRAPHS * 95 / 100, "Breaks identical for short paragraphs",
+                      std::to_string(identical) + "/" + std::to_string(PARAGRAPHS));
+  }
+
+  // Test 3: edge cases
+  {
+    KnuthPlass engine(100, 5);
+    runner.expectTrue(engine.breakLines({}).empty(), "Empty paragraph");
+    runner.expectTrue(engine.breakLines({40}) == Breaks{1}, "Single word");
+    runner.expectTrue(engine.breakLines({30, 150, 30}) == Breaks{1, 2, 3}, "Oversized word on its own line");
+    runner.expectTrue(engine.breakLines({150, 150}) == Breaks{1, 2}, "Consecutive oversized words");
+    runner.expectTrue(engine.breakLines({50, 45}) == Breaks{2}, "Exact fit on one line");
+    runner.expectTrue(KnuthPlass(0, 5).breakLines({10, 10}) == Breaks{1, 2}, "Zero page width");
+
+    int calls = 0;
+    const Widths widths = makeParagraph(500, 3);
+    runner.expectTrue(engine.breakLines(widths, [&calls] { return ++calls > 2; }).empty(), "Abort returns empty");
+
+    runner.expectEq(KnuthPlass::LINE_PENALTY, KnuthPlass::lineDemerits(10, 100, true), "Last line pays penalty only");
+    runner.expectEq(KnuthPlass::ONE + KnuthPlass::LINE_PENALTY, KnuthPlass::lineDemerits(100, 100, false),
+                    "Tight line: (1 + 0)^2 + penalty");
+    runner.expectTrue(KnuthPlass::lineDemerits(50, 100, false) > KnuthPlass::lineDemerits(90, 100, false),
+                      "Looser line costs more");
+  }
+
+  // Test 4: hundreds of breakpoints within one line force early commits but stay bounded
+  {
+    const Widths widths(3000, 1);
+    KnuthPlass engine(2000, 0);
+    const Breaks breaks = engine.breakLines(widths);
+    runner.expectTrue(validBreaks(2000, 0, widths, breaks), "Dense breakpoints: valid breaks");
+    runner.expectTrue(engine.peakNodes() <= KnuthPlass::MAX_NODES, "Dense breakpoints: pool bounded",
+                      std::to_string(engine.peakNodes()) + " nodes");
+  }
+
+  // Test 5: streaming - emitting final lines as words arrive, with bounded buffering, vs the whole paragraph
+  {
+    constexpr size_t STREAM_WORDS = 200;  // ParsedText::STREAM_LAYOUT_WORDS
+    const Widths paragraph = makeParagraph(20000, 99);
+    const Breaks whole = KnuthPlass(PAGE_WIDTH, SPACE_WIDTH).breakLines(paragraph);
+
+    // Mirrors ParsedText: buffer words, emit all but the open tail, drop the emitted words
+    Breaks streamed;
+    Widths buffered;
+    size_t dropped = 0;
+    size_t peakBuffered = 0;
+    size_t wordsBeforeFirstLine = 0;
+    for (size_t i = 0; i < paragraph.size(); i++) {
+      buffered.push_back(paragraph[i]);
+      peakBuffered = std::max(peakBuffered, buffered.size());
+      if (buffered.size() < STREAM_WORDS) continue;
+      const Breaks partial = KnuthPlass(PAGE_WIDTH, SPACE_WIDTH).breakLines(buffered, nullptr, false);
+      if (partial.size() < 2) continue;
+      if (streamed.empty()) wordsBeforeFirstLine = i + 1;
+      for (size_t b = 0; b + 1 < partial.size(); b++) streamed.push_back(dropped + partial[b]);
+      const size_t emitted = partial[partial.size() - 2];
+      buffered.erase(buffered.begin(), buffered.begin() + emitted);
+      dropped += emitted;
+    }
+    for (const size_t b : KnuthPlass(PAGE_WIDTH, SPACE_WIDTH).breakLines(buffered)) streamed.push_back(dropped + b);
+
+    Breaks shared;
+    std::set_intersection(streamed.begin(), streamed.end(), whole.begin(), whole.end(), std::back_inserter(shared));
+    const float streamedDemerits = floatDemerits(PAGE_WIDTH, SPACE_WIDTH, paragraph, streamed);
+    const float wholeDemerits = floatDemerits(PAGE_WIDTH, SPACE_WIDTH, paragraph, whole);
+    printf("\n    20000 words: %zu lines, %zu breaks shared, demerits %.0f streamed vs %.0f whole\n\n",
+           whole.size(), shared.size(), streamedDemerits, wholeDemerits);
+    runner.expectTrue(validBreaks(PAGE_WIDTH, SPACE_WIDTH, paragraph, streamed), "Streamed breaks valid");
+    runner.expectTrue(streamedDemerits <= wholeDemerits * 1.01f, "Streamed layout within 1% of whole paragraph");
+    runner.expectTrue(peakBuffered <= STREAM_WORDS, "Buffered words bounded", std::to_string(peakBuffered));
+    runner.expectEq(STREAM_WORDS, wordsBeforeFirstLine, "First lines emitted after one batch");
+
+    const Breaks tail = KnuthPlass(PAGE_WIDTH, SPACE_WIDTH).breakLines({40, 40}, nullptr, false);
+    runner.expectTrue(tail == Breaks{2}, "Short partial paragraph: only the open tail");
+  }
+
+  // Benchmark: a 5000-word paragraph
+  {
+    const Widths widths = makeParagraph(5000, 42);
+    constexpr int RUNS = 5;
+    struct Result {
+      double ms;
+      size_t peakBytes;
+      size_t lines;
+      float demerits;
+    };
+    auto measure = [&](auto engine) {
+      Breaks breaks;
+      const size_t baseline = g_liveBytes;
+      g_peakBytes = g_liveBytes;
+      const auto start = std::chrono::steady_clock::now();
+      for (int r = 0; r < RUNS; r++) breaks = engine();
+      const auto us =
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+      // Peak includes the returned breaks vector, which every engine allocates alike
+      return Result{us / 1000.0 / RUNS, g_peakBytes - baseline, breaks.size(),
+                    floatDemerits(PAGE_WIDTH, SPACE_WIDTH, widths, breaks)};
+    };
+    const Result dp = measure([&] { return computeLineBreaksFloat(PAGE_WIDTH, SPACE_WIDTH, widths); });
+    const Result full = measure([&] { return computeLineBreaksFull(PAGE_WIDTH, SPACE_WIDTH, widths); });
+    const Result greedy = measure([&] { return computeLineBreaksGreedy(PAGE_WIDTH, SPACE_WIDTH, widths); });
+    const Result kp = measure([&] { return KnuthPlass(PAGE_WIDTH, SPACE_WIDTH).breakLines(widths); });
+
+    printf("\n    Engine               Time     Peak heap   Lines   Demerits\n");
+    printf("    %-16s %6.2f ms %8zu B %7zu %10.0f\n", "float DP", dp.ms, dp.peakBytes, dp.lines, dp.demerits);
+    printf("    %-16s %6.2f ms %8zu B %7zu %10.0f\n", "full DP, int", full.ms, full.peakBytes, full.lines,
+           full.demerits);
+    printf("    %-16s %6.2f ms %8zu B %7zu %10.0f\n", "greedy", greedy.ms, greedy.peakBytes, greedy.lines,
+           greedy.demerits);
+    printf("    %-16s %6.2f ms %8zu B %7zu %10.0f\n\n", "KnuthPlass", kp.ms, kp.peakBytes, kp.lines, kp.demerits);
+
+    runner.expectTrue(kp.demerits <= greedy.demerits, "Knuth-Plass beats greedy on demerits");
+    runner.expectTrue(kp.peakBytes < dp.peakBytes, "Less peak heap than the float DP");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
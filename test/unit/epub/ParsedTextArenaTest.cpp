@@ -0,0 +1,309 @@
+#include "test_utils.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// Compares heap allocations of ParsedText's word storage before and after the paragraph arena:
+// list<std::string> words with per-line WordData strings vs one byte arena with slices and one text
+// buffer per TextBlock line. Mirrors the addWord -> calculateWordWidths -> extractLine pipeline with a
+// fake fixed-advance font, so only the storage strategy differs.
+
+static size_t g_allocations = 0;
+
+void* operator new(size_t size) {
+  g_allocations++;
+  void* p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+namespace {
+
+constexpr unsigned char SOFT_HYPHEN_BYTE1 = 0xC2;
+constexpr unsigned char SOFT_HYPHEN_BYTE2 = 0xAD;
+constexpr int PAGE_WIDTH = 460;
+constexpr int SPACE_WIDTH = 5;
+
+enum Style : uint8_t { REGULAR = 0, BOLD = 1, ITALIC = 2 };
+
+int textWidth(const char* text) { return 7 * static_cast<int>(strlen(text)); }
+
+std::string stripSoftHyphens(const std::string& word) {
+  std::string result;
+  result.reserve(word.size());
+  size_t i = 0;
+  while (i < word.size()) {
+    if (i + 1 < word.size() && static_cast<unsigned char>(word[i]) == SOFT_HYPHEN_BYTE1 &&
+        static_cast<unsigned char>(word[i + 1]) == SOFT_HYPHEN_BYTE2) {
+      i += 2;
+    } else {
+      result += word[i++];
+    }
+  }
+  return result;
+}
+
+std::vector<size_t> greedyBreaks(const std::vector<uint16_t>& widths) {
+  std::vector<size_t> breaks;
+  int lineWidth = 0;
+  for (size_t i = 0; i < widths.size(); i++) {
+    const int add = lineWidth == 0 ? widths[i] : widths[i] + SPACE_WIDTH;
+    if (lineWidth > 0 && lineWidth + add > PAGE_WIDTH) {
+      breaks.push_back(i);
+      lineWidth = widths[i];
+    } else {
+      lineWidth += add;
+    }
+  }
+  breaks.push_back(widths.size());
+  return breaks;
+}
+
+// Rendered form of a line, used to check both storages lay out identical text
+void describe(std::string& out, const char* word, uint16_t xpos) {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "@%u:", xpos);
+  out += buf;
+  out += word;
+  out += ' ';
+}
+
+// ---- Storage before the arena ----
+
+struct LegacyWordData {
+  std::string word;
+  uint16_t xPos;
+  Style style;
+};
+
+struct LegacyTextBlock {
+  std::vector<LegacyWordData> wordData;
+  explicit LegacyTextBlock(std::vector<LegacyWordData> data) : wordData(std::move(data)) {}
+};
+
+struct LegacyParsedText {
+  std::list<std::string> words;
+  std::list<Style> wordStyles;
+
+  void addWord(std::string word, Style style) {
+    if (word.empty()) return;
+    words.push_back(std::move(word));
+    wordStyles.push_back(style);
+  }
+
+  void layout(std::vector<std::string>* rendered) {
+    std::vector<uint16_t> widths;
+    widths.reserve(words.size());
+    for (auto& word : words) {
+      std::string displayWord = stripSoftHyphens(word);
+      widths.push_back(textWidth(displayWord.c_str()));
+      word = std::move(displayWord);
+    }
+    const auto breaks = greedyBreaks(widths);
+    size_t lastBreak = 0;
+    for (const size_t lineBreak : breaks) {
+      std::vector<LegacyWordData> lineData;
+      lineData.reserve(lineBreak - lastBreak);
+      auto wordIt = words.begin();
+      auto styleIt = wordStyles.begin();
+      uint16_t xpos = 0;
+      for (size_t i = lastBreak; i < lineBreak; i++) {
+        lineData.push_back({std::move(*wordIt), xpos, *styleIt});
+        xpos += widths[i] + SPACE_WIDTH;
+        ++wordIt;
+        ++styleIt;
+      }
+      words.erase(words.begin(), wordIt);
+      wordStyles.erase(wordStyles.begin(), styleIt);
+      const auto block = std::make_shared<LegacyTextBlock>(std::move(lineData));
+      if (rendered) {
+        std::string line;
+        for (const auto& wd : block->wordData) describe(line, wd.word.c_str(), wd.xPos);
+        rendered->push_back(line);
+      }
+      lastBreak = lineBreak;
+    }
+  }
+};
+
+// ---- Arena storage (mirrors ParsedText / TextBlock) ----
+
+struct WordData {
+  uint16_t offset;
+  uint16_t xPos;
+  Style style;
+};
+
+struct TextBlock {
+  std::string text;
+  std::vector<WordData> wordData;
+  TextBlock(std::string text, std::vector<WordData> data) : text(std::move(text)), wordData(std::move(data)) {}
+};
+
+struct ArenaParsedText {
+  struct WordSlice {
+    uint32_t offset;
+    uint16_t len;
+    Style style;
+  };
+  std::vector<char> wordBytes;
+  std::vector<WordSlice> words;
+
+  void addWord(const char* word, size_t len, Style style) {
+    if (len == 0) return;
+    words.push_back({static_cast<uint32_t>(wordBytes.size()), static_cast<uint16_t>(len), style});
+    wordBytes.insert(wordBytes.end(), word, word + len);
+    wordBytes.push_back('\0');
+  }
+
+  void layout(std::vector<std::string>* rendered) {
+    std::vector<uint16_t> widths;
+    widths.reserve(words.size());
+    for (auto& word : words) {
+      char* text = wordBytes.data() + word.offset;
+      size_t out = 0;
+      for (size_t i = 0; i < word.len; i++) {
+        if (i + 1 < word.len && static_cast<unsigned char>(text[i]) == SOFT_HYPHEN_BYTE1 &&
+            static_cast<unsigned char>(text[i + 1]) == SOFT_HYPHEN_BYTE2) {
+          i++;
+          continue;
+        }
+        text[out++] = text[i];
+      }
+      text[out] = '\0';
+      word.len = static_cast<uint16_t>(out);
+      widths.push_back(textWidth(text));
+    }
+    const auto breaks = greedyBreaks(widths);
+    size_t lastBreak = 0;
+    for (const size_t lineBreak : breaks) {
+      size_t lineBytes = 0;
+      for (size_t i = lastBreak; i < lineBreak; i++) lineBytes += words[i].len + 1;
+      std::string lineText;
+      lineText.reserve(lineBytes);
+      std::vector<WordData> lineData;
+      lineData.reserve(lineBreak - lastBreak);
+      uint16_t xpos = 0;
+      for (size_t i = lastBreak; i < lineBreak; i++) {
+        lineData.push_back({static_cast<uint16_t>(lineText.size()), xpos, words[i].style});
+        lineText.append(wordBytes.data() + words[i].offset, words[i].len + 1);
+        xpos += widths[i] + SPACE_WIDTH;
+      }
+      const auto block = std::make_shared<TextBlock>(std::move(lineText), std::move(lineData));
+      if (rendered) {
+        std::string line;
+        for (const auto& wd : block->wordData) describe(line, block->text.c_str() + wd.offset, wd.xPos);
+        rendered->push_back(line);
+      }
+      lastBreak = lineBreak;
+    }
+    words.clear();
+    wordBytes.clear();
+  }
+};
+
+// Word stream resembling book prose: mostly short words, some long ones past std::string's inline
+// capacity, a few with soft hyphens
+std::vector<std::string> makeWords(size_t count) {
+  const char* hyphenated = "in\xc2\xad" "com\xc2\xad" "pre\xc2\xad" "hen\xc2\xad" "sible";
+  const char* vocabulary[] = {"the",   "lantern",  "flickered",    "as",
+                              "she",   "read",     "of",           "extraordinarily",
+                              "quiet", hyphenated, "and",          "river",
+                              "\xc3\xa9t\xc3\xa9", "characteristically", "winter", "glass"};
+  std::vector<std::string> words;
+  uint32_t seed = 2024;
+  for (size_t i = 0; i < count; i++) {
+    seed = seed * 1103515245 + 12345;
+    words.push_back(vocabulary[(seed >> 16) % 16]);
+  }
+  return words;
+}
+
+struct RunStats {
+  size_t allocations;
+  long long micros;
+};
+
+// Feeds words the way ChapterHtmlSlimParser does (from a char buffer), in paragraphs of 120 words
+template <typename Feed>
+RunStats run(const std::vector<std::string>& words, Feed feed) {
+  char buffer[64];
+  const size_t before = g_allocations;
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < words.size(); i++) {
+    memcpy(buffer, words[i].c_str(), words[i].size() + 1);
+    feed(buffer, words[i].size(), (i % 120) == 119 || i + 1 == words.size());
+  }
+  const auto us =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  return {g_allocations - before, static_cast<long long>(us)};
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("ParsedText Arena");
+
+  const std::vector<std::string> words = makeWords(10000);
+
+  // Test 1: both storages lay out the same lines
+  {
+    std::vector<std::string> legacyLines;
+    std::vector<std::string> arenaLines;
+    LegacyParsedText legacy;
+    ArenaParsedText arena;
+    for (size_t i = 0; i < 2000; i++) {
+      legacy.addWord(words[i], static_cast<Style>(i % 3));
+      arena.addWord(words[i].data(), words[i].size(), static_cast<Style>(i % 3));
+      if (i % 120 == 119 || i == 1999) {
+        legacy.layout(&legacyLines);
+        arena.layout(&arenaLines);
+      }
+    }
+    runner.expectTrue(!arenaLines.empty(), "Lines produced");
+    runner.expectTrue(legacyLines == arenaLines, "Arena lays out identical lines");
+    bool noSoftHyphens = true;
+    for (const auto& line : arenaLines) {
+      if (line.find("\xc2\xad") != std::string::npos) noSoftHyphens = false;
+    }
+    runner.expectTrue(noSoftHyphens, "Soft hyphens stripped in place");
+  }
+
+  // Test 2: allocations per 10k words
+  LegacyParsedText legacy;
+  const RunStats legacyStats = run(words, [&](const char* word, size_t len, bool endParagraph) {
+    legacy.addWord(std::string(word, len), REGULAR);
+    if (endParagraph) legacy.layout(nullptr);
+  });
+
+  ArenaParsedText arena;
+  const RunStats arenaStats = run(words, [&](const char* word, size_t len, bool endParagraph) {
+    arena.addWord(word, len, REGULAR);
+    if (endParagraph) arena.layout(nullptr);
+  });
+
+  std::cout << "\n    Storage              Allocations/10k words   Time (us)\n";
+  printf("    %-20s %21zu %11lld\n", "list<string>", legacyStats.allocations, legacyStats.micros);
+  printf("    %-20s %21zu %11lld\n", "arena + slices", arenaStats.allocations, arenaStats.micros);
+  std::cout << "\n";
+
+  runner.expectTrue(legacyStats.allocations >= 2 * words.size(), "Legacy storage allocates per word",
+                    std::to_string(legacyStats.allocations) + " allocations");
+  runner.expectTrue(arenaStats.allocations * 5 < legacyStats.allocations, "Arena cuts allocations at least 5x",
+                    std::to_string(arenaStats.allocations) + " vs " + std::to_string(legacyStats.allocations));
+  // Three per line remain: the TextBlock, its text buffer and its WordData vector
+  runner.expectTrue(arenaStats.allocations < words.size() / 2, "Arena allocations scale with lines, not words",
+                    std::to_string(arenaStats.allocations) + " allocations");
+
+  return runner.allPassed() ? 0 : 1;
+}
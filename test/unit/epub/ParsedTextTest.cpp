@@ -120,6 +120,45 @@ static std::vector<size_t> computeLineBreaksGreedy(int pageWidth, int spaceWidth
   return breaks;
 }
 
+// Streaming layout state (mirrors ParsedText::layoutAndExtractLines / calculateWordWidths / dropWords):
+// each pass indents the first word unless already done, emits every line but the open last one, and
+// drops the emitted words. Words are 10px per byte, so an em-space indent adds 30px.
+struct StreamingParagraph {
+  static constexpr const char* INDENT = "\xe2\x80\x83";
+  std::vector<std::string> words;
+  bool indentApplied = false;
+  std::vector<std::string> lines;
+
+  void layout(int pageWidth, bool paragraphComplete) {
+    if (words.empty()) return;
+    if (!indentApplied) {
+      words.front() = INDENT + words.front();
+      indentApplied = true;
+    }
+    std::vector<uint16_t> widths;
+    for (const auto& w : words) widths.push_back(static_cast<uint16_t>(10 * w.size()));
+    const auto breaks = computeLineBreaksGreedy(pageWidth, 10, widths);
+    const size_t lineCount = paragraphComplete ? breaks.size() : breaks.size() - 1;
+    size_t start = 0;
+    for (size_t i = 0; i < lineCount; i++) {
+      std::string line;
+      for (size_t w = start; w < breaks[i]; w++) line += (w > start ? " " : "") + words[w];
+      lines.push_back(line);
+      start = breaks[i];
+    }
+    words.erase(words.begin(), words.begin() + start);
+  }
+};
+
+static size_t countIndents(const std::string& line) {
+  size_t count = 0;
+  for (size_t pos = line.find(StreamingParagraph::INDENT); pos != std::string::npos;
+       pos = line.find(StreamingParagraph::INDENT, pos + 1)) {
+    count++;
+  }
+  return count;
+}
+
 int main() {
   TestUtils::TestRunner runner("ParsedText Functions");
 
@@ -441,5 +480,46 @@ int main() {
     runner.expectTrue(isCjkCodepoint(cp), "CJK detection: hangul 가 detected");
   }
 
+  // ============================================
+  // Streaming layout first-line indent
+  // ============================================
+
+  // Test 41: a first pass that emits no lines doesn't get the indent added again
+  {
+    StreamingParagraph paragraph;
+    for (const char* w : {"It", "was", "a", "dark"}) paragraph.words.push_back(w);
+    paragraph.layout(400, false);  // All fit on the open last line
+    runner.expectTrue(paragraph.lines.empty(), "Streaming indent: first pass emits no lines");
+    for (const char* w : {"and", "stormy", "night;", "the", "rain", "fell", "in", "torrents"}) {
+      paragraph.words.push_back(w);
+    }
+    paragraph.layout(400, false);
+    paragraph.layout(400, true);
+    runner.expectTrue(paragraph.lines.size() >= 2, "Streaming indent: later passes emit lines");
+    runner.expectEq(static_cast<size_t>(1), countIndents(paragraph.lines[0]), "Streaming indent: indented once");
+    runner.expectEq(static_cast<size_t>(0), paragraph.lines[0].find(StreamingParagraph::INDENT),
+                    "Streaming indent: indent leads the first line");
+    bool laterLinesPlain = true;
+    for (size_t i = 1; i < paragraph.lines.size(); i++) {
+      if (countIndents(paragraph.lines[i]) != 0) laterLinesPlain = false;
+    }
+    runner.expectTrue(laterLinesPlain, "Streaming indent: later lines not indented");
+  }
+
+  // Test 42: the flag travels with a checkpoint taken before any line was emitted
+  {
+    StreamingParagraph paragraph;
+    paragraph.words = {"Once", "upon"};
+    paragraph.layout(400, false);
+    StreamingParagraph resumed;
+    resumed.words = paragraph.words;
+    resumed.indentApplied = paragraph.indentApplied;  // flags bit 0x08 in ParsedText::serialize
+    resumed.words.push_back("a");
+    resumed.words.push_back("time");
+    resumed.layout(400, true);
+    runner.expectEq(static_cast<size_t>(1), resumed.lines.size(), "Streaming indent: resumed paragraph laid out");
+    runner.expectEq(static_cast<size_t>(1), countIndents(resumed.lines[0]), "Streaming indent: resume indents once");
+  }
+
   return runner.allPassed() ? 0 : 1;
 }
@@ -0,0 +1,142 @@
+#include "test_utils.h"
+
+#include <EpdFontFamily.h>
+#include <ScriptDetector.h>
+#include <Utf8.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "builtinFonts/reader_2b.h"
+#include "builtinFonts/reader_bold_2b.h"
+
+// Checks the dense advance tables behind EpdFontFamily::getAdvanceWidth against the per-codepoint
+// getGlyph() sum GfxRenderer used before, and times both on Latin words the way an uncached
+// getTextWidth() measures them (including the containsThai scan the old path ran first).
+
+namespace {
+
+int referenceWidth(const EpdFontFamily& family, const char* text, const EpdFontFamily::Style style) {
+  int w = 0;
+  const char* ptr = text;
+  uint32_t cp;
+  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&ptr)))) {
+    const EpdGlyph* glyph = family.getGlyph(cp, style);
+    if (!glyph) glyph = family.getGlyph('?', style);
+    if (glyph) w += glyph->advanceX;
+  }
+  return w;
+}
+
+std::vector<std::string> makeWords(const size_t count) {
+  static const char* const SYLLABLES[] = {"the", "an", "qu", "ick", "br", "own", "fo", "x", "ju", "mps",
+                                          "ov", "er", "la", "zy", "do", "g", "é", "ç", "ü", "ł"};
+  std::vector<std::string> words;
+  uint32_t state = 7;
+  for (size_t i = 0; i < count; i++) {
+    std::string word;
+    const int parts = 1 + i % 4;
+    for (int p = 0; p < parts; p++) {
+      state = state * 1103515245 + 12345;
+      word += SYLLABLES[(state >> 16) % 20];
+    }
+    if (i % 7 == 0) word += ",";
+    words.push_back(word);
+  }
+  return words;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("GlyphAdvance");
+
+  EpdFont regular(&reader_2b);
+  EpdFont bold(&reader_bold_2b);
+  EpdFontFamily family(&regular, &bold);
+
+  // Test 1: Tables only exist once built
+  {
+    int w = -1;
+    runner.expectFalse(family.getAdvanceWidth("abc", &w), "No table before build");
+    runner.expectEq(-1, w, "Width untouched on failure");
+    family.buildAdvanceTables();
+    runner.expectTrue(regular.advanceTable() != nullptr, "Regular table built");
+    runner.expectTrue(bold.advanceTable() != nullptr, "Bold table built");
+    const uint8_t* table = regular.advanceTable();
+    family.buildAdvanceTables();
+    runner.expectTrue(regular.advanceTable() == table, "Rebuild keeps the table");
+  }
+
+  // Test 2: Every codepoint in the table matches getGlyph
+  {
+    bool allMatch = true;
+    for (uint32_t cp = 0; cp < EpdFont::ADVANCE_TABLE_SIZE; cp++) {
+      const EpdGlyph* glyph = regular.getGlyph(cp);
+      allMatch &= regular.advanceTable()[cp] == (glyph ? glyph->advanceX : 0);
+    }
+    runner.expectTrue(allMatch, "Table matches getGlyph for U+0000-U+017F");
+  }
+
+  // Test 3: Fast path agrees with the reference on Latin text
+  {
+    const char* const samples[] = {"hello", "Hello,", "naïve", "café", "Łódź",
+                                   "straße", "œuvre", "“quoted”", ""};
+    for (const char* text : samples) {
+      for (const auto style : {EpdFontFamily::REGULAR, EpdFontFamily::BOLD, EpdFontFamily::BOLD_ITALIC}) {
+        int w = -1;
+        const bool fast = family.getAdvanceWidth(text, &w, style);
+        if (fast) {
+          runner.expectEq(referenceWidth(family, text, style), w, std::string("Width of '") + text + "'");
+        } else {
+          runner.expectTrue(std::string(text) == "“quoted”", std::string("Fast path for '") + text + "'");
+        }
+      }
+    }
+  }
+
+  // Test 4: Text beyond the tables falls back
+  {
+    int w = 0;
+    runner.expectFalse(family.getAdvanceWidth("привет", &w), "Cyrillic falls back");
+    runner.expectFalse(family.getAdvanceWidth("ภาษาไทย", &w), "Thai falls back");
+    runner.expectFalse(family.getAdvanceWidth("漢字", &w), "CJK falls back");
+    runner.expectFalse(family.getAdvanceWidth("a\x01z", &w), "Missing glyph falls back");
+    runner.expectFalse(family.getAdvanceWidth("a\xC3", &w), "Truncated sequence falls back");
+  }
+
+  // Test 5: Benchmark against the old measuring loop
+  {
+    const std::vector<std::string> words = makeWords(20000);
+    constexpr int RUNS = 20;
+    long oldSum = 0;
+    long newSum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; r++) {
+      for (const auto& word : words) {
+        if (!ScriptDetector::containsThai(word.c_str())) oldSum += referenceWidth(family, word.c_str(), REGULAR);
+      }
+    }
+    const auto oldUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; r++) {
+      for (const auto& word : words) {
+        int w = 0;
+        if (family.getAdvanceWidth(word.c_str(), &w, REGULAR)) newSum += w;
+      }
+    }
+    const auto newUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    printf("\n    %zu words x %d: getGlyph loop %.1f ms, advance table %.1f ms\n\n", words.size(), RUNS,
+           oldUs / 1000.0, newUs / 1000.0);
+    runner.expectEq(oldSum, newSum, "Benchmark widths agree");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+#include "test_utils.h"
+
+#include <EpdFontData.h>
+#include <GlyphAtlas.h>
+#include <GlyphBlit.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Drives GlyphAtlas::get past its entry limit and its byte budget on synthetic glyphs. After a glyph is
+// inserted its source bitmap is scrambled, so a lookup that returns the original rotated plane proves the
+// plane came out of the atlas: it survived compaction byte for byte and the rebuilt index still finds it.
+// A glyph that was evicted is rebuilt from the scrambled bitmap instead.
+
+namespace {
+
+constexpr int Portrait = 0;
+constexpr int PortraitInverted = 2;
+constexpr size_t MAX_ENTRIES = 256;  // GlyphAtlas::MAX_ENTRIES
+
+// Glyphs over one shared bitmap, like a font; the glyph table never reallocates once built
+struct GlyphSet {
+  std::vector<EpdGlyph> glyphs;
+  std::vector<uint8_t> bitmap;
+  bool is2Bit = false;
+
+  GlyphSet(const size_t count, const bool twoBit, int (*width)(size_t), int (*height)(size_t)) : is2Bit(twoBit) {
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < count; i++) {
+      const int w = width(i);
+      const int h = height(i);
+      const size_t bytes = (static_cast<size_t>(w) * h * (twoBit ? 2 : 1) + 7) / 8;
+      const EpdGlyph glyph = {static_cast<uint8_t>(w), static_cast<uint8_t>(h), static_cast<uint8_t>(w + 1), 0,
+                              static_cast<int16_t>(h), static_cast<uint16_t>(bytes),
+                              static_cast<uint32_t>(bitmap.size())};
+      glyphs.push_back(glyph);
+      for (size_t b = 0; b < bytes; b++) {
+        seed = seed * 1103515245 + 12345;
+        bitmap.push_back(static_cast<uint8_t>(seed >> 16));
+      }
+    }
+  }
+
+  const EpdGlyph* glyph(const size_t i) const { return &glyphs[i]; }
+
+  std::vector<uint8_t> rotated(const size_t i, const int orientation) const {
+    const EpdGlyph& g = glyphs[i];
+    std::vector<uint8_t> plane(g.width * GlyphBlit::rotatedRowBytes(g.height));
+    GlyphBlit::buildRotated(&bitmap[g.dataOffset], g.width, g.height, is2Bit, orientation, plane.data());
+    return plane;
+  }
+
+  // Flips every bitmap bit, so a plane rebuilt from now on differs from the one built before
+  void scramble() {
+    for (uint8_t& b : bitmap) b = static_cast<uint8_t>(~b);
+  }
+};
+
+bool samePlane(const uint8_t* plane, const std::vector<uint8_t>& expected) {
+  return plane && memcmp(plane, expected.data(), expected.size()) == 0;
+}
+
+const uint8_t* get(GlyphAtlas& atlas, const GlyphSet& set, const size_t i) {
+  return atlas.get(set.glyph(i), set.bitmap.data() + set.glyphs[i].dataOffset, set.is2Bit);
+}
+
+int smallWidth(size_t) { return 8; }
+int smallHeight(size_t) { return 8; }
+int mixedWidth(const size_t i) { return 6 + static_cast<int>(i * 7 % 25); }
+int mixedHeight(const size_t i) { return 9 + static_cast<int>(i * 11 % 23); }
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Glyph Atlas");
+
+  // Test 1: more glyphs than entries; the byte budget is never the limit
+  for (const int orientation : {Portrait, PortraitInverted}) {
+    for (const bool is2Bit : {false, true}) {
+      const std::string label = std::string(orientation == Portrait ? " (Portrait" : " (PortraitInverted") +
+                                (is2Bit ? ", 2-bit)" : ", 1-bit)");
+      constexpr size_t COUNT = MAX_ENTRIES + 44;
+      GlyphSet set(COUNT, is2Bit, smallWidth, smallHeight);
+      std::vector<std::vector<uint8_t>> before;
+      for (size_t i = 0; i < COUNT; i++) before.push_back(set.rotated(i, orientation));
+
+      GlyphAtlas atlas;
+      atlas.configure(orientation, 32 * 1024);
+      bool builtRight = true;
+      size_t peakEntries = 0;
+      for (size_t i = 0; i < COUNT; i++) {
+        if (!samePlane(get(atlas, set, i), before[i])) builtRight = false;
+        peakEntries = std::max(peakEntries, atlas.entryCount());
+      }
+      runner.expectTrue(builtRight, "Every plane built correctly" + label);
+      runner.expectEq(MAX_ENTRIES, peakEntries, "Entry table filled to its limit" + label);
+      runner.expectTrue(atlas.entryCount() < MAX_ENTRIES, "Full table compacted" + label,
+                        std::to_string(atlas.entryCount()));
+
+      // The most recent glyphs survived; none of them is rebuilt
+      set.scramble();
+      const size_t survivors = atlas.entryCount();
+      bool survivorsIntact = true;
+      for (size_t i = COUNT - survivors; i < COUNT; i++) {
+        if (!samePlane(get(atlas, set, i), before[i])) survivorsIntact = false;
+      }
+      runner.expectTrue(survivorsIntact, "Survivors found through the rebuilt index, planes unchanged" + label);
+      runner.expectEq(survivors, atlas.entryCount(), "Survivor lookups build nothing" + label);
+
+      // The oldest were evicted and come back built from the scrambled bitmap
+      bool evictedRebuilt = true;
+      for (size_t i = 0; i < COUNT - survivors; i++) {
+        if (!samePlane(get(atlas, set, i), set.rotated(i, orientation))) evictedRebuilt = false;
+      }
+      runner.expectTrue(evictedRebuilt, "Evicted glyphs rebuilt on their next lookup" + label);
+    }
+  }
+
+  // Test 2: glyphs of mixed sizes past a small byte budget; a hot set touched between misses survives every
+  // compaction and the arena never exceeds the budget
+  {
+    constexpr size_t BUDGET = 1024;
+    constexpr size_t COUNT = 120;
+    constexpr size_t HOT = 4;
+    GlyphSet set(COUNT, true, mixedWidth, mixedHeight);
+    std::vector<std::vector<uint8_t>> before;
+    size_t totalBytes = 0;
+    for (size_t i = 0; i < COUNT; i++) {
+      before.push_back(set.rotated(i, Portrait));
+      totalBytes += before.back().size();
+    }
+
+    GlyphAtlas atlas;
+    atlas.configure(Portrait, BUDGET);
+    bool withinBudget = true;
+    bool planesIntact = true;
+    size_t compactions = 0;
+    size_t lastEntries = 0;
+    for (size_t i = 0; i < COUNT; i++) {
+      if (!samePlane(get(atlas, set, i), before[i])) planesIntact = false;
+      if (atlas.entryCount() < lastEntries) compactions++;
+      lastEntries = atlas.entryCount();
+      for (size_t hot = 0; hot < HOT && hot < i; hot++) {
+        if (!samePlane(get(atlas, set, hot), before[hot])) planesIntact = false;
+      }
+      if (atlas.usedBytes() > BUDGET) withinBudget = false;
+    }
+    runner.expectTrue(totalBytes > 4 * BUDGET, "Glyphs need several times the budget",
+                      std::to_string(totalBytes) + " bytes");
+    runner.expectTrue(compactions > 2, "Budget forced repeated compactions", std::to_string(compactions));
+    runner.expectTrue(withinBudget, "Arena stays within the byte budget");
+    runner.expectTrue(planesIntact, "Every lookup returned the right plane through compactions");
+
+    set.scramble();
+    const size_t entries = atlas.entryCount();
+    bool hotIntact = true;
+    for (size_t hot = 0; hot < HOT; hot++) {
+      if (!samePlane(get(atlas, set, hot), before[hot])) hotIntact = false;
+    }
+    runner.expectTrue(hotIntact, "Hot glyphs survive every compaction byte for byte");
+    runner.expectEq(entries, atlas.entryCount(), "Hot glyph lookups build nothing");
+  }
+
+  // Test 3: a glyph that can't fit the budget is refused and leaves the atlas as it was
+  {
+    GlyphSet small(2, false, smallWidth, smallHeight);
+    GlyphSet large(1, false, [](size_t) { return 40; }, [](size_t) { return 40; });  // 40 * 5 = 200 bytes
+    GlyphSet empty(1, false, [](size_t) { return 0; }, [](size_t) { return 8; });
+    GlyphAtlas atlas;
+    atlas.configure(Portrait, 128);
+    get(atlas, small, 0);
+    get(atlas, small, 1);
+    const size_t used = atlas.usedBytes();
+    runner.expectTrue(get(atlas, large, 0) == nullptr, "Glyph larger than the budget returns nullptr");
+    runner.expectTrue(get(atlas, empty, 0) == nullptr, "Empty glyph returns nullptr");
+    runner.expectEq(static_cast<size_t>(2), atlas.entryCount(), "Refused glyphs evict nothing");
+    runner.expectEq(used, atlas.usedBytes(), "Refused glyphs use no bytes");
+    const auto expected = small.rotated(0, Portrait);
+    small.scramble();
+    runner.expectTrue(samePlane(get(atlas, small, 0), expected), "Earlier glyph still served after a refusal");
+
+    atlas.clear();
+    runner.expectEq(static_cast<size_t>(0), atlas.entryCount(), "clear() drops every entry");
+    runner.expectTrue(samePlane(get(atlas, small, 0), small.rotated(0, Portrait)), "Cleared glyph rebuilt");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,413 @@
+#include "test_utils.h"
+
+#include <EpdFontData.h>
+#include <GlyphAtlas.h>
+#include <GlyphBlit.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "builtinFonts/reader_2b.h"
+
+// Checks GlyphBlit against the per-pixel path it replaced in GfxRenderer::renderChar (drawPixel with
+// rotateCoordinates per set pixel), on a full page of reader_2b text in each of the four orientations,
+// and reports glyphs/sec for both. Also checks GlyphAtlas's pre-rotated portrait path against the same
+// reference and times it against landscape, where glyph rows already run along panel rows.
+
+namespace {
+
+constexpr int DISPLAY_WIDTH = 800;
+constexpr int DISPLAY_HEIGHT = 480;
+constexpr int DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+constexpr size_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+
+enum Orientation { Portrait, LandscapeClockwise, PortraitInverted, LandscapeCounterClockwise };
+enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+const char* const ORIENTATION_NAMES[] = {"Portrait", "LandscapeCW", "PortraitInverted", "LandscapeCCW"};
+
+const EpdGlyph* getGlyph(const EpdFontData& font, uint32_t cp) {
+  for (uint32_t i = 0; i < font.intervalCount; i++) {
+    const EpdUnicodeInterval& interval = font.intervals[i];
+    if (cp >= interval.first && cp <= interval.last) return &font.glyph[interval.offset + (cp - interval.first)];
+  }
+  return nullptr;
+}
+
+struct Screen {
+  Orientation orientation;
+  int width() const { return orientation == Portrait || orientation == PortraitInverted ? 480 : 800; }
+  int height() const { return orientation == Portrait || orientation == PortraitInverted ? 800 : 480; }
+
+  void rotateCoordinates(int x, int y, int* rotatedX, int* rotatedY) const {
+    switch (orientation) {
+      case Portrait:
+        *rotatedX = y;
+        *rotatedY = DISPLAY_HEIGHT - 1 - x;
+        break;
+      case LandscapeClockwise:
+        *rotatedX = DISPLAY_WIDTH - 1 - x;
+        *rotatedY = DISPLAY_HEIGHT - 1 - y;
+        break;
+      case PortraitInverted:
+        *rotatedX = DISPLAY_WIDTH - 1 - y;
+        *rotatedY = x;
+        break;
+      case LandscapeCounterClockwise:
+        *rotatedX = x;
+        *rotatedY = y;
+        break;
+    }
+  }
+};
+
+// Mirrors GfxRenderer::drawPixel
+void drawPixel(const Screen& screen, uint8_t* frameBuffer, int x, int y, bool state) {
+  if (!frameBuffer) return;
+  int rotatedX = 0;
+  int rotatedY = 0;
+  screen.rotateCoordinates(x, y, &rotatedX, &rotatedY);
+  if (rotatedX < 0 || rotatedX >= DISPLAY_WIDTH || rotatedY < 0 || rotatedY >= DISPLAY_HEIGHT) return;
+  const uint16_t byteIndex = rotatedY * DISPLAY_WIDTH_BYTES + (rotatedX / 8);
+  const uint8_t bitPosition = 7 - (rotatedX % 8);
+  if (state) {
+    frameBuffer[byteIndex] &= ~(1 << bitPosition);
+  } else {
+    frameBuffer[byteIndex] |= 1 << bitPosition;
+  }
+}
+
+// Mirrors the pixel loop renderChar used before GlyphBlit
+void renderCharPerPixel(const Screen& screen, uint8_t* frameBuffer, const EpdFontData& font, const EpdGlyph* glyph,
+                        int x, int y, bool pixelState, RenderMode renderMode) {
+  const uint8_t* bitmap = &font.bitmap[glyph->dataOffset];
+  for (int glyphY = 0; glyphY < glyph->height; glyphY++) {
+    const int screenY = y - glyph->top + glyphY;
+    if (screenY < 0 || screenY >= screen.height()) continue;
+    for (int glyphX = 0; glyphX < glyph->width; glyphX++) {
+      const int screenX = x + glyph->left + glyphX;
+      if (screenX < 0 || screenX >= screen.width()) continue;
+      const int pixelPosition = glyphY * glyph->width + glyphX;
+      if (font.is2Bit) {
+        const uint8_t byte = bitmap[pixelPosition / 4];
+        const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
+        const uint8_t bmpVal = (3 - (byte >> bit_index)) & 0x3;
+        if (renderMode == BW && bmpVal < 3) {
+          drawPixel(screen, frameBuffer, screenX, screenY, pixelState);
+        } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
+          drawPixel(screen, frameBuffer, screenX, screenY, false);
+        } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
+          drawPixel(screen, frameBuffer, screenX, screenY, false);
+        }
+      } else {
+        const uint8_t byte = bitmap[pixelPosition / 8];
+        if ((byte >> (7 - pixelPosition % 8)) & 1) drawPixel(screen, frameBuffer, screenX, screenY, pixelState);
+      }
+    }
+  }
+}
+
+// Mirrors renderChar's blitter call
+void renderCharBlit(const Screen& screen, uint8_t* frameBuffer, const EpdFontData& font, const EpdGlyph* glyph,
+                    int x, int y, bool pixelState, RenderMode renderMode, GlyphBlit::Fn blit) {
+  uint8_t inkMask = GlyphBlit::INK_BW;
+  bool setBits = !pixelState;
+  if (font.is2Bit && renderMode == GRAYSCALE_MSB) {
+    inkMask = GlyphBlit::INK_GRAYSCALE_MSB;
+    setBits = true;
+  } else if (font.is2Bit && renderMode == GRAYSCALE_LSB) {
+    inkMask = GlyphBlit::INK_GRAYSCALE_LSB;
+    setBits = true;
+  }
+  const GlyphBlit::Glyph placed = {&font.bitmap[glyph->dataOffset], x + glyph->left, y - glyph->top, glyph->width,
+                                   glyph->height};
+  blit(frameBuffer, placed, screen.width(), screen.height(), inkMask, setBits);
+}
+
+// Mirrors renderChar's atlas path: pre-rotated plane for BW glyphs fully on screen, blitter otherwise
+void renderCharAtlas(const Screen& screen, uint8_t* frameBuffer, const EpdFontData& font, const EpdGlyph* glyph,
+                     int x, int y, bool pixelState, GlyphAtlas& atlas, GlyphBlit::Fn blit) {
+  const uint8_t* bitmap = &font.bitmap[glyph->dataOffset];
+  const int left = x + glyph->left;
+  const int top = y - glyph->top;
+  const uint8_t* rotated = nullptr;
+  if (atlas.orientation() == screen.orientation && left >= 0 && top >= 0 && left + glyph->width <= screen.width() &&
+      top + glyph->height <= screen.height()) {
+    rotated = atlas.get(glyph, bitmap, font.is2Bit);
+  }
+  if (rotated) {
+    GlyphBlit::blitRotated(frameBuffer, rotated, glyph->width, glyph->height, left, top, screen.orientation,
+                           !pixelState);
+  } else {
+    renderCharBlit(screen, frameBuffer, font, glyph, x, y, pixelState, BW, blit);
+  }
+}
+
+struct Placement {
+  const EpdGlyph* glyph;
+  int x;
+  int y;
+};
+
+// Lays out a full page of text; the first line starts slightly off-screen to exercise clipping
+std::vector<Placement> layoutPage(const Screen& screen, const EpdFontData& font) {
+  const char* text =
+      "The lantern flickered as she read of extraordinarily quiet winters, of rivers frozen glass-still "
+      "and characteristically patient ferrymen. Every page turned with a whisper; every chapter ended too soon. ";
+  std::vector<Placement> page;
+  size_t i = 0;
+  for (int baseline = font.ascender - 6; baseline < screen.height() + 10; baseline += font.advanceY) {
+    int x = -4;
+    while (x < screen.width() + 4) {
+      const char c = text[i++ % strlen(text)];
+      const EpdGlyph* glyph = getGlyph(font, static_cast<uint8_t>(c));
+      if (!glyph) continue;
+      page.push_back({glyph, x, baseline});
+      x += glyph->advanceX;
+    }
+  }
+  return page;
+}
+
+double glyphsPerSecond(size_t glyphs, long long micros) { return micros > 0 ? glyphs * 1e6 / micros : 0; }
+
+template <typename Render>
+long long timeRuns(int runs, Render render) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < runs; r++) render();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Glyph Blitter");
+  const EpdFontData& font = reader_2b;
+  constexpr int RUNS = 5;
+
+  std::cout << "\n    Orientation        Glyphs   Per-pixel (glyphs/s)   Blit (glyphs/s)\n";
+  for (int o = 0; o < 4; o++) {
+    const Screen screen{static_cast<Orientation>(o)};
+    const auto page = layoutPage(screen, font);
+    const GlyphBlit::Fn blit = GlyphBlit::forOrientation(o, font.is2Bit);
+    const std::string label = std::string(" (") + ORIENTATION_NAMES[o] + ")";
+
+    // Test: every render mode matches the per-pixel path, on white and on a busy background
+    bool allMatch = true;
+    const RenderMode modes[] = {BW, GRAYSCALE_LSB, GRAYSCALE_MSB};
+    for (const RenderMode mode : modes) {
+      for (const uint8_t fill : {static_cast<uint8_t>(0xFF), static_cast<uint8_t>(0x00), static_cast<uint8_t>(0x5A)}) {
+        for (const bool black : {true, false}) {
+          std::vector<uint8_t> expected(BUFFER_SIZE, fill);
+          std::vector<uint8_t> actual(BUFFER_SIZE, fill);
+          for (const auto& p : page) {
+            renderCharPerPixel(screen, expected.data(), font, p.glyph, p.x, p.y, black, mode);
+            renderCharBlit(screen, actual.data(), font, p.glyph, p.x, p.y, black, mode, blit);
+          }
+          if (expected != actual) allMatch = false;
+        }
+      }
+    }
+    runner.expectTrue(allMatch, "Blit matches per-pixel rendering in all modes" + label);
+
+    std::vector<uint8_t> frameBuffer(BUFFER_SIZE, 0xFF);
+    const long long perPixelUs = timeRuns(RUNS, [&]() {
+      for (const auto& p : page) renderCharPerPixel(screen, frameBuffer.data(), font, p.glyph, p.x, p.y, true, BW);
+    });
+    const long long blitUs = timeRuns(RUNS, [&]() {
+      for (const auto& p : page) renderCharBlit(screen, frameBuffer.data(), font, p.glyph, p.x, p.y, true, BW, blit);
+    });
+    printf("    %-18s %6zu %22.0f %17.0f\n", ORIENTATION_NAMES[o], page.size(),
+           glyphsPerSecond(page.size() * RUNS, perPixelUs), glyphsPerSecond(page.size() * RUNS, blitUs));
+  }
+  std::cout << "\n";
+
+  // Test: pre-rotated atlas matches the per-pixel path in both portrait orientations
+  for (const Orientation o : {Portrait, PortraitInverted}) {
+    const Screen screen{o};
+    const auto page = layoutPage(screen, font);
+    const GlyphBlit::Fn blit = GlyphBlit::forOrientation(o, font.is2Bit);
+    const std::string label = std::string(" (") + ORIENTATION_NAMES[o] + ")";
+
+    for (const size_t budget : {static_cast<size_t>(32 * 1024), static_cast<size_t>(1024)}) {
+      GlyphAtlas atlas;
+      atlas.configure(o, budget);
+      bool allMatch = true;
+      for (const uint8_t fill : {static_cast<uint8_t>(0xFF), static_cast<uint8_t>(0x5A)}) {
+        for (const bool black : {true, false}) {
+          std::vector<uint8_t> expected(BUFFER_SIZE, fill);
+          std::vector<uint8_t> actual(BUFFER_SIZE, fill);
+          for (const auto& p : page) {
+            renderCharPerPixel(screen, expected.data(), font, p.glyph, p.x, p.y, black, BW);
+            renderCharAtlas(screen, actual.data(), font, p.glyph, p.x, p.y, black, atlas, blit);
+          }
+          if (expected != actual) allMatch = false;
+        }
+      }
+      const std::string budgetLabel = label + " " + std::to_string(budget) + " byte budget";
+      runner.expectTrue(allMatch, "Atlas matches per-pixel rendering" + budgetLabel);
+      runner.expectTrue(atlas.entryCount() > 0, "Atlas holds glyphs" + budgetLabel);
+      runner.expectTrue(atlas.usedBytes() <= budget, "Atlas stays within budget" + budgetLabel,
+                        std::to_string(atlas.usedBytes()) + " bytes");
+    }
+  }
+
+  // Test: landscape and zero budget leave the atlas disabled
+  {
+    GlyphAtlas atlas;
+    atlas.configure(LandscapeCounterClockwise, 32 * 1024);
+    runner.expectEq(-1, atlas.orientation(), "Landscape disables the atlas");
+    atlas.configure(Portrait, 0);
+    runner.expectEq(-1, atlas.orientation(), "Zero budget disables the atlas");
+    runner.expectTrue(atlas.get(getGlyph(font, 'a'), font.bitmap, font.is2Bit) == nullptr,
+                      "Disabled atlas builds nothing");
+  }
+
+  // Test: more distinct glyphs than atlas entries; the small budget compacts the arena often, the large
+  // one runs into the entry limit first
+  for (const size_t budget : {static_cast<size_t>(4096), static_cast<size_t>(32 * 1024)}) {
+    const Screen screen{Portrait};
+    const GlyphBlit::Fn blit = GlyphBlit::forOrientation(Portrait, font.is2Bit);
+    GlyphAtlas atlas;
+    atlas.configure(Portrait, budget);
+    std::vector<uint8_t> expected(BUFFER_SIZE, 0xFF);
+    std::vector<uint8_t> actual(BUFFER_SIZE, 0xFF);
+    size_t drawn = 0;
+    size_t peakEntries = 0;
+    bool withinBudget = true;
+    for (int pass = 0; pass < 2; pass++) {
+      for (uint32_t i = 0; i < font.intervalCount; i++) {
+        const EpdUnicodeInterval& interval = font.intervals[i];
+        for (uint32_t cp = interval.first; cp <= interval.last; cp++) {
+          const EpdGlyph* glyph = &font.glyph[interval.offset + (cp - interval.first)];
+          const int x = 10 + static_cast<int>(drawn % 16) * 28;
+          const int y = 40 + static_cast<int>(drawn / 16 % 24) * 30;
+          renderCharPerPixel(screen, expected.data(), font, glyph, x, y, true, BW);
+          renderCharAtlas(screen, actual.data(), font, glyph, x, y, true, atlas, blit);
+          peakEntries = std::max(peakEntries, atlas.entryCount());
+          if (atlas.usedBytes() > budget) withinBudget = false;
+          drawn++;
+        }
+      }
+    }
+    const std::string label = " (" + std::to_string(budget) + " byte budget)";
+    runner.expectTrue(drawn > 2 * 256, "More glyphs than atlas entries" + label, std::to_string(drawn) + " glyphs");
+    runner.expectTrue(expected == actual, "Atlas matches per-pixel rendering through evictions" + label);
+    runner.expectTrue(peakEntries <= 256, "Atlas entry table bounded" + label, std::to_string(peakEntries));
+    runner.expectTrue(withinBudget, "Arena stays within budget through evictions" + label);
+  }
+
+  // Benchmark: portrait with a warm atlas against landscape, which needs no rotation
+  {
+    const Screen portrait{Portrait};
+    const Screen landscape{LandscapeCounterClockwise};
+    const auto portraitPage = layoutPage(portrait, font);
+    const auto landscapePage = layoutPage(landscape, font);
+    const GlyphBlit::Fn portraitBlit = GlyphBlit::forOrientation(Portrait, font.is2Bit);
+    const GlyphBlit::Fn landscapeBlit = GlyphBlit::forOrientation(LandscapeCounterClockwise, font.is2Bit);
+    GlyphAtlas atlas;
+    atlas.configure(Portrait, 32 * 1024);
+    std::vector<uint8_t> frameBuffer(BUFFER_SIZE, 0xFF);
+    for (const auto& p : portraitPage) {
+      renderCharAtlas(portrait, frameBuffer.data(), font, p.glyph, p.x, p.y, true, atlas, portraitBlit);
+    }
+
+    const long long portraitBlitUs = timeRuns(RUNS, [&]() {
+      for (const auto& p : portraitPage) {
+        renderCharBlit(portrait, frameBuffer.data(), font, p.glyph, p.x, p.y, true, BW, portraitBlit);
+      }
+    });
+    const long long portraitAtlasUs = timeRuns(RUNS, [&]() {
+      for (const auto& p : portraitPage) {
+        renderCharAtlas(portrait, frameBuffer.data(), font, p.glyph, p.x, p.y, true, atlas, portraitBlit);
+      }
+    });
+    const long long landscapeUs = timeRuns(RUNS, [&]() {
+      for (const auto& p : landscapePage) {
+        renderCharBlit(landscape, frameBuffer.data(), font, p.glyph, p.x, p.y, true, BW, landscapeBlit);
+      }
+    });
+    std::cout << "    Path                          glyphs/s\n";
+    printf("    %-26s %11.0f\n", "Portrait blit", glyphsPerSecond(portraitPage.size() * RUNS, portraitBlitUs));
+    printf("    %-26s %11.0f\n", "Portrait atlas", glyphsPerSecond(portraitPage.size() * RUNS, portraitAtlasUs));
+    printf("    %-26s %11.0f\n", "LandscapeCCW blit", glyphsPerSecond(landscapePage.size() * RUNS, landscapeUs));
+    printf("    Atlas: %zu glyphs, %zu bytes\n\n", atlas.entryCount(), atlas.usedBytes());
+  }
+
+  // Test: gray strips set the same LSB/MSB bits as the per-pixel gray passes into a cleared frame buffer,
+  // including glyphs that straddle strip boundaries and the screen edges
+  for (int o = 0; o < 4; o++) {
+    const Screen screen{static_cast<Orientation>(o)};
+    const auto page = layoutPage(screen, font);
+    const GlyphBlit::GrayStripFn strip = GlyphBlit::grayStripFor(o);
+    std::vector<uint8_t> expectedLsb(BUFFER_SIZE, 0x00);
+    std::vector<uint8_t> expectedMsb(BUFFER_SIZE, 0x00);
+    for (const auto& p : page) {
+      renderCharPerPixel(screen, expectedLsb.data(), font, p.glyph, p.x, p.y, true, GRAYSCALE_LSB);
+      renderCharPerPixel(screen, expectedMsb.data(), font, p.glyph, p.x, p.y, true, GRAYSCALE_MSB);
+    }
+    bool allMatch = true;
+    for (const int stripRows : {48, 7}) {
+      std::vector<uint8_t> lsb(BUFFER_SIZE, 0x00);
+      std::vector<uint8_t> msb(BUFFER_SIZE, 0x00);
+      for (int stripY = 0; stripY < DISPLAY_HEIGHT; stripY += stripRows) {
+        const int rows = std::min(stripRows, DISPLAY_HEIGHT - stripY);
+        const size_t offset = static_cast<size_t>(stripY) * DISPLAY_WIDTH_BYTES;
+        for (const auto& p : page) {
+          const GlyphBlit::Glyph placed = {&font.bitmap[p.glyph->dataOffset], p.x + p.glyph->left,
+                                           p.y - p.glyph->top, p.glyph->width, p.glyph->height};
+          strip(lsb.data() + offset, msb.data() + offset, placed, screen.width(), screen.height(), stripY, rows);
+        }
+      }
+      if (lsb != expectedLsb || msb != expectedMsb) allMatch = false;
+    }
+    runner.expectTrue(allMatch, std::string("Gray strips match per-pixel gray passes (") + ORIENTATION_NAMES[o] + ")");
+  }
+
+  // Test: 1-bit glyphs (drawn with pixelState in every mode)
+  {
+    // 10x3 glyph: a checker row, a solid row, an empty row
+    const uint8_t bitmap[] = {0xAA, 0xBF, 0xF0, 0x00};
+    const EpdGlyph glyph = {10, 3, 11, 0, 3, 4, 0};
+    const EpdFontData oneBit = {bitmap, &glyph, nullptr, 0, 4, 3, 0, false};
+    bool allMatch = true;
+    for (int o = 0; o < 4; o++) {
+      const Screen screen{static_cast<Orientation>(o)};
+      const GlyphBlit::Fn blit = GlyphBlit::forOrientation(o, false);
+      for (const int x : {-3, 0, 5, screen.width() - 7}) {
+        for (const RenderMode mode : {BW, GRAYSCALE_MSB}) {
+          std::vector<uint8_t> expected(BUFFER_SIZE, 0x0F);
+          std::vector<uint8_t> actual(BUFFER_SIZE, 0x0F);
+          renderCharPerPixel(screen, expected.data(), oneBit, &glyph, x, 10, true, mode);
+          renderCharBlit(screen, actual.data(), oneBit, &glyph, x, 10, true, mode, blit);
+          if (expected != actual) allMatch = false;
+        }
+      }
+    }
+    runner.expectTrue(allMatch, "1-bit glyphs match per-pixel rendering, clipped at both edges");
+
+    // Every column alignment of the pre-rotated plane
+    bool atlasMatch = true;
+    for (const Orientation o : {Portrait, PortraitInverted}) {
+      const Screen screen{o};
+      GlyphAtlas atlas;
+      atlas.configure(o, 4096);
+      const GlyphBlit::Fn blit = GlyphBlit::forOrientation(o, false);
+      for (int y = 3; y < 3 + 16; y++) {
+        std::vector<uint8_t> expected(BUFFER_SIZE, 0x0F);
+        std::vector<uint8_t> actual(BUFFER_SIZE, 0x0F);
+        renderCharPerPixel(screen, expected.data(), oneBit, &glyph, 7, y, true, BW);
+        renderCharAtlas(screen, actual.data(), oneBit, &glyph, 7, y, true, atlas, blit);
+        if (expected != actual) atlasMatch = false;
+      }
+      if (atlas.entryCount() != 1) atlasMatch = false;
+    }
+    runner.expectTrue(atlasMatch, "1-bit glyphs match through the atlas at every byte alignment");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
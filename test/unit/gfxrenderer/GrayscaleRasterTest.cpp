@@ -0,0 +1,318 @@
+#include "test_utils.h"
+
+#include <GlyphBlit.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+// Compares GfxRenderer's three-pass anti-aliased render (BW, GRAYSCALE_LSB, GRAYSCALE_MSB walks through
+// renderChar/drawPixel) with the single-pass capture: one BW walk records 2-bit glyphs, then
+// rasterizeGrayStrip() emits both gray planes per strip of panel rows through GlyphBlit::grayStripFor().
+// Mirrors the pixel code of renderChar and drawPixel in portrait orientation with a synthetic 2-bit font.
+
+namespace {
+
+constexpr int DISPLAY_WIDTH = 800;
+constexpr int DISPLAY_HEIGHT = 480;
+constexpr int DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+constexpr size_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+constexpr int SCREEN_WIDTH = 480;  // Logical portrait
+constexpr int SCREEN_HEIGHT = 800;
+constexpr int GRAY_STRIP_ROWS = 48;
+
+enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+
+struct Glyph {
+  uint8_t width;
+  uint8_t height;
+  int8_t left;
+  int8_t top;
+  uint8_t advanceX;
+  uint32_t dataOffset;
+};
+
+// 2-bit font with anti-aliased edges: solid core, gray ramps towards the glyph border
+struct Font {
+  std::map<uint32_t, Glyph> glyphs;
+  std::vector<uint8_t> bitmap;
+
+  Font() {
+    for (uint32_t cp = 33; cp < 127; cp++) {
+      Glyph g{static_cast<uint8_t>(8 + cp % 6), static_cast<uint8_t>(14 + cp % 5), 1, 16, 0, 0};
+      g.advanceX = g.width + 2;
+      g.dataOffset = bitmap.size();
+      const int pixels = g.width * g.height;
+      std::vector<uint8_t> data((pixels + 3) / 4, 0);
+      for (int p = 0; p < pixels; p++) {
+        const int gx = p % g.width;
+        const int gy = p / g.width;
+        const int edge = std::min(std::min(gx, g.width - 1 - gx), std::min(gy, g.height - 1 - gy));
+        // Font value: 0 white, 1 light gray, 2 dark gray, 3 black
+        uint8_t value = edge == 0 ? 0 : edge == 1 ? 1 : edge == 2 ? 2 : 3;
+        if ((gx * 7 + gy * 3 + cp) % 11 == 0) value = 0;
+        data[p / 4] |= value << ((3 - p % 4) * 2);
+      }
+      bitmap.insert(bitmap.end(), data.begin(), data.end());
+      glyphs[cp] = g;
+    }
+    glyphs[' '] = Glyph{0, 0, 0, 0, 5, 0};
+  }
+
+  const Glyph* getGlyph(uint32_t cp) const {
+    const auto it = glyphs.find(cp);
+    return it == glyphs.end() ? nullptr : &it->second;
+  }
+};
+
+void rotateCoordinates(int x, int y, int* rotatedX, int* rotatedY) {
+  *rotatedX = y;
+  *rotatedY = DISPLAY_HEIGHT - 1 - x;
+}
+
+struct GrayGlyph {
+  const uint8_t* bitmap;
+  int16_t x;
+  int16_t y;
+  uint8_t width;
+  uint8_t height;
+};
+
+struct Renderer {
+  const Font& font;
+  uint8_t* frameBuffer;
+  RenderMode renderMode = BW;
+  bool capturingGrayscale = false;
+  std::vector<GrayGlyph> grayGlyphs;
+  size_t glyphVisits = 0;
+
+  Renderer(const Font& font, uint8_t* frameBuffer) : font(font), frameBuffer(frameBuffer) {}
+
+  void drawPixel(int x, int y, bool state) const {
+    int rotatedX = 0;
+    int rotatedY = 0;
+    rotateCoordinates(x, y, &rotatedX, &rotatedY);
+    if (rotatedX < 0 || rotatedX >= DISPLAY_WIDTH || rotatedY < 0 || rotatedY >= DISPLAY_HEIGHT) return;
+    const uint16_t byteIndex = rotatedY * DISPLAY_WIDTH_BYTES + (rotatedX / 8);
+    const uint8_t bitPosition = 7 - (rotatedX % 8);
+    if (state) {
+      frameBuffer[byteIndex] &= ~(1 << bitPosition);
+    } else {
+      frameBuffer[byteIndex] |= 1 << bitPosition;
+    }
+  }
+
+  void renderChar(uint32_t cp, int* x, int y) {
+    const Glyph* glyph = font.getGlyph(cp);
+    if (!glyph) return;
+    glyphVisits++;
+    const uint8_t* bitmap = &font.bitmap[glyph->dataOffset];
+    if (capturingGrayscale && renderMode == BW && glyph->width > 0 && glyph->height > 0) {
+      grayGlyphs.push_back({bitmap, static_cast<int16_t>(*x + glyph->left), static_cast<int16_t>(y - glyph->top),
+                            glyph->width, glyph->height});
+    }
+
+    for (int glyphY = 0; glyphY < glyph->height; glyphY++) {
+      const int screenY = y - glyph->top + glyphY;
+      if (screenY < 0 || screenY >= SCREEN_HEIGHT) continue;
+      for (int glyphX = 0; glyphX < glyph->width; glyphX++) {
+        const int screenX = *x + glyph->left + glyphX;
+        if (screenX < 0 || screenX >= SCREEN_WIDTH) continue;
+        const int pixelPosition = glyphY * glyph->width + glyphX;
+        const uint8_t byte = bitmap[pixelPosition / 4];
+        const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
+        const uint8_t bmpVal = (3 - (byte >> bit_index)) & 0x3;
+        if (renderMode == BW && bmpVal < 3) {
+          drawPixel(screenX, screenY, true);
+        } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
+          drawPixel(screenX, screenY, false);
+        } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
+          drawPixel(screenX, screenY, false);
+        }
+      }
+    }
+    *x += glyph->advanceX;
+  }
+
+  void drawPage(const std::vector<std::string>& lines, int marginLeft, int marginTop, int lineHeight) {
+    for (size_t i = 0; i < lines.size(); i++) {
+      int x = marginLeft;
+      const int y = marginTop + static_cast<int>(i) * lineHeight + 16;
+      for (const char c : lines[i]) renderChar(static_cast<uint8_t>(c), &x, y);
+    }
+  }
+
+  // Same walk as GfxRenderer::rasterizeGrayStrip; visits count the glyphs whose rows overlap the strip
+  void rasterizeGrayStrip(int stripY, int rows, uint8_t* lsbStrip, uint8_t* msbStrip) {
+    const GlyphBlit::GrayStripFn strip = GlyphBlit::grayStripFor(0);
+    for (const auto& glyph : grayGlyphs) {
+      int x0, y0, x1, y1;
+      rotateCoordinates(glyph.x, glyph.y, &x0, &y0);
+      rotateCoordinates(glyph.x + glyph.width - 1, glyph.y + glyph.height - 1, &x1, &y1);
+      if (std::max(y0, y1) < stripY || std::min(y0, y1) >= stripY + rows) continue;
+      glyphVisits++;
+      const GlyphBlit::Glyph placed = {glyph.bitmap, glyph.x, glyph.y, glyph.width, glyph.height};
+      strip(lsbStrip, msbStrip, placed, SCREEN_WIDTH, SCREEN_HEIGHT, stripY, rows);
+    }
+  }
+};
+
+// Display controller RAM: strips land at their row offset
+struct DisplayRam {
+  std::vector<uint8_t> bwRam = std::vector<uint8_t>(BUFFER_SIZE, 0xFF);
+  std::vector<uint8_t> redRam = std::vector<uint8_t>(BUFFER_SIZE, 0xFF);
+  size_t bytesWritten = 0;
+
+  void copyGrayscaleStrip(int y, int h, const uint8_t* lsbStrip, const uint8_t* msbStrip) {
+    const size_t size = static_cast<size_t>(h) * DISPLAY_WIDTH_BYTES;
+    memcpy(bwRam.data() + y * DISPLAY_WIDTH_BYTES, lsbStrip, size);
+    memcpy(redRam.data() + y * DISPLAY_WIDTH_BYTES, msbStrip, size);
+    bytesWritten += 2 * size;
+  }
+};
+
+struct Planes {
+  std::vector<uint8_t> bw;
+  std::vector<uint8_t> lsb;
+  std::vector<uint8_t> msb;
+  size_t glyphVisits;
+  long long micros;
+};
+
+Planes renderThreePass(const Font& font, const std::vector<std::string>& lines) {
+  std::vector<uint8_t> frameBuffer(BUFFER_SIZE, 0xFF);
+  Renderer renderer(font, frameBuffer.data());
+  Planes planes;
+  const auto start = std::chrono::steady_clock::now();
+
+  renderer.drawPage(lines, 10, 12, 26);
+  planes.bw = frameBuffer;  // storeBwBuffer()
+
+  memset(frameBuffer.data(), 0x00, BUFFER_SIZE);
+  renderer.renderMode = GRAYSCALE_LSB;
+  renderer.drawPage(lines, 10, 12, 26);
+  planes.lsb = frameBuffer;  // copyGrayscaleLsbBuffers()
+
+  memset(frameBuffer.data(), 0x00, BUFFER_SIZE);
+  renderer.renderMode = GRAYSCALE_MSB;
+  renderer.drawPage(lines, 10, 12, 26);
+  planes.msb = frameBuffer;  // copyGrayscaleMsbBuffers()
+
+  memcpy(frameBuffer.data(), planes.bw.data(), BUFFER_SIZE);  // restoreBwBuffer()
+  planes.micros =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  planes.glyphVisits = renderer.glyphVisits;
+  return planes;
+}
+
+Planes renderSinglePass(const Font& font, const std::vector<std::string>& lines, size_t* walkVisits,
+                        size_t* ramBytes) {
+  std::vector<uint8_t> frameBuffer(BUFFER_SIZE, 0xFF);
+  Renderer renderer(font, frameBuffer.data());
+  DisplayRam ram;
+  Planes planes;
+  const auto start = std::chrono::steady_clock::now();
+
+  renderer.capturingGrayscale = true;
+  renderer.drawPage(lines, 10, 12, 26);
+  renderer.capturingGrayscale = false;
+  *walkVisits = renderer.glyphVisits;
+
+  std::vector<uint8_t> lsbStrip(GRAY_STRIP_ROWS * DISPLAY_WIDTH_BYTES);
+  std::vector<uint8_t> msbStrip(GRAY_STRIP_ROWS * DISPLAY_WIDTH_BYTES);
+  for (int stripY = 0; stripY < DISPLAY_HEIGHT; stripY += GRAY_STRIP_ROWS) {
+    const int rows = std::min(GRAY_STRIP_ROWS, DISPLAY_HEIGHT - stripY);
+    const size_t stripSize = static_cast<size_t>(rows) * DISPLAY_WIDTH_BYTES;
+    memset(lsbStrip.data(), 0x00, stripSize);
+    memset(msbStrip.data(), 0x00, stripSize);
+    renderer.rasterizeGrayStrip(stripY, rows, lsbStrip.data(), msbStrip.data());
+    ram.copyGrayscaleStrip(stripY, rows, lsbStrip.data(), msbStrip.data());
+  }
+
+  planes.micros =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  planes.bw = frameBuffer;
+  planes.lsb = ram.bwRam;
+  planes.msb = ram.redRam;
+  planes.glyphVisits = renderer.glyphVisits;
+  *ramBytes = ram.bytesWritten;
+  return planes;
+}
+
+// Dense page: 29 lines of ~40 glyphs
+std::vector<std::string> makePage() {
+  std::vector<std::string> lines;
+  uint32_t seed = 7;
+  for (int line = 0; line < 29; line++) {
+    std::string text;
+    while (text.size() < 44) {
+      seed = seed * 1103515245 + 12345;
+      const int wordLen = 2 + (seed >> 16) % 8;
+      for (int i = 0; i < wordLen; i++) {
+        seed = seed * 1103515245 + 12345;
+        text += static_cast<char>('a' + (seed >> 16) % 26);
+      }
+      text += ' ';
+    }
+    lines.push_back(text);
+  }
+  return lines;
+}
+
+size_t countSetBits(const std::vector<uint8_t>& plane) {
+  size_t bits = 0;
+  for (const uint8_t b : plane) bits += __builtin_popcount(b);
+  return bits;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Grayscale Single-Pass Rasterizer");
+
+  const Font font;
+  const auto page = makePage();
+
+  const Planes threePass = renderThreePass(font, page);
+  size_t walkVisits = 0;
+  size_t ramBytes = 0;
+  const Planes singlePass = renderSinglePass(font, page, &walkVisits, &ramBytes);
+
+  // Test 1: identical planes
+  runner.expectTrue(threePass.bw == singlePass.bw, "BW frame matches the BW pass");
+  runner.expectTrue(threePass.lsb == singlePass.lsb, "LSB plane matches the GRAYSCALE_LSB pass");
+  runner.expectTrue(threePass.msb == singlePass.msb, "MSB plane matches the GRAYSCALE_MSB pass");
+  runner.expectTrue(countSetBits(singlePass.lsb) > 0 && countSetBits(singlePass.msb) > countSetBits(singlePass.lsb),
+                    "Gray planes are populated (MSB covers LSB)");
+  runner.expectEq(2 * BUFFER_SIZE, ramBytes, "Strips cover both planes exactly once");
+
+  // Test 2: page walked once
+  const size_t pageGlyphs = threePass.glyphVisits / 3;
+  runner.expectEq(pageGlyphs, walkVisits, "Single pass walks the page once");
+  runner.expectTrue(singlePass.glyphVisits < threePass.glyphVisits, "Fewer glyph visits than three passes",
+                    std::to_string(singlePass.glyphVisits) + " vs " + std::to_string(threePass.glyphVisits));
+
+  std::cout << "\n    Mode          Layout walks   Glyph visits   Time (us)\n";
+  printf("    %-13s %12d %14zu %11lld\n", "three-pass", 3, threePass.glyphVisits, threePass.micros);
+  printf("    %-13s %12d %14zu %11lld\n", "single-pass", 1, singlePass.glyphVisits, singlePass.micros);
+  std::cout << "\n";
+
+  // Test 3: a glyph straddling a strip boundary is rasterized in both strips
+  {
+    // Portrait panel row is 479 - x: 'W' (11px wide) drawn at x = 41 covers panel rows 428..438, across 432
+    const std::vector<std::string> shifted = {std::string(6, ' ') + "W"};
+    const Planes a = renderThreePass(font, shifted);
+    size_t visits = 0;
+    size_t bytes = 0;
+    const Planes b = renderSinglePass(font, shifted, &visits, &bytes);
+    runner.expectTrue(a.lsb == b.lsb && a.msb == b.msb, "Glyph across a strip boundary matches");
+    runner.expectEq(static_cast<size_t>(2), b.glyphVisits - visits, "Straddling glyph visited once per strip");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
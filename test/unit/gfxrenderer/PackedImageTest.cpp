@@ -0,0 +1,227 @@
+#include "test_utils.h"
+
+#include <GlyphBlit.h>
+#include <PackedImage.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Checks the packed image cache against the path it replaced for inline EPUB images: GfxRenderer::drawBitmap
+// decoding Bitmap::readRow rows (0 black .. 3 white) and calling drawPixel with rotateCoordinates per pixel.
+// Packed rows are blitted in strips the way GfxRenderer::drawPackedImage does, in each orientation and
+// render mode, and both paths are timed on a full-width image.
+
+namespace {
+
+constexpr int DISPLAY_WIDTH = 800;
+constexpr int DISPLAY_HEIGHT = 480;
+constexpr int DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+constexpr size_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+constexpr int ROW_BUFFER_SIZE = 2400;  // GfxRenderer::BITMAP_ROW_BYTES_SIZE
+
+enum Orientation { Portrait, LandscapeClockwise, PortraitInverted, LandscapeCounterClockwise };
+enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+const char* const ORIENTATION_NAMES[] = {"Portrait", "LandscapeCW", "PortraitInverted", "LandscapeCCW"};
+const char* const MODE_NAMES[] = {"BW", "LSB", "MSB"};
+
+struct Screen {
+  Orientation orientation;
+  int width() const { return orientation == Portrait || orientation == PortraitInverted ? 480 : 800; }
+  int height() const { return orientation == Portrait || orientation == PortraitInverted ? 800 : 480; }
+
+  void rotateCoordinates(int x, int y, int* rotatedX, int* rotatedY) const {
+    switch (orientation) {
+      case Portrait:
+        *rotatedX = y;
+        *rotatedY = DISPLAY_HEIGHT - 1 - x;
+        break;
+      case LandscapeClockwise:
+        *rotatedX = DISPLAY_WIDTH - 1 - x;
+        *rotatedY = DISPLAY_HEIGHT - 1 - y;
+        break;
+      case PortraitInverted:
+        *rotatedX = DISPLAY_WIDTH - 1 - y;
+        *rotatedY = x;
+        break;
+      case LandscapeCounterClockwise:
+        *rotatedX = x;
+        *rotatedY = y;
+        break;
+    }
+  }
+};
+
+// Mirrors GfxRenderer::drawPixel
+void drawPixel(const Screen& screen, uint8_t* frameBuffer, int x, int y, bool state) {
+  int rotatedX = 0;
+  int rotatedY = 0;
+  screen.rotateCoordinates(x, y, &rotatedX, &rotatedY);
+  if (rotatedX < 0 || rotatedX >= DISPLAY_WIDTH || rotatedY < 0 || rotatedY >= DISPLAY_HEIGHT) return;
+  const uint16_t byteIndex = rotatedY * DISPLAY_WIDTH_BYTES + (rotatedX / 8);
+  const uint8_t bitPosition = 7 - (rotatedX % 8);
+  if (state) {
+    frameBuffer[byteIndex] &= ~(1 << bitPosition);
+  } else {
+    frameBuffer[byteIndex] |= 1 << bitPosition;
+  }
+}
+
+// Deterministic image in Bitmap::readRow layout, with garbage in the padding bits of each row
+struct Image {
+  int width;
+  int height;
+  std::vector<uint8_t> rows;
+
+  Image(const int w, const int h, uint32_t seed) : width(w), height(h), rows(PackedImage::rowBytes(w) * h) {
+    for (auto& byte : rows) {
+      seed = seed * 1103515245 + 12345;
+      byte = static_cast<uint8_t>(seed >> 16);
+    }
+  }
+  const uint8_t* row(const int y) const { return &rows[y * PackedImage::rowBytes(width)]; }
+};
+
+// Mirrors the unscaled drawBitmap loop for a top-down 2-bit BMP
+void drawBitmapPerPixel(const Screen& screen, uint8_t* frameBuffer, const Image& image, int x, int y,
+                        RenderMode renderMode) {
+  for (int bmpY = 0; bmpY < image.height; bmpY++) {
+    const int screenY = y + bmpY;
+    if (screenY >= screen.height()) break;
+    const uint8_t* row = image.row(bmpY);
+    for (int bmpX = 0; bmpX < image.width; bmpX++) {
+      const int screenX = x + bmpX;
+      if (screenX >= screen.width()) break;
+      const uint8_t val = row[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
+      if (renderMode == BW && val < 3) {
+        drawPixel(screen, frameBuffer, screenX, screenY, true);
+      } else if (renderMode == GRAYSCALE_MSB && (val == 1 || val == 2)) {
+        drawPixel(screen, frameBuffer, screenX, screenY, false);
+      } else if (renderMode == GRAYSCALE_LSB && val == 1) {
+        drawPixel(screen, frameBuffer, screenX, screenY, false);
+      }
+    }
+  }
+}
+
+std::vector<uint8_t> pack(const Image& image) {
+  const int rowBytes = PackedImage::rowBytes(image.width);
+  std::vector<uint8_t> packed(rowBytes * image.height);
+  for (int y = 0; y < image.height; y++) PackedImage::packRow(image.row(y), image.width, &packed[y * rowBytes]);
+  return packed;
+}
+
+// Mirrors GfxRenderer::drawPackedImage once the header is read
+void drawPacked(const Screen& screen, uint8_t* frameBuffer, const std::vector<uint8_t>& packed, const int width,
+                const int height, int x, int y, RenderMode renderMode, const int rowBufferSize = ROW_BUFFER_SIZE) {
+  uint8_t inkMask = GlyphBlit::INK_BW;
+  bool setBits = false;
+  if (renderMode == GRAYSCALE_MSB) {
+    inkMask = GlyphBlit::INK_GRAYSCALE_MSB;
+    setBits = true;
+  } else if (renderMode == GRAYSCALE_LSB) {
+    inkMask = GlyphBlit::INK_GRAYSCALE_LSB;
+    setBits = true;
+  }
+  const GlyphBlit::Fn blit = GlyphBlit::forOrientation(screen.orientation, true);
+  const int rowBytes = PackedImage::rowBytes(width);
+  const int stripRows = rowBufferSize / rowBytes;
+  for (int row = 0; row < height && y + row < screen.height(); row += stripRows) {
+    const int rows = std::min(stripRows, height - row);
+    const GlyphBlit::Glyph strip = {&packed[row * rowBytes], x, y + row, rowBytes * 4, rows};
+    blit(frameBuffer, strip, screen.width(), screen.height(), inkMask, setBits);
+  }
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("PackedImage");
+
+  // Test 1: Cache file naming
+  {
+    runner.expectEq(std::string("/cache/img_3.pki"), PackedImage::pathFor("/cache/img_3.bmp"), "Extension replaced");
+    runner.expectEq(std::string("/cache.d/img.pki"), PackedImage::pathFor("/cache.d/img"), "Dot in directory kept");
+    runner.expectEq(std::string("img.pki"), PackedImage::pathFor("img.bmp"), "Bare file name");
+  }
+
+  // Test 2: Rows are inverted and padding is white
+  {
+    const uint8_t bmpRow[] = {0x1B, 0x00, 0xFF};  // 0 1 2 3 | black x4 | white x4
+    uint8_t out[3];
+    PackedImage::packRow(bmpRow, 12, out);
+    runner.expectEq(0xE4, static_cast<int>(out[0]), "Levels inverted");
+    runner.expectEq(0xFF, static_cast<int>(out[1]), "Black becomes 3");
+    runner.expectEq(0x00, static_cast<int>(out[2]), "White becomes 0");
+
+    const uint8_t black[] = {0x00, 0x00};
+    for (int width = 5; width <= 8; width++) {
+      PackedImage::packRow(black, width, out);
+      const int inked = 4 + width % 4 + (width % 4 == 0 ? 4 : 0);
+      const int expected = static_cast<uint8_t>(0xFF << (8 - (inked - 4) * 2));
+      runner.expectEq(expected, static_cast<int>(out[1]), "Padding white at width " + std::to_string(width));
+    }
+  }
+
+  // Test 3: Strips match drawBitmap in every orientation and mode, including clipped placements
+  {
+    const Image images[] = {Image(203, 157, 1), Image(480, 64, 2), Image(1, 1, 3), Image(97, 700, 4)};
+    const int positions[][2] = {{0, 0}, {13, 29}, {430, 760}, {750, 420}};
+    for (int o = 0; o < 4; o++) {
+      const Screen screen{static_cast<Orientation>(o)};
+      for (int mode = 0; mode < 3; mode++) {
+        bool allMatch = true;
+        for (const Image& image : images) {
+          const std::vector<uint8_t> packed = pack(image);
+          for (const auto& pos : positions) {
+            // Small row buffer too, so tall images span many strips
+            for (const int rowBufferSize : {ROW_BUFFER_SIZE, PackedImage::rowBytes(image.width) * 3}) {
+              std::vector<uint8_t> expected(BUFFER_SIZE, mode == BW ? 0xFF : 0x00);
+              std::vector<uint8_t> actual(expected);
+              drawBitmapPerPixel(screen, expected.data(), image, pos[0], pos[1], static_cast<RenderMode>(mode));
+              drawPacked(screen, actual.data(), packed, image.width, image.height, pos[0], pos[1],
+                         static_cast<RenderMode>(mode), rowBufferSize);
+              allMatch &= expected == actual;
+            }
+          }
+        }
+        runner.expectTrue(allMatch, std::string(ORIENTATION_NAMES[o]) + " " + MODE_NAMES[mode] + " matches");
+      }
+    }
+  }
+
+  // Test 4: Benchmark a full-width illustration in all three passes
+  {
+    const Screen screen{Portrait};
+    const Image image(480, 360, 5);
+    const std::vector<uint8_t> packed = pack(image);
+    std::vector<uint8_t> frameBuffer(BUFFER_SIZE);
+    constexpr int RUNS = 10;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; r++) {
+      for (const RenderMode mode : {BW, GRAYSCALE_LSB, GRAYSCALE_MSB}) {
+        drawBitmapPerPixel(screen, frameBuffer.data(), image, 0, 100, mode);
+      }
+    }
+    const auto oldUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; r++) {
+      for (const RenderMode mode : {BW, GRAYSCALE_LSB, GRAYSCALE_MSB}) {
+        drawPacked(screen, frameBuffer.data(), packed, image.width, image.height, 0, 100, mode);
+      }
+    }
+    const auto newUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    printf("\n    %dx%d image x %d (3 passes): drawPixel %.2f ms, packed strips %.2f ms\n\n", image.width,
+           image.height, RUNS, oldUs / 1000.0, newUs / 1000.0);
+    runner.expectTrue(newUs < oldUs, "Packed strips beat per-pixel drawing");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
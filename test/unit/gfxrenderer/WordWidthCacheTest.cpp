@@ -0,0 +1,218 @@
+#include "test_utils.h"
+
+#include <SdFat.h>
+#include <WordWidthCache.h>
+
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Checks WordWidthCache lookups, CLOCK eviction, per-font clearing and the save/load round trip, and
+// compares its hit rate on a Zipf-like word stream against the unordered_map it replaced in
+// GfxRenderer (512 entries, cleared when full and after every chapter).
+
+namespace {
+
+constexpr int FONT_A = 1818981670;
+constexpr int FONT_B = -42;
+
+int fakeWidth(const std::string& word) { return static_cast<int>(word.size()) * 9 + 3; }
+
+// Deterministic word stream: a few hundred common words make up most of the text, as in prose
+std::vector<std::string> makeWordStream(const size_t count) {
+  std::vector<std::string> words;
+  words.reserve(count);
+  uint32_t state = 12345;
+  for (size_t i = 0; i < count; i++) {
+    state = state * 1103515245 + 12345;
+    const uint32_t r = (state >> 8) & 0xFFFF;
+    // Rank ~ 1/r distribution over 20000 words
+    const uint32_t rank = 20000u / (1 + r % 20000u);
+    words.push_back("w" + std::to_string(rank));
+  }
+  return words;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("WordWidthCache");
+
+  // Test 1: Miss, insert, hit
+  {
+    WordWidthCache cache;
+    int width = -1;
+    runner.expectFalse(cache.lookup(FONT_A, EpdFontFamily::REGULAR, "hello", &width), "Empty cache misses");
+    cache.insert(FONT_A, EpdFontFamily::REGULAR, "hello", 47);
+    runner.expectTrue(cache.lookup(FONT_A, EpdFontFamily::REGULAR, "hello", &width), "Inserted word hits");
+    runner.expectEq(47, width, "Hit returns stored width");
+    runner.expectFalse(cache.lookup(FONT_A, EpdFontFamily::BOLD, "hello", &width), "Style is part of the key");
+    runner.expectFalse(cache.lookup(FONT_B, EpdFontFamily::REGULAR, "hello", &width), "Font is part of the key");
+    cache.insert(FONT_A, EpdFontFamily::REGULAR, "hello", 50);
+    cache.lookup(FONT_A, EpdFontFamily::REGULAR, "hello", &width);
+    runner.expectEq(50, width, "Re-insert updates in place");
+    runner.expectEq(static_cast<size_t>(1), cache.entryCount(), "Re-insert doesn't duplicate");
+    runner.expectEq(static_cast<uint32_t>(2), cache.hits(), "Hit counter");
+    runner.expectEq(static_cast<uint32_t>(3), cache.misses(), "Miss counter");
+  }
+
+  // Test 2: Full cache evicts instead of clearing, and referenced words survive
+  {
+    WordWidthCache cache;
+    const size_t capacity = WordWidthCache::SETS * WordWidthCache::WAYS;
+    cache.insert(FONT_A, EpdFontFamily::REGULAR, "the", 30);
+    int width = 0;
+    bool hotSurvived = true;
+    for (size_t i = 0; i < capacity * 4; i++) {
+      const std::string word = "cold" + std::to_string(i);
+      cache.insert(FONT_A, EpdFontFamily::REGULAR, word.c_str(), fakeWidth(word));
+      hotSurvived &= cache.lookup(FONT_A, EpdFontFamily::REGULAR, "the", &width);
+    }
+    runner.expectTrue(hotSurvived, "Frequently used word is never evicted");
+    runner.expectTrue(cache.evictions() > 0, "Overflow evicts");
+    runner.expectTrue(cache.entryCount() > capacity * 9 / 10, "Cache stays nearly full");
+
+    size_t correct = 0;
+    size_t found = 0;
+    for (size_t i = capacity * 3; i < capacity * 4; i++) {
+      const std::string word = "cold" + std::to_string(i);
+      if (cache.lookup(FONT_A, EpdFontFamily::REGULAR, word.c_str(), &width)) {
+        found++;
+        if (width == fakeWidth(word)) correct++;
+      }
+    }
+    runner.expectEq(found, correct, "Surviving entries keep their widths");
+    runner.expectTrue(found > capacity / 2, "Recent words mostly survive");
+  }
+
+  // Test 3: clearFont only drops that font
+  {
+    WordWidthCache cache;
+    cache.insert(FONT_A, EpdFontFamily::REGULAR, "alpha", 10);
+    cache.insert(FONT_B, EpdFontFamily::REGULAR, "alpha", 20);
+    cache.clearFont(FONT_A);
+    int width = 0;
+    runner.expectFalse(cache.lookup(FONT_A, EpdFontFamily::REGULAR, "alpha", &width), "clearFont drops font");
+    runner.expectTrue(cache.lookup(FONT_B, EpdFontFamily::REGULAR, "alpha", &width), "clearFont keeps others");
+    runner.expectEq(20, width, "Other font keeps width");
+    cache.release();
+    runner.expectFalse(cache.lookup(FONT_B, EpdFontFamily::REGULAR, "alpha", &width), "release drops all");
+  }
+
+  // Test 4: Save/load round trip of one font
+  {
+    WordWidthCache cache;
+    for (int i = 0; i < 300; i++) {
+      const std::string word = "word" + std::to_string(i);
+      cache.insert(FONT_A, EpdFontFamily::ITALIC, word.c_str(), fakeWidth(word));
+    }
+    cache.insert(FONT_B, EpdFontFamily::REGULAR, "other", 99);
+
+    FsFile file;
+    file.setBuffer("");
+    runner.expectTrue(cache.save(file, FONT_A, 777), "Save succeeds");
+    const std::string saved = file.getBuffer();
+
+    WordWidthCache restored;
+    file.setBuffer(saved);
+    runner.expectTrue(restored.load(file, FONT_A, 777), "Load succeeds");
+    runner.expectEq(cache.entryCount() - 1, restored.entryCount(), "Only the saved font is restored");
+    bool allMatch = true;
+    int width = 0;
+    for (int i = 0; i < 300; i++) {
+      const std::string word = "word" + std::to_string(i);
+      if (cache.lookup(FONT_A, EpdFontFamily::ITALIC, word.c_str(), &width)) {
+        const int expected = width;
+        allMatch &= restored.lookup(FONT_A, EpdFontFamily::ITALIC, word.c_str(), &width) && width == expected;
+      }
+    }
+    runner.expectTrue(allMatch, "Restored widths match");
+    runner.expectFalse(restored.lookup(FONT_B, EpdFontFamily::REGULAR, "other", &width), "Other font not saved");
+
+    WordWidthCache stale;
+    file.setBuffer(saved);
+    runner.expectFalse(stale.load(file, FONT_A, 778), "Fingerprint mismatch rejected");
+    file.setBuffer(saved);
+    runner.expectFalse(stale.load(file, FONT_B, 777), "Font id mismatch rejected");
+    file.setBuffer(saved.substr(0, saved.size() - 3));
+    runner.expectFalse(stale.load(file, FONT_A, 777), "Truncated file rejected");
+  }
+
+  // Test 5: Hit rate over a book against the old clear-all map
+  {
+    constexpr size_t CHAPTERS = 20;
+    constexpr size_t WORDS_PER_CHAPTER = 5000;
+    constexpr size_t OLD_MAX = 512;
+    const std::vector<std::string> words = makeWordStream(CHAPTERS * WORDS_PER_CHAPTER);
+
+    std::unordered_map<std::string, int> oldMap;
+    size_t oldHits = 0;
+    WordWidthCache cache;
+    for (size_t i = 0; i < words.size(); i++) {
+      if (i % WORDS_PER_CHAPTER == 0) oldMap.clear();  // EpubChapterParser cleared after each chapter
+      const std::string& word = words[i];
+      if (oldMap.count(word)) {
+        oldHits++;
+      } else {
+        if (oldMap.size() >= OLD_MAX) oldMap.clear();
+        oldMap[word] = fakeWidth(word);
+      }
+
+      int width;
+      if (!cache.lookup(FONT_A, EpdFontFamily::REGULAR, word.c_str(), &width)) {
+        cache.insert(FONT_A, EpdFontFamily::REGULAR, word.c_str(), fakeWidth(word));
+      }
+    }
+
+    const double oldRate = 100.0 * oldHits / words.size();
+    const double newRate = 100.0 * cache.hits() / words.size();
+    printf("\n    %zu words: clear-all map %.1f%% hits, CLOCK cache %.1f%% hits (%u evictions)\n\n", words.size(),
+           oldRate, newRate, static_cast<unsigned>(cache.evictions()));
+    runner.expectTrue(newRate > oldRate, "CLOCK cache beats clear-all map");
+  }
+
+  // Test 6: an entry whose set and tag match but whose check word doesn't is another word, not a hit.
+  // The collision is made by editing a saved entry: header is 13 bytes, then set (1), tag (4), check (4),
+  // width (2); the check's low byte is the word length, the other three its second hash.
+  {
+    WordWidthCache cache;
+    cache.insert(FONT_A, EpdFontFamily::REGULAR, "alpha", 55);
+    FsFile file;
+    file.setBuffer("");
+    cache.save(file, FONT_A, 777);
+    const std::string saved = file.getBuffer();
+    constexpr size_t CHECK_OFFSET = 13 + 1 + 4;
+    runner.expectEq(CHECK_OFFSET + 4 + 2, saved.size(), "One saved entry");
+
+    auto loadsAsHit = [&](const std::string& bytes) {
+      WordWidthCache restored;
+      FsFile in;
+      in.setBuffer(bytes);
+      int width = 0;
+      return restored.load(in, FONT_A, 777) && restored.entryCount() == 1 &&
+             restored.lookup(FONT_A, EpdFontFamily::REGULAR, "alpha", &width) && width == 55;
+    };
+    runner.expectTrue(loadsAsHit(saved), "Unedited entry hits");
+
+    std::string otherLength = saved;
+    otherLength[CHECK_OFFSET] = static_cast<char>(otherLength[CHECK_OFFSET] + 1);
+    runner.expectFalse(loadsAsHit(otherLength), "Tag match with another length misses");
+
+    std::string otherHash = saved;
+    otherHash[CHECK_OFFSET + 2] = static_cast<char>(otherHash[CHECK_OFFSET + 2] ^ 0x10);
+    runner.expectFalse(loadsAsHit(otherHash), "Tag match with another second hash misses");
+
+    // The real word gets its own way beside the colliding entry instead of updating it
+    WordWidthCache restored;
+    file.setBuffer(otherHash);
+    restored.load(file, FONT_A, 777);
+    restored.insert(FONT_A, EpdFontFamily::REGULAR, "alpha", 60);
+    int width = 0;
+    runner.expectTrue(restored.lookup(FONT_A, EpdFontFamily::REGULAR, "alpha", &width) && width == 60,
+                      "Real word inserted next to the collision hits with its own width");
+    runner.expectEq(static_cast<size_t>(2), restored.entryCount(), "Collision and real word kept apart");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,351 @@
+#include "test_utils.h"
+
+#include <Html5Normalizer.h>
+
+#include <cctype>
+#include <cstdint>
+#include <string>
+
+// Runs the streaming VoidElementNormalizer against a mirror of the old normalizeVoidElements file pass.
+// The normalizer now sits behind the ZIP inflater and sees whatever chunk sizes it produces, so every
+// input is also split at each byte boundary and fed one byte at a time; the output must never change.
+
+namespace {
+
+// Mirror of the pre-streaming normalizeVoidElements, reading the input in 512 byte chunks
+std::string legacyNormalize(const std::string& input) {
+  constexpr const char* VOID_ELEMENTS[] = {"img",  "br",  "hr",    "input", "meta",   "link",  "area",
+                                           "base", "col", "embed", "param", "source", "track", "wbr"};
+  constexpr size_t MAX_TAG_NAME_LENGTH = 8;
+  constexpr size_t BUFFER_SIZE = 512;
+  enum class State { Normal, InTagStart, InTagName, InTagAttrs, InQuote, InClosingTagName, InClosingTagRest };
+
+  auto isVoidElement = [&](const char* name, size_t len) {
+    for (const char* ve : VOID_ELEMENTS) {
+      if (std::string(ve).size() != len) continue;
+      bool match = true;
+      for (size_t j = 0; j < len && match; j++) {
+        if (std::tolower(static_cast<unsigned char>(name[j])) != ve[j]) match = false;
+      }
+      if (match) return true;
+    }
+    return false;
+  };
+
+  std::string out;
+  State state = State::Normal;
+  char tagName[MAX_TAG_NAME_LENGTH + 1] = {0};
+  size_t tagNameLen = 0;
+  char closingTagWhitespace[8] = {0};
+  size_t closingTagWsLen = 0;
+  bool isCurrentTagVoid = false;
+  char quoteChar = 0;
+  char prevChar = 0;
+
+  auto writeClosingTag = [&](bool withWhitespace) {
+    out += "</";
+    out.append(tagName, tagNameLen);
+    if (withWhitespace) out.append(closingTagWhitespace, closingTagWsLen);
+  };
+
+  for (size_t start = 0; start < input.size(); start += BUFFER_SIZE) {
+    const std::string chunk = input.substr(start, BUFFER_SIZE);
+    for (const char c : chunk) {
+      switch (state) {
+        case State::Normal:
+          if (c == '<') {
+            state = State::InTagStart;
+            tagNameLen = 0;
+            isCurrentTagVoid = false;
+          } else {
+            out += c;
+          }
+          break;
+
+        case State::InTagStart:
+          if (c == '/') {
+            state = State::InClosingTagName;
+            tagNameLen = 0;
+            closingTagWsLen = 0;
+          } else if (std::isalpha(static_cast<unsigned char>(c))) {
+            state = State::InTagName;
+            tagName[0] = c;
+            tagNameLen = 1;
+            out += '<';
+            out += c;
+          } else {
+            state = State::Normal;
+            out += '<';
+            out += c;
+          }
+          break;
+
+        case State::InTagName:
+          if (std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == ':') {
+            if (tagNameLen < MAX_TAG_NAME_LENGTH) tagName[tagNameLen++] = c;
+            out += c;
+          } else {
+            tagName[tagNameLen] = '\0';
+            isCurrentTagVoid = isVoidElement(tagName, tagNameLen);
+            if (c == '>') {
+              if (isCurrentTagVoid && prevChar != '/') out += " /";
+              out += c;
+              state = State::Normal;
+            } else if (std::isspace(static_cast<unsigned char>(c)) || c == '/') {
+              out += c;
+              state = State::InTagAttrs;
+            } else {
+              out += c;
+              state = State::Normal;
+            }
+          }
+          break;
+
+        case State::InTagAttrs:
+          if (c == '"' || c == '\'') {
+            state = State::InQuote;
+            quoteChar = c;
+          } else if (c == '>') {
+            if (isCurrentTagVoid && prevChar != '/') out += " /";
+            state = State::Normal;
+          }
+          out += c;
+          break;
+
+        case State::InQuote:
+          if (c == quoteChar) state = State::InTagAttrs;
+          out += c;
+          break;
+
+        case State::InClosingTagName:
+          if (std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == ':') {
+            if (tagNameLen < MAX_TAG_NAME_LENGTH) {
+              tagName[tagNameLen++] = c;
+            } else {
+              writeClosingTag(false);
+              out += c;
+              state = State::InClosingTagRest;
+            }
+          } else if (c == '>') {
+            tagName[tagNameLen] = '\0';
+            if (!isVoidElement(tagName, tagNameLen)) {
+              writeClosingTag(true);
+              out += '>';
+            }
+            state = State::Normal;
+          } else if (std::isspace(static_cast<unsigned char>(c))) {
+            if (closingTagWsLen < sizeof(closingTagWhitespace)) closingTagWhitespace[closingTagWsLen++] = c;
+          } else {
+            writeClosingTag(false);
+            out += c;
+            state = State::Normal;
+          }
+          break;
+
+        case State::InClosingTagRest:
+          out += c;
+          if (c == '>') state = State::Normal;
+          break;
+      }
+      prevChar = c;
+    }
+  }
+
+  if (state == State::InTagStart) {
+    out += '<';
+  } else if (state == State::InClosingTagName) {
+    writeClosingTag(true);
+  }
+  return out;
+}
+
+// Print sink that collects the normalized output, optionally refusing writes past a limit
+class StringSink : public Print {
+ public:
+  explicit StringSink(size_t limit = SIZE_MAX) : limit_(limit) {}
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+
+  size_t write(const uint8_t* buf, size_t size) override {
+    if (data.size() + size > limit_) return 0;
+    data.append(reinterpret_cast<const char*>(buf), size);
+    return size;
+  }
+
+  std::string data;
+
+ private:
+  size_t limit_;
+};
+
+std::string normalizeSplit(const std::string& input, size_t split) {
+  StringSink sink;
+  html5::VoidElementNormalizer normalizer(sink);
+  normalizer.write(reinterpret_cast<const uint8_t*>(input.data()), split);
+  normalizer.write(reinterpret_cast<const uint8_t*>(input.data()) + split, input.size() - split);
+  normalizer.finish();
+  return sink.data;
+}
+
+std::string normalizeBytewise(const std::string& input) {
+  StringSink sink;
+  html5::VoidElementNormalizer normalizer(sink);
+  for (const char c : input) normalizer.write(static_cast<uint8_t>(c));
+  normalizer.finish();
+  return sink.data;
+}
+
+std::string normalize(const std::string& input) { return normalizeSplit(input, input.size()); }
+
+// Every split point and byte-at-a-time feeding must match the old whole-file pass
+bool matchesLegacyAtEveryBoundary(const std::string& input) {
+  const std::string expected = legacyNormalize(input);
+  for (size_t split = 0; split <= input.size(); split++) {
+    if (normalizeSplit(input, split) != expected) {
+      printf("    split at %zu differs for: %s\n", split, input.c_str());
+      return false;
+    }
+  }
+  return normalizeBytewise(input) == expected;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Html5Normalizer");
+
+  // Test 1: Void elements gain a self-closing slash
+  {
+    runner.expectEq(std::string("<img src=\"x\" />"), normalize("<img src=\"x\">"), "img with attributes");
+    runner.expectEq(std::string("a<br />b"), normalize("a<br>b"), "Bare br");
+    runner.expectEq(std::string("<HR />"), normalize("<HR>"), "Uppercase void element");
+    runner.expectEq(std::string("<p>text</p>"), normalize("<p>text</p>"), "Non-void elements untouched");
+  }
+
+  // Test 2: Already self-closed tags are left alone
+  {
+    runner.expectEq(std::string("<br/>"), normalize("<br/>"), "br/ unchanged");
+    runner.expectEq(std::string("<img src=\"x\" />"), normalize("<img src=\"x\" />"), "img /> unchanged");
+  }
+
+  // Test 3: Stray void closing tags are dropped, others replayed with their whitespace
+  {
+    runner.expectEq(std::string("a<br />b"), normalize("a<br></br>b"), "</br> dropped");
+    runner.expectEq(std::string("x"), normalize("x</img >"), "</img > with whitespace dropped");
+    runner.expectEq(std::string("<p>y</p >"), normalize("<p>y</p >"), "</p > keeps its whitespace");
+  }
+
+  // Test 4: A '>' inside a quoted attribute does not end the tag
+  {
+    runner.expectEq(std::string("<img alt=\"a>b\" />"), normalize("<img alt=\"a>b\">"), "Double quoted >");
+    runner.expectEq(std::string("<img alt='c>d' />"), normalize("<img alt='c>d'>"), "Single quoted >");
+  }
+
+  // Test 5: Tag names past MAX_TAG_NAME_LENGTH pass through untouched
+  {
+    runner.expectEq(std::string("</verylongtagname>"), normalize("</verylongtagname>"), "Long closing tag");
+    runner.expectEq(std::string("<verylongtagname>"), normalize("<verylongtagname>"), "Long opening tag");
+  }
+
+  // Test 6: Comments, doctypes and tags left open at end of input
+  {
+    runner.expectEq(std::string("<!DOCTYPE html>"), normalize("<!DOCTYPE html>"), "Doctype passes");
+    runner.expectEq(std::string("text<"), normalize("text<"), "Trailing <");
+    runner.expectEq(std::string("text</di"), normalize("text</di"), "Trailing partial closing tag");
+  }
+
+  // Test 7: Every chunk boundary matches the old file pass
+  {
+    const char* inputs[] = {
+        "<p>a<br>b</br>c<img src=\"x\"><img alt=\"a>b\"/></p>",
+        "<hr/><HR><input type='text' value='1>0'><wbr></wbr ></p >",
+        "<!DOCTYPE html><?xml version=\"1.0\"?><meta charset=\"utf-8\"><link rel=x></link>",
+        "</verylongtagname></br\t></p\n><a:b>< notatag><1></x-y-z></col>",
+        "<source src=a><track><embed><param><area><base><col></col ></col\t\t\t\t\t\t\t\t\t>",
+    };
+    bool allMatch = true;
+    for (const char* input : inputs) allMatch = matchesLegacyAtEveryBoundary(input) && allMatch;
+    runner.expectTrue(allMatch, "All split points match legacy output");
+  }
+
+  // Test 8: Input longer than the output buffer crosses several flushes
+  {
+    std::string input;
+    for (int i = 0; i < 200; i++) input += "<p>line " + std::to_string(i) + "<br><img src=\"i.png\"></br></p>\n";
+    const std::string expected = legacyNormalize(input);
+    runner.expectTrue(input.size() > 4096, "Input spans many buffers");
+    runner.expectEq(expected, normalize(input), "Single write matches legacy");
+    runner.expectEq(expected, normalizeBytewise(input), "Byte writes match legacy");
+    bool splitsMatch = true;
+    for (size_t split = 0; split <= input.size(); split += 97) {
+      splitsMatch = splitsMatch && normalizeSplit(input, split) == expected;
+    }
+    runner.expectTrue(splitsMatch, "Split writes match legacy");
+  }
+
+  // Test 9: A failing output is reported and later writes are refused
+  {
+    std::string input;
+    for (int i = 0; i < 100; i++) input += "<img src=\"a\">";
+    StringSink sink(100);
+    html5::VoidElementNormalizer normalizer(sink);
+    const size_t written = normalizer.write(reinterpret_cast<const uint8_t*>(input.data()), input.size());
+    runner.expectEq(static_cast<size_t>(0), written, "Write reports failure");
+    runner.expectEq(static_cast<size_t>(0), normalizer.write('x'), "Later writes refused");
+    runner.expectFalse(normalizer.finish(), "finish() reports failure");
+  }
+
+  // Test 10: A normalizer restarted at any sync point reproduces the rest of the output
+  {
+    std::string input;
+    for (int i = 0; i < 300; i++) {
+      input += "<p class=\"c\">Line " + std::to_string(i) + "<br><img alt='x>y' src=\"i.png\"></br></p>\n";
+    }
+    StringSink full;
+    html5::VoidElementNormalizer first(full);
+    first.write(reinterpret_cast<const uint8_t*>(input.data()), input.size());
+    first.finish();
+
+    bool allMatch = true;
+    int restarts = 0;
+    for (uint32_t stop = 0; stop < full.data.size(); stop += 997) {
+      // Sync points are only kept around the latest output, so ask while the pass is still there
+      StringSink sink;
+      html5::VoidElementNormalizer pass(sink);
+      pass.write(reinterpret_cast<const uint8_t*>(input.data()), input.size() * stop / full.data.size() + 64);
+      html5::VoidElementNormalizer::SyncPoint point;
+      if (!pass.syncPointBefore(stop, &point)) continue;
+
+      StringSink tail;
+      html5::VoidElementNormalizer resumed(tail, point, stop);
+      resumed.write(reinterpret_cast<const uint8_t*>(input.data()) + point.input, input.size() - point.input);
+      resumed.finish();
+      allMatch = allMatch && tail.data == full.data.substr(stop);
+      restarts++;
+    }
+    runner.expectEq(static_cast<int>((full.data.size() + 996) / 997), restarts, "Sync point found for every stop");
+    runner.expectTrue(allMatch, "Restarted output matches the rest of the full pass");
+  }
+
+  // Test 11: Held sync points survive the rest of the input
+  {
+    std::string input;
+    for (int i = 0; i < 200; i++) input += "<div>text text text text text text text<hr></div>\n";
+    StringSink sink;
+    html5::VoidElementNormalizer normalizer(sink);
+    normalizer.write(reinterpret_cast<const uint8_t*>(input.data()), 2048);
+    normalizer.holdSyncPoints();
+    normalizer.write(reinterpret_cast<const uint8_t*>(input.data()) + 2048, input.size() - 2048);
+    normalizer.finish();
+    html5::VoidElementNormalizer::SyncPoint point;
+    runner.expectTrue(normalizer.syncPointBefore(1500, &point), "Early sync point kept");
+    runner.expectTrue(point.output <= 1500 && point.input <= 1500, "Sync point at or before the stop");
+  }
+
+  // Test 12: A missing input file fails without output
+  {
+    runner.expectFalse(html5::normalizeVoidElements("/missing.html", "/out.html"), "Missing input fails");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,460 @@
+#include "test_utils.h"
+
+#include <JpegToBmpConverter.h>
+#include <picojpeg.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Checks picojpeg's reduced decodes (1/2 and 1/4 luma IDCT, 1/8 DC-only) against a box-averaged full decode for
+// every scan type JpegToBmpConverter handles, gathering MCUs the way the converter does. Then times full against
+// reduced decodes of large synthetic JPEGs fitted to the reader viewport, and reports the MCU row buffer each needs.
+// The JPEGs come from a small baseline encoder below, so no large fixtures live in the repo.
+
+namespace {
+
+// ---------------------------------------------------------------------------------------------------------------
+// Baseline encoder: one quantization table, one Huffman table per class with fixed-length codes
+// ---------------------------------------------------------------------------------------------------------------
+
+const int ZIGZAG[64] = {0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,  12, 19, 26, 33, 40, 48,
+                        41, 34, 27, 20, 13, 6,  7,  14, 21, 28, 35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23,
+                        30, 37, 44, 51, 58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63};
+
+struct BitWriter {
+  std::string& out;
+  uint32_t acc = 0;
+  int bits = 0;
+
+  void put(const uint32_t code, const int len) {
+    for (int i = len - 1; i >= 0; i--) {
+      acc = (acc << 1) | ((code >> i) & 1);
+      if (++bits == 8) {
+        out += static_cast<char>(acc);
+        if (acc == 0xFF) out += '\0';
+        acc = 0;
+        bits = 0;
+      }
+    }
+  }
+  void flush() {
+    while (bits) put(1, 1);
+  }
+};
+
+struct Image {
+  int width;
+  int height;
+  int comps;
+  std::vector<uint8_t> pixels;  // comps bytes per pixel: gray, or RGB
+};
+
+// Resolution-independent scene: gradients, rings, hard-edged shapes and a little noise
+Image makeImage(const int width, const int height, const int comps, uint32_t seed) {
+  Image image{width, height, comps, std::vector<uint8_t>(static_cast<size_t>(width) * height * comps)};
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      const float u = static_cast<float>(x) / width;
+      const float v = static_cast<float>(y) / height;
+      const float dx = u - 0.5f;
+      const float dy = v - 0.4f;
+      float base = 60.0f + 120.0f * v + 50.0f * std::sin(40.0f * std::sqrt(dx * dx + dy * dy));
+      if (u > 0.1f && u < 0.35f && v > 0.6f && v < 0.9f) base = 30.0f;
+      if (std::fabs(u - v) < 0.01f) base = 240.0f;
+      seed = seed * 1103515245 + 12345;
+      base += static_cast<float>((seed >> 16) % 9) - 4.0f;
+      uint8_t* p = &image.pixels[(static_cast<size_t>(y) * width + x) * comps];
+      for (int c = 0; c < comps; c++) {
+        const float tint = comps == 1 ? 0.0f : (c == 0 ? 40.0f * u : c == 1 ? -30.0f * v : 25.0f * dx);
+        p[c] = static_cast<uint8_t>(std::min(255.0f, std::max(0.0f, base + tint)));
+      }
+    }
+  }
+  return image;
+}
+
+void fdct(const float* in, float* out) {
+  static float cosTable[8][8];
+  static bool ready = false;
+  if (!ready) {
+    for (int u = 0; u < 8; u++) {
+      for (int x = 0; x < 8; x++) {
+        cosTable[u][x] = std::cos((2 * x + 1) * u * M_PI / 16) * (u == 0 ? std::sqrt(0.5) : 1.0) / 2;
+      }
+    }
+    ready = true;
+  }
+  float rows[64];
+  for (int y = 0; y < 8; y++) {
+    for (int u = 0; u < 8; u++) {
+      float sum = 0;
+      for (int x = 0; x < 8; x++) sum += in[y * 8 + x] * cosTable[u][x];
+      rows[y * 8 + u] = sum;
+    }
+  }
+  for (int u = 0; u < 8; u++) {
+    for (int v = 0; v < 8; v++) {
+      float sum = 0;
+      for (int y = 0; y < 8; y++) sum += rows[y * 8 + u] * cosTable[v][y];
+      out[v * 8 + u] = sum;
+    }
+  }
+}
+
+int category(int value) {
+  value = std::abs(value);
+  int bits = 0;
+  while (value) {
+    bits++;
+    value >>= 1;
+  }
+  return bits;
+}
+
+uint32_t valueBits(const int value, const int size) {
+  return value >= 0 ? static_cast<uint32_t>(value) : static_cast<uint32_t>(value + (1 << size) - 1);
+}
+
+// DC symbols (12) get 4-bit codes, AC symbols (EOB, ZRL and run/size pairs, 162) 8-bit codes, in symbol order
+std::vector<uint8_t> acSymbols() {
+  std::vector<uint8_t> symbols = {0x00, 0xF0};
+  for (int run = 0; run < 16; run++) {
+    for (int size = 1; size <= 10; size++) symbols.push_back(static_cast<uint8_t>(run << 4 | size));
+  }
+  return symbols;
+}
+
+void encodeBlock(BitWriter& bw, const float* pixels, const uint8_t* quant, int& lastDc, const int acCode[256]) {
+  float shifted[64];
+  float coeffs[64];
+  for (int i = 0; i < 64; i++) shifted[i] = pixels[i] - 128.0f;
+  fdct(shifted, coeffs);
+  int q[64];
+  for (int k = 0; k < 64; k++) q[k] = static_cast<int>(std::lround(coeffs[ZIGZAG[k]] / quant[k]));
+
+  const int diff = q[0] - lastDc;
+  lastDc = q[0];
+  const int dcSize = category(diff);
+  bw.put(dcSize, 4);
+  if (dcSize) bw.put(valueBits(diff, dcSize), dcSize);
+
+  int run = 0;
+  for (int k = 1; k < 64; k++) {
+    if (q[k] == 0) {
+      run++;
+      continue;
+    }
+    while (run > 15) {
+      bw.put(acCode[0xF0], 8);
+      run -= 16;
+    }
+    const int size = category(q[k]);
+    bw.put(acCode[run << 4 | size], 8);
+    bw.put(valueBits(q[k], size), size);
+    run = 0;
+  }
+  if (run) bw.put(acCode[0x00], 8);
+}
+
+void putMarker(std::string& out, const uint8_t marker, const std::vector<uint8_t>& payload) {
+  out += static_cast<char>(0xFF);
+  out += static_cast<char>(marker);
+  const size_t len = payload.size() + 2;
+  out += static_cast<char>(len >> 8);
+  out += static_cast<char>(len & 0xFF);
+  out.append(payload.begin(), payload.end());
+}
+
+// hs x vs luma blocks per MCU; color images are converted to YCbCr with one block of each chroma per MCU
+std::string encodeJpeg(const Image& image, const int hs, const int vs) {
+  uint8_t quant[64];
+  for (int k = 0; k < 64; k++) {
+    const int pos = ZIGZAG[k];
+    quant[k] = static_cast<uint8_t>(4 + 2 * ((pos & 7) + (pos >> 3)));
+  }
+
+  std::string out = "\xFF\xD8";
+  std::vector<uint8_t> dqt = {0x00};
+  dqt.insert(dqt.end(), quant, quant + 64);
+  putMarker(out, 0xDB, dqt);
+
+  const int comps = image.comps;
+  std::vector<uint8_t> sof = {8,
+                              static_cast<uint8_t>(image.height >> 8),
+                              static_cast<uint8_t>(image.height),
+                              static_cast<uint8_t>(image.width >> 8),
+                              static_cast<uint8_t>(image.width),
+                              static_cast<uint8_t>(comps)};
+  for (int c = 0; c < comps; c++) {
+    sof.push_back(static_cast<uint8_t>(c + 1));
+    sof.push_back(c == 0 ? static_cast<uint8_t>(hs << 4 | vs) : 0x11);
+    sof.push_back(0);
+  }
+  putMarker(out, 0xC0, sof);
+
+  const std::vector<uint8_t> ac = acSymbols();
+  std::vector<uint8_t> dhtDc = {0x00, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  for (int i = 0; i < 12; i++) dhtDc.push_back(static_cast<uint8_t>(i));
+  putMarker(out, 0xC4, dhtDc);
+  std::vector<uint8_t> dhtAc = {0x10, 0, 0, 0, 0, 0, 0, 0, static_cast<uint8_t>(ac.size()), 0, 0, 0, 0, 0, 0, 0, 0};
+  dhtAc.insert(dhtAc.end(), ac.begin(), ac.end());
+  putMarker(out, 0xC4, dhtAc);
+  int acCode[256] = {};
+  for (size_t i = 0; i < ac.size(); i++) acCode[ac[i]] = static_cast<int>(i);
+
+  std::vector<uint8_t> sos = {static_cast<uint8_t>(comps)};
+  for (int c = 0; c < comps; c++) {
+    sos.push_back(static_cast<uint8_t>(c + 1));
+    sos.push_back(0x00);
+  }
+  sos.insert(sos.end(), {0, 63, 0});
+  putMarker(out, 0xDA, sos);
+
+  // Component planes, edge-replicated
+  auto sample = [&](int x, int y, const int c) -> float {
+    x = std::min(x, image.width - 1);
+    y = std::min(y, image.height - 1);
+    const uint8_t* p = &image.pixels[(static_cast<size_t>(y) * image.width + x) * comps];
+    if (comps == 1) return p[0];
+    const float r = p[0], g = p[1], b = p[2];
+    if (c == 0) return 0.299f * r + 0.587f * g + 0.114f * b;
+    if (c == 1) return 128.0f - 0.168736f * r - 0.331264f * g + 0.5f * b;
+    return 128.0f + 0.5f * r - 0.418688f * g - 0.081312f * b;
+  };
+
+  BitWriter bw{out};
+  int lastDc[3] = {0, 0, 0};
+  const int mcuWidth = 8 * hs;
+  const int mcuHeight = 8 * vs;
+  float block[64];
+  for (int my = 0; my < (image.height + mcuHeight - 1) / mcuHeight; my++) {
+    for (int mx = 0; mx < (image.width + mcuWidth - 1) / mcuWidth; mx++) {
+      for (int by = 0; by < vs; by++) {
+        for (int bx = 0; bx < hs; bx++) {
+          for (int i = 0; i < 64; i++) {
+            block[i] = sample(mx * mcuWidth + bx * 8 + i % 8, my * mcuHeight + by * 8 + i / 8, 0);
+          }
+          encodeBlock(bw, block, quant, lastDc[0], acCode);
+        }
+      }
+      for (int c = 1; c < comps; c++) {
+        for (int i = 0; i < 64; i++) {
+          float sum = 0;
+          for (int sy = 0; sy < vs; sy++) {
+            for (int sx = 0; sx < hs; sx++) {
+              sum += sample(mx * mcuWidth + (i % 8) * hs + sx, my * mcuHeight + (i / 8) * vs + sy, c);
+            }
+          }
+          block[i] = sum / (hs * vs);
+        }
+        encodeBlock(bw, block, quant, lastDc[c], acCode);
+      }
+    }
+  }
+  bw.flush();
+  out += "\xFF\xD9";
+  return out;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Decoding through picojpeg
+// ---------------------------------------------------------------------------------------------------------------
+
+struct MemoryReader {
+  const std::string* data;
+  size_t pos;
+};
+
+unsigned char readCallback(unsigned char* pBuf, const unsigned char bufSize, unsigned char* pBytesRead, void* ctx) {
+  auto* reader = static_cast<MemoryReader*>(ctx);
+  const size_t n = std::min(static_cast<size_t>(bufSize), reader->data->size() - reader->pos);
+  memcpy(pBuf, reader->data->data() + reader->pos, n);
+  reader->pos += n;
+  *pBytesRead = static_cast<unsigned char>(n);
+  return 0;
+}
+
+struct Decoded {
+  bool ok = false;
+  int width = 0;
+  int height = 0;
+  size_t mcuRowBytes = 0;
+  std::vector<uint8_t> gray;
+};
+
+uint8_t toGray(const uint8_t r, const uint8_t g, const uint8_t b) { return (77 * r + 150 * g + 29 * b) >> 8; }
+
+// Mirrors JpegToBmpConverter's MCU gather for decode scale 1/2^shift
+Decoded decode(const std::string& jpeg, const int shift) {
+  static const unsigned char REDUCE_MODES[] = {PJPG_REDUCE_NONE, PJPG_REDUCE_HALF, PJPG_REDUCE_QUARTER,
+                                               PJPG_REDUCE_EIGHTH};
+  Decoded result;
+  MemoryReader reader{&jpeg, 0};
+  pjpeg_image_info_t info;
+  if (pjpeg_decode_init(&info, readCallback, &reader, REDUCE_MODES[shift]) != 0) return result;
+
+  result.width = (info.m_width + (1 << shift) - 1) >> shift;
+  result.height = (info.m_height + (1 << shift) - 1) >> shift;
+  const int mcuPixelWidth = info.m_MCUWidth >> shift;
+  const int mcuPixelHeight = info.m_MCUHeight >> shift;
+  const int blockPixels = 8 >> shift;
+  const bool lumaOnly = info.m_comps == 1 || shift == 1 || shift == 2;
+  result.mcuRowBytes = static_cast<size_t>(result.width) * mcuPixelHeight;
+  result.gray.resize(static_cast<size_t>(result.width) * result.height);
+
+  for (int mcuY = 0; mcuY < info.m_MCUSPerCol; mcuY++) {
+    for (int mcuX = 0; mcuX < info.m_MCUSPerRow; mcuX++) {
+      if (pjpeg_decode_mcu() != 0) return result;
+      for (int blockY = 0; blockY < mcuPixelHeight; blockY++) {
+        const int pixelY = mcuY * mcuPixelHeight + blockY;
+        if (pixelY >= result.height) continue;
+        for (int blockX = 0; blockX < mcuPixelWidth; blockX++) {
+          const int pixelX = mcuX * mcuPixelWidth + blockX;
+          if (pixelX >= result.width) continue;
+          const int pixelOffset = (blockY / blockPixels) * 128 + (blockX / blockPixels) * 64 +
+                                  (blockY % blockPixels) * 8 + blockX % blockPixels;
+          result.gray[pixelY * result.width + pixelX] =
+              lumaOnly ? info.m_pMCUBufR[pixelOffset]
+                       : toGray(info.m_pMCUBufR[pixelOffset], info.m_pMCUBufG[pixelOffset],
+                                info.m_pMCUBufB[pixelOffset]);
+        }
+      }
+    }
+  }
+  result.ok = true;
+  return result;
+}
+
+// Mean and max absolute difference between a reduced decode and the box-averaged full decode
+void compareToFull(const Decoded& full, const Decoded& reduced, const int shift, double* meanError, int* maxError) {
+  const int factor = 1 << shift;
+  double total = 0;
+  int worst = 0;
+  int count = 0;
+  // Skip the last row/column, which may cover padding past the image edge
+  for (int y = 0; y < reduced.height - 1; y++) {
+    for (int x = 0; x < reduced.width - 1; x++) {
+      int sum = 0;
+      for (int sy = 0; sy < factor; sy++) {
+        for (int sx = 0; sx < factor; sx++) sum += full.gray[(y * factor + sy) * full.width + x * factor + sx];
+      }
+      const int error = std::abs(sum / (factor * factor) - reduced.gray[y * reduced.width + x]);
+      total += error;
+      worst = std::max(worst, error);
+      count++;
+    }
+  }
+  *meanError = count ? total / count : 0;
+  *maxError = worst;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("JpegScaledDecode");
+
+  // Test 1: Scale choice never decodes below the output size
+  {
+    runner.expectEq(0, JpegToBmpConverter::decodeScaleShift(450, 800, 450, 800), "Same size decodes in full");
+    runner.expectEq(0, JpegToBmpConverter::decodeScaleShift(900, 1599, 480, 800), "Just under 2x decodes in full");
+    runner.expectEq(1, JpegToBmpConverter::decodeScaleShift(960, 1600, 480, 800), "2x decodes at 1/2");
+    runner.expectEq(2, JpegToBmpConverter::decodeScaleShift(3000, 4000, 600, 800), "3000x4000 cover at 1/4");
+    runner.expectEq(3, JpegToBmpConverter::decodeScaleShift(4000, 6000, 120, 180), "Thumbnail at 1/8");
+    runner.expectEq(3, JpegToBmpConverter::decodeScaleShift(8000, 8000, 100, 100), "Never beyond 1/8");
+  }
+
+  // Test 2: Reduced decodes match the box-averaged full decode for every scan type
+  {
+    struct Case {
+      const char* name;
+      int comps;
+      int hs;
+      int vs;
+    };
+    const Case cases[] = {{"Grayscale", 1, 1, 1}, {"H1V1", 3, 1, 1}, {"H2V1", 3, 2, 1}, {"H1V2", 3, 1, 2},
+                          {"H2V2", 3, 2, 2}};
+    for (const Case& c : cases) {
+      const Image image = makeImage(203, 157, c.comps, 11);
+      const std::string jpeg = encodeJpeg(image, c.hs, c.vs);
+      const Decoded full = decode(jpeg, 0);
+      runner.expectTrue(full.ok, std::string(c.name) + ": full decode");
+
+      // The full decode itself must match the source, which checks the MCU block layout
+      double sourceError = 0;
+      for (int y = 0; y < image.height; y++) {
+        for (int x = 0; x < image.width; x++) {
+          const uint8_t* p = &image.pixels[(static_cast<size_t>(y) * image.width + x) * image.comps];
+          const int expected = image.comps == 1 ? p[0] : toGray(p[0], p[1], p[2]);
+          sourceError += std::abs(expected - full.gray[y * full.width + x]);
+        }
+      }
+      sourceError /= image.width * image.height;
+      runner.expectTrue(sourceError < 6.0, std::string(c.name) + ": full decode matches source");
+
+      for (int shift = 1; shift <= 3; shift++) {
+        const Decoded reduced = decode(jpeg, shift);
+        double meanError = 0;
+        int maxError = 0;
+        compareToFull(full, reduced, shift, &meanError, &maxError);
+        const std::string label = std::string(c.name) + " 1/" + std::to_string(1 << shift);
+        runner.expectTrue(reduced.ok, label + ": decodes");
+        runner.expectEq((image.width + (1 << shift) - 1) >> shift, reduced.width, label + ": width");
+        runner.expectTrue(meanError < 4.0, label + ": mean error " + std::to_string(meanError));
+        runner.expectTrue(maxError < 64, label + ": max error " + std::to_string(maxError));
+      }
+    }
+  }
+
+  // Test 3: Benchmark large JPEGs fitted to the 480x800 viewport
+  {
+    struct Case {
+      const char* name;
+      int width;
+      int height;
+      int comps;
+      int hs;
+      int vs;
+    };
+    const Case cases[] = {{"3000x4000 H2V2", 3000, 4000, 3, 2, 2},
+                          {"2000x3000 gray", 2000, 3000, 1, 1, 1},
+                          {"1600x2400 H1V1", 1600, 2400, 3, 1, 1}};
+    printf("\n");
+    for (const Case& c : cases) {
+      const std::string jpeg = encodeJpeg(makeImage(c.width, c.height, c.comps, 5), c.hs, c.vs);
+
+      // Same fit as jpegFileToBmpStreamInternal
+      const float scale = std::max(480.0f / c.width, 800.0f / c.height);
+      const int outWidth = static_cast<int>(c.width * scale);
+      const int outHeight = static_cast<int>(c.height * scale);
+      const int shift = JpegToBmpConverter::decodeScaleShift(c.width, c.height, outWidth, outHeight);
+
+      auto start = std::chrono::steady_clock::now();
+      const Decoded full = decode(jpeg, 0);
+      const auto fullUs =
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+      start = std::chrono::steady_clock::now();
+      const Decoded reduced = decode(jpeg, shift);
+      const auto reducedUs =
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+      printf("    %s (%zu KB) -> %dx%d: full %.1f ms, %zu B MCU row | 1/%d %.1f ms, %zu B MCU row\n", c.name,
+             jpeg.size() / 1024, outWidth, outHeight, fullUs / 1000.0, full.mcuRowBytes, 1 << shift,
+             reducedUs / 1000.0, reduced.mcuRowBytes);
+      runner.expectTrue(full.ok && reduced.ok, std::string(c.name) + ": decodes");
+      runner.expectTrue(shift > 0, std::string(c.name) + ": decoded reduced");
+      runner.expectTrue(reduced.width >= outWidth && reduced.height >= outHeight,
+                        std::string(c.name) + ": reduced decode covers the output");
+      runner.expectTrue(reducedUs < fullUs, std::string(c.name) + ": reduced decode is faster");
+    }
+    printf("\n");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
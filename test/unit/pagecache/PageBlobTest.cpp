@@ -0,0 +1,529 @@
+#include "test_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// Include mocks
+#include "HardwareSerial.h"
+#include "SdFat.h"
+
+#include "Serialization.h"
+
+// Mirrors the flat page blob of Page::serialize / PageView::load against the element-per-object page
+// format it replaced: round trips, corrupt blob rejection, and heap allocations per page load.
+// Also mirrors PageCache's resident LUT: page spans derived from it allow one read per page.
+
+static size_t g_allocations = 0;
+
+void* operator new(size_t size) {
+  g_allocations++;
+  void* p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+namespace {
+
+constexpr uint8_t TAG_PageLine = 1;
+constexpr uint8_t TAG_PageImage = 2;
+constexpr uint16_t MAX_PAGE_ELEMENTS = 500;
+constexpr uint16_t MAX_PAGE_WORDS = 10000;
+
+struct PageBlobHeader {
+  uint16_t elementCount;
+  uint16_t wordCount;
+  uint16_t poolSize;
+  uint16_t reserved;
+};
+
+struct PageBlobElement {
+  uint8_t tag;
+  uint8_t flags;
+  int16_t xPos;
+  int16_t yPos;
+  uint16_t first;
+  uint16_t count;
+  uint16_t height;
+};
+
+struct PageBlobWord {
+  uint16_t offset;
+  uint16_t xPos;
+  uint8_t style;
+  uint8_t reserved;
+};
+
+constexpr uint32_t MAX_BLOB_SIZE = sizeof(PageBlobHeader) + MAX_PAGE_ELEMENTS * sizeof(PageBlobElement) +
+                                   MAX_PAGE_WORDS * sizeof(PageBlobWord) + UINT16_MAX;
+
+// Page content independent of storage
+struct TestLine {
+  int16_t x, y;
+  uint8_t style;
+  std::vector<std::string> words;
+  std::vector<uint16_t> xpos;
+  std::vector<uint8_t> wordStyles;
+};
+
+struct TestImage {
+  int16_t x, y;
+  std::string path;
+  uint16_t width, height;
+};
+
+struct TestPage {
+  std::vector<TestLine> lines;
+  std::vector<TestImage> images;
+};
+
+// ---- Flat blob (mirrors Page::serialize and PageView) ----
+
+bool serializeBlob(FsFile& file, const TestPage& page) {
+  std::vector<PageBlobElement> elements;
+  std::vector<PageBlobWord> words;
+  std::vector<char> pool;
+  auto appendToPool = [&pool](const std::string& str, uint16_t* offset) {
+    if (pool.size() + str.size() + 1 > UINT16_MAX) return false;
+    *offset = static_cast<uint16_t>(pool.size());
+    pool.insert(pool.end(), str.begin(), str.end());
+    pool.push_back('\0');
+    return true;
+  };
+
+  for (const auto& line : page.lines) {
+    PageBlobElement el = {TAG_PageLine, line.style, line.x, line.y, static_cast<uint16_t>(words.size()),
+                          static_cast<uint16_t>(line.words.size()), 0};
+    for (size_t i = 0; i < line.words.size(); i++) {
+      PageBlobWord w = {0, line.xpos[i], line.wordStyles[i], 0};
+      if (!appendToPool(line.words[i], &w.offset)) return false;
+      words.push_back(w);
+    }
+    elements.push_back(el);
+  }
+  for (const auto& image : page.images) {
+    PageBlobElement el = {TAG_PageImage, 0, image.x, image.y, 0, image.width, image.height};
+    if (!appendToPool(image.path, &el.first)) return false;
+    elements.push_back(el);
+  }
+
+  const PageBlobHeader header = {static_cast<uint16_t>(elements.size()), static_cast<uint16_t>(words.size()),
+                                 static_cast<uint16_t>(pool.size()), 0};
+  const uint32_t blobSize = sizeof(header) + elements.size() * sizeof(PageBlobElement) +
+                            words.size() * sizeof(PageBlobWord) + pool.size();
+  std::vector<uint8_t> record(sizeof(blobSize) + blobSize);
+  uint8_t* out = record.data();
+  auto put = [&out](const void* data, size_t len) {
+    if (len > 0) memcpy(out, data, len);
+    out += len;
+  };
+  put(&blobSize, sizeof(blobSize));
+  put(&header, sizeof(header));
+  put(elements.data(), elements.size() * sizeof(PageBlobElement));
+  put(words.data(), words.size() * sizeof(PageBlobWord));
+  put(pool.data(), pool.size());
+  return file.write(record.data(), record.size()) == record.size();
+}
+
+class PageView {
+ public:
+  bool load(FsFile& file, uint32_t recordSpan = 0) {
+    loaded_ = false;
+    readCalls_ = 0;
+    uint32_t blobSize;
+    if (recordSpan >= PREFIX_SIZE + sizeof(PageBlobHeader) && recordSpan <= PREFIX_SIZE + MAX_BLOB_SIZE) {
+      if (buffer_.size() < recordSpan) buffer_.resize(recordSpan);
+      readCalls_++;
+      if (file.read(buffer_.data(), recordSpan) != static_cast<int>(recordSpan)) return false;
+      memcpy(&blobSize, buffer_.data(), PREFIX_SIZE);
+      if (blobSize < sizeof(PageBlobHeader) || blobSize > recordSpan - PREFIX_SIZE) return false;
+    } else {
+      readCalls_++;
+      if (!serialization::readPodChecked(file, blobSize)) return false;
+      if (blobSize < sizeof(PageBlobHeader) || blobSize > MAX_BLOB_SIZE) return false;
+      if (buffer_.size() < PREFIX_SIZE + blobSize) buffer_.resize(PREFIX_SIZE + blobSize);
+      readCalls_++;
+      if (file.read(buffer_.data() + PREFIX_SIZE, blobSize) != static_cast<int>(blobSize)) return false;
+    }
+    size_ = blobSize;
+    if (!validate()) return false;
+    loaded_ = true;
+    return true;
+  }
+
+  uint8_t readCalls() const { return readCalls_; }
+
+  // Stand-in for render(): visits every word and image straight out of the blob
+  template <typename DrawText, typename DrawImage>
+  void render(DrawText drawText, DrawImage drawImage) const {
+    const PageBlobElement* els = elements();
+    const PageBlobWord* ws = words();
+    for (uint16_t i = 0; i < header()->elementCount; i++) {
+      const PageBlobElement& el = els[i];
+      if (el.tag == TAG_PageLine) {
+        for (uint16_t w = el.first; w < el.first + el.count; w++) {
+          drawText(ws[w].xPos + el.xPos, el.yPos, pool() + ws[w].offset, ws[w].style);
+        }
+      } else {
+        drawImage(el.xPos, el.yPos, pool() + el.first, el.count, el.height);
+      }
+    }
+  }
+
+ private:
+  static constexpr size_t PREFIX_SIZE = sizeof(uint32_t);
+  const uint8_t* blob() const { return buffer_.data() + PREFIX_SIZE; }
+  const PageBlobHeader* header() const { return reinterpret_cast<const PageBlobHeader*>(blob()); }
+  const PageBlobElement* elements() const {
+    return reinterpret_cast<const PageBlobElement*>(blob() + sizeof(PageBlobHeader));
+  }
+  const PageBlobWord* words() const {
+    return reinterpret_cast<const PageBlobWord*>(blob() + sizeof(PageBlobHeader) +
+                                                 header()->elementCount * sizeof(PageBlobElement));
+  }
+  const char* pool() const { return reinterpret_cast<const char*>(words() + header()->wordCount); }
+
+  bool validate() const {
+    const PageBlobHeader* h = header();
+    if (h->elementCount > MAX_PAGE_ELEMENTS || h->wordCount > MAX_PAGE_WORDS) return false;
+    const size_t expected = sizeof(PageBlobHeader) + h->elementCount * sizeof(PageBlobElement) +
+                            h->wordCount * sizeof(PageBlobWord) + h->poolSize;
+    if (expected != size_ || (h->poolSize > 0 && pool()[h->poolSize - 1] != '\0')) return false;
+    for (uint16_t i = 0; i < h->elementCount; i++) {
+      const PageBlobElement& el = elements()[i];
+      if (el.tag == TAG_PageLine) {
+        if (el.first + el.count > h->wordCount) return false;
+      } else if (el.tag == TAG_PageImage) {
+        if (el.first >= h->poolSize || el.count > 2000 || el.height > 2000) return false;
+      } else {
+        return false;
+      }
+    }
+    for (uint16_t i = 0; i < h->wordCount; i++) {
+      if (words()[i].offset >= h->poolSize) return false;
+    }
+    return true;
+  }
+
+  std::vector<uint8_t> buffer_;
+  size_t size_ = 0;
+  uint8_t readCalls_ = 0;
+  bool loaded_ = false;
+};
+
+// ---- Element-per-object format it replaced ----
+
+struct LegacyWordData {
+  std::string word;
+  uint16_t xPos;
+  uint8_t style;
+};
+
+struct LegacyElement {
+  virtual ~LegacyElement() = default;
+  int16_t xPos = 0, yPos = 0;
+};
+
+struct LegacyTextBlock {
+  std::vector<LegacyWordData> wordData;
+  uint8_t style = 0;
+};
+
+struct LegacyLine : LegacyElement {
+  std::shared_ptr<LegacyTextBlock> block;
+};
+
+struct LegacyImage : LegacyElement {
+  std::string path;
+  uint16_t width = 0, height = 0;
+};
+
+struct LegacyPage {
+  std::vector<std::shared_ptr<LegacyElement>> elements;
+};
+
+void serializeLegacy(FsFile& file, const TestPage& page) {
+  serialization::writePod(file, static_cast<uint16_t>(page.lines.size() + page.images.size()));
+  for (const auto& line : page.lines) {
+    serialization::writePod(file, TAG_PageLine);
+    serialization::writePod(file, line.x);
+    serialization::writePod(file, line.y);
+    serialization::writePod(file, static_cast<uint16_t>(line.words.size()));
+    for (const auto& w : line.words) serialization::writeString(file, w);
+    for (const auto x : line.xpos) serialization::writePod(file, x);
+    for (const auto s : line.wordStyles) serialization::writePod(file, s);
+    serialization::writePod(file, line.style);
+  }
+  for (const auto& image : page.images) {
+    serialization::writePod(file, TAG_PageImage);
+    serialization::writePod(file, image.x);
+    serialization::writePod(file, image.y);
+    serialization::writeString(file, image.path);
+    serialization::writePod(file, image.width);
+    serialization::writePod(file, image.height);
+  }
+}
+
+std::unique_ptr<LegacyPage> deserializeLegacy(FsFile& file) {
+  auto page = std::unique_ptr<LegacyPage>(new LegacyPage());
+  uint16_t count;
+  serialization::readPod(file, count);
+  for (uint16_t i = 0; i < count; i++) {
+    uint8_t tag;
+    serialization::readPod(file, tag);
+    if (tag == TAG_PageLine) {
+      auto line = std::make_shared<LegacyLine>();
+      serialization::readPod(file, line->xPos);
+      serialization::readPod(file, line->yPos);
+      uint16_t wc;
+      serialization::readPod(file, wc);
+      auto block = std::make_shared<LegacyTextBlock>();
+      std::vector<std::string> words(wc);
+      std::vector<uint16_t> xpos(wc);
+      std::vector<uint8_t> styles(wc);
+      for (auto& w : words) {
+        if (!serialization::readString(file, w)) return nullptr;
+      }
+      for (auto& x : xpos) serialization::readPod(file, x);
+      for (auto& s : styles) serialization::readPod(file, s);
+      serialization::readPod(file, block->style);
+      block->wordData.reserve(wc);
+      for (uint16_t w = 0; w < wc; w++) block->wordData.push_back({std::move(words[w]), xpos[w], styles[w]});
+      line->block = std::move(block);
+      page->elements.push_back(std::move(line));
+    } else {
+      auto image = std::make_shared<LegacyImage>();
+      serialization::readPod(file, image->xPos);
+      serialization::readPod(file, image->yPos);
+      if (!serialization::readString(file, image->path)) return nullptr;
+      serialization::readPod(file, image->width);
+      serialization::readPod(file, image->height);
+      page->elements.push_back(std::move(image));
+    }
+  }
+  return page;
+}
+
+// A full page of prose: 24 lines of 9-11 words with a mix of short and long words
+TestPage makePage(uint32_t seed) {
+  const char* vocabulary[] = {"the",    "lantern",     "flickered", "as",    "she",           "read",
+                              "of",     "remarkable",  "quiet",     "river", "characteristic", "winter"};
+  TestPage page;
+  for (int l = 0; l < 24; l++) {
+    TestLine line = {0, static_cast<int16_t>(l * 32), static_cast<uint8_t>(l % 4), {}, {}, {}};
+    uint16_t x = 0;
+    const int count = 9 + l % 3;
+    for (int w = 0; w < count; w++) {
+      seed = seed * 1103515245 + 12345;
+      const std::string word = vocabulary[(seed >> 16) % 12];
+      line.words.push_back(word);
+      line.xpos.push_back(x);
+      line.wordStyles.push_back((seed >> 8) % 4);
+      x += word.size() * 9 + 6;
+    }
+    page.lines.push_back(line);
+  }
+  return page;
+}
+
+std::string describeBlob(const PageView& view) {
+  std::string out;
+  view.render(
+      [&out](int x, int y, const char* word, uint8_t style) {
+        out += std::to_string(x) + "," + std::to_string(y) + ":" + word + "/" + std::to_string(style) + " ";
+      },
+      [&out](int x, int y, const char* path, uint16_t w, uint16_t h) {
+        out += std::to_string(x) + "," + std::to_string(y) + ":[" + path + " " + std::to_string(w) + "x" +
+               std::to_string(h) + "] ";
+      });
+  return out;
+}
+
+std::string describeLegacy(const LegacyPage& page) {
+  std::string out;
+  for (const auto& el : page.elements) {
+    if (const auto* line = dynamic_cast<const LegacyLine*>(el.get())) {
+      for (const auto& wd : line->block->wordData) {
+        out += std::to_string(wd.xPos + line->xPos) + "," + std::to_string(line->yPos) + ":" + wd.word + "/" +
+               std::to_string(wd.style) + " ";
+      }
+    } else {
+      const auto* image = static_cast<const LegacyImage*>(el.get());
+      out += std::to_string(image->xPos) + "," + std::to_string(image->yPos) + ":[" + image->path + " " +
+             std::to_string(image->width) + "x" + std::to_string(image->height) + "] ";
+    }
+  }
+  return out;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Page Blob");
+
+  TestPage page = makePage(7);
+  page.images.push_back({40, 780, "/.papyrix/epub_1/images/img_3.bmp", 400, 200});
+
+  FsFile blobFile;
+  blobFile.setBuffer("");
+  runner.expectTrue(serializeBlob(blobFile, page), "Blob serializes");
+  FsFile legacyFile;
+  legacyFile.setBuffer("");
+  serializeLegacy(legacyFile, page);
+
+  // Test 1: round trip renders the same words, positions and images as the old format
+  {
+    blobFile.seek(0);
+    PageView view;
+    runner.expectTrue(view.load(blobFile), "Blob loads");
+    legacyFile.seek(0);
+    const auto legacy = deserializeLegacy(legacyFile);
+    runner.expectTrue(legacy != nullptr, "Old format loads");
+    runner.expectTrue(legacy && describeBlob(view) == describeLegacy(*legacy),
+                      "Blob renders the same page as the old format");
+    std::cout << "    Page size: blob " << blobFile.size() << " bytes, old format " << legacyFile.size()
+              << " bytes\n";
+  }
+
+  // Test 2: allocations per page load
+  {
+    constexpr int LOADS = 100;
+    PageView view;
+    size_t before = g_allocations;
+    for (int i = 0; i < LOADS; i++) {
+      blobFile.seek(0);
+      view.load(blobFile);
+    }
+    const size_t blobAllocs = g_allocations - before;
+
+    before = g_allocations;
+    for (int i = 0; i < LOADS; i++) {
+      legacyFile.seek(0);
+      if (!deserializeLegacy(legacyFile)) break;
+    }
+    const size_t legacyAllocs = g_allocations - before;
+
+    std::cout << "\n    Format           Allocations/page load\n";
+    printf("    %-16s %21.1f\n", "element objects", static_cast<double>(legacyAllocs) / LOADS);
+    printf("    %-16s %21.1f\n\n", "flat blob", static_cast<double>(blobAllocs) / LOADS);
+
+    runner.expectTrue(blobAllocs <= 1, "Reused view allocates at most once across loads",
+                      std::to_string(blobAllocs) + " allocations");
+    runner.expectTrue(legacyAllocs / LOADS > 100, "Old format allocates per word",
+                      std::to_string(legacyAllocs / LOADS) + " per load");
+  }
+
+  // Test 3: corrupt blobs are rejected
+  {
+    const std::string good = blobFile.getBuffer();
+    auto rejects = [](std::string bytes) {
+      FsFile file;
+      file.setBuffer(bytes);
+      PageView view;
+      return !view.load(file);
+    };
+    runner.expectTrue(rejects(good.substr(0, good.size() - 5)), "Truncated blob rejected");
+
+    std::string oversized = good;
+    const uint32_t huge = 0x7FFFFFFF;
+    memcpy(&oversized[0], &huge, 4);
+    runner.expectTrue(rejects(oversized), "Oversized length rejected");
+
+    std::string badTag = good;
+    badTag[4 + sizeof(PageBlobHeader)] = 9;
+    runner.expectTrue(rejects(badTag), "Unknown element tag rejected");
+
+    std::string badWordRange = good;
+    const uint16_t tooMany = 5000;
+    memcpy(&badWordRange[4 + sizeof(PageBlobHeader) + offsetof(PageBlobElement, count)], &tooMany, 2);
+    runner.expectTrue(rejects(badWordRange), "Line word range past table rejected");
+
+    std::string unterminated = good;
+    unterminated[unterminated.size() - 1] = 'x';
+    runner.expectTrue(rejects(unterminated), "Unterminated string pool rejected");
+  }
+
+  // Test 4: consecutive pages share one stream
+  {
+    FsFile file;
+    file.setBuffer("");
+    const TestPage a = makePage(1);
+    const TestPage b = makePage(2);
+    serializeBlob(file, a);
+    const size_t secondPos = file.position();
+    serializeBlob(file, b);
+
+    PageView view;
+    file.seek(secondPos);
+    runner.expectTrue(view.load(file), "Second page loads from its LUT position");
+    FsFile legacy;
+    legacy.setBuffer("");
+    serializeLegacy(legacy, b);
+    legacy.seek(0);
+    runner.expectTrue(describeBlob(view) == describeLegacy(*deserializeLegacy(legacy)), "Second page content");
+    file.seek(0);
+    runner.expectTrue(view.load(file), "Buffer reused for a smaller or larger page");
+  }
+
+  // Test 5: resident LUT spans (as PageCache::loadPage computes them) load each page in one read,
+  // including the last page of a chunk followed by that chunk's LUT and the next chunk
+  {
+    FsFile file;
+    file.setBuffer("");
+    std::vector<uint32_t> lut;
+    std::vector<TestPage> pages;
+    for (uint32_t i = 0; i < 6; i++) {
+      if (i == 3) {
+        // End of the first chunk: its LUT is written, the next chunk is appended after it
+        for (const uint32_t pos : lut) serialization::writePod(file, pos);
+      }
+      lut.push_back(file.position());
+      pages.push_back(makePage(100 + i));
+      serializeBlob(file, pages.back());
+    }
+    const uint32_t lutOffset = file.position();
+    for (const uint32_t pos : lut) serialization::writePod(file, pos);
+
+    PageView view;
+    bool allSingleRead = true;
+    bool allMatch = true;
+    for (size_t i = 0; i < lut.size(); i++) {
+      const uint32_t end = i + 1 < lut.size() ? lut[i + 1] : lutOffset;
+      file.seek(lut[i]);
+      if (!view.load(file, end - lut[i]) || view.readCalls() != 1) allSingleRead = false;
+      FsFile legacy;
+      legacy.setBuffer("");
+      serializeLegacy(legacy, pages[i]);
+      legacy.seek(0);
+      if (describeBlob(view) != describeLegacy(*deserializeLegacy(legacy))) allMatch = false;
+    }
+    runner.expectTrue(allSingleRead, "Every page loads with one read from its LUT span");
+    runner.expectTrue(allMatch, "Span loads match page content across a chunk boundary");
+
+    file.seek(lut[0]);
+    runner.expectTrue(!view.load(file, 12), "Span too short for the page rejected");
+    file.seek(lut[0]);
+    runner.expectTrue(view.load(file) && view.readCalls() == 2, "Without a span the size is read first");
+  }
+
+  // Test 6: empty page
+  {
+    FsFile file;
+    file.setBuffer("");
+    serializeBlob(file, TestPage{});
+    file.seek(0);
+    PageView view;
+    runner.expectTrue(view.load(file), "Empty page loads");
+    runner.expectTrue(describeBlob(view).empty(), "Empty page renders nothing");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,187 @@
+#include "test_utils.h"
+
+#include <ContentParser.h>
+#include <Epub/Page.h>
+#include <PageCache.h>
+#include <SDCardManager.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+// Drives the real PageCache on the in-memory card: pages come from its resident LUT through the read handle
+// it keeps open, one open per cache rather than per page. Checks that a font or orientation change
+// invalidates the file and the LUT, that extend() closes the handle and leaves a LUT that covers the new
+// pages, and that a failed page read closes the handle so the next one reopens it.
+
+namespace {
+
+const char* const CACHE_PATH = "/book/sections/0.bin";
+
+RenderConfig portraitConfig(const int fontId = 1) { return RenderConfig(fontId, 1.0f, 1, 1, 0, true, true, 464, 760); }
+
+RenderConfig landscapeConfig() { return RenderConfig(1, 1.0f, 1, 1, 0, true, true, 784, 440); }
+
+// Emits numbered pages of one line each; the line's y position is the page number so a load can be checked
+class NumberedParser final : public ContentParser {
+ public:
+  explicit NumberedParser(const int totalPages) : totalPages_(totalPages) {}
+
+  bool parsePages(const std::function<void(std::unique_ptr<Page>)>& onPageComplete, const uint16_t maxPages,
+                  const AbortCallback& shouldAbort) override {
+    for (uint16_t emitted = 0; next_ < totalPages_ && (maxPages == 0 || emitted < maxPages); emitted++) {
+      if (shouldAbort && shouldAbort()) return false;
+      const std::string word = "page" + std::to_string(next_);
+      std::string text = word;
+      text.push_back('\0');
+      auto block = std::make_shared<TextBlock>(
+          text, std::vector<TextBlock::WordData>{{0, 0, EpdFontFamily::REGULAR}}, TextBlock::LEFT_ALIGN);
+      auto page = std::unique_ptr<Page>(new Page());
+      page->elements.push_back(std::make_shared<PageLine>(block, 0, static_cast<int16_t>(next_)));
+      next_++;
+      onPageComplete(std::move(page));
+    }
+    return true;
+  }
+
+  bool hasMoreContent() const override { return next_ < totalPages_; }
+  void reset() override { next_ = 0; }
+
+ private:
+  int totalPages_;
+  int next_ = 0;
+};
+
+// The page a view holds, from the y position NumberedParser gave its line (-1 if unreadable)
+int pageNumber(const PageView& view) {
+  if (!view.isLoaded()) return -1;
+  const auto page = view.toPage();
+  if (!page || page->elements.size() != 1) return -1;
+  return page->elements[0]->yPos;
+}
+
+// Loads every page in [from, to) and checks each is the one asked for
+bool loadsInOrder(PageCache& cache, const int from, const int to) {
+  PageView view;
+  for (int i = from; i < to; i++) {
+    if (!cache.loadPage(static_cast<uint16_t>(i), view) || pageNumber(view) != i) return false;
+  }
+  return true;
+}
+
+// Builds a partial cache of the first 10 pages and returns the bytes written
+std::string createPartial(const RenderConfig& config) {
+  SdMan.clear();
+  PageCache cache(CACHE_PATH);
+  NumberedParser parser(25);
+  cache.create(parser, config);
+  return SdMan.readFile(CACHE_PATH);
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("PageCache LUT and read handle");
+
+  // Test 1: a loaded cache serves every page through one open handle
+  {
+    createPartial(portraitConfig());
+    PageCache cache(CACHE_PATH);
+    runner.expectTrue(cache.load(portraitConfig()), "Cache loads with the config it was built for");
+    runner.expectEq(10, static_cast<int>(cache.pageCount()), "Partial cache holds the first chunk");
+    runner.expectTrue(cache.isPartial(), "Cache marked partial");
+    runner.expectTrue(loadsInOrder(cache, 0, 10), "Every page loads from the LUT");
+    PageView view;
+    runner.expectTrue(cache.loadPage(3, view) && pageNumber(view) == 3, "Page back loads");
+    runner.expectEq(1, SdMan.readOpens(), "One open for the header, LUT and every page");
+    runner.expectFalse(cache.loadPage(10, view), "Page past the LUT rejected");
+  }
+
+  // Test 2: a font change invalidates the file and the LUT
+  {
+    createPartial(portraitConfig());
+    PageCache cache(CACHE_PATH);
+    runner.expectTrue(cache.load(portraitConfig()), "Cache loads before the font change");
+    PageView view;
+    runner.expectTrue(cache.loadPage(0, view), "Page loads before the font change");
+    runner.expectFalse(cache.load(portraitConfig(2)), "Load with another font rejected");
+    runner.expectFalse(SdMan.exists(CACHE_PATH), "Font change removes the cache file");
+    runner.expectFalse(cache.loadPage(0, view), "No page served from the dropped LUT");
+  }
+
+  // Test 3: an orientation change (swapped viewport) invalidates the file the same way
+  {
+    createPartial(portraitConfig());
+    PageCache cache(CACHE_PATH);
+    runner.expectFalse(cache.load(landscapeConfig()), "Load with the other orientation rejected");
+    runner.expectFalse(SdMan.exists(CACHE_PATH), "Orientation change removes the cache file");
+    PageView view;
+    runner.expectFalse(cache.loadPage(0, view), "No page served after the orientation change");
+
+    // Rebuilt for the new orientation, then back: each rebuild invalidates the other
+    NumberedParser parser(25);
+    runner.expectTrue(cache.create(parser, landscapeConfig()), "Cache rebuilt for landscape");
+    runner.expectTrue(loadsInOrder(cache, 0, 10), "Rebuilt cache serves its pages");
+    PageCache reopened(CACHE_PATH);
+    runner.expectFalse(reopened.load(portraitConfig()), "Portrait rejects the landscape cache");
+  }
+
+  // Test 4: extend() closes the read handle, appends, and the new LUT covers old and new pages
+  {
+    createPartial(portraitConfig());
+    PageCache cache(CACHE_PATH);
+    cache.load(portraitConfig());
+    runner.expectTrue(loadsInOrder(cache, 0, 10), "Pages load before extend");
+    const int opensBefore = SdMan.readOpens();
+    NumberedParser parser(25);
+    runner.expectTrue(cache.extend(parser, 10), "Cache extends by a chunk");
+    runner.expectEq(20, static_cast<int>(cache.pageCount()), "Extended cache holds two chunks");
+    runner.expectTrue(loadsInOrder(cache, 0, 20), "Old and new pages load after extend");
+    runner.expectEq(opensBefore + 1, SdMan.readOpens(), "Handle reopened once after the write");
+
+    PageCache reloaded(CACHE_PATH);
+    runner.expectTrue(reloaded.load(portraitConfig()), "Extended file loads from the card");
+    runner.expectTrue(loadsInOrder(reloaded, 0, 20), "Reloaded LUT covers every page");
+
+    runner.expectTrue(cache.extend(parser, 10), "Cache extends to the end");
+    runner.expectFalse(cache.isPartial(), "Complete cache no longer partial");
+    runner.expectTrue(loadsInOrder(cache, 0, 25), "Every page loads once complete");
+  }
+
+  // Test 5: a failed page read closes the handle; the next page reopens it
+  {
+    std::string bytes = createPartial(portraitConfig());
+    // The LUT is the last thing in the file; overwrite the size prefix of page 4 with an impossible size
+    const size_t lutOffset = bytes.size() - 10 * sizeof(uint32_t);
+    uint32_t page4Pos = 0;
+    memcpy(&page4Pos, &bytes[lutOffset + 4 * sizeof(uint32_t)], sizeof(page4Pos));
+    const uint32_t hugeSize = 0x00FFFFFF;
+    memcpy(&bytes[page4Pos], &hugeSize, sizeof(hugeSize));
+    SdMan.clear();
+    SdMan.writeFile(CACHE_PATH, bytes);
+
+    PageCache cache(CACHE_PATH);
+    PageView view;
+    runner.expectTrue(cache.load(portraitConfig()), "Cache with a damaged page still loads");
+    runner.expectTrue(loadsInOrder(cache, 0, 4), "Pages before the damage load");
+    runner.expectFalse(cache.loadPage(4, view), "Damaged page rejected");
+    runner.expectEq(1, SdMan.readOpens(), "No reopen before the failure");
+    runner.expectTrue(loadsInOrder(cache, 5, 10), "Pages after the damage load");
+    runner.expectEq(2, SdMan.readOpens(), "Failure closed the handle, next page reopened it once");
+  }
+
+  // Test 6: a LUT that points past the file is rejected and the file dropped
+  {
+    const std::string bytes = createPartial(portraitConfig());
+    SdMan.writeFile(CACHE_PATH, bytes.substr(0, bytes.size() - 6));
+    PageCache cache(CACHE_PATH);
+    runner.expectFalse(cache.load(portraitConfig()), "Truncated LUT rejected");
+    runner.expectFalse(SdMan.exists(CACHE_PATH), "Truncated cache removed");
+    PageView view;
+    runner.expectFalse(cache.loadPage(0, view), "No page served from a rejected LUT");
+  }
+
+  SdMan.clear();
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,179 @@
+#include "test_utils.h"
+
+#include <PagePrefetchRing.h>
+
+#include <cstdint>
+#include <string>
+
+// Drives the real PagePrefetchRing the way ReaderState does: fill() run by the background task after a
+// render and take() on the next render. Pages are stand-ins that only remember which page they hold;
+// SD reads and free heap are counted/faked so the test checks how many page turns hit the disk.
+
+namespace {
+
+constexpr uint32_t kPageBytes = 4 * 1024;
+
+struct FakePage {
+  int loadedPage = -1;
+  bool holdsBuffer = false;
+  bool isLoaded() const { return loadedPage >= 0; }
+  void release() {
+    loadedPage = -1;
+    holdsBuffer = false;
+  }
+};
+
+using Ring = PagePrefetchRing<FakePage>;
+
+// ReaderState around the ring: pageView_/pageViewPage_, PageCache::loadPage and ESP.getFreeHeap()
+struct Reader {
+  int pageCount = 50;
+  uint32_t baseHeap = 200 * 1024;
+  int sdLoads = 0;
+  int ringHits = 0;
+  int stopAfterLoads = -1;  // shouldStop() once this many loads happened (-1: never)
+  FakePage pageView;
+  int pageViewPage = -1;
+  Ring prefetch;
+  FakePage* ringPages[Ring::kSlots] = {};
+  int ringPageCount = 0;
+
+  // Heap held by every page buffer, the ring's included (tracked through the pages it loaded into)
+  uint32_t freeHeap() const {
+    uint32_t used = pageView.holdsBuffer ? kPageBytes : 0;
+    for (int i = 0; i < ringPageCount; i++) used += ringPages[i]->holdsBuffer ? kPageBytes : 0;
+    return used > baseHeap ? 0 : baseHeap - used;
+  }
+
+  bool loadPage(int page, FakePage& out) {
+    if (page < 0 || page >= pageCount) return false;
+    sdLoads++;
+    out.loadedPage = page;
+    out.holdsBuffer = true;
+    return true;
+  }
+
+  void trackRingPage(FakePage* page) {
+    if (page == &pageView) return;
+    for (int i = 0; i < ringPageCount; i++) {
+      if (ringPages[i] == page) return;
+    }
+    if (ringPageCount < Ring::kSlots) ringPages[ringPageCount++] = page;
+  }
+
+  void prefetchPages(int sectionPage) {
+    prefetch.fill(
+        sectionPage, pageViewPage, pageCount,
+        [this](int page, FakePage& out) {
+          trackRingPage(&out);
+          return loadPage(page, out);
+        },
+        [this]() { return freeHeap(); }, [this]() { return stopAfterLoads >= 0 && sdLoads >= stopAfterLoads; });
+  }
+
+  // renderCachedPage(): current page from pageView_, the ring, or SD; then prefetch around it
+  bool render(int sectionPage) {
+    bool loaded = pageView.isLoaded() && pageViewPage == sectionPage;
+    if (!loaded && prefetch.take(sectionPage, pageView, pageViewPage)) {
+      loaded = true;
+      ringHits++;
+    }
+    if (!loaded) {
+      loaded = loadPage(sectionPage, pageView);
+      pageViewPage = loaded ? sectionPage : -1;
+    }
+    if (loaded) prefetchPages(sectionPage);
+    return loaded && pageView.loadedPage == sectionPage;
+  }
+};
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("PageCache Prefetch Ring");
+
+  // Test 1: reading forward only the first render waits on SD
+  {
+    Reader reader;
+    bool allCorrect = reader.render(10);
+    const int loadsAfterFirst = reader.sdLoads;
+    reader.ringHits = 0;
+    for (int page = 11; page < 30; page++) allCorrect = reader.render(page) && allCorrect;
+    runner.expectTrue(allCorrect, "Every render shows the requested page");
+    runner.expectEq(19, reader.ringHits, "Every forward page turn served from the ring");
+    runner.expectEq(4, loadsAfterFirst, "First render loads current, next two and previous");
+    runner.expectEq(loadsAfterFirst + 19, reader.sdLoads, "One background load per forward page turn");
+  }
+
+  // Test 2: page back after a page forward is served from the swapped-out slot
+  {
+    Reader reader;
+    reader.render(5);
+    reader.render(6);
+    const int loads = reader.sdLoads;
+    reader.ringHits = 0;
+    runner.expectTrue(reader.render(5), "Page back renders the previous page");
+    runner.expectEq(1, reader.ringHits, "Page back hits the ring");
+    runner.expectTrue(reader.render(4), "Second page back renders");
+    runner.expectEq(2, reader.ringHits, "Second page back prefetched after the first");
+    runner.expectTrue(reader.sdLoads - loads <= 2, "Page back triggers at most one load per turn");
+  }
+
+  // Test 3: section edges don't prefetch outside the cache
+  {
+    Reader reader;
+    reader.pageCount = 3;
+    reader.render(2);
+    runner.expectEq(1, reader.prefetch.size(), "Last page only prefetches backwards");
+    runner.expectEq(2, reader.sdLoads, "No loads past the end");
+    Reader first;
+    first.render(0);
+    runner.expectEq(2, first.prefetch.size(), "First page only prefetches forwards");
+  }
+
+  // Test 4: low heap shrinks the ring instead of failing the render
+  {
+    Reader reader;
+    reader.baseHeap = Ring::kMinFreeHeap + kPageBytes * 2 + 100;
+    runner.expectTrue(reader.render(10), "Render succeeds with little heap");
+    runner.expectEq(2, reader.prefetch.size(), "Ring depth bounded by free heap");
+    runner.expectTrue(reader.freeHeap() >= Ring::kMinFreeHeap - kPageBytes, "Prefetch leaves heap headroom");
+
+    reader.baseHeap = Ring::kMinFreeHeap / 2;
+    reader.sdLoads = 0;
+    runner.expectTrue(reader.render(11), "Render succeeds below the prefetch threshold");
+    runner.expectEq(0, reader.sdLoads, "No prefetch below the threshold");
+    runner.expectTrue(reader.render(12), "Page already in the ring still served");
+    runner.expectEq(0, reader.sdLoads, "Ring kept while heap is low");
+    runner.expectTrue(reader.render(13), "Page turn past the ring still loads from SD");
+    runner.expectEq(1, reader.sdLoads, "Missed page loaded on demand");
+  }
+
+  // Test 5: a stop request (panel refresh done, task stopping) ends the fill between loads
+  {
+    Reader reader;
+    reader.stopAfterLoads = 2;
+    runner.expectTrue(reader.render(20), "Render succeeds when the fill is cut short");
+    runner.expectEq(1, reader.prefetch.size(), "Fill stops at the first check after the request");
+    reader.stopAfterLoads = -1;
+    reader.prefetchPages(20);
+    runner.expectEq(3, reader.prefetch.size(), "Next fill completes the window");
+    runner.expectEq(4, reader.sdLoads, "Completing the window reloads nothing");
+  }
+
+  // Test 6: clear() drops every page, as resetPageCache() does when the cache goes away
+  {
+    Reader reader;
+    reader.render(10);
+    reader.prefetch.clear();
+    runner.expectEq(0, reader.prefetch.size(), "Cleared ring holds nothing");
+    runner.expectFalse(reader.prefetch.holds(11), "Cleared ring no longer holds the next page");
+    runner.expectEq(200u * 1024 - kPageBytes, reader.freeHeap(), "Cleared ring frees its buffers");
+    const int loads = reader.sdLoads;
+    runner.expectTrue(reader.render(11), "Page turn after a clear renders");
+    runner.expectEq(0, reader.ringHits, "Page turn after a clear misses the ring");
+    runner.expectTrue(reader.sdLoads > loads, "Page turn after a clear reads from SD");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -372,5 +372,34 @@ int main() {
     runner.expectEqual("Third", s3, "Sequential strings: value 3");
   }
 
+  // ============================================
+  // writePodChecked() tests
+  // ============================================
+
+  // Test 26: writePodChecked success
+  {
+    FsFile file;
+    file.setBuffer("");
+    runner.expectTrue(serialization::writePodChecked(file, static_cast<uint32_t>(0x12345678)),
+                      "writePodChecked: returns true on success");
+    file.seek(0);
+    uint32_t val = 0;
+    runner.expectTrue(serialization::readPodChecked(file, val) && val == 0x12345678,
+                      "writePodChecked: value reads back");
+  }
+
+  // Test 27: writePodChecked short write (card full)
+  {
+    FsFile file;
+    file.setBuffer("");
+    file.setWriteLimit(6);
+    runner.expectTrue(serialization::writePodChecked(file, static_cast<uint32_t>(1)),
+                      "writePodChecked: write within the limit succeeds");
+    runner.expectFalse(serialization::writePodChecked(file, static_cast<uint32_t>(2)),
+                       "writePodChecked: returns false on short write");
+    runner.expectFalse(serialization::writePodChecked(file, static_cast<uint8_t>(3)),
+                       "writePodChecked: returns false once full");
+  }
+
   return runner.allPassed() ? 0 : 1;
 }
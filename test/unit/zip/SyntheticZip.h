@@ -0,0 +1,252 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Synthetic zip images and a mirror of ZipFile::CentralDirReader for the zip tests.
+// ZipFile depends on SdFat and SDCardManager, so the walkers are mirrored over an in-memory file.
+
+namespace ziptest {
+
+// In-memory file counting read calls, standing in for FsFile
+class CountingFile {
+ public:
+  explicit CountingFile(std::string data = "") : data_(std::move(data)) {}
+
+  size_t read(void* buf, size_t len) {
+    reads++;
+    const size_t n = std::min(len, data_.size() - std::min(pos_, data_.size()));
+    memcpy(buf, data_.data() + pos_, n);
+    pos_ += n;
+    return n;
+  }
+  bool seek(size_t pos) {
+    if (pos > data_.size()) return false;
+    pos_ = pos;
+    return true;
+  }
+  bool seekCur(size_t off) { return seek(pos_ + off); }
+  bool available() const { return pos_ < data_.size(); }
+  size_t size() const { return data_.size(); }
+  size_t write(const void* buf, size_t len) {
+    if (pos_ + len > data_.size()) data_.resize(pos_ + len);
+    memcpy(&data_[pos_], buf, len);
+    pos_ += len;
+    return len;
+  }
+
+  size_t reads = 0;
+
+ private:
+  std::string data_;
+  size_t pos_ = 0;
+};
+
+uint64_t fnvHash64(const char* s, size_t len) {
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= static_cast<uint8_t>(s[i]);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+template <typename T>
+void put(std::string& out, T value) {
+  out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+struct SyntheticZip {
+  std::string bytes;
+  uint32_t centralDirOffset = 0;
+  uint32_t centralDirSize = 0;
+  uint16_t totalEntries = 0;
+  std::vector<uint32_t> dataOffsets;
+};
+
+// Stored entries with a varying extra field so data offsets can't be derived from the name alone
+SyntheticZip buildZip(const std::vector<std::string>& names) {
+  SyntheticZip zip;
+  std::vector<uint32_t> headerOffsets;
+  for (size_t i = 0; i < names.size(); i++) {
+    const std::string& name = names[i];
+    const uint16_t extraLen = static_cast<uint16_t>(i % 7);
+    const std::string content = "content of " + name;
+    headerOffsets.push_back(zip.bytes.size());
+    put<uint32_t>(zip.bytes, 0x04034b50);
+    put<uint16_t>(zip.bytes, 10);
+    put<uint16_t>(zip.bytes, 0);
+    put<uint16_t>(zip.bytes, 0);  // stored
+    put<uint32_t>(zip.bytes, 0);
+    put<uint32_t>(zip.bytes, 0);  // crc
+    put<uint32_t>(zip.bytes, content.size());
+    put<uint32_t>(zip.bytes, content.size());
+    put<uint16_t>(zip.bytes, name.size());
+    put<uint16_t>(zip.bytes, extraLen);
+    zip.bytes += name;
+    zip.bytes.append(extraLen, '\0');
+    zip.dataOffsets.push_back(zip.bytes.size());
+    zip.bytes += content;
+  }
+
+  zip.centralDirOffset = zip.bytes.size();
+  for (size_t i = 0; i < names.size(); i++) {
+    const std::string& name = names[i];
+    const uint32_t size = ("content of " + name).size();
+    const uint16_t extraLen = i % 5 == 0 ? 4 : 0;
+    const uint16_t commentLen = i % 11 == 0 ? 3 : 0;
+    put<uint32_t>(zip.bytes, 0x02014b50);
+    put<uint16_t>(zip.bytes, 20);
+    put<uint16_t>(zip.bytes, 10);
+    put<uint16_t>(zip.bytes, 0);
+    put<uint16_t>(zip.bytes, 0);  // method
+    put<uint32_t>(zip.bytes, 0);
+    put<uint32_t>(zip.bytes, 0);  // crc
+    put<uint32_t>(zip.bytes, size);
+    put<uint32_t>(zip.bytes, size);
+    put<uint16_t>(zip.bytes, name.size());
+    put<uint16_t>(zip.bytes, extraLen);
+    put<uint16_t>(zip.bytes, commentLen);
+    put<uint16_t>(zip.bytes, 0);
+    put<uint16_t>(zip.bytes, 0);
+    put<uint32_t>(zip.bytes, 0);
+    put<uint32_t>(zip.bytes, headerOffsets[i]);
+    zip.bytes += name;
+    zip.bytes.append(extraLen, 'x');
+    zip.bytes.append(commentLen, 'c');
+  }
+
+  const uint32_t centralDirSize = zip.bytes.size() - zip.centralDirOffset;
+  zip.centralDirSize = centralDirSize;
+  put<uint32_t>(zip.bytes, 0x06054b50);
+  put<uint16_t>(zip.bytes, 0);
+  put<uint16_t>(zip.bytes, 0);
+  put<uint16_t>(zip.bytes, names.size());
+  put<uint16_t>(zip.bytes, names.size());
+  put<uint32_t>(zip.bytes, centralDirSize);
+  put<uint32_t>(zip.bytes, zip.centralDirOffset);
+  put<uint16_t>(zip.bytes, 0);
+  zip.totalEntries = names.size();
+  return zip;
+}
+
+// Mirrors ZipFile::CentralDirReader
+class CentralDirReader {
+ public:
+  struct Entry {
+    uint16_t method;
+    uint32_t compressedSize;
+    uint32_t uncompressedSize;
+    uint32_t localHeaderOffset;
+    uint16_t nameLen;
+    const char* name;
+  };
+
+  CentralDirReader(CountingFile& file, uint32_t centralDirOffset, uint32_t centralDirSize, size_t budget)
+      : file(file), filePos(centralDirOffset), remaining(centralDirSize) {
+    if (!file.seek(centralDirOffset)) return;
+    valid = true;
+    if (remaining == 0) return;
+    capacity = std::min<size_t>(remaining, std::max(budget, MIN_CAPACITY));
+    buffer = static_cast<uint8_t*>(malloc(capacity));
+    valid = buffer != nullptr;
+  }
+  ~CentralDirReader() { free(buffer); }
+
+  bool next(Entry* entry) {
+    constexpr size_t headerSize = 46;
+    while (valid && fill(headerSize)) {
+      const uint8_t* header = buffer + start;
+      uint32_t sig;
+      memcpy(&sig, header, 4);
+      if (sig != 0x02014b50) return false;
+
+      uint16_t nameLen, m, k;
+      memcpy(&entry->method, header + 10, 2);
+      memcpy(&entry->compressedSize, header + 20, 4);
+      memcpy(&entry->uncompressedSize, header + 24, 4);
+      memcpy(&nameLen, header + 28, 2);
+      memcpy(&m, header + 30, 2);
+      memcpy(&k, header + 32, 2);
+      memcpy(&entry->localHeaderOffset, header + 42, 4);
+      start += headerSize;
+
+      if (nameLen >= 255) {
+        if (!skip(nameLen + m + k)) return false;
+        continue;
+      }
+
+      if (!fill(nameLen)) return false;
+      memcpy(name, buffer + start, nameLen);
+      name[nameLen] = '\0';
+      start += nameLen;
+      entry->nameLen = nameLen;
+      entry->name = name;
+      skip(m + k);
+      return true;
+    }
+    return false;
+  }
+
+ private:
+  static constexpr size_t MIN_CAPACITY = 512;
+
+  bool fill(size_t needed) {
+    if (end - start >= needed) return true;
+    if (needed > capacity) return false;
+    if (start > 0) {
+      memmove(buffer, buffer + start, end - start);
+      end -= start;
+      start = 0;
+    }
+    while (end < needed && remaining > 0) {
+      size_t toRead = std::min<size_t>(capacity - end, remaining);
+      if (toRead < remaining) {
+        const size_t misalignment = (filePos + toRead) % 512;
+        if (toRead > misalignment && end + toRead - misalignment >= needed) toRead -= misalignment;
+      }
+      const size_t bytesRead = file.read(buffer + end, toRead);
+      if (bytesRead == 0) {
+        remaining = 0;
+        break;
+      }
+      end += bytesRead;
+      filePos += bytesRead;
+      remaining -= bytesRead;
+    }
+    return end - start >= needed;
+  }
+
+  bool skip(size_t count) {
+    const size_t buffered = end - start;
+    if (count <= buffered) {
+      start += count;
+      return true;
+    }
+    count -= buffered;
+    start = end = 0;
+    if (count > remaining) {
+      remaining = 0;
+      return false;
+    }
+    filePos += count;
+    remaining -= count;
+    return file.seek(filePos);
+  }
+
+  CountingFile& file;
+  uint8_t* buffer = nullptr;
+  size_t capacity = 0;
+  size_t start = 0;
+  size_t end = 0;
+  uint32_t filePos = 0;
+  uint32_t remaining = 0;
+  bool valid = false;
+  char name[256];
+};
+
+}  // namespace ziptest
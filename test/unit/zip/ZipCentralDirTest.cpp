@@ -0,0 +1,176 @@
+#include "test_utils.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "SyntheticZip.h"
+
+// Compares the block-buffered ZipFile::CentralDirReader against the per-field central directory walk it
+// replaced, on a synthetic 5000-entry zip. Read calls stand in for SdFat transactions.
+
+using ziptest::buildZip;
+using ziptest::CentralDirReader;
+using ziptest::CountingFile;
+using ziptest::SyntheticZip;
+
+namespace {
+
+struct ParsedEntry {
+  std::string name;
+  uint16_t method;
+  uint32_t compressedSize;
+  uint32_t uncompressedSize;
+  uint32_t localHeaderOffset;
+
+  bool operator==(const ParsedEntry& other) const {
+    return name == other.name && method == other.method && compressedSize == other.compressedSize &&
+           uncompressedSize == other.uncompressedSize && localHeaderOffset == other.localHeaderOffset;
+  }
+};
+
+// The walk ZipFile::loadAllFileStatSlims did before the block reader
+std::vector<ParsedEntry> legacyWalk(CountingFile& file, uint32_t centralDirOffset) {
+  std::vector<ParsedEntry> entries;
+  file.seek(centralDirOffset);
+
+  uint32_t sig;
+  char itemName[256];
+  while (file.available()) {
+    file.read(&sig, 4);
+    if (sig != 0x02014b50) break;
+
+    ParsedEntry entry = {};
+    file.seekCur(6);
+    file.read(&entry.method, 2);
+    file.seekCur(8);
+    file.read(&entry.compressedSize, 4);
+    file.read(&entry.uncompressedSize, 4);
+    uint16_t nameLen, m, k;
+    file.read(&nameLen, 2);
+    file.read(&m, 2);
+    file.read(&k, 2);
+    file.seekCur(8);
+    file.read(&entry.localHeaderOffset, 4);
+
+    if (nameLen >= 255) {
+      file.seekCur(nameLen + m + k);
+      continue;
+    }
+
+    file.read(itemName, nameLen);
+    itemName[nameLen] = '\0';
+    entry.name = itemName;
+    entries.push_back(entry);
+
+    file.seekCur(m + k);
+  }
+  return entries;
+}
+
+std::vector<ParsedEntry> bufferedWalk(CountingFile& file, uint32_t centralDirOffset, uint32_t centralDirSize,
+                                      size_t budget) {
+  std::vector<ParsedEntry> entries;
+  CentralDirReader reader(file, centralDirOffset, centralDirSize, budget);
+  CentralDirReader::Entry entry;
+  while (reader.next(&entry)) {
+    entries.push_back({std::string(entry.name, entry.nameLen), entry.method, entry.compressedSize,
+                       entry.uncompressedSize, entry.localHeaderOffset});
+  }
+  return entries;
+}
+
+std::vector<std::string> makeNames(int count) {
+  std::vector<std::string> names;
+  for (int i = 0; i < count; i++) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "OEBPS/Images/comic_page_%05d.jpg", i);
+    names.push_back(buf);
+  }
+  return names;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("ZipFile Central Directory");
+
+  const auto names = makeNames(5000);
+  const SyntheticZip zip = buildZip(names);
+
+  // Test 1: legacy walk baseline
+  CountingFile legacyFile(zip.bytes);
+  const auto legacyStart = std::chrono::steady_clock::now();
+  const auto legacyEntries = legacyWalk(legacyFile, zip.centralDirOffset);
+  const auto legacyUs =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - legacyStart).count();
+  runner.expectEq(static_cast<size_t>(5000), legacyEntries.size(), "Legacy walk parses all entries");
+
+  std::cout << "\n    Central directory: " << zip.centralDirSize << " bytes, " << names.size() << " entries\n";
+  std::cout << "    Walker           Budget     Read calls   Time (us)\n";
+  printf("    %-16s %-10s %10zu %11lld\n", "per-field", "-", legacyFile.reads, static_cast<long long>(legacyUs));
+
+  // Test 2: block reader at several budgets parses identical entries with far fewer reads
+  const size_t budgets[] = {zip.centralDirSize, 16 * 1024, 4 * 1024, 512};
+  for (const size_t budget : budgets) {
+    CountingFile file(zip.bytes);
+    const auto start = std::chrono::steady_clock::now();
+    const auto entries = bufferedWalk(file, zip.centralDirOffset, zip.centralDirSize, budget);
+    const auto us =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    printf("    %-16s %-10zu %10zu %11lld\n", "block-buffered", budget, file.reads, static_cast<long long>(us));
+
+    const std::string label = " (budget " + std::to_string(budget) + ")";
+    runner.expectTrue(entries == legacyEntries, "Block reader matches legacy walk" + label);
+    // Chunks shrink by at most one sector for alignment, plus one partial read per refill
+    const size_t chunk = budget > 512 ? budget - 512 : budget / 2;
+    const size_t bound = zip.centralDirSize / chunk + 2;
+    runner.expectTrue(file.reads <= bound, "Read calls bounded by directory size / budget" + label,
+                      std::to_string(file.reads) + " reads, bound " + std::to_string(bound));
+  }
+  std::cout << "\n";
+
+  // Test 3: a directory that fits the budget is pulled in a single read
+  {
+    CountingFile file(zip.bytes);
+    bufferedWalk(file, zip.centralDirOffset, zip.centralDirSize, zip.centralDirSize);
+    runner.expectEq(static_cast<size_t>(1), file.reads, "Directory within budget read in one call");
+    runner.expectTrue(legacyFile.reads >= 8 * 5000, "Legacy walk issues ~8 reads per entry");
+  }
+
+  // Test 4: overlong names are skipped by both walkers
+  {
+    std::vector<std::string> mixed = {"a.xhtml", std::string(300, 'n'), "b.xhtml"};
+    const SyntheticZip small = buildZip(mixed);
+    CountingFile legacy(small.bytes);
+    CountingFile buffered(small.bytes);
+    const auto legacyResult = legacyWalk(legacy, small.centralDirOffset);
+    const auto bufferedResult = bufferedWalk(buffered, small.centralDirOffset, small.centralDirSize, 512);
+    runner.expectEq(static_cast<size_t>(2), bufferedResult.size(), "Overlong name skipped");
+    runner.expectTrue(bufferedResult == legacyResult, "Skip matches legacy walk");
+  }
+
+  // Test 5: truncated directory stops cleanly
+  {
+    CountingFile file(zip.bytes.substr(0, zip.centralDirOffset + 1000));
+    const auto entries = bufferedWalk(file, zip.centralDirOffset, zip.centralDirSize, 4096);
+    runner.expectTrue(entries.size() < 5000, "Truncated directory stops early");
+    bool prefixMatches = true;
+    for (size_t i = 0; i < entries.size(); i++) {
+      if (!(entries[i] == legacyEntries[i])) prefixMatches = false;
+    }
+    runner.expectTrue(prefixMatches, "Entries before truncation are intact");
+  }
+
+  // Test 6: empty directory
+  {
+    const SyntheticZip empty = buildZip({});
+    CountingFile file(empty.bytes);
+    runner.expectTrue(bufferedWalk(file, empty.centralDirOffset, empty.centralDirSize, 4096).empty(),
+                      "Empty directory yields no entries");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,283 @@
+#include "test_utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "SyntheticZip.h"
+
+// Mirrors ZipFile::buildIndex / ZipFile::findIndexEntry over an in-memory zip image
+
+using ziptest::buildZip;
+using ziptest::CentralDirReader;
+using ziptest::CountingFile;
+using ziptest::fnvHash64;
+using ziptest::SyntheticZip;
+
+namespace {
+
+struct IndexEntry {
+  uint64_t hash;
+  uint16_t len;
+  uint16_t method;
+  uint32_t compressedSize;
+  uint32_t uncompressedSize;
+  uint32_t dataOffset;
+};
+
+struct IndexHeader {
+  uint8_t version;
+  uint8_t reserved;
+  uint16_t entryCount;
+  uint32_t centralDirOffset;
+  uint32_t zipSize;
+};
+
+constexpr uint16_t INDEX_AMBIGUOUS = 0xFFFF;
+
+long getDataOffset(CountingFile& file, uint32_t localHeaderOffset) {
+  uint8_t header[30];
+  file.seek(localHeaderOffset);
+  if (file.read(header, 30) != 30) return -1;
+  if (header[0] + (header[1] << 8) + (header[2] << 16) + (header[3] << 24) != 0x04034b50) return -1;
+  const uint16_t filenameLength = header[26] + (header[27] << 8);
+  const uint16_t extraOffset = header[28] + (header[29] << 8);
+  return localHeaderOffset + 30 + filenameLength + extraOffset;
+}
+
+// Mirrors ZipFile::buildIndex
+bool buildIndex(CountingFile& file, uint32_t centralDirOffset, uint32_t centralDirSize, uint16_t totalEntries,
+                size_t budget, CountingFile& indexFile, int* passesOut) {
+  IndexHeader header = {1, 0, 0, centralDirOffset, static_cast<uint32_t>(file.size())};
+  indexFile.write(&header, sizeof(header));
+
+  const size_t entriesPerPass = budget / sizeof(IndexEntry);
+  const int passes = std::max<int>(1, (totalEntries + entriesPerPass - 1) / entriesPerPass);
+  uint32_t written = 0;
+  std::vector<IndexEntry> entries;
+
+  for (int pass = 0; pass < passes; pass++) {
+    const uint32_t rangeStart = pass * 256 / passes;
+    const uint32_t rangeEnd = (pass + 1) * 256 / passes;
+    entries.clear();
+    CentralDirReader reader(file, centralDirOffset, centralDirSize, 16 * 1024);
+    CentralDirReader::Entry dirEntry;
+    while (reader.next(&dirEntry)) {
+      const uint64_t hash = fnvHash64(dirEntry.name, dirEntry.nameLen);
+      const uint32_t bucket = static_cast<uint32_t>(hash >> 56);
+      if (bucket < rangeStart || bucket >= rangeEnd) continue;
+      entries.push_back({hash, dirEntry.nameLen, dirEntry.method, dirEntry.compressedSize, dirEntry.uncompressedSize,
+                         dirEntry.localHeaderOffset});
+    }
+
+    std::sort(entries.begin(), entries.end(),
+              [](const IndexEntry& a, const IndexEntry& b) { return a.dataOffset < b.dataOffset; });
+    for (auto& entry : entries) {
+      const long dataOffset = getDataOffset(file, entry.dataOffset);
+      if (dataOffset <= 0) return false;
+      entry.dataOffset = static_cast<uint32_t>(dataOffset);
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const IndexEntry& a, const IndexEntry& b) {
+      return a.hash < b.hash || (a.hash == b.hash && a.len < b.len);
+    });
+    for (size_t i = 1; i < entries.size(); i++) {
+      if (entries[i].hash == entries[i - 1].hash && entries[i].len == entries[i - 1].len) {
+        entries[i].method = INDEX_AMBIGUOUS;
+        entries[i - 1].method = INDEX_AMBIGUOUS;
+      }
+    }
+
+    if (!entries.empty()) indexFile.write(entries.data(), entries.size() * sizeof(IndexEntry));
+    written += entries.size();
+  }
+
+  header.entryCount = static_cast<uint16_t>(written);
+  indexFile.seek(0);
+  indexFile.write(&header, sizeof(header));
+  *passesOut = passes;
+  return true;
+}
+
+// Mirrors ZipFile::findIndexEntry
+int findIndexEntry(CountingFile& indexFile, uint16_t entryCount, uint64_t hash, uint16_t len, IndexEntry* entry) {
+  uint32_t lo = 0;
+  uint32_t hi = entryCount;
+  while (lo < hi) {
+    const uint32_t mid = lo + (hi - lo) / 2;
+    IndexEntry probe;
+    if (!indexFile.seek(sizeof(IndexHeader) + mid * sizeof(IndexEntry)) ||
+        indexFile.read(&probe, sizeof(IndexEntry)) != sizeof(IndexEntry)) {
+      return -1;
+    }
+    if (probe.hash == hash && probe.len == len) {
+      if (probe.method == INDEX_AMBIGUOUS) return -1;
+      *entry = probe;
+      return 1;
+    }
+    if (probe.hash < hash || (probe.hash == hash && probe.len < len)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return 0;
+}
+
+// Linear central directory scan as done by ZipFile::loadFileStatSlim without an index
+bool scanForName(CountingFile& file, uint32_t centralDirOffset, const std::string& name) {
+  file.seek(centralDirOffset);
+  uint32_t sig;
+  char itemName[256];
+  while (file.available()) {
+    file.read(&sig, 4);
+    if (sig != 0x02014b50) break;
+    uint16_t method;
+    uint32_t compressedSize, uncompressedSize, localHeaderOffset;
+    file.seekCur(6);
+    file.read(&method, 2);
+    file.seekCur(8);
+    file.read(&compressedSize, 4);
+    file.read(&uncompressedSize, 4);
+    uint16_t nameLen, m, k;
+    file.read(&nameLen, 2);
+    file.read(&m, 2);
+    file.read(&k, 2);
+    file.seekCur(8);
+    file.read(&localHeaderOffset, 4);
+    file.read(itemName, nameLen);
+    itemName[nameLen] = '\0';
+    if (name == itemName) return true;
+    file.seekCur(m + k);
+  }
+  return false;
+}
+
+std::vector<std::string> makeNames(int count) {
+  std::vector<std::string> names;
+  for (int i = 0; i < count; i++) {
+    names.push_back("OEBPS/images/page" + std::to_string(i) + (i % 3 == 0 ? ".png" : ".jpg"));
+  }
+  return names;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("ZipFile Index");
+
+  // Test 1: every entry is found with its precomputed data offset, across multiple build passes
+  {
+    const auto names = makeNames(1200);
+    const SyntheticZip zip = buildZip(names);
+    CountingFile file(zip.bytes);
+    CountingFile indexFile;
+    int passes = 0;
+    runner.expectTrue(
+        buildIndex(file, zip.centralDirOffset, zip.centralDirSize, zip.totalEntries, 16 * 1024, indexFile, &passes),
+        "Index builds");
+    runner.expectTrue(passes > 1, "1200 entries need several passes within a 16KB budget");
+
+    IndexHeader header;
+    indexFile.seek(0);
+    indexFile.read(&header, sizeof(header));
+    runner.expectEq(static_cast<uint16_t>(1200), header.entryCount, "All entries indexed");
+    runner.expectEq(static_cast<size_t>(sizeof(IndexHeader) + 1200 * sizeof(IndexEntry)), indexFile.size(),
+                    "Index size matches entry count");
+
+    bool sorted = true;
+    IndexEntry prev = {};
+    for (uint32_t i = 0; i < header.entryCount; i++) {
+      IndexEntry entry;
+      indexFile.seek(sizeof(IndexHeader) + i * sizeof(IndexEntry));
+      indexFile.read(&entry, sizeof(entry));
+      if (i > 0 && (entry.hash < prev.hash || (entry.hash == prev.hash && entry.len < prev.len))) sorted = false;
+      prev = entry;
+    }
+    runner.expectTrue(sorted, "Passes concatenate into a sorted index");
+
+    bool allFound = true;
+    bool offsetsMatch = true;
+    size_t maxReads = 0;
+    for (size_t i = 0; i < names.size(); i++) {
+      IndexEntry entry;
+      indexFile.reads = 0;
+      const int result = findIndexEntry(indexFile, header.entryCount, fnvHash64(names[i].data(), names[i].size()),
+                                        names[i].size(), &entry);
+      maxReads = std::max(maxReads, indexFile.reads);
+      if (result != 1) {
+        allFound = false;
+        continue;
+      }
+      if (entry.dataOffset != zip.dataOffsets[i] || entry.uncompressedSize != ("content of " + names[i]).size()) {
+        offsetsMatch = false;
+      }
+    }
+    runner.expectTrue(allFound, "Every entry found in index");
+    runner.expectTrue(offsetsMatch, "Data offsets and sizes match the local headers");
+    const size_t logBound = static_cast<size_t>(std::ceil(std::log2(1200.0))) + 1;
+    runner.expectTrue(maxReads <= logBound, "Lookup reads bounded by log2(n)",
+                      "max reads " + std::to_string(maxReads));
+
+    IndexEntry entry;
+    const std::string missing = "OEBPS/images/missing.png";
+    runner.expectEq(0, findIndexEntry(indexFile, header.entryCount, fnvHash64(missing.data(), missing.size()),
+                                      missing.size(), &entry),
+                    "Missing entry not found");
+
+    // Compare against a linear scan for the last entry
+    file.reads = 0;
+    runner.expectTrue(scanForName(file, zip.centralDirOffset, names.back()), "Scan finds last entry");
+    const size_t scanReads = file.reads;
+    indexFile.reads = 0;
+    findIndexEntry(indexFile, header.entryCount, fnvHash64(names.back().data(), names.back().size()),
+                   names.back().size(), &entry);
+    std::cout << "    Lookup of last entry: scan " << scanReads << " reads, index " << indexFile.reads
+              << " reads\n";
+    runner.expectTrue(indexFile.reads * 100 < scanReads, "Index lookup far cheaper than scan");
+  }
+
+  // Test 2: single pass for a typical EPUB
+  {
+    const auto names = makeNames(150);
+    const SyntheticZip zip = buildZip(names);
+    CountingFile file(zip.bytes);
+    CountingFile indexFile;
+    int passes = 0;
+    buildIndex(file, zip.centralDirOffset, zip.centralDirSize, zip.totalEntries, 16 * 1024, indexFile, &passes);
+    runner.expectEq(1, passes, "Small archive indexed in one pass");
+  }
+
+  // Test 3: duplicate names are marked ambiguous so lookups fall back to a scan
+  {
+    const std::vector<std::string> names = {"a.xhtml", "dup.css", "b.xhtml", "dup.css"};
+    const SyntheticZip zip = buildZip(names);
+    CountingFile file(zip.bytes);
+    CountingFile indexFile;
+    int passes = 0;
+    buildIndex(file, zip.centralDirOffset, zip.centralDirSize, zip.totalEntries, 16 * 1024, indexFile, &passes);
+    IndexEntry entry;
+    runner.expectEq(-1, findIndexEntry(indexFile, 4, fnvHash64("dup.css", 7), 7, &entry),
+                    "Colliding entries report ambiguous");
+    runner.expectEq(1, findIndexEntry(indexFile, 4, fnvHash64("b.xhtml", 7), 7, &entry), "Other entries resolve");
+    runner.expectEq(zip.dataOffsets[2], entry.dataOffset, "Resolved entry has correct data offset");
+  }
+
+  // Test 4: empty archive
+  {
+    const SyntheticZip zip = buildZip({});
+    CountingFile file(zip.bytes);
+    CountingFile indexFile;
+    int passes = 0;
+    runner.expectTrue(
+        buildIndex(file, zip.centralDirOffset, zip.centralDirSize, zip.totalEntries, 16 * 1024, indexFile, &passes),
+        "Empty archive builds");
+    IndexEntry entry;
+    runner.expectEq(0, findIndexEntry(indexFile, 0, fnvHash64("x", 1), 1, &entry), "Empty index finds nothing");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,209 @@
+#include "test_utils.h"
+
+#include <miniz.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Mirrors the inflate loop of ZipFile::readFileToStream with its seek index: snapshots of the tinfl state and
+// dictionary window taken between tinfl_decompress() calls must let inflation restart at any later offset.
+// Runs against the real miniz inflater on a raw deflate stream, with the seek index kept in memory.
+
+namespace {
+
+constexpr uint32_t INTERVAL = 256 * 1024;
+constexpr size_t CHUNK_SIZE = 4096;
+
+struct SeekPoint {
+  uint32_t outOffset;
+  uint32_t inOffset;
+  uint32_t dictCursor;
+  std::vector<uint8_t> state;
+  std::vector<uint8_t> dict;
+};
+
+struct InflateResult {
+  bool ok = false;
+  std::string output;
+  size_t inflatedBytes = 0;  // Bytes produced by tinfl, including skipped ones
+};
+
+InflateResult inflateFrom(const std::vector<uint8_t>& deflated, uint32_t fromOffset, std::vector<SeekPoint>& index) {
+  InflateResult result;
+  auto* inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+  auto* outputBuffer = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
+  memset(inflator, 0, sizeof(tinfl_decompressor));
+  tinfl_init(inflator);
+  memset(outputBuffer, 0, TINFL_LZ_DICT_SIZE);
+
+  size_t filePos = 0;
+  size_t fileRemainingBytes = deflated.size();
+  size_t processedOutputBytes = 0;
+  size_t outputCursor = 0;
+  uint8_t fileReadBuffer[CHUNK_SIZE];
+  size_t fileReadBufferFilledBytes = 0;
+  size_t fileReadBufferCursor = 0;
+
+  uint16_t pointCount = index.size();
+  if (pointCount > 0 && fromOffset >= INTERVAL) {
+    int point = std::min<int>(pointCount, fromOffset / INTERVAL) - 1;
+    while (point >= 0 && index[point].outOffset > fromOffset) point--;
+    if (point >= 0) {
+      const SeekPoint& seekPoint = index[point];
+      memcpy(inflator, seekPoint.state.data(), sizeof(tinfl_decompressor));
+      memcpy(outputBuffer, seekPoint.dict.data(), TINFL_LZ_DICT_SIZE);
+      filePos = seekPoint.inOffset;
+      fileRemainingBytes = deflated.size() - seekPoint.inOffset;
+      processedOutputBytes = seekPoint.outOffset;
+      outputCursor = seekPoint.dictCursor;
+    }
+  }
+  const size_t startOutput = processedOutputBytes;
+
+  while (true) {
+    if (fileReadBufferCursor >= fileReadBufferFilledBytes) {
+      if (fileRemainingBytes == 0) break;
+      fileReadBufferFilledBytes = std::min(fileRemainingBytes, CHUNK_SIZE);
+      memcpy(fileReadBuffer, deflated.data() + filePos, fileReadBufferFilledBytes);
+      filePos += fileReadBufferFilledBytes;
+      fileRemainingBytes -= fileReadBufferFilledBytes;
+      fileReadBufferCursor = 0;
+    }
+
+    size_t inBytes = fileReadBufferFilledBytes - fileReadBufferCursor;
+    size_t outBytes = TINFL_LZ_DICT_SIZE - outputCursor;
+    const tinfl_status status =
+        tinfl_decompress(inflator, fileReadBuffer + fileReadBufferCursor, &inBytes, outputBuffer,
+                         outputBuffer + outputCursor, &outBytes, fileRemainingBytes > 0 ? TINFL_FLAG_HAS_MORE_INPUT : 0);
+    fileReadBufferCursor += inBytes;
+
+    if (outBytes > 0) {
+      const size_t chunkStart = processedOutputBytes;
+      processedOutputBytes += outBytes;
+      if (processedOutputBytes > fromOffset) {
+        const size_t skip = chunkStart < fromOffset ? fromOffset - chunkStart : 0;
+        result.output.append(reinterpret_cast<const char*>(outputBuffer + outputCursor + skip), outBytes - skip);
+      }
+      outputCursor = (outputCursor + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+    }
+
+    if (status < 0) break;
+    if (status == TINFL_STATUS_DONE) {
+      result.ok = true;
+      break;
+    }
+
+    if (processedOutputBytes >= (pointCount + 1u) * INTERVAL) {
+      SeekPoint seekPoint;
+      seekPoint.outOffset = processedOutputBytes;
+      seekPoint.inOffset = deflated.size() - fileRemainingBytes - (fileReadBufferFilledBytes - fileReadBufferCursor);
+      seekPoint.dictCursor = outputCursor;
+      seekPoint.state.assign(reinterpret_cast<uint8_t*>(inflator),
+                             reinterpret_cast<uint8_t*>(inflator) + sizeof(tinfl_decompressor));
+      seekPoint.dict.assign(outputBuffer, outputBuffer + TINFL_LZ_DICT_SIZE);
+      index.push_back(std::move(seekPoint));
+      pointCount++;
+    }
+  }
+
+  result.inflatedBytes = processedOutputBytes - startOutput;
+  free(outputBuffer);
+  free(inflator);
+  return result;
+}
+
+// Chapter-like text with enough repetition for long back-references across snapshot boundaries
+std::string makeChapter(size_t size) {
+  std::string text;
+  uint32_t seed = 12345;
+  const char* words[] = {"the",  "reader", "turned", "page", "<p>",    "</p>",  "lantern", "quietly",
+                         "ink",  "paper",  "river",  "and",  "<em>",   "</em>", "winter",  "glass"};
+  while (text.size() < size) {
+    seed = seed * 1103515245 + 12345;
+    text += words[(seed >> 16) % 16];
+    text += (seed >> 8) % 13 == 0 ? "\n" : " ";
+  }
+  text.resize(size);
+  return text;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("ZipFile Seek Index");
+
+  const std::string chapter = makeChapter(2 * 1024 * 1024);
+  size_t deflatedSize = 0;
+  void* deflatedData = tdefl_compress_mem_to_heap(chapter.data(), chapter.size(), &deflatedSize,
+                                                  TDEFL_DEFAULT_MAX_PROBES);
+  runner.expectTrue(deflatedData != nullptr, "Chapter deflates");
+  const std::vector<uint8_t> deflated(static_cast<uint8_t*>(deflatedData),
+                                      static_cast<uint8_t*>(deflatedData) + deflatedSize);
+  free(deflatedData);
+
+  // Test 1: full inflate builds the index and reproduces the chapter
+  std::vector<SeekPoint> index;
+  const InflateResult full = inflateFrom(deflated, 0, index);
+  runner.expectTrue(full.ok, "Full inflate completes");
+  runner.expectTrue(full.output == chapter, "Full inflate matches the original");
+  runner.expectEq(static_cast<size_t>(7), index.size(), "One snapshot per 256KB of output before the end");
+  bool spaced = true;
+  for (size_t i = 0; i < index.size(); i++) {
+    if (index[i].outOffset < (i + 1) * INTERVAL || index[i].outOffset >= (i + 1) * INTERVAL + TINFL_LZ_DICT_SIZE) {
+      spaced = false;
+    }
+  }
+  runner.expectTrue(spaced, "Snapshots taken within one window of each interval");
+
+  // Test 2: restarting from snapshots reproduces every suffix and skips the prefix
+  const uint32_t offsets[] = {1, 100000, INTERVAL, INTERVAL + 7, 1000003, 1500000, 2 * 1024 * 1024 - 10,
+                              2 * 1024 * 1024};
+  std::cout << "\n    Offset       Inflated (no index)   Inflated (seek index)\n";
+  for (const uint32_t offset : offsets) {
+    std::vector<SeekPoint> none;
+    const InflateResult cold = inflateFrom(deflated, offset, none);
+    std::vector<SeekPoint> indexCopy = index;
+    const InflateResult warm = inflateFrom(deflated, offset, indexCopy);
+    printf("    %-12u %-21zu %zu\n", offset, cold.inflatedBytes, warm.inflatedBytes);
+
+    const std::string label = " at " + std::to_string(offset);
+    runner.expectTrue(warm.ok && warm.output == chapter.substr(offset), "Seek index output matches" + label);
+    runner.expectTrue(cold.output == warm.output, "Cold and seek-indexed output agree" + label);
+    runner.expectTrue(warm.inflatedBytes <= chapter.size() - offset + INTERVAL + TINFL_LZ_DICT_SIZE,
+                      "Seek index bounds wasted inflation" + label);
+  }
+  std::cout << "\n";
+
+  // Test 3: a partial index is extended from its last snapshot
+  {
+    std::vector<SeekPoint> partial(index.begin(), index.begin() + 2);
+    const InflateResult result = inflateFrom(deflated, 1900000, partial);
+    runner.expectTrue(result.ok && result.output == chapter.substr(1900000), "Output correct from partial index");
+    runner.expectEq(index.size(), partial.size(), "Partial index extended to full length");
+    bool same = true;
+    for (size_t i = 0; i < index.size(); i++) {
+      if (partial[i].outOffset != index[i].outOffset || partial[i].inOffset != index[i].inOffset) same = false;
+    }
+    runner.expectTrue(same, "Extended snapshots match a fresh build");
+  }
+
+  // Test 4: data shorter than an interval produces no snapshots
+  {
+    const std::string small = makeChapter(100000);
+    size_t smallSize = 0;
+    void* smallData = tdefl_compress_mem_to_heap(small.data(), small.size(), &smallSize, TDEFL_DEFAULT_MAX_PROBES);
+    const std::vector<uint8_t> smallDeflated(static_cast<uint8_t*>(smallData),
+                                             static_cast<uint8_t*>(smallData) + smallSize);
+    free(smallData);
+    std::vector<SeekPoint> smallIndex;
+    const InflateResult result = inflateFrom(smallDeflated, 5000, smallIndex);
+    runner.expectTrue(result.ok && result.output == small.substr(5000), "Small entry streams from offset");
+    runner.expectTrue(smallIndex.empty(), "No snapshots below one interval");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}